@@ -0,0 +1,104 @@
+#!/bin/bash
+#
+# ATE switch provisioning against the local fake switch (bench/fake_cumulus.sh),
+# no switch, NIC or DPDK needed. Scenarios:
+#
+#   legacy         old path on an empty switch (one ssh session per command)
+#   batched-cold   one ControlMaster + one transaction, empty switch
+#   batched-warm   same again, nothing changed (query only)
+#   batched-1port  one port's VLAN missing from the applied state
+#   fallback-cold  ControlMaster refused: parallel per-group sessions
+#
+# After every scenario the fake switch's bridge VLANs and interfaces file are
+# checked against the ATE table. Timing is dominated by the emulated
+# connection cost (FAKE_CUMULUS_CONNECT_MS, default 250 ms per handshake).
+#
+# Usage: bench/ate_provision_ab.sh [-c CONNECT_MS] [-r RELOAD_MS]
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+export FAKE_CUMULUS_ROOT=${FAKE_CUMULUS_ROOT:-/tmp/fake_cumulus}
+export FAKE_CUMULUS_CONNECT_MS=${FAKE_CUMULUS_CONNECT_MS:-250}
+export FAKE_CUMULUS_RELOAD_MS=${FAKE_CUMULUS_RELOAD_MS:-1000}
+
+usage() {
+    sed -n '3,17p' "$0" | sed 's/^# \{0,1\}//'
+    exit 2
+}
+
+while getopts "c:r:h" opt; do
+    case $opt in
+        c) FAKE_CUMULUS_CONNECT_MS=$OPTARG ;;
+        r) FAKE_CUMULUS_RELOAD_MS=$OPTARG ;;
+        *) usage ;;
+    esac
+done
+
+ROOT=$FAKE_CUMULUS_ROOT
+BIN=./dpdk_app-ate-bench
+IFACES=$PWD/ate_cumulus/interfaces
+
+cc -O2 -std=gnu11 -Wall -Wextra -Iinclude -DATE_INTERFACES_LOCAL_PATH="\"$IFACES\"" \
+   bench/ate_provision_bench.c src/ate_cumulus_config.c -o "$BIN" -lpthread
+
+export ATE_CUMULUS_SSH="$PWD/bench/fake_cumulus.sh ssh"
+export ATE_CUMULUS_SCP="$PWD/bench/fake_cumulus.sh scp"
+
+# Expected "iface vlan" lines, from the ATE table in ate_cumulus_config.c
+expected=$(grep -o '{ "[a-z0-9/]*", "swp[0-9s]*", [0-9]* }' src/ate_cumulus_config.c |
+           awk -F'"' '{ gsub(/[ ,}]/, "", $5); print $4, $5 }' | sort)
+
+reset_switch() {
+    rm -rf "$ROOT"
+    rm -f /tmp/ate_cumulus_%r@%h:%p
+}
+
+check_switch() {
+    if [ "$(sort "$ROOT/bridge_vlans")" = "$expected" ] &&
+       cmp -s "$IFACES" "$ROOT/etc/network/interfaces"; then
+        echo ok
+    else
+        echo MISMATCH
+    fi
+}
+
+results=()
+run() {
+    local name=$1
+    shift
+    mkdir -p "$ROOT"
+    : > "$ROOT/sessions.log"
+    local line
+    line=$("$BIN" "$@" | grep '^ATE-PROVISION-RESULT' || true)
+    local sessions
+    sessions=$(wc -l < "$ROOT/sessions.log")
+    local total changed
+    total=$(echo "$line" | grep -o 'total_ms=[0-9.]*' | cut -d= -f2)
+    changed=$(echo "$line" | grep -o 'ports_changed=[0-9]*' | cut -d= -f2 || true)
+    results+=("$name,${total:-fail},$sessions,${changed:-32},$(check_switch)")
+    echo "  $name: ${line#ATE-PROVISION-RESULT }"
+}
+
+reset_switch
+run legacy --legacy
+
+reset_switch
+run batched-cold
+run batched-warm
+
+# Drop one port from the applied state and from the bridge
+sed -i 's/ swp27s2=107//' "$ROOT/run/ate_cumulus.applied"
+sed -i '/^swp27s2 107$/d' "$ROOT/bridge_vlans"
+run batched-1port
+
+reset_switch
+FAKE_CUMULUS_NO_MUX=1 run fallback-cold
+
+rm -f "$BIN"
+
+echo
+{
+    echo "scenario,total_ms,ssh_scp_calls,ports_sent,switch_state"
+    printf '%s\n' "${results[@]}"
+} | awk -F, '{ printf "  %-16s %10s %14s %11s %13s\n", $1, $2, $3, $4, $5 }'
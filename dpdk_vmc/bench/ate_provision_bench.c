@@ -0,0 +1,62 @@
+/**
+ * ATE switch provisioning timing
+ *
+ * Standalone binary (bench/ate_provision_ab.sh): links only
+ * ate_cumulus_config.c, no DPDK. Runs one provisioning pass against
+ * whatever ATE_CUMULUS_SSH / ATE_CUMULUS_SCP point at (normally
+ * bench/fake_cumulus.sh) and prints one ATE-PROVISION-RESULT line.
+ *
+ * Usage: dpdk_app-ate-bench [--legacy] [--force]
+ *
+ *   --legacy  old path: deploy interfaces + one ssh session per command
+ *   --force   batched path, ignore the switch's applied state
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "ate_cumulus_config.h"
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+int main(int argc, char *argv[])
+{
+    bool legacy = false;
+    bool force = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--legacy") == 0) {
+            legacy = true;
+        } else if (strcmp(argv[i], "--force") == 0) {
+            force = true;
+        } else {
+            fprintf(stderr, "Usage: %s [--legacy] [--force]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (legacy) {
+        double t0 = now_ms();
+        bool ok = ate_cumulus_deploy_interfaces() && ate_cumulus_configure_sequence();
+        printf("ATE-PROVISION-RESULT mode=legacy ok=%d total_ms=%.1f\n", ok, now_ms() - t0);
+        return ok ? 0 : 1;
+    }
+
+    struct ate_provision_report r;
+    int ret = ate_cumulus_provision(ATE_INTERFACES_LOCAL_PATH, force, &r);
+
+    printf("ATE-PROVISION-RESULT mode=batched ok=%d total_ms=%.1f connect_ms=%.1f "
+           "query_ms=%.1f render_ms=%.1f apply_ms=%.1f close_ms=%.1f ports_changed=%d "
+           "interfaces_changed=%d multiplexed=%d fallback=%d\n",
+           ret == 0, r.total_ms, r.phase_ms[ATE_PHASE_CONNECT], r.phase_ms[ATE_PHASE_QUERY],
+           r.phase_ms[ATE_PHASE_RENDER], r.phase_ms[ATE_PHASE_APPLY], r.phase_ms[ATE_PHASE_CLOSE],
+           r.ports_changed, r.interfaces_changed, r.multiplexed, r.fallback);
+    return ret == 0 ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""
+Compare two bench_hotpath JSON results and flag regressions.
+
+Usage: bench_compare.py BASELINE.json CURRENT.json [--threshold PCT] [--cold-threshold PCT]
+
+Entries are matched by (name, variant, frame). An entry regresses when its
+ns/op grows by more than the threshold (cold variants are noisier and get
+their own threshold). Exit status: 0 = no regression, 1 = regression,
+2 = usage / input error.
+"""
+
+import argparse
+import json
+import sys
+
+SCHEMA_VERSION = 1
+
+
+def load(path):
+    try:
+        with open(path) as f:
+            data = json.load(f)
+    except (OSError, ValueError) as e:
+        sys.exit(f"bench_compare: cannot read {path}: {e}")
+
+    if data.get("schema") != SCHEMA_VERSION:
+        sys.exit(f"bench_compare: {path}: schema {data.get('schema')} != {SCHEMA_VERSION}")
+
+    entries = {}
+    for r in data["results"]:
+        entries[(r["name"], r["variant"], r["frame"])] = r
+    return data, entries
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Flag hot-path benchmark regressions")
+    ap.add_argument("baseline")
+    ap.add_argument("current")
+    ap.add_argument("--threshold", type=float, default=10.0,
+                    help="allowed ns/op increase for warm entries, percent (default 10)")
+    ap.add_argument("--cold-threshold", type=float, default=20.0,
+                    help="allowed ns/op increase for cold entries, percent (default 20)")
+    args = ap.parse_args()
+
+    base, base_entries = load(args.baseline)
+    cur, cur_entries = load(args.current)
+
+    if abs(base["tsc_hz"] - cur["tsc_hz"]) > 0.02 * base["tsc_hz"]:
+        print(f"WARNING: TSC differs ({base['tsc_hz'] / 1e9:.3f} vs {cur['tsc_hz'] / 1e9:.3f} GHz),"
+              " results are from different machines or frequency settings")
+    if base.get("vlan") != cur.get("vlan"):
+        print("WARNING: VLAN build setting differs between baseline and current")
+
+    print(f"{'primitive':<22} {'mode':<4} {'frame':>5} {'base ns':>10} {'cur ns':>10} {'delta':>8}")
+
+    regressions = 0
+    improvements = 0
+    for key in sorted(cur_entries, key=lambda k: (k[0], k[2], k[1])):
+        c = cur_entries[key]
+        b = base_entries.get(key)
+        name, variant, frame = key
+        if b is None:
+            print(f"{name:<22} {variant:<4} {frame:>5} {'-':>10} {c['ns_per_op']:>10.2f}      new")
+            continue
+
+        delta = (c["ns_per_op"] - b["ns_per_op"]) / b["ns_per_op"] * 100.0
+        limit = args.cold_threshold if variant == "cold" else args.threshold
+        mark = ""
+        if delta > limit:
+            mark = "  REGRESSION"
+            regressions += 1
+        elif delta < -limit:
+            mark = "  improved"
+            improvements += 1
+
+        print(f"{name:<22} {variant:<4} {frame:>5} {b['ns_per_op']:>10.2f} "
+              f"{c['ns_per_op']:>10.2f} {delta:>+7.1f}%{mark}")
+
+    missing = sorted(set(base_entries) - set(cur_entries))
+    for name, variant, frame in missing:
+        print(f"{name:<22} {variant:<4} {frame:>5}  missing in current run")
+
+    print(f"\n{regressions} regression(s), {improvements} improvement(s), "
+          f"threshold warm {args.threshold:.0f}% / cold {args.cold_threshold:.0f}%")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
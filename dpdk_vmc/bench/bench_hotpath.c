@@ -0,0 +1,573 @@
+/**
+ * Hot-path microbenchmarks
+ *
+ * Standalone binary (make bench): links packet_manager.c and the shared
+ * inline primitives (payload_transform.h, vl_range.h), but never calls
+ * rte_eal_init, so no NIC, no hugepages and no root are needed. Mbufs are
+ * plain structs pointing into a malloc'd frame pool.
+ *
+ * Variants:
+ *   warm - same frame / same PRBS offset every op (L1 resident)
+ *   cold - frames walked over a pool larger than LLC with a non-unit
+ *          stride, random sequence numbers (PRBS offsets over the full
+ *          ~268 MB cache, same as the RX/TX workers see)
+ *
+ * Every case is run BENCH_REPS times after one warm-up rep; the median
+ * cycles/op is reported. TSC frequency is calibrated against
+ * CLOCK_MONOTONIC_RAW (rte_get_tsc_hz needs EAL).
+ *
+ * Built with CAPTURE=1 the RX capture ring record (armed, never triggered)
+ * is measured as well (capture_record).
+ *
+ * Usage: dpdk_app-bench [--json FILE] [--lcore N] [--filter NAME] [--cold-mb MB]
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <sched.h>
+#include <getopt.h>
+#include <rte_cycles.h>
+#include <rte_mbuf.h>
+
+#include "config.h"
+#include "packet.h"
+#include "payload_transform.h"
+#include "vl_range.h"
+#include "capture_ring.h"
+
+// ==========================================
+// CONFIGURATION
+// ==========================================
+#define BENCH_SCHEMA_VERSION 1
+#define BENCH_REPS 7                         // Timed repetitions (median reported)
+#define BENCH_MIN_REP_MS 10                  // Minimum duration of one repetition
+#define BENCH_FRAME_STRIDE 2048              // Frame slot size in the pool
+#define BENCH_COLD_POOL_MB 64                // Default cold pool (> LLC)
+#define BENCH_COLD_STEP 7919                 // Odd stride: full cycle over 2^n frames
+#define BENCH_MAX_RESULTS 128
+#define BENCH_CAPTURE_BURST 32               // rx_burst size seen by capture_record
+
+// vl_range.h needs the VLAN table; tx_rx_manager.c is not linked
+struct port_vlan_config port_vlans[MAX_PORTS_CONFIG] = PORT_VLAN_CONFIG_INIT;
+
+static const uint16_t bench_frame_sizes[] = {
+    IMIX_SIZE_1, IMIX_SIZE_2, IMIX_SIZE_3, IMIX_SIZE_4, IMIX_SIZE_5, IMIX_SIZE_6
+};
+#define BENCH_FRAME_COUNT (sizeof(bench_frame_sizes) / sizeof(bench_frame_sizes[0]))
+
+#define BENCH_PAYLOAD_OFF (L2_HEADER_SIZE + IP_HDR_SIZE + UDP_HDR_SIZE)
+
+// ==========================================
+// STATE
+// ==========================================
+
+struct bench_ctx {
+    uint8_t *pool;                 // Frame pool (pool_frames * BENCH_FRAME_STRIDE)
+    struct rte_mbuf *mbufs;        // One fake mbuf per frame slot
+    uint64_t *seqs;                // Sequence stored in each frame
+    uint32_t pool_frames;          // Power of 2
+    uint32_t mask;                 // pool_frames - 1 (0 for warm)
+    uint16_t frame;                // Frame size under test
+    struct packet_config cfg;
+};
+
+typedef uint64_t (*bench_fn_t)(struct bench_ctx *ctx, uint32_t iters);
+
+struct bench_case {
+    const char *name;
+    bench_fn_t fn;
+    bool per_frame;                // Run for every frame size
+    bool has_cold;                 // Cold variant meaningful
+    uint32_t (*bytes)(uint16_t frame);
+};
+
+struct bench_result {
+    const char *name;
+    const char *variant;
+    uint16_t frame;
+    uint32_t bytes;
+    uint64_t iters;
+    double cycles_per_op;
+    double ns_per_op;
+    double bytes_per_cycle;
+};
+
+static double tsc_hz;
+static volatile uint64_t bench_sink;   // Defeats dead-code elimination
+
+static struct bench_result results[BENCH_MAX_RESULTS];
+static int result_count;
+
+// ==========================================
+// HELPERS
+// ==========================================
+
+static uint64_t mono_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static double calibrate_tsc_hz(void)
+{
+    uint64_t t0 = mono_ns();
+    uint64_t c0 = rte_rdtsc_precise();
+    while (mono_ns() - t0 < 100000000ULL)
+        ;
+    uint64_t c1 = rte_rdtsc_precise();
+    uint64_t t1 = mono_ns();
+    return (double)(c1 - c0) * 1e9 / (double)(t1 - t0);
+}
+
+static inline uint32_t next_slot(const struct bench_ctx *ctx, uint32_t slot)
+{
+    return (slot + BENCH_COLD_STEP) & ctx->mask;
+}
+
+static inline uint8_t *slot_frame(const struct bench_ctx *ctx, uint32_t slot)
+{
+    return ctx->pool + (size_t)slot * BENCH_FRAME_STRIDE;
+}
+
+static inline uint16_t bench_prbs_len(uint16_t frame)
+{
+    uint16_t len = calc_prbs_size(frame);
+    return len > MAX_PRBS_BYTES ? MAX_PRBS_BYTES : len;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// ==========================================
+// BENCHMARKED PRIMITIVES
+// ==========================================
+
+static uint64_t run_build_packet(struct bench_ctx *ctx, uint32_t iters)
+{
+    uint64_t acc = 0;
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < iters; i++) {
+        struct packet_template *t = (struct packet_template *)slot_frame(ctx, slot);
+        ctx->cfg.vl_id = (uint16_t)i;
+        build_packet(t, &ctx->cfg);
+        acc += t->ip.hdr_checksum;
+        slot = next_slot(ctx, slot);
+    }
+    return acc;
+}
+
+static uint64_t run_ip_checksum(struct bench_ctx *ctx, uint32_t iters)
+{
+    uint64_t acc = 0;
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < iters; i++) {
+        struct rte_ipv4_hdr *ip = (struct rte_ipv4_hdr *)(slot_frame(ctx, slot) + L2_HEADER_SIZE);
+        ip->packet_id = (uint16_t)i;
+        acc += calculate_ip_checksum(ip);
+        slot = next_slot(ctx, slot);
+    }
+    return acc;
+}
+
+static uint64_t run_prbs_fill(struct bench_ctx *ctx, uint32_t iters)
+{
+    const uint16_t prbs_len = bench_prbs_len(ctx->frame);
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < iters; i++) {
+        fill_payload_with_prbs31_dynamic(&ctx->mbufs[slot], 0, ctx->seqs[slot],
+                                         L2_HEADER_SIZE, prbs_len);
+        slot = next_slot(ctx, slot);
+    }
+    return slot;
+}
+
+static uint64_t run_splitmix_transform(struct bench_ctx *ctx, uint32_t iters)
+{
+    uint64_t acc = 0;
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < iters; i++) {
+        splitmix64_transform(&ctx->mbufs[slot]);
+        acc += slot_frame(ctx, slot)[BENCH_PAYLOAD_OFF + SEQ_BYTES + SPLITMIX_XOR_BYTES];
+        slot = next_slot(ctx, slot);
+    }
+    return acc;
+}
+
+static uint64_t run_crc32c(struct bench_ctx *ctx, uint32_t iters)
+{
+    const uint32_t len = calc_payload_size(ctx->frame);
+    uint64_t acc = 0;
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < iters; i++) {
+        acc += hw_crc32c(slot_frame(ctx, slot) + BENCH_PAYLOAD_OFF, len);
+        slot = next_slot(ctx, slot);
+    }
+    return acc;
+}
+
+// RX good path: sequence from frame -> PRBS offset -> memcmp
+static uint64_t run_prbs_verify(struct bench_ctx *ctx, uint32_t iters)
+{
+    const uint16_t prbs_len = bench_prbs_len(ctx->frame);
+    const uint8_t *cache = port_prbs_cache[0].cache_ext;
+    uint64_t good = 0;
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < iters; i++) {
+        const uint8_t *payload = slot_frame(ctx, slot) + BENCH_PAYLOAD_OFF;
+        uint64_t seq = *(const uint64_t *)payload;
+        uint64_t off = (seq * (uint64_t)MAX_PRBS_BYTES) % (uint64_t)PRBS_CACHE_SIZE;
+        good += (memcmp(payload + SEQ_BYTES, cache + off, prbs_len) == 0);
+        slot = next_slot(ctx, slot);
+    }
+    return good;
+}
+
+// RX bad path: full popcount over the PRBS region
+static uint64_t run_prbs_bit_errors(struct bench_ctx *ctx, uint32_t iters)
+{
+    const uint16_t prbs_len = bench_prbs_len(ctx->frame);
+    const uint8_t *cache = port_prbs_cache[0].cache_ext;
+    uint64_t bits = 0;
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < iters; i++) {
+        const uint8_t *payload = slot_frame(ctx, slot) + BENCH_PAYLOAD_OFF;
+        uint64_t seq = *(const uint64_t *)payload ^ 1;   // Off by one: all bits compared
+        uint64_t off = (seq * (uint64_t)MAX_PRBS_BYTES) % (uint64_t)PRBS_CACHE_SIZE;
+        bits += prbs_bit_errors(payload + SEQ_BYTES, cache + off, prbs_len);
+        slot = next_slot(ctx, slot);
+    }
+    return bits;
+}
+
+// RX VL-ID validation: random (port, queue, vl_id) over ports with RX VLANs
+static uint64_t run_vl_range_lookup(struct bench_ctx *ctx, uint32_t iters)
+{
+    (void)ctx;
+    uint16_t ports[MAX_PORTS_CONFIG];
+    uint16_t nb_ports = 0;
+    for (uint16_t p = 0; p < MAX_PORTS_CONFIG; p++) {
+        if (port_vlans[p].rx_vlan_count > 0)
+            ports[nb_ports++] = p;
+    }
+    if (nb_ports == 0)
+        return 0;
+
+    uint64_t hits = 0;
+    uint64_t x = 0x1234;
+    for (uint32_t i = 0; i < iters; i++) {
+        uint64_t r = splitmix64(x++);
+        uint16_t port = ports[r % nb_ports];
+        uint16_t queue = (uint16_t)((r >> 16) % port_vlans[port].rx_vlan_count);
+        uint16_t vl_id = (uint16_t)((r >> 32) % (MAX_VL_ID + 1));
+        hits += is_valid_rx_vl_id_for_queue(vl_id, port, queue);
+    }
+    return hits;
+}
+
+#if CAPTURE_ENABLED
+// Armed capture ring, never triggered: one TSC read per burst + snap copy
+static struct capture_ring bench_capture_ring;
+
+static uint64_t run_capture_record(struct bench_ctx *ctx, uint32_t iters)
+{
+    struct rte_mbuf *burst[BENCH_CAPTURE_BURST];
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < iters; i += BENCH_CAPTURE_BURST) {
+        for (uint16_t j = 0; j < BENCH_CAPTURE_BURST; j++) {
+            burst[j] = &ctx->mbufs[slot];
+            slot = next_slot(ctx, slot);
+        }
+        capture_record_burst(&bench_capture_ring, burst, BENCH_CAPTURE_BURST);
+    }
+    return bench_capture_ring.head;
+}
+
+static uint32_t bytes_capture(uint16_t frame)
+{
+    return frame < CAPTURE_SNAP_LEN ? frame : CAPTURE_SNAP_LEN;
+}
+#endif
+
+static uint32_t bytes_template(uint16_t frame) { (void)frame; return sizeof(struct packet_template); }
+static uint32_t bytes_ip_hdr(uint16_t frame) { (void)frame; return IP_HDR_SIZE; }
+static uint32_t bytes_prbs(uint16_t frame) { return bench_prbs_len(frame); }
+static uint32_t bytes_splitmix(uint16_t frame) { (void)frame; return SPLITMIX_MIN_PAYLOAD; }
+static uint32_t bytes_payload(uint16_t frame) { return calc_payload_size(frame); }
+static uint32_t bytes_none(uint16_t frame) { (void)frame; return 0; }
+
+static const struct bench_case bench_cases[] = {
+    { "build_packet",          run_build_packet,       false, true,  bytes_template },
+    { "calculate_ip_checksum", run_ip_checksum,        false, true,  bytes_ip_hdr },
+    { "prbs31_fill",           run_prbs_fill,          true,  true,  bytes_prbs },
+    { "splitmix64_transform",  run_splitmix_transform, true,  true,  bytes_splitmix },
+    { "crc32c",                run_crc32c,             true,  true,  bytes_payload },
+    { "prbs_verify",           run_prbs_verify,        true,  true,  bytes_prbs },
+    { "prbs_bit_errors",       run_prbs_bit_errors,    true,  true,  bytes_prbs },
+    { "vl_range_lookup",       run_vl_range_lookup,    false, false, bytes_none },
+#if CAPTURE_ENABLED
+    { "capture_record",        run_capture_record,     true,  true,  bytes_capture },
+#endif
+};
+#define BENCH_CASE_COUNT (sizeof(bench_cases) / sizeof(bench_cases[0]))
+
+// ==========================================
+// SETUP
+// ==========================================
+
+/**
+ * PRBS cache for port 0 (malloc, no EAL). Content does not affect timing, so a
+ * splitmix64 fill replaces the minute-long PRBS-31 generation.
+ */
+static int setup_prbs_cache(void)
+{
+    size_t ext_size = (size_t)PRBS_CACHE_SIZE + (size_t)NUM_PRBS_BYTES + 8;
+    uint64_t *ext = malloc(ext_size);
+    if (!ext) {
+        fprintf(stderr, "bench: cannot allocate %zu MB PRBS cache\n", ext_size >> 20);
+        return -1;
+    }
+    for (size_t i = 0; i < ext_size / 8; i++)
+        ext[i] = splitmix64(i);
+
+    port_prbs_cache[0].cache = (uint8_t *)ext;
+    port_prbs_cache[0].cache_ext = (uint8_t *)ext;
+    port_prbs_cache[0].initialized = true;
+    return 0;
+}
+
+#if CAPTURE_ENABLED
+static int setup_capture_ring(void)
+{
+    size_t ring_bytes = (size_t)CAPTURE_RING_SIZE * sizeof(struct capture_slot);
+    bench_capture_ring.slots = aligned_alloc(64, ring_bytes);
+    if (!bench_capture_ring.slots) {
+        fprintf(stderr, "bench: cannot allocate %zu KB capture ring\n", ring_bytes >> 10);
+        return -1;
+    }
+    memset(bench_capture_ring.slots, 0, ring_bytes);
+    bench_capture_ring.state = CAPTURE_ARMED;
+    return 0;
+}
+#endif
+
+/**
+ * Frame pool: headers built, payload = valid seq + PRBS (verify good path)
+ */
+static int setup_pool(struct bench_ctx *ctx, uint32_t cold_mb)
+{
+    uint32_t frames = 1;
+    while ((uint64_t)frames * BENCH_FRAME_STRIDE < (uint64_t)cold_mb << 20)
+        frames <<= 1;
+
+    ctx->pool_frames = frames;
+    ctx->pool = aligned_alloc(64, (size_t)frames * BENCH_FRAME_STRIDE);
+    ctx->mbufs = calloc(frames, sizeof(struct rte_mbuf));
+    ctx->seqs = malloc((size_t)frames * sizeof(uint64_t));
+    if (!ctx->pool || !ctx->mbufs || !ctx->seqs) {
+        fprintf(stderr, "bench: cannot allocate %u frame pool\n", frames);
+        return -1;
+    }
+
+    init_packet_config(&ctx->cfg);
+    for (uint32_t i = 0; i < frames; i++) {
+        uint8_t *frame = slot_frame(ctx, i);
+        struct rte_mbuf *m = &ctx->mbufs[i];
+
+        m->buf_addr = frame;
+        m->data_off = 0;
+        m->buf_len = BENCH_FRAME_STRIDE;
+
+        build_packet((struct packet_template *)frame, &ctx->cfg);
+        ctx->seqs[i] = splitmix64(i) >> 20;
+    }
+    return 0;
+}
+
+static void prepare_frames(struct bench_ctx *ctx, uint16_t frame)
+{
+    ctx->frame = frame;
+    for (uint32_t i = 0; i < ctx->pool_frames; i++) {
+        struct rte_mbuf *m = &ctx->mbufs[i];
+        m->data_len = frame;
+        m->pkt_len = frame;
+        fill_payload_with_prbs31_dynamic(m, 0, ctx->seqs[i], L2_HEADER_SIZE,
+                                         bench_prbs_len(frame));
+    }
+}
+
+// ==========================================
+// RUNNER
+// ==========================================
+
+static void run_case(struct bench_ctx *ctx, const struct bench_case *bc,
+                     bool cold, uint16_t frame)
+{
+    ctx->mask = cold ? ctx->pool_frames - 1 : 0;
+
+    // Size iterations so one repetition lasts at least BENCH_MIN_REP_MS
+    uint32_t iters = 1024;
+    const uint64_t min_cycles = (uint64_t)(tsc_hz * BENCH_MIN_REP_MS / 1000.0);
+    for (;;) {
+        uint64_t c0 = rte_rdtsc_precise();
+        bench_sink += bc->fn(ctx, iters);
+        uint64_t dt = rte_rdtsc_precise() - c0;
+        if (dt >= min_cycles || iters >= (1u << 30))
+            break;
+        iters <<= 1;
+    }
+
+    double cpo[BENCH_REPS];
+    for (int r = 0; r < BENCH_REPS; r++) {
+        uint64_t c0 = rte_rdtsc_precise();
+        bench_sink += bc->fn(ctx, iters);
+        cpo[r] = (double)(rte_rdtsc_precise() - c0) / iters;
+    }
+    qsort(cpo, BENCH_REPS, sizeof(double), cmp_double);
+
+    if (result_count >= BENCH_MAX_RESULTS)
+        return;
+
+    struct bench_result *res = &results[result_count++];
+    res->name = bc->name;
+    res->variant = cold ? "cold" : "warm";
+    res->frame = frame;
+    res->bytes = bc->bytes(frame);
+    res->iters = iters;
+    res->cycles_per_op = cpo[BENCH_REPS / 2];
+    res->ns_per_op = res->cycles_per_op * 1e9 / tsc_hz;
+    res->bytes_per_cycle = res->bytes ? res->bytes / res->cycles_per_op : 0.0;
+
+    printf("%-22s %-4s %5u %6u B %10.2f ns %10.2f cyc %8.3f B/cyc\n",
+           res->name, res->variant, res->frame, res->bytes,
+           res->ns_per_op, res->cycles_per_op, res->bytes_per_cycle);
+    fflush(stdout);
+}
+
+static int write_json(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "bench: cannot open %s\n", path);
+        return -1;
+    }
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"schema\": %d,\n", BENCH_SCHEMA_VERSION);
+    fprintf(f, "  \"tsc_hz\": %.0f,\n", tsc_hz);
+    fprintf(f, "  \"vlan\": %d,\n", VLAN_ENABLED);
+    fprintf(f, "  \"reps\": %d,\n", BENCH_REPS);
+    fprintf(f, "  \"results\": [\n");
+    for (int i = 0; i < result_count; i++) {
+        const struct bench_result *r = &results[i];
+        fprintf(f, "    {\"name\": \"%s\", \"variant\": \"%s\", \"frame\": %u, "
+                   "\"bytes\": %u, \"iters\": %lu, \"ns_per_op\": %.3f, "
+                   "\"cycles_per_op\": %.3f, \"bytes_per_cycle\": %.4f}%s\n",
+                r->name, r->variant, r->frame, r->bytes, (unsigned long)r->iters,
+                r->ns_per_op, r->cycles_per_op, r->bytes_per_cycle,
+                (i + 1 < result_count) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [--json FILE] [--lcore N] [--filter NAME] [--cold-mb MB]\n", prog);
+    printf("  --json FILE   Write results as JSON (input of bench_compare.py)\n");
+    printf("  --lcore N     Pin to CPU N (recommended: isolated core)\n");
+    printf("  --filter NAME Run only cases whose name contains NAME\n");
+    printf("  --cold-mb MB  Cold working set (default %d, keep > LLC)\n", BENCH_COLD_POOL_MB);
+}
+
+int main(int argc, char **argv)
+{
+    const char *json_path = NULL;
+    const char *filter = NULL;
+    uint32_t cold_mb = BENCH_COLD_POOL_MB;
+    int lcore = -1;
+
+    static const struct option opts[] = {
+        { "json",    required_argument, NULL, 'j' },
+        { "lcore",   required_argument, NULL, 'l' },
+        { "filter",  required_argument, NULL, 'f' },
+        { "cold-mb", required_argument, NULL, 'c' },
+        { "help",    no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "j:l:f:c:h", opts, NULL)) != -1) {
+        switch (opt) {
+        case 'j': json_path = optarg; break;
+        case 'l': lcore = atoi(optarg); break;
+        case 'f': filter = optarg; break;
+        case 'c': cold_mb = (uint32_t)atoi(optarg); break;
+        default:  usage(argv[0]); return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    if (lcore >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(lcore, &set);
+        if (sched_setaffinity(0, sizeof(set), &set) != 0)
+            fprintf(stderr, "bench: cannot pin to CPU %d, continuing unpinned\n", lcore);
+    }
+
+    tsc_hz = calibrate_tsc_hz();
+    printf("=== Hot-path microbenchmarks ===\n");
+    printf("TSC: %.3f GHz, VLAN: %d, cold pool: %u MB, reps: %d (median)\n\n",
+           tsc_hz / 1e9, VLAN_ENABLED, cold_mb, BENCH_REPS);
+
+    struct bench_ctx ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    if (setup_prbs_cache() < 0 || setup_pool(&ctx, cold_mb) < 0)
+        return 1;
+#if CAPTURE_ENABLED
+    if (setup_capture_ring() < 0)
+        return 1;
+#endif
+
+    printf("%-22s %-4s %5s %8s %13s %14s %13s\n",
+           "primitive", "mode", "frame", "bytes", "ns/op", "cycles/op", "bytes/cycle");
+
+    for (uint32_t fi = 0; fi < BENCH_FRAME_COUNT; fi++) {
+        uint16_t frame = bench_frame_sizes[fi];
+
+        for (uint32_t ci = 0; ci < BENCH_CASE_COUNT; ci++) {
+            const struct bench_case *bc = &bench_cases[ci];
+            if (filter && !strstr(bc->name, filter))
+                continue;
+            // Fixed-size cases run once, with the largest frame
+            if (!bc->per_frame && fi != BENCH_FRAME_COUNT - 1)
+                continue;
+            // splitmix64_transform skips frames below its minimum payload
+            if (bc->fn == run_splitmix_transform &&
+                frame < BENCH_PAYLOAD_OFF + SPLITMIX_MIN_PAYLOAD)
+                continue;
+
+            // Fresh frames per case (transform/checksum cases modify them)
+            prepare_frames(&ctx, frame);
+            run_case(&ctx, bc, false, frame);
+            if (bc->has_cold)
+                run_case(&ctx, bc, true, frame);
+        }
+    }
+
+    if (json_path) {
+        if (write_json(json_path) < 0)
+            return 1;
+        printf("\nResults: %s (%d entries)\n", json_path, result_count);
+    }
+    return 0;
+}
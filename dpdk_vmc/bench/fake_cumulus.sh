@@ -0,0 +1,133 @@
+#!/bin/bash
+#
+# Local stand-in for the ATE Cumulus switch, used in place of ssh / scp:
+#
+#   ATE_CUMULUS_SSH="bench/fake_cumulus.sh ssh"
+#   ATE_CUMULUS_SCP="bench/fake_cumulus.sh scp"
+#
+# Remote commands run locally with /etc/network/, /tmp/ and /run/ mapped
+# under $FAKE_CUMULUS_ROOT, and with shims for sudo, bridge and ifreload:
+#   bridge vlan add dev X vid V untagged   adds "X V" to $ROOT/bridge_vlans
+#   ifreload -a                            clears $ROOT/bridge_vlans
+# Every new connection costs FAKE_CUMULUS_CONNECT_MS (ssh handshake + auth),
+# a session on an open ControlMaster FAKE_CUMULUS_MUX_MS. With
+# FAKE_CUMULUS_NO_MUX=1 ControlMaster is refused (fallback path).
+# Every invocation is appended to $ROOT/sessions.log.
+
+set -uo pipefail
+
+ROOT=${FAKE_CUMULUS_ROOT:-/tmp/fake_cumulus}
+CONNECT_MS=${FAKE_CUMULUS_CONNECT_MS:-250}
+MUX_MS=${FAKE_CUMULUS_MUX_MS:-5}
+RELOAD_MS=${FAKE_CUMULUS_RELOAD_MS:-1000}
+SELF=$(readlink -f "$0")
+
+ms_sleep() {
+    sleep "$(awk -v ms="$1" 'BEGIN { printf "%.3f", ms / 1000 }')"
+}
+
+rewrite() {
+    # /tmp/ first: $ROOT itself may be under /tmp. Here-document bodies
+    # (file contents) are left as they are.
+    sed -e "/<<'[A-Z_]*EOF'\$/,/^[A-Z_]*EOF\$/{ /<<'/b map; /^[A-Z_]*EOF\$/b map; b }" \
+        -e ":map" \
+        -e "s#\(^\|[ '\"=>]\)/tmp/#\1$ROOT/tmp/#g" \
+        -e "s#/etc/network/#$ROOT/etc/network/#g" \
+        -e "s#/run/#$ROOT/run/#g"
+}
+
+setup() {
+    mkdir -p "$ROOT/bin" "$ROOT/etc/network" "$ROOT/tmp" "$ROOT/run"
+    touch "$ROOT/bridge_vlans"
+    [ -x "$ROOT/bin/sudo" ] && return
+
+    cat > "$ROOT/bin/sudo" << EOF
+#!/bin/bash
+# -S: password on stdin (first line)
+if [ "\$1" = "-S" ]; then shift; read -r _pw; fi
+if [ "\$1" = "sh" ] && [ -f "\${2:-}" ]; then
+    exec bash <("$SELF" rewrite < "\$2")
+fi
+exec "\$@"
+EOF
+    cat > "$ROOT/bin/bridge" << EOF
+#!/bin/bash
+# bridge vlan add dev X vid V untagged
+[ "\$1 \$2" = "vlan add" ] || exit 1
+line="\$4 \$6"
+grep -qxF "\$line" "$ROOT/bridge_vlans" || echo "\$line" >> "$ROOT/bridge_vlans"
+EOF
+    cat > "$ROOT/bin/ifreload" << EOF
+#!/bin/bash
+: > "$ROOT/bridge_vlans"
+sleep $(awk -v ms="$RELOAD_MS" 'BEGIN { printf "%.3f", ms / 1000 }')
+EOF
+    chmod +x "$ROOT/bin/sudo" "$ROOT/bin/bridge" "$ROOT/bin/ifreload"
+}
+
+# Connection cost: multiplexed if the ControlPath master exists
+connect() {
+    local path=$1
+    if [ -n "$path" ] && [ -e "$path" ]; then
+        ms_sleep "$MUX_MS"
+    else
+        ms_sleep "$CONNECT_MS"
+    fi
+}
+
+tool=${1:-}
+shift
+if [ "$tool" = "rewrite" ]; then
+    rewrite
+    exit 0
+fi
+setup
+echo "$tool $*" >> "$ROOT/sessions.log"
+
+master=0
+exit_master=0
+control_path=""
+args=()
+while [ $# -gt 0 ]; do
+    case $1 in
+        -o)
+            case $2 in
+                ControlMaster=yes) master=1 ;;
+                ControlPath=*) control_path=${2#ControlPath=} ;;
+            esac
+            shift 2 ;;
+        -O) [ "$2" = "exit" ] && exit_master=1; shift 2 ;;
+        -N | -f) shift ;;
+        *) args+=("$1"); shift ;;
+    esac
+done
+
+if [ "$tool" = "ssh" ]; then
+    if [ "$master" = 1 ]; then
+        [ "${FAKE_CUMULUS_NO_MUX:-0}" = 1 ] && exit 255
+        ms_sleep "$CONNECT_MS"
+        touch "$control_path"
+        exit 0
+    fi
+    if [ "$exit_master" = 1 ]; then
+        rm -f "$control_path"
+        exit 0
+    fi
+
+    connect "$control_path"
+    # args: user@host command
+    cmd=$(printf '%s' "${args[1]:-true}" | rewrite)
+    PATH="$ROOT/bin:$PATH" exec bash -c "$cmd"
+fi
+
+if [ "$tool" = "scp" ]; then
+    connect "$control_path"
+    n=${#args[@]}
+    dest=${args[$((n - 1))]#*:}
+    dest=$(printf '%s' "$dest" | rewrite)
+    cp "${args[@]:0:$((n - 1))}" "$dest"
+    exit $?
+fi
+
+echo "usage: $0 ssh|scp [options] ..." >&2
+exit 2
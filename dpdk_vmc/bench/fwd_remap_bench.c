@@ -0,0 +1,403 @@
+/**
+ * Forward remap benchmark
+ *
+ * Standalone binary (make fwd-remap-bench): forward_worker's per-burst
+ * work over fake mbufs, no EAL, no NIC (same setup as rx_pipeline_bench.c).
+ * Both loops run on the same bursts:
+ *
+ *   scan  - process_packet per packet (FWD_REMAP_TABLE=0): R1 / R2 range
+ *           scan of the port's queues, byte-wise VLAN / VL-ID rewrite + checksum
+ *   table - fwd_remap.h: VL-ID table lookup for the burst, then the
+ *           rewrites with the precomputed IPv4 checksum delta
+ *
+ * each alone (remap) and followed by splitmix64_transform as in
+ * forward_worker (fwd, reported as single-core Mpps).
+ *
+ * Correctness first: fwd_remap_check compares the table with
+ * process_packet for every VL-ID 0..MAX_VL_ID on every forwarder port.
+ * The timed passes must then give the same frames (valid IPv4 checksum
+ * on both sides) and TX ports (ok=1).
+ *
+ * Traffic: --vls VL-IDs spread over the first forwarder port's R1 / R2
+ * ranges (remapped, cross-port and kept ones), interleaved, VMC_1 headers.
+ * Frames come from a pool larger than LLC; headers are restored between
+ * passes (untimed), so every pass remaps the same input.
+ *
+ * Usage: dpdk_app-fwd-bench [--lcore N] [--vls N] [--pool-mb MB] [--frames LIST] [--ate]
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <sched.h>
+#include <getopt.h>
+#include <rte_cycles.h>
+#include <rte_mbuf.h>
+
+#include "config.h"
+#include "packet.h"
+#include "payload_transform.h"
+#include "fwd_remap.h"
+
+// ==========================================
+// CONFIGURATION
+// ==========================================
+#define BENCH_REPS 5                  // Timed passes over the pool (median reported)
+#define BENCH_FRAME_STRIDE 2048       // Frame slot size in the pool
+#define BENCH_POOL_MB 64              // Default pool (> LLC)
+#define BENCH_VLS 64                  // Default interleaved VL-IDs
+#define BENCH_MAX_VLS 4096
+#define BENCH_MAX_FRAMES 8
+
+// process_packet / fwd_remap_build read the forwarder tables;
+// tx_rx_manager.c is not linked
+struct port_vlan_config port_vlans[MAX_PORTS_CONFIG] = FWD_PORT_VLAN_CONFIG_INIT;
+static const struct port_vlan_config fwd_ate_port_vlans[MAX_PORTS_CONFIG] = FWD_ATE_PORT_VLAN_CONFIG_INIT;
+
+static struct fwd_remap_table tables[MAX_PORTS_CONFIG];
+
+static uint8_t *pool;
+static uint8_t *headers;          // Input headers, restored before every pass
+static uint8_t *ref_out;          // scan output headers
+static uint16_t *ref_ports;
+static uint16_t *ports_out;
+static struct rte_mbuf *mbufs;
+static struct rte_mbuf **trace;
+static uint32_t pool_frames;
+
+static uint16_t rx_port;
+static uint16_t vls[BENCH_MAX_VLS];
+static uint16_t nb_vls = BENCH_VLS;
+static double tsc_hz;
+
+// ==========================================
+// HELPERS
+// ==========================================
+
+static uint64_t mono_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static double calibrate_tsc_hz(void)
+{
+    uint64_t t0 = mono_ns();
+    uint64_t c0 = rte_rdtsc_precise();
+    while (mono_ns() - t0 < 100000000ULL)
+        ;
+    uint64_t c1 = rte_rdtsc_precise();
+    uint64_t t1 = mono_ns();
+    return (double)(c1 - c0) * 1e9 / (double)(t1 - t0);
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// ==========================================
+// LOOPS UNDER TEST
+// ==========================================
+
+// forward_worker before the table: remap and transform per packet
+static void scan_burst(struct rte_mbuf **pkts, uint16_t nb_rx, uint16_t *targets, bool transform)
+{
+    for (uint16_t i = 0; i < nb_rx; i++) {
+        targets[i] = process_packet(pkts[i], rx_port);
+        if (transform)
+            splitmix64_transform(pkts[i]);
+    }
+}
+
+// forward_worker with the table (FWD_REMAP_TABLE=1)
+static void table_burst(struct rte_mbuf **pkts, uint16_t nb_rx, uint16_t *targets, bool transform)
+{
+    fwd_remap_burst(&tables[rx_port], pkts, nb_rx, rx_port, targets);
+    if (transform)
+        for (uint16_t i = 0; i < nb_rx; i++)
+            splitmix64_transform(pkts[i]);
+}
+
+// ==========================================
+// SETUP
+// ==========================================
+
+/**
+ * Table of every forwarder port, checked against process_packet for every
+ * VL-ID. Bench port: first one with TX queues, nb_vls of its range VL-IDs.
+ */
+static bool setup_tables(void)
+{
+    bool ok = true;
+
+    rx_port = MAX_PORTS_CONFIG;
+    printf("%4s %8s %8s %8s %8s %10s\n", "port", "ranges", "remap", "cross", "vlan_ovr", "mismatch");
+    for (uint16_t p = 0; p < MAX_PORTS_CONFIG; p++) {
+        const struct port_vlan_config *cfg = &port_vlans[p];
+        if (cfg->tx_vlan_count == 0)
+            continue;
+        if (rx_port == MAX_PORTS_CONFIG)
+            rx_port = p;
+
+        fwd_remap_build(&tables[p], p);
+        uint32_t bad = fwd_remap_check(&tables[p], p);
+        ok = ok && bad == 0;
+
+        uint32_t in_range = 0, remapped = 0, cross = 0, override = 0;
+        for (uint32_t vl = 0; vl <= MAX_VL_ID; vl++) {
+            const struct fwd_remap_entry *e = &tables[p].e[vl];
+            bool matched = false;
+            for (uint16_t q = 0; q < cfg->tx_vlan_count && !matched; q++) {
+                uint16_t r1_size = cfg->tx_vl_range1_size[q] > 0
+                                   ? cfg->tx_vl_range1_size[q] : VL_RANGE_SIZE_PER_QUEUE;
+                matched = (vl >= cfg->tx_vl_ids[q] && vl < (uint32_t)cfg->tx_vl_ids[q] + r1_size) ||
+                          (cfg->tx_vl_ids2[q] > 0 && vl >= cfg->tx_vl_ids2[q] &&
+                           vl < (uint32_t)cfg->tx_vl_ids2[q] + cfg->tx_vl_range2_size[q]);
+            }
+            in_range += matched;
+            remapped += rte_be_to_cpu_16(e->vl_be) != vl;
+            cross += e->port != p;
+            override += !(e->vlan & FWD_REMAP_VID_KEEP);
+        }
+        printf("%4u %8u %8u %8u %8u %10u\n", p, in_range, remapped, cross, override, bad);
+    }
+    if (rx_port == MAX_PORTS_CONFIG) {
+        fprintf(stderr, "bench: no port with TX queues in the forwarder VLAN config\n");
+        return false;
+    }
+
+    const struct port_vlan_config *cfg = &port_vlans[rx_port];
+    uint16_t all[BENCH_MAX_VLS];
+    uint32_t total = 0;
+    for (uint16_t q = 0; q < cfg->tx_vlan_count; q++) {
+        uint16_t r1_size = cfg->tx_vl_range1_size[q] > 0
+                           ? cfg->tx_vl_range1_size[q] : VL_RANGE_SIZE_PER_QUEUE;
+        for (uint32_t k = 0; k < r1_size && total < BENCH_MAX_VLS; k++)
+            if (cfg->tx_vl_ids[q] + k <= MAX_VL_ID)
+                all[total++] = (uint16_t)(cfg->tx_vl_ids[q] + k);
+        if (cfg->tx_vl_ids2[q] == 0)
+            continue;
+        for (uint32_t k = 0; k < cfg->tx_vl_range2_size[q] && total < BENCH_MAX_VLS; k++)
+            if (cfg->tx_vl_ids2[q] + k <= MAX_VL_ID)
+                all[total++] = (uint16_t)(cfg->tx_vl_ids2[q] + k);
+    }
+    if (total == 0) {
+        fprintf(stderr, "bench: port %u has no range VL-IDs\n", rx_port);
+        rx_port = MAX_PORTS_CONFIG;
+        return false;
+    }
+    if (total < nb_vls)
+        nb_vls = (uint16_t)total;
+    for (uint16_t v = 0; v < nb_vls; v++)
+        vls[v] = all[(uint32_t)v * total / nb_vls];
+
+    return ok;
+}
+
+static int setup_pool(uint32_t pool_mb)
+{
+    pool_frames = (uint32_t)(((uint64_t)pool_mb << 20) / BENCH_FRAME_STRIDE);
+    pool_frames -= pool_frames % BURST_SIZE;
+
+    pool = aligned_alloc(64, (size_t)pool_frames * BENCH_FRAME_STRIDE);
+    headers = malloc((size_t)pool_frames * FWD_REMAP_PROBE_LEN);
+    ref_out = malloc((size_t)pool_frames * FWD_REMAP_PROBE_LEN);
+    ref_ports = malloc((size_t)pool_frames * sizeof(*ref_ports));
+    ports_out = malloc((size_t)pool_frames * sizeof(*ports_out));
+    mbufs = calloc(pool_frames, sizeof(struct rte_mbuf));
+    trace = malloc((size_t)pool_frames * sizeof(*trace));
+    if (!pool || !headers || !ref_out || !ref_ports || !ports_out || !mbufs || !trace) {
+        fprintf(stderr, "bench: cannot allocate %u frame pool\n", pool_frames);
+        return -1;
+    }
+    for (uint32_t i = 0; i < pool_frames; i++) {
+        mbufs[i].buf_addr = pool + (size_t)i * BENCH_FRAME_STRIDE;
+        mbufs[i].data_off = 0;
+        mbufs[i].buf_len = BENCH_FRAME_STRIDE;
+        trace[i] = &mbufs[i];
+    }
+    return 0;
+}
+
+/**
+ * Frame i: VL vls[i % nb_vls], one of the port's RX VLANs, VMC_1 headers
+ * (fwd_remap_probe_frame) and a sequence in the payload
+ */
+static void prepare_frames(uint16_t frame)
+{
+    const struct port_vlan_config *cfg = &port_vlans[rx_port];
+
+    for (uint32_t i = 0; i < pool_frames; i++) {
+        struct rte_mbuf *m = &mbufs[i];
+        uint8_t *pkt = rte_pktmbuf_mtod(m, uint8_t *);
+        uint16_t vid = cfg->rx_vlan_count > 0 ? cfg->rx_vlans[i % cfg->rx_vlan_count] : 1;
+        uint64_t seq = i;
+
+        memset(pkt, 0, frame);
+        fwd_remap_probe_frame(pkt, vls[i % nb_vls], (uint16_t)(0x2000 | (vid & 0x0FFF)));
+        memcpy(pkt + L2_HEADER_SIZE + IP_HDR_SIZE + UDP_HDR_SIZE, &seq, sizeof(seq));
+        memcpy(headers + (size_t)i * FWD_REMAP_PROBE_LEN, pkt, FWD_REMAP_PROBE_LEN);
+        m->pkt_len = frame;
+        m->data_len = frame;
+    }
+}
+
+static void restore_headers(void)
+{
+    for (uint32_t i = 0; i < pool_frames; i++)
+        memcpy(rte_pktmbuf_mtod(&mbufs[i], uint8_t *),
+               headers + (size_t)i * FWD_REMAP_PROBE_LEN, FWD_REMAP_PROBE_LEN);
+}
+
+// ==========================================
+// RUNNER
+// ==========================================
+
+static double run_loop(bool table, bool transform)
+{
+    double cpp[BENCH_REPS];
+
+    for (int r = 0; r < BENCH_REPS; r++) {
+        restore_headers();
+
+        uint64_t c0 = rte_rdtsc_precise();
+        for (uint32_t b = 0; b < pool_frames; b += BURST_SIZE) {
+            if (table)
+                table_burst(&trace[b], BURST_SIZE, &ports_out[b], transform);
+            else
+                scan_burst(&trace[b], BURST_SIZE, &ports_out[b], transform);
+        }
+        cpp[r] = (double)(rte_rdtsc_precise() - c0) / pool_frames;
+    }
+    qsort(cpp, BENCH_REPS, sizeof(double), cmp_double);
+    return cpp[BENCH_REPS / 2];
+}
+
+// Table output vs the scan output saved in ref_out / ref_ports
+static bool same_output(void)
+{
+    for (uint32_t i = 0; i < pool_frames; i++) {
+        uint8_t *pkt = rte_pktmbuf_mtod(&mbufs[i], uint8_t *);
+        uint8_t *ref = ref_out + (size_t)i * FWD_REMAP_PROBE_LEN;
+
+        if (ports_out[i] != ref_ports[i] || fwd_remap_ip_sum(pkt + 18) != 0xFFFF ||
+            memcmp(pkt, ref, FWD_REMAP_PROBE_LEN) != 0)
+            return false;
+    }
+    return true;
+}
+
+static void run_frame(uint16_t frame, bool tables_ok)
+{
+    prepare_frames(frame);
+
+    double scan_remap = run_loop(false, false);
+    double table_remap = run_loop(true, false);
+    double scan_fwd = run_loop(false, true);
+    for (uint32_t i = 0; i < pool_frames; i++)
+        memcpy(ref_out + (size_t)i * FWD_REMAP_PROBE_LEN,
+               rte_pktmbuf_mtod(&mbufs[i], uint8_t *), FWD_REMAP_PROBE_LEN);
+    memcpy(ref_ports, ports_out, (size_t)pool_frames * sizeof(*ports_out));
+    double table_fwd = run_loop(true, true);
+    bool ok = tables_ok && same_output();
+
+    double scan_mpps = tsc_hz / scan_fwd / 1e6;
+    double table_mpps = tsc_hz / table_fwd / 1e6;
+    printf("%5u %10.1f %10.1f %10.1f %10.1f %10.2f %10.2f %+7.1f%%  %s\n",
+           frame, scan_remap, table_remap, scan_fwd, table_fwd, scan_mpps, table_mpps,
+           (table_mpps - scan_mpps) * 100 / scan_mpps, ok ? "ok" : "MISMATCH");
+    printf("FWD-REMAP-RESULT frame=%u scan_remap_cpp=%.1f table_remap_cpp=%.1f scan_fwd_cpp=%.1f table_fwd_cpp=%.1f scan_mpps=%.2f table_mpps=%.2f ok=%d\n",
+           frame, scan_remap, table_remap, scan_fwd, table_fwd, scan_mpps, table_mpps, ok);
+    fflush(stdout);
+}
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [--lcore N] [--vls N] [--pool-mb MB] [--frames LIST] [--ate]\n", prog);
+    printf("  --lcore N      Pin to CPU N (recommended: isolated core)\n");
+    printf("  --vls N        Interleaved VL-IDs (default %d)\n", BENCH_VLS);
+    printf("  --pool-mb MB   Frame pool (default %d, keep > LLC)\n", BENCH_POOL_MB);
+    printf("  --frames LIST  Frame sizes (default 64,512,1518)\n");
+    printf("  --ate          ATE forwarder tables (FWD_ATE_PORT_VLAN_CONFIG_INIT)\n");
+}
+
+int main(int argc, char **argv)
+{
+    uint16_t frames[BENCH_MAX_FRAMES] = { 64, 512, 1518 };
+    int nb_frames = 3;
+    uint32_t pool_mb = BENCH_POOL_MB;
+    int lcore = -1;
+    bool ate = false;
+
+    static const struct option opts[] = {
+        { "lcore",   required_argument, NULL, 'l' },
+        { "vls",     required_argument, NULL, 'v' },
+        { "pool-mb", required_argument, NULL, 'p' },
+        { "frames",  required_argument, NULL, 'f' },
+        { "ate",     no_argument,       NULL, 'a' },
+        { "help",    no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "l:v:p:f:ah", opts, NULL)) != -1) {
+        switch (opt) {
+        case 'l': lcore = atoi(optarg); break;
+        case 'v': nb_vls = (uint16_t)atoi(optarg); break;
+        case 'p': pool_mb = (uint32_t)atoi(optarg); break;
+        case 'a': ate = true; break;
+        case 'f':
+            nb_frames = 0;
+            for (char *tok = strtok(optarg, ","); tok && nb_frames < BENCH_MAX_FRAMES;
+                 tok = strtok(NULL, ",")) {
+                int f = atoi(tok);
+                if (f >= 64 && f <= BENCH_FRAME_STRIDE)
+                    frames[nb_frames++] = (uint16_t)f;
+            }
+            break;
+        default:  usage(argv[0]); return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (nb_vls == 0 || nb_vls > BENCH_MAX_VLS || nb_frames == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (lcore >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(lcore, &set);
+        if (sched_setaffinity(0, sizeof(set), &set) != 0)
+            fprintf(stderr, "bench: cannot pin to CPU %d, continuing unpinned\n", lcore);
+    }
+    if (ate)
+        memcpy(port_vlans, fwd_ate_port_vlans, sizeof(port_vlans));
+
+    tsc_hz = calibrate_tsc_hz();
+    printf("=== Forward remap: %s forwarder tables, VL-ID 0..%u per port ===\n",
+           ate ? "ATE" : "normal", MAX_VL_ID);
+    bool tables_ok = setup_tables();
+    if (rx_port == MAX_PORTS_CONFIG || setup_pool(pool_mb) < 0)
+        return 1;
+    if (!tables_ok)
+        printf("Table differs from process_packet, see mismatch column\n");
+
+    printf("\n=== Port %u, %u VL-IDs, %u frames/pass ===\n", rx_port, nb_vls, pool_frames);
+    printf("TSC: %.3f GHz, reps: %d (median), fwd = remap + splitmix64_transform\n\n",
+           tsc_hz / 1e9, BENCH_REPS);
+    printf("%5s %10s %10s %10s %10s %10s %10s %8s\n",
+           "frame", "scan", "table", "scan", "table", "scan", "table", "fwd");
+    printf("%5s %10s %10s %10s %10s %10s %10s %8s\n",
+           "", "remap cyc", "remap cyc", "fwd cyc", "fwd cyc", "Mpps", "Mpps", "delta");
+
+    for (int i = 0; i < nb_frames; i++)
+        run_frame(frames[i], tables_ok);
+    return tables_ok ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+#!/bin/bash
+#
+# NIC-free throughput sweep on the SW harness (net_ring ports 0..3).
+#
+# For every TX/RX core count and mbuf pool sizing combination the app is
+# rebuilt with SW_HARNESS=1, run for a fixed duration with --no-pci and
+# the HARNESS-RESULT line is appended to a CSV.
+#
+# Usage: bench/harness_sweep.sh [-t "1 2 4"] [-r "1 2 4"] [-d SECONDS]
+#                               [-m "sized legacy"] [-R "verifier forwarder"]
+#                               [-P] [-l LCORES] [-o OUT.csv]
+#
+#   -m  mbuf pool sizing: sized (per-role RX/TX pools) and/or legacy
+#   -R  --role of each run: verifier (loopback fabric) and/or forwarder
+#       (source fabric); one build serves both
+#   -P  perf stat cache misses over the measured window (cache_miss_per_pkt)
+#
+# TX pacing targets are raised so tx_worker runs unthrottled; the numbers
+# are the software ceiling of tx_worker / fabric / rx_worker (or
+# forward_worker) on this box, not NIC line rate.
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+TX_LIST="1 2 4"
+RX_LIST="1 2 4"
+POOL_LIST="sized"
+ROLE_LIST="verifier"
+DURATION=10
+LCORES="0-39"
+OUT="bench/harness_results.csv"
+PERF=0
+UNTHROTTLED_GBPS=1000
+
+usage() {
+    sed -n '3,20p' "$0" | sed 's/^# \{0,1\}//'
+    exit 2
+}
+
+while getopts "t:r:d:m:R:l:o:Ph" opt; do
+    case $opt in
+        t) TX_LIST=$OPTARG ;;
+        r) RX_LIST=$OPTARG ;;
+        d) DURATION=$OPTARG ;;
+        m) POOL_LIST=$OPTARG ;;
+        R) ROLE_LIST=$OPTARG ;;
+        l) LCORES=$OPTARG ;;
+        o) OUT=$OPTARG ;;
+        P) PERF=1 ;;
+        *) usage ;;
+    esac
+done
+
+if [ "$PERF" = 1 ] && ! command -v perf > /dev/null; then
+    echo "perf not found, cache misses not collected"
+    PERF=0
+fi
+
+KEYS="mode,role,pools,ports,tx_cores,rx_cores,fabric_cores,seconds,tx_mpps,tx_gbps,rx_mpps,rx_gbps,fabric_in_mpps,fabric_out_mpps,drop_pps,mbuf_mb"
+if [ "$PERF" = 1 ]; then
+    echo "$KEYS,cache_miss_per_pkt" > "$OUT"
+else
+    echo "$KEYS" > "$OUT"
+fi
+
+# Run the app with --role $1; with -P attach perf stat once the warmup
+# seconds are over. Prints the HARNESS-RESULT line, then the cache miss
+# count (or empty).
+run_app() {
+    local role=$1 log perf_out pid app line misses=""
+    log=$(mktemp)
+    perf_out=$(mktemp)
+
+    sudo stdbuf -oL ./dpdk_app -l "$LCORES" -n 4 --no-pci --role "$role" > "$log" 2>&1 &
+    pid=$!
+
+    if [ "$PERF" = 1 ]; then
+        # First per-second table without the [warmup] tag
+        until grep -q '^=== SW Harness (.*) t=[0-9]*s ===$' "$log" || ! kill -0 "$pid" 2> /dev/null; do
+            sleep 0.2
+        done
+        app=$(pgrep -n -x dpdk_app || true)
+        if [ -n "$app" ] && [ "$DURATION" -gt 1 ]; then
+            sudo perf stat -x, -e cache-misses -p "$app" -o "$perf_out" \
+                -- sleep $((DURATION - 1)) > /dev/null 2>&1 || true
+            misses=$(awk -F, '/cache-misses/ { print $1 }' "$perf_out")
+        fi
+    fi
+
+    wait "$pid" || true
+    line=$(grep '^HARNESS-RESULT' "$log" | tail -1 || true)
+    echo "$line"
+    echo "$misses"
+    rm -f "$log" "$perf_out"
+}
+
+for pools in $POOL_LIST; do
+    legacy=0
+    [ "$pools" = "legacy" ] && legacy=1
+
+    for tx in $TX_LIST; do
+        for rx in $RX_LIST; do
+            echo "=== TX cores $tx / RX cores $rx / $pools mbuf pools ==="
+            make -B SW_HARNESS=1 HARNESS_DURATION="$DURATION" MBUF_POOL_LEGACY=$legacy \
+                 NUM_TX_CORES="$tx" NUM_RX_CORES="$rx" \
+                 TARGET_GBPS_FAST=$UNTHROTTLED_GBPS TARGET_GBPS_MID=$UNTHROTTLED_GBPS \
+                 TARGET_GBPS_SLOW=$UNTHROTTLED_GBPS > /dev/null
+
+            for role in $ROLE_LIST; do
+                result=$(run_app "$role")
+                line=$(echo "$result" | sed -n 1p)
+                misses=$(echo "$result" | sed -n 2p)
+                if [ -z "$line" ]; then
+                    echo "  $role: no HARNESS-RESULT (not enough lcores in -l $LCORES?)"
+                    continue
+                fi
+                echo "  $role: $line${misses:+ cache_misses=$misses}"
+
+                echo "$line" | awk -v keys="$KEYS" -v perf="$PERF" -v misses="$misses" \
+                                   -v window=$((DURATION - 1)) '{
+                    for (i = 2; i <= NF; i++) { split($i, kv, "="); v[kv[1]] = kv[2] }
+                    n = split(keys, k, ",")
+                    out = v[k[1]]
+                    for (i = 2; i <= n; i++) out = out "," v[k[i]]
+                    if (perf == 1) {
+                        mpps = v["rx_mpps"] > 0 ? v["rx_mpps"] : v["tx_mpps"]
+                        pkts = mpps * 1e6 * window
+                        out = out "," ((misses != "" && pkts > 0) ? sprintf("%.2f", misses / pkts) : "")
+                    }
+                    print out
+                }' >> "$OUT"
+            done
+        done
+    done
+done
+
+echo "Results: $OUT"
+column -s, -t < "$OUT"
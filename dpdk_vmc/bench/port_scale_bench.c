@@ -0,0 +1,299 @@
+/**
+ * Per-port state scaling benchmark
+ *
+ * Standalone binary (make port-scale-bench): no EAL, no NIC (same setup as
+ * rx_pipeline_bench.c). One thread per port (1..8 ports) runs the per-port
+ * state work of the TX / RX / forward workers on the real structs and
+ * hot-path code of tx_rx_manager.h, tx_vl_seq.h and rx_pipeline.h:
+ *
+ *   per packet  TX sequence of the VL (get_next_tx_sequence, queue-private
+ *               tx_vl_seq_local, every VL-ID owned)
+ *   per burst   VL-ID tracker pass (rx_pipe_track, no steering), rx_stats
+ *               counter adds, forward TX queue lock / unlock
+ *
+ * Two layouts of that state:
+ *
+ *   packed  - previous layout: static [MAX_PORTS] arrays, zeroed by the
+ *             main thread (first touch on its node), rx_stats at its
+ *             unaligned size and bare rte_spinlock_t TX queue locks
+ *             packed, so neighbouring ports share lines
+ *   scaled  - capacity_port_zmalloc layout: one block per port, allocated
+ *             and first touched by the port's own thread (stand-in for
+ *             rte_zmalloc_socket on the port's socket), struct rx_stats
+ *             and struct fwd_tx_queue_lock one cache line each
+ *
+ * Per-port Mpps is packets per thread CPU second, so the result stays
+ * meaningful when there are fewer CPUs than ports. "flat" is the per-port
+ * Mpps at N ports over the 1-port value (1.00 = no per-port loss). Line
+ * sharing between ports only costs when the port threads really run in
+ * parallel, i.e. with at least as many free CPUs as ports.
+ *
+ * Usage: dpdk_app-port-bench [--ports LIST] [--packets N] [--vls N] [--no-pin]
+ *   --ports    comma separated port counts (default 1,2,4,8)
+ *   --packets  packets per port (default 8000000)
+ *   --vls      VL-IDs per port (default 512, NUM_TX_CORES x 128)
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <rte_atomic.h>
+#include <rte_spinlock.h>
+
+#include "config.h"
+#include "tx_rx_manager.h"
+#include "rx_pipeline.h"
+#include "tx_vl_seq.h"
+
+#define BENCH_REPS 3
+#define BENCH_MAX_VLS (MAX_VL_ID / 2)
+
+// struct rx_stats without its cache line alignment (previous layout)
+#define RX_STATS_PACKED_SIZE (offsetof(struct rx_stats, raw_socket_rx_bytes) + sizeof(rte_atomic64_t))
+
+// Packed layout (static, first touched by main)
+static struct port_vl_tracker packed_trackers[MAX_PORTS];
+static struct tx_vl_sequence packed_tx_seq[MAX_PORTS];
+static uint64_t packed_tx_local[MAX_PORTS][BENCH_MAX_VLS];
+static uint8_t packed_stats[MAX_PORTS][RX_STATS_PACKED_SIZE] __attribute__((aligned(8)));
+static rte_spinlock_t packed_locks[MAX_PORTS][MAX_TX_QUEUES_FWD];
+
+struct port_thread {
+    pthread_t thread;
+    int port;
+    int cpu;
+    bool scaled;
+    uint32_t packets;
+    double cpu_s;
+    uint64_t checksum;
+    uint64_t lost;
+};
+
+static pthread_barrier_t start_barrier;
+static uint16_t bench_vls = 512;
+
+// rx_stats counter of either layout (packed: at its offset in the unaligned block)
+static inline rte_atomic64_t *stats_counter(uint8_t *stats, size_t off)
+{
+    return (rte_atomic64_t *)(stats + off);
+}
+
+static double thread_cpu_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *port_thread_main(void *arg)
+{
+    struct port_thread *pt = arg;
+    struct port_vl_tracker *trk;
+    struct tx_vl_sequence *txs;
+    struct tx_vl_seq_local local = { 0 };
+    struct rx_stats *own_stats = NULL;
+    struct fwd_tx_queue_lock *own_locks = NULL;
+    uint8_t *stats;
+    rte_spinlock_t *fwd_lock;
+
+    if (pt->cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(pt->cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+
+    if (pt->scaled) {
+        // Port's own block, zeroed (first touch) by the port's thread
+        trk = aligned_alloc(RTE_CACHE_LINE_SIZE, sizeof(*trk));
+        txs = aligned_alloc(RTE_CACHE_LINE_SIZE, sizeof(*txs));
+        local.seq = aligned_alloc(RTE_CACHE_LINE_SIZE, sizeof(uint64_t) * BENCH_MAX_VLS);
+        own_stats = aligned_alloc(RTE_CACHE_LINE_SIZE, sizeof(*own_stats));
+        own_locks = aligned_alloc(RTE_CACHE_LINE_SIZE, sizeof(*own_locks) * MAX_TX_QUEUES_FWD);
+        if (!trk || !txs || !local.seq || !own_stats || !own_locks) {
+            fprintf(stderr, "port %d: allocation failed\n", pt->port);
+            exit(1);
+        }
+        memset(trk, 0, sizeof(*trk));
+        memset(txs, 0, sizeof(*txs));
+        memset(local.seq, 0, sizeof(uint64_t) * BENCH_MAX_VLS);
+        memset(own_stats, 0, sizeof(*own_stats));
+        for (int q = 0; q < MAX_TX_QUEUES_FWD; q++)
+            rte_spinlock_init(&own_locks[q].lock);
+        stats = (uint8_t *)own_stats;
+        fwd_lock = &own_locks[0].lock;
+    } else {
+        trk = &packed_trackers[pt->port];
+        txs = &packed_tx_seq[pt->port];
+        local.seq = packed_tx_local[pt->port];
+        stats = packed_stats[pt->port];
+        fwd_lock = &packed_locks[pt->port][0];
+    }
+    local.shared_seq = txs->shared_seq;
+
+    rte_atomic64_t *total = stats_counter(stats, offsetof(struct rx_stats, total_rx_pkts));
+    rte_atomic64_t *good = stats_counter(stats, offsetof(struct rx_stats, good_pkts));
+    rte_atomic64_t *lost = stats_counter(stats, offsetof(struct rx_stats, lost_pkts));
+    struct rx_pipe_burst b;
+
+    pthread_barrier_wait(&start_barrier);
+    double t0 = thread_cpu_s();
+
+    // Own VL-ID range per port, inside [1, MAX_VL_ID]
+    uint16_t vl_base = 1 + (uint16_t)((pt->port * bench_vls) % (MAX_VL_ID - bench_vls));
+    for (uint32_t i = 0; i < pt->packets; i += BURST_SIZE) {
+        for (uint32_t j = 0; j < BURST_SIZE; j++) {
+            uint16_t off = (uint16_t)((i + j) % bench_vls);
+            uint16_t vl = vl_base + off;
+
+            // TX: queue-private sequence of the VL
+            b.pkt[j].seq = get_next_tx_sequence(&local, off, vl);
+            b.pkt[j].vl_id = vl;
+            b.pkt[j].idx = (uint16_t)j;
+        }
+        b.nb = BURST_SIZE;
+
+        // RX: per-VL tracker pass, stats flush; forward TX queue lock
+        uint64_t gaps = rx_pipe_track(&b, trk->vl_trackers, NULL);
+        rte_atomic64_add(total, BURST_SIZE);
+        rte_atomic64_add(good, BURST_SIZE);
+        if (gaps)
+            rte_atomic64_add(lost, (int64_t)gaps);
+        rte_spinlock_lock(fwd_lock);
+        rte_spinlock_unlock(fwd_lock);
+    }
+
+    pt->cpu_s = thread_cpu_s() - t0;
+
+    uint64_t sum = 0;
+    for (uint16_t v = 0; v < bench_vls; v++)
+        sum += trk->vl_trackers[vl_base + v].pkt_count + local.seq[v];
+    pt->checksum = sum + (uint64_t)rte_atomic64_read(total);
+    pt->lost = (uint64_t)rte_atomic64_read(lost);
+
+    if (pt->scaled) {
+        free(trk);
+        free(txs);
+        free(local.seq);
+        free(own_stats);
+        free(own_locks);
+    }
+    return NULL;
+}
+
+/* Mean per-port Mpps (packets / thread CPU second) of one run */
+static double run_ports(int nb_ports, bool scaled, uint32_t packets, bool pin, bool *ok)
+{
+    struct port_thread pts[MAX_PORTS];
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (!scaled) {
+        // Main thread zeroes the whole static layout, as init_rx_stats did
+        memset(packed_trackers, 0, sizeof(packed_trackers));
+        memset(packed_tx_seq, 0, sizeof(packed_tx_seq));
+        memset(packed_tx_local, 0, sizeof(packed_tx_local));
+        memset(packed_stats, 0, sizeof(packed_stats));
+        for (int p = 0; p < MAX_PORTS; p++)
+            for (int q = 0; q < MAX_TX_QUEUES_FWD; q++)
+                rte_spinlock_init(&packed_locks[p][q]);
+    }
+
+    pthread_barrier_init(&start_barrier, NULL, nb_ports);
+    for (int p = 0; p < nb_ports; p++) {
+        pts[p] = (struct port_thread){
+            .port = p,
+            .cpu = pin ? (int)(p % ncpu) : -1,
+            .scaled = scaled,
+            .packets = packets,
+        };
+        pthread_create(&pts[p].thread, NULL, port_thread_main, &pts[p]);
+    }
+
+    double mpps = 0;
+    for (int p = 0; p < nb_ports; p++) {
+        pthread_join(pts[p].thread, NULL);
+        uint64_t expect = (uint64_t)(packets + BURST_SIZE - 1) / BURST_SIZE * BURST_SIZE;
+        if (pts[p].checksum != expect * 3 || pts[p].lost != 0)
+            *ok = false;
+        mpps += packets / pts[p].cpu_s / 1e6;
+    }
+    pthread_barrier_destroy(&start_barrier);
+    return mpps / nb_ports;
+}
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [--ports LIST] [--packets N] [--vls N] [--no-pin]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    int port_counts[MAX_PORTS];
+    int nb_counts = 0;
+    uint32_t packets = 8000000;
+    bool pin = true;
+    const char *ports_arg = "1,2,4,8";
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--ports") && i + 1 < argc)
+            ports_arg = argv[++i];
+        else if (!strcmp(argv[i], "--packets") && i + 1 < argc)
+            packets = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--vls") && i + 1 < argc)
+            bench_vls = (uint16_t)strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--no-pin"))
+            pin = false;
+        else {
+            usage(argv[0]);
+            return !strcmp(argv[i], "--help") ? 0 : 2;
+        }
+    }
+
+    char buf[128];
+    snprintf(buf, sizeof(buf), "%s", ports_arg);
+    for (char *tok = strtok(buf, ","); tok && nb_counts < MAX_PORTS; tok = strtok(NULL, ",")) {
+        int n = atoi(tok);
+        if (n >= 1 && n <= MAX_PORTS)
+            port_counts[nb_counts++] = n;
+    }
+    if (nb_counts == 0 || bench_vls == 0 || bench_vls > BENCH_MAX_VLS) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    printf("Per-port state scaling: %u packets/port, %u VL-IDs/port, %ld CPUs, %s\n",
+           packets, bench_vls, sysconf(_SC_NPROCESSORS_ONLN), pin ? "pinned" : "unpinned");
+    printf("%-6s %14s %14s %9s %9s\n", "ports", "packed Mpps/p", "scaled Mpps/p", "flat pk", "flat sc");
+
+    bool ok = true;
+    double base_packed = 0, base_scaled = 0;
+    for (int c = 0; c < nb_counts; c++) {
+        int n = port_counts[c];
+        double best_packed = 0, best_scaled = 0;
+        for (int r = 0; r < BENCH_REPS; r++) {
+            double pk = run_ports(n, false, packets, pin, &ok);
+            double sc = run_ports(n, true, packets, pin, &ok);
+            if (pk > best_packed) best_packed = pk;
+            if (sc > best_scaled) best_scaled = sc;
+        }
+        if (c == 0) {
+            base_packed = best_packed;
+            base_scaled = best_scaled;
+        }
+        double flat_packed = best_packed / base_packed;
+        double flat_scaled = best_scaled / base_scaled;
+        printf("%-6d %14.1f %14.1f %9.2f %9.2f\n", n, best_packed, best_scaled, flat_packed, flat_scaled);
+        printf("PORT-SCALE-RESULT ports=%d packed_mpps=%.1f scaled_mpps=%.1f flat_packed=%.2f flat_scaled=%.2f\n",
+               n, best_packed, best_scaled, flat_packed, flat_scaled);
+    }
+    printf("PORT-SCALE-RESULT ok=%d\n", ok ? 1 : 0);
+    return ok ? 0 : 1;
+}
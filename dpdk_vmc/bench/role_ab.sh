@@ -0,0 +1,125 @@
+#!/bin/bash
+#
+# Merged binary vs the split trees it replaced, on the SW harness (net_ring
+# ports 0..3): --role verifier (loopback: tx_worker -> fabric -> rx_worker)
+# against dpdk_vmc_1, --role forwarder (source: fabric gen -> forward_worker
+# -> sink) against dpdk_vmc_2 of a commit before the merge. Same options,
+# same lcores, runs alternated; every HARNESS-RESULT goes to a CSV and the
+# median Mpps per side is printed with the delta.
+#
+# Usage: bench/role_ab.sh -r REF [-n RUNS] [-d SECONDS] [-l LCORES] [-o OUT.csv]
+#
+#   -r  commit that still has dpdk_vmc_1/ and dpdk_vmc_2/ (built in a
+#       temporary git worktree)
+#   -n  runs per side and role (default 5)
+#   -d  HARNESS_DURATION of each run (default 10)
+#
+# Verifier compares rx_mpps (every packet through rx_worker), forwarder
+# tx_mpps (every packet through forward_worker); TX pacing is unthrottled as
+# in harness_sweep.sh. |delta| above 2% is flagged.
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+REF=""
+RUNS=5
+DURATION=10
+LCORES="0-39"
+OUT="bench/role_ab_results.csv"
+UNTHROTTLED_GBPS=1000
+MAX_DELTA_PCT=2
+
+usage() {
+    sed -n '3,19p' "$0" | sed 's/^# \{0,1\}//'
+    exit 2
+}
+
+while getopts "r:n:d:l:o:h" opt; do
+    case $opt in
+        r) REF=$OPTARG ;;
+        n) RUNS=$OPTARG ;;
+        d) DURATION=$OPTARG ;;
+        l) LCORES=$OPTARG ;;
+        o) OUT=$OPTARG ;;
+        *) usage ;;
+    esac
+done
+[ -n "$REF" ] || usage
+
+BUILD_ARGS="SW_HARNESS=1 HARNESS_DURATION=$DURATION TARGET_GBPS_FAST=$UNTHROTTLED_GBPS \
+TARGET_GBPS_MID=$UNTHROTTLED_GBPS TARGET_GBPS_SLOW=$UNTHROTTLED_GBPS"
+
+WT=$(mktemp -d)
+trap 'git worktree remove --force "$WT" > /dev/null 2>&1 || rm -rf "$WT"' EXIT
+
+echo "=== Building split trees of $REF and this tree (SW_HARNESS=1) ==="
+git worktree add --detach "$WT" "$REF" > /dev/null
+for t in dpdk_vmc_1 dpdk_vmc_2; do
+    if [ ! -d "$WT/$t" ]; then
+        echo "$REF has no $t/, pass a commit before the merge"
+        exit 2
+    fi
+    # shellcheck disable=SC2086
+    make -C "$WT/$t" -B $BUILD_ARGS > /dev/null
+done
+# shellcheck disable=SC2086
+make -B $BUILD_ARGS > /dev/null
+
+# Run one binary; prints the value of key $2 from its HARNESS-RESULT line
+run_app() {
+    local app=$1 key=$2 log line
+    shift 2
+    log=$(mktemp)
+    sudo stdbuf -oL "$app" -l "$LCORES" -n 4 --no-pci "$@" > "$log" 2>&1 || true
+    line=$(grep '^HARNESS-RESULT' "$log" | tail -1 || true)
+    rm -f "$log"
+    echo "$line" | tr ' ' '\n' | awk -F= -v k="$key" '$1 == k { print $2 }'
+}
+
+echo "role,side,run,metric,mpps" > "$OUT"
+
+for run in $(seq 1 "$RUNS"); do
+    for role in verifier forwarder; do
+        if [ "$role" = verifier ]; then
+            split_app="$WT/dpdk_vmc_1/dpdk_app"
+            key=rx_mpps
+        else
+            split_app="$WT/dpdk_vmc_2/dpdk_app"
+            key=tx_mpps
+        fi
+
+        split=$(run_app "$split_app" "$key")
+        merged=$(run_app ./dpdk_app "$key" --role "$role")
+        echo "  run $run $role: split $key=${split:--} merged $key=${merged:--}"
+
+        [ -n "$split" ] && echo "$role,split,$run,$key,$split" >> "$OUT"
+        [ -n "$merged" ] && echo "$role,merged,$run,$key,$merged" >> "$OUT"
+    done
+done
+
+echo "Results: $OUT"
+echo
+echo "Median Mpps per role:"
+tail -n +2 "$OUT" | sort -t, -k1,1 -k2,2 -k5,5n | awk -F, -v max="$MAX_DELTA_PCT" '
+    function flush() {
+        if (n == 0) return
+        m[role, side] = (n % 2) ? v[(n + 1) / 2] : (v[n / 2] + v[n / 2 + 1]) / 2
+        metric[role] = key
+        n = 0
+    }
+    { if ($1 != role || $2 != side) { flush(); role = $1; side = $2; key = $4 } v[++n] = $5 }
+    END {
+        flush()
+        printf "  %-10s %-8s %10s %10s %8s\n", "role", "metric", "split", "merged", "delta"
+        split("verifier forwarder", roles, " ")
+        for (i = 1; i <= 2; i++) {
+            r = roles[i]
+            if (!((r, "split") in m) || !((r, "merged") in m)) {
+                printf "  %-10s no result on one side\n", r
+                continue
+            }
+            d = m[r, "split"] > 0 ? (m[r, "merged"] - m[r, "split"]) * 100 / m[r, "split"] : 0
+            printf "  %-10s %-8s %10.3f %10.3f %+7.1f%%%s\n", r, metric[r],
+                   m[r, "split"], m[r, "merged"], d, (d > max || d < -max) ? "  <-- differs" : ""
+        }
+    }'
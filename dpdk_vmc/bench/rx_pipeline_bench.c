@@ -0,0 +1,520 @@
+/**
+ * RX verification pipeline benchmark
+ *
+ * Standalone binary (make rx-pipeline-bench): rx_worker's own-packet path
+ * over fake mbufs, no EAL, no NIC (same setup as bench_hotpath.c). All
+ * loops run on the same bursts:
+ *
+ *   legacy - per-packet loop (RX_STAGED_PIPELINE=0): header prefetch
+ *            i+4 / i+7, VL-ID range scans, tracker atomics per packet,
+ *            then CRC / PRBS
+ *   staged - rx_pipeline.h: parse, prefetch, per-VL tracker pass, verify
+ *   steered - staged with exclusive trackers (RX_FLOW_STEERING, MAC
+ *            modes: every own VL-ID has a rule to this queue, which is
+ *            its only writer, no locked RMW)
+ *
+ * Traffic: --vls VL-IDs spread over the first RX port's own set,
+ * interleaved, each with its own sequence (random start, so PRBS offsets
+ * spread over the ~268 MB cache). Every BENCH_DROP_EVERY-th packet is
+ * dropped, every BENCH_SWAP_EVERY-th one swapped with the VL's next
+ * packet, every BENCH_CORRUPT_EVERY-th gets a flipped PRBS bit (and a
+ * flipped splitmix byte -> CRC fail, RX_VERIFY_SPLITMIX). Frames come
+ * from a pool larger than LLC, so every burst starts cold. All loops
+ * must give the same counters and tracker table (ok=1).
+ *
+ * Frames below the RX minimum (full-size frame without IMIX,
+ * IMIX_MIN_PACKET_SIZE with IMIX=1) take the short-packet path in all loops.
+ *
+ * Usage: dpdk_app-rx-pipeline-bench [--lcore N] [--vls N] [--pool-mb MB] [--frames LIST]
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <sched.h>
+#include <getopt.h>
+#include <rte_cycles.h>
+#include <rte_mbuf.h>
+
+#include "config.h"
+#include "packet.h"
+#include "payload_transform.h"
+#include "vl_range.h"
+#include "rx_pipeline.h"
+
+// ==========================================
+// CONFIGURATION
+// ==========================================
+#define BENCH_REPS 5                  // Timed passes over the pool (median reported)
+#define BENCH_FRAME_STRIDE 2048       // Frame slot size in the pool
+#define BENCH_POOL_MB 64              // Default pool (> LLC)
+#define BENCH_VLS 32                  // Default interleaved VL-IDs
+#define BENCH_MAX_VLS 1024
+#define BENCH_MAX_FRAMES 8
+#define BENCH_DROP_EVERY 997
+#define BENCH_SWAP_EVERY 4099
+#define BENCH_CORRUPT_EVERY 1009
+
+// vl_range.h needs the VLAN table; tx_rx_manager.c is not linked
+struct port_vlan_config port_vlans[MAX_PORTS_CONFIG] = PORT_VLAN_CONFIG_INIT;
+
+struct bench_counters {
+    uint64_t good;
+    uint64_t bad;
+    uint64_t bits;
+    uint64_t lost;
+    uint64_t short_pkts;
+    uint64_t external;
+};
+
+static struct vl_sequence_tracker trackers[MAX_VL_ID + 1];
+static struct vl_sequence_tracker trackers_ref[MAX_VL_ID + 1];
+static uint8_t own_vl_map[RX_PIPE_VL_MAP_BYTES];
+static struct rx_pipe_burst pipe;
+
+static uint8_t *prbs_cache;
+static uint8_t *pool;
+static struct rte_mbuf *mbufs;
+static struct rte_mbuf **trace;   // Burst order
+static uint32_t pool_frames;
+
+static uint16_t rx_port, src_port;
+static uint32_t rx_min_len;
+static uint16_t vls[BENCH_MAX_VLS];
+static uint16_t nb_vls = BENCH_VLS;
+static double tsc_hz;
+
+// ==========================================
+// HELPERS
+// ==========================================
+
+static uint64_t mono_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static double calibrate_tsc_hz(void)
+{
+    uint64_t t0 = mono_ns();
+    uint64_t c0 = rte_rdtsc_precise();
+    while (mono_ns() - t0 < 100000000ULL)
+        ;
+    uint64_t c1 = rte_rdtsc_precise();
+    uint64_t t1 = mono_ns();
+    return (double)(c1 - c0) * 1e9 / (double)(t1 - t0);
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static inline bool legacy_is_own(uint16_t vl_id)
+{
+    return is_valid_tx_vl_id_for_source_port(vl_id, src_port) ||
+           (RX_VERIFY_SPLITMIX && is_valid_rx_vl_id_for_port(vl_id, rx_port));
+}
+
+// ==========================================
+// LOOPS UNDER TEST
+// ==========================================
+
+// rx_worker's per-packet own path (tracker + verify), RX_STAGED_PIPELINE=0
+static void legacy_burst(struct rte_mbuf **pkts, uint16_t nb_rx, struct bench_counters *c)
+{
+    const uint32_t payload_off = RX_PIPE_PAYLOAD_OFF;
+
+    for (uint16_t i = 0; i + 7 < nb_rx; i++) {
+        rte_prefetch0(rte_pktmbuf_mtod(pkts[i + 4], void *));
+        rte_prefetch0(rte_pktmbuf_mtod(pkts[i + 7], void *));
+    }
+
+    for (uint16_t i = 0; i < nb_rx; i++) {
+        struct rte_mbuf *m = pkts[i];
+        uint8_t *pkt = rte_pktmbuf_mtod(m, uint8_t *);
+
+        if (unlikely(m->pkt_len < rx_min_len)) {
+            c->short_pkts++;
+            continue;
+        }
+
+        uint16_t vl_id = ((uint16_t)pkt[4] << 8) | pkt[5];
+        if (!legacy_is_own(vl_id)) {
+            c->external++;
+            continue;
+        }
+
+        uint64_t seq = *(uint64_t *)(pkt + payload_off);
+
+        if (vl_id <= MAX_VL_ID) {
+            struct vl_sequence_tracker *seq_tracker = &trackers[vl_id];
+            int was_init = __atomic_load_n(&seq_tracker->initialized, __ATOMIC_ACQUIRE);
+            if (!was_init) {
+                int expected_init = 0;
+                if (__atomic_compare_exchange_n(&seq_tracker->initialized, &expected_init, 1,
+                                                false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+#if TOKEN_BUCKET_TX_ENABLED
+                    __atomic_store_n(&seq_tracker->min_seq, seq, __ATOMIC_RELEASE);
+#endif
+                    __atomic_store_n(&seq_tracker->expected_seq, seq + 1, __ATOMIC_RELEASE);
+                }
+            } else {
+                uint64_t expected = __atomic_load_n(&seq_tracker->expected_seq, __ATOMIC_ACQUIRE);
+                if (seq > expected)
+                    c->lost += (seq - expected);
+                if (seq >= expected)
+                    __atomic_store_n(&seq_tracker->expected_seq, seq + 1, __ATOMIC_RELEASE);
+            }
+
+            uint64_t current_max;
+            do {
+                current_max = __atomic_load_n(&seq_tracker->max_seq, __ATOMIC_ACQUIRE);
+                if (seq <= current_max)
+                    break;
+            } while (!__atomic_compare_exchange_n(&seq_tracker->max_seq, &current_max, seq,
+                                                   false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+            __atomic_fetch_add(&seq_tracker->pkt_count, 1, __ATOMIC_RELAXED);
+        }
+
+        uint8_t *payload_base = pkt + payload_off;
+#if RX_VERIFY_SPLITMIX
+        bool crc_ok = splitmix64_crc_ok(payload_base);
+#else
+        bool crc_ok = true;
+#endif
+        uint8_t *recv = payload_base + SEQ_BYTES + RX_PIPE_PRBS_SKIP;
+#if IMIX_ENABLED
+        uint16_t total_prbs_len = m->pkt_len - payload_off - SEQ_BYTES;
+        if (total_prbs_len > MAX_PRBS_BYTES) total_prbs_len = MAX_PRBS_BYTES;
+        uint16_t prbs_check_len = (total_prbs_len > RX_PIPE_PRBS_SKIP)
+            ? total_prbs_len - RX_PIPE_PRBS_SKIP : 0;
+        uint64_t off = (seq * (uint64_t)MAX_PRBS_BYTES) % (uint64_t)PRBS_CACHE_SIZE;
+        uint8_t *exp = prbs_cache + off + RX_PIPE_PRBS_SKIP;
+        bool prbs_ok = (prbs_check_len == 0) || (memcmp(recv, exp, prbs_check_len) == 0);
+#else
+        uint64_t off = (seq * (uint64_t)NUM_PRBS_BYTES) % (uint64_t)PRBS_CACHE_SIZE;
+        uint8_t *exp = prbs_cache + off + RX_PIPE_PRBS_SKIP;
+        uint32_t prbs_check_len = NUM_PRBS_BYTES - RX_PIPE_PRBS_SKIP;
+        bool prbs_ok = (memcmp(recv, exp, prbs_check_len) == 0);
+#endif
+        if (likely(crc_ok && prbs_ok)) {
+            c->good++;
+        } else {
+            c->bad++;
+            if (!prbs_ok && prbs_check_len > 0)
+                c->bits += prbs_bit_errors(recv, exp, prbs_check_len);
+        }
+    }
+}
+
+// rx_pipeline.h, as called by rx_worker (RX_STAGED_PIPELINE=1)
+static void staged_burst(struct rte_mbuf **pkts, uint16_t nb_rx, struct bench_counters *c,
+                         const uint8_t *excl_map)
+{
+    rx_pipe_parse(&pipe, pkts, nb_rx, own_vl_map, rx_min_len);
+    rx_pipe_prefetch(&pipe, prbs_cache, trackers);
+    c->lost += rx_pipe_track(&pipe, trackers, excl_map);
+
+    for (uint16_t i = 0; i < nb_rx; i++) {
+        if (pipe.own[i] == 0) {
+            // Per-packet path of rx_worker (only short / foreign here)
+            if (pkts[i]->pkt_len < rx_min_len)
+                c->short_pkts++;
+            else
+                c->external++;
+            continue;
+        }
+
+        const struct rx_pipe_pkt *p = &pipe.pkt[pipe.own[i] - 1];
+        bool crc_ok, prbs_ok;
+        if (likely(rx_pipe_verify(p, &crc_ok, &prbs_ok))) {
+            c->good++;
+        } else {
+            c->bad++;
+            if (!prbs_ok && p->check_len > 0)
+                c->bits += prbs_bit_errors(p->recv, p->exp, p->check_len);
+        }
+    }
+}
+
+// ==========================================
+// SETUP
+// ==========================================
+
+/**
+ * PRBS cache (malloc, no EAL). Content does not affect timing, so a
+ * splitmix64 fill replaces the PRBS-31 generation.
+ */
+static int setup_prbs_cache(void)
+{
+    size_t ext_size = (size_t)PRBS_CACHE_SIZE + (size_t)NUM_PRBS_BYTES + 8;
+    uint64_t *ext = malloc(ext_size);
+    if (!ext) {
+        fprintf(stderr, "bench: cannot allocate %zu MB PRBS cache\n", ext_size >> 20);
+        return -1;
+    }
+    for (size_t i = 0; i < ext_size / 8; i++)
+        ext[i] = splitmix64(i);
+    prbs_cache = (uint8_t *)ext;
+    return 0;
+}
+
+/**
+ * First port with RX VLANs; VMC_1 (splitmix) checks its own loopback
+ * traffic, VMC_2 the paired port's. nb_vls VL-IDs spread over the own set.
+ */
+static int setup_port(void)
+{
+    uint32_t own_total = 0;
+
+    rx_port = MAX_PORTS_CONFIG;
+    for (uint16_t p = 0; p < MAX_PORTS_CONFIG; p++) {
+        if (port_vlans[p].rx_vlan_count > 0) {
+            rx_port = p;
+            break;
+        }
+    }
+    if (rx_port == MAX_PORTS_CONFIG) {
+        fprintf(stderr, "bench: no port with RX VLANs in PORT_VLAN_CONFIG_INIT\n");
+        return -1;
+    }
+    src_port = RX_VERIFY_SPLITMIX ? rx_port : (rx_port ^ 1);
+
+    rx_pipe_own_map_build(own_vl_map, rx_port, src_port, RX_VERIFY_SPLITMIX);
+    for (uint32_t vl = 0; vl <= MAX_VL_ID; vl++)
+        own_total += rx_pipe_vl_is_own(own_vl_map, (uint16_t)vl);
+    if (own_total < nb_vls) {
+        fprintf(stderr, "bench: port %u has %u own VL-IDs, --vls %u\n", rx_port, own_total, nb_vls);
+        return -1;
+    }
+
+    uint32_t step = own_total / nb_vls, seen = 0, n = 0;
+    for (uint32_t vl = 0; vl <= MAX_VL_ID && n < nb_vls; vl++) {
+        if (!rx_pipe_vl_is_own(own_vl_map, (uint16_t)vl))
+            continue;
+        if (seen++ % step == 0)
+            vls[n++] = (uint16_t)vl;
+    }
+
+#if IMIX_ENABLED
+    rx_min_len = IMIX_MIN_PACKET_SIZE;
+#else
+    rx_min_len = RX_PIPE_PAYLOAD_OFF + SEQ_BYTES + NUM_PRBS_BYTES;
+#endif
+    return 0;
+}
+
+static int setup_pool(uint32_t pool_mb)
+{
+    pool_frames = (uint32_t)(((uint64_t)pool_mb << 20) / BENCH_FRAME_STRIDE);
+    pool_frames -= pool_frames % BURST_SIZE;
+
+    pool = aligned_alloc(64, (size_t)pool_frames * BENCH_FRAME_STRIDE);
+    mbufs = calloc(pool_frames, sizeof(struct rte_mbuf));
+    trace = malloc((size_t)pool_frames * sizeof(*trace));
+    if (!pool || !mbufs || !trace) {
+        fprintf(stderr, "bench: cannot allocate %u frame pool\n", pool_frames);
+        return -1;
+    }
+    for (uint32_t i = 0; i < pool_frames; i++) {
+        mbufs[i].buf_addr = pool + (size_t)i * BENCH_FRAME_STRIDE;
+        mbufs[i].data_off = 0;
+        mbufs[i].buf_len = BENCH_FRAME_STRIDE;
+        trace[i] = &mbufs[i];
+    }
+    return 0;
+}
+
+/**
+ * Frame i carries VL vls[i % nb_vls] and that VL's next sequence, with
+ * drops, swaps and corruption injected (see header)
+ */
+static void prepare_frames(uint16_t frame)
+{
+    static uint64_t next_seq[BENCH_MAX_VLS];
+    uint16_t prbs_len = frame > RX_PIPE_PAYLOAD_OFF + SEQ_BYTES
+                        ? frame - RX_PIPE_PAYLOAD_OFF - SEQ_BYTES : 0;
+    if (prbs_len > MAX_PRBS_BYTES)
+        prbs_len = MAX_PRBS_BYTES;
+
+    for (uint16_t v = 0; v < nb_vls; v++)
+        next_seq[v] = splitmix64(v) >> 40;
+
+    for (uint32_t i = 0; i < pool_frames; i++) {
+        struct rte_mbuf *m = &mbufs[i];
+        uint8_t *pkt = rte_pktmbuf_mtod(m, uint8_t *);
+        uint16_t v = i % nb_vls;
+
+        if (i % BENCH_DROP_EVERY == BENCH_DROP_EVERY - 1)
+            next_seq[v]++;
+        uint64_t seq = next_seq[v]++;
+
+        memset(pkt, 0, RX_PIPE_PAYLOAD_OFF);
+        pkt[0] = 0x03;
+        pkt[4] = (uint8_t)(vls[v] >> 8);
+        pkt[5] = (uint8_t)vls[v];
+        pkt[12] = 0x81;
+        pkt[13] = 0x00;
+        pkt[16] = 0x08;
+        pkt[17] = 0x00;
+        memcpy(pkt + RX_PIPE_PAYLOAD_OFF, &seq, sizeof(seq));
+
+        uint64_t off = (seq * (uint64_t)MAX_PRBS_BYTES) % (uint64_t)PRBS_CACHE_SIZE;
+        memcpy(pkt + RX_PIPE_PAYLOAD_OFF + SEQ_BYTES, prbs_cache + off, prbs_len);
+        m->pkt_len = frame;
+        m->data_len = frame;
+
+        bool corrupt = i % BENCH_CORRUPT_EVERY == BENCH_CORRUPT_EVERY - 1;
+        if (corrupt && prbs_len > RX_PIPE_PRBS_SKIP)
+            pkt[RX_PIPE_PAYLOAD_OFF + SEQ_BYTES + prbs_len - 1] ^= 0x10;
+#if RX_VERIFY_SPLITMIX
+        if (frame >= RX_PIPE_PAYLOAD_OFF + SPLITMIX_MIN_PAYLOAD) {
+            splitmix64_transform_payload(pkt + RX_PIPE_PAYLOAD_OFF);
+            if (corrupt && (i / BENCH_CORRUPT_EVERY) % 2 == 0)
+                pkt[RX_PIPE_PAYLOAD_OFF + SEQ_BYTES] ^= 0x01;
+        }
+#endif
+    }
+
+    // Swap with the VL's next packet (nb_vls frames later)
+    for (uint32_t i = 0; i < pool_frames; i++)
+        trace[i] = &mbufs[i];
+    for (uint32_t i = BENCH_SWAP_EVERY; i + nb_vls < pool_frames; i += BENCH_SWAP_EVERY) {
+        struct rte_mbuf *t = trace[i];
+        trace[i] = trace[i + nb_vls];
+        trace[i + nb_vls] = t;
+    }
+}
+
+// ==========================================
+// RUNNER
+// ==========================================
+
+enum bench_loop { LOOP_LEGACY, LOOP_STAGED, LOOP_STEERED };
+
+static double run_loop(enum bench_loop loop, struct bench_counters *out)
+{
+    double cpp[BENCH_REPS];
+
+    for (int r = 0; r < BENCH_REPS; r++) {
+        struct bench_counters c;
+        memset(&c, 0, sizeof(c));
+        memset(trackers, 0, sizeof(trackers));
+
+        uint64_t c0 = rte_rdtsc_precise();
+        for (uint32_t b = 0; b < pool_frames; b += BURST_SIZE) {
+            if (loop == LOOP_LEGACY)
+                legacy_burst(&trace[b], BURST_SIZE, &c);
+            else
+                staged_burst(&trace[b], BURST_SIZE, &c,
+                             loop == LOOP_STEERED ? own_vl_map : NULL);
+        }
+        cpp[r] = (double)(rte_rdtsc_precise() - c0) / pool_frames;
+        *out = c;
+    }
+    qsort(cpp, BENCH_REPS, sizeof(double), cmp_double);
+    return cpp[BENCH_REPS / 2];
+}
+
+static void run_frame(uint16_t frame)
+{
+    struct bench_counters lc, sc, xc;
+
+    prepare_frames(frame);
+
+    double legacy = run_loop(LOOP_LEGACY, &lc);
+    memcpy(trackers_ref, trackers, sizeof(trackers));
+    double staged = run_loop(LOOP_STAGED, &sc);
+    bool ok = memcmp(&lc, &sc, sizeof(lc)) == 0 &&
+              memcmp(trackers_ref, trackers, sizeof(trackers)) == 0;
+    double steered = run_loop(LOOP_STEERED, &xc);
+    ok = ok && memcmp(&lc, &xc, sizeof(lc)) == 0 &&
+         memcmp(trackers_ref, trackers, sizeof(trackers)) == 0;
+
+    printf("%5u %10.1f %10.1f %10.1f %8.2fx  good=%lu bad=%lu bits=%lu lost=%lu short=%lu  %s\n",
+           frame, legacy, staged, steered, legacy / steered,
+           sc.good, sc.bad, sc.bits, sc.lost, sc.short_pkts, ok ? "ok" : "MISMATCH");
+    printf("RX-PIPELINE-RESULT frame=%u legacy_cpp=%.1f staged_cpp=%.1f steered_cpp=%.1f good=%lu bad=%lu lost=%lu ok=%d\n",
+           frame, legacy, staged, steered, sc.good, sc.bad, sc.lost, ok);
+    fflush(stdout);
+}
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [--lcore N] [--vls N] [--pool-mb MB] [--frames LIST]\n", prog);
+    printf("  --lcore N      Pin to CPU N (recommended: isolated core)\n");
+    printf("  --vls N        Interleaved VL-IDs (default %d)\n", BENCH_VLS);
+    printf("  --pool-mb MB   Frame pool (default %d, keep > LLC)\n", BENCH_POOL_MB);
+    printf("  --frames LIST  Frame sizes (default 64,512,1518)\n");
+}
+
+int main(int argc, char **argv)
+{
+    uint16_t frames[BENCH_MAX_FRAMES] = { 64, 512, 1518 };
+    int nb_frames = 3;
+    uint32_t pool_mb = BENCH_POOL_MB;
+    int lcore = -1;
+
+    static const struct option opts[] = {
+        { "lcore",   required_argument, NULL, 'l' },
+        { "vls",     required_argument, NULL, 'v' },
+        { "pool-mb", required_argument, NULL, 'p' },
+        { "frames",  required_argument, NULL, 'f' },
+        { "help",    no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "l:v:p:f:h", opts, NULL)) != -1) {
+        switch (opt) {
+        case 'l': lcore = atoi(optarg); break;
+        case 'v': nb_vls = (uint16_t)atoi(optarg); break;
+        case 'p': pool_mb = (uint32_t)atoi(optarg); break;
+        case 'f':
+            nb_frames = 0;
+            for (char *tok = strtok(optarg, ","); tok && nb_frames < BENCH_MAX_FRAMES;
+                 tok = strtok(NULL, ",")) {
+                int f = atoi(tok);
+                if (f >= 64 && f <= BENCH_FRAME_STRIDE)
+                    frames[nb_frames++] = (uint16_t)f;
+            }
+            break;
+        default:  usage(argv[0]); return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (nb_vls == 0 || nb_vls > BENCH_MAX_VLS || nb_frames == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (lcore >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(lcore, &set);
+        if (sched_setaffinity(0, sizeof(set), &set) != 0)
+            fprintf(stderr, "bench: cannot pin to CPU %d, continuing unpinned\n", lcore);
+    }
+
+    tsc_hz = calibrate_tsc_hz();
+    if (setup_port() < 0 || setup_prbs_cache() < 0 || setup_pool(pool_mb) < 0)
+        return 1;
+
+    printf("=== RX verification pipeline: port %u (src %u), %u VL-IDs, %u frames/pass ===\n",
+           rx_port, src_port, nb_vls, pool_frames);
+    printf("TSC: %.3f GHz, splitmix: %d, IMIX: %d, min RX length: %u B, reps: %d (median)\n\n",
+           tsc_hz / 1e9, RX_VERIFY_SPLITMIX, IMIX_ENABLED, rx_min_len, BENCH_REPS);
+    printf("%5s %10s %10s %10s %9s\n", "frame", "legacy", "staged", "steered", "speedup");
+    printf("%5s %10s %10s %10s\n", "", "cyc/pkt", "cyc/pkt", "cyc/pkt");
+
+    for (int i = 0; i < nb_frames; i++)
+        run_frame(frames[i]);
+    return 0;
+}
@@ -0,0 +1,305 @@
+/**
+ * Sequence tracker contention benchmark
+ *
+ * Standalone binary (make seq-tracker-bench): links only vl_seq_tracker.c,
+ * no DPDK. N fanout workers (1..8) feed one raw port's VL-IDs the way
+ * PACKET_FANOUT spreads them: every VL-ID's sequence is interleaved over
+ * all workers, so each VL is written by every worker.
+ *
+ *   atomic  - previous scheme: one shared entry per VL, atomic_fetch_add
+ *             on the count and CAS loops on min / max
+ *   sharded - vl_seq_update: one shard per worker, plain stores, merged
+ *             by vl_seq_read_port
+ *
+ * The traces drop every BENCH_DROP_EVERY-th sequence and swap adjacent
+ * packets of a VL every BENCH_SWAP_EVERY packets (inside one worker), so
+ * both trackers must report exactly the injected loss; the sharded one
+ * also reports the swaps as reordered. Traces are built before timing.
+ *
+ * Usage: dpdk_app-seq-bench [--workers LIST] [--packets N] [--vls N] [--no-pin]
+ *   --workers  comma separated worker counts (default 1,2,4,8)
+ *   --packets  packets per worker (default 4000000)
+ *   --vls      VL-IDs on the port (default 128, Port 12's DPDK external set)
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "vl_seq_tracker.h"
+
+#define BENCH_MAX_WORKERS VL_SEQ_MAX_SHARDS
+#define BENCH_VL_START    4291
+#define BENCH_DROP_EVERY  997
+#define BENCH_SWAP_EVERY  64
+#define BENCH_REPS        3
+
+// Previous scheme (raw_socket_port.c before the tracker)
+struct atomic_vl_state {
+    _Atomic uint64_t min_seq;
+    _Atomic uint64_t max_seq;
+    _Atomic uint64_t rx_count;
+    _Atomic bool initialized;
+};
+
+static struct atomic_vl_state atomic_vls[VL_SEQ_MAX_VLS];
+
+struct trace_pkt {
+    uint16_t vl_id;
+    uint64_t seq;
+};
+
+struct worker {
+    pthread_t thread;
+    int id;
+    int cpu;
+    bool sharded;
+    struct trace_pkt *trace;
+    uint32_t len;
+};
+
+static pthread_barrier_t start_barrier;
+static uint16_t bench_vls = 128;
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static inline void atomic_update(uint16_t vl_id, uint64_t seq)
+{
+    struct atomic_vl_state *vs = &atomic_vls[vl_id - BENCH_VL_START];
+
+    atomic_fetch_add(&vs->rx_count, 1);
+
+    if (!atomic_load(&vs->initialized)) {
+        uint64_t expected = UINT64_MAX;
+        if (atomic_compare_exchange_strong(&vs->min_seq, &expected, seq))
+            atomic_store(&vs->initialized, true);
+    }
+
+    uint64_t old_max = atomic_load(&vs->max_seq);
+    while (seq > old_max) {
+        if (atomic_compare_exchange_weak(&vs->max_seq, &old_max, seq))
+            break;
+    }
+
+    uint64_t old_min = atomic_load(&vs->min_seq);
+    while (seq < old_min) {
+        if (atomic_compare_exchange_weak(&vs->min_seq, &old_min, seq))
+            break;
+    }
+}
+
+static void atomic_reset(void)
+{
+    for (int i = 0; i < VL_SEQ_MAX_VLS; i++) {
+        atomic_store(&atomic_vls[i].min_seq, UINT64_MAX);
+        atomic_store(&atomic_vls[i].max_seq, 0);
+        atomic_store(&atomic_vls[i].rx_count, 0);
+        atomic_store(&atomic_vls[i].initialized, false);
+    }
+}
+
+static uint64_t atomic_lost(uint64_t *rx_total)
+{
+    uint64_t lost = 0;
+    *rx_total = 0;
+    for (int i = 0; i < bench_vls; i++) {
+        if (!atomic_load(&atomic_vls[i].initialized))
+            continue;
+        uint64_t span = atomic_load(&atomic_vls[i].max_seq) - atomic_load(&atomic_vls[i].min_seq) + 1;
+        uint64_t rx = atomic_load(&atomic_vls[i].rx_count);
+        *rx_total += rx;
+        if (span > rx)
+            lost += span - rx;
+    }
+    return lost;
+}
+
+/*
+ * Worker w of nw gets sequences w, w + nw, w + 2nw, ... of every VL,
+ * VLs round-robin. Returns the trace length; drops / swaps are added to
+ * the injected totals.
+ */
+static uint32_t build_trace(struct worker *wk, int nw, uint32_t packets,
+                            uint64_t *drops, uint64_t *swaps)
+{
+    uint32_t n = 0;
+
+    wk->trace = malloc(sizeof(*wk->trace) * packets);
+    if (!wk->trace)
+        return 0;
+
+    for (uint32_t i = 0; i < packets; i++) {
+        uint16_t vl = i % bench_vls;
+        uint64_t seq = (uint64_t)(i / bench_vls) * nw + wk->id;
+        // Keep both ends of every VL so the span is the full range
+        bool inner = seq > 0 && i + bench_vls < packets;
+        if (inner && seq % BENCH_DROP_EVERY == 0) {
+            (*drops)++;
+            continue;
+        }
+        wk->trace[n].vl_id = BENCH_VL_START + vl;
+        wk->trace[n].seq = seq;
+        n++;
+    }
+
+    // Swap this VL's packet with its next one (bench_vls entries later)
+    for (uint32_t i = BENCH_SWAP_EVERY; i + bench_vls < n; i += BENCH_SWAP_EVERY * bench_vls) {
+        if (wk->trace[i].vl_id != wk->trace[i + bench_vls].vl_id)
+            continue;
+        struct trace_pkt t = wk->trace[i];
+        wk->trace[i] = wk->trace[i + bench_vls];
+        wk->trace[i + bench_vls] = t;
+        (*swaps)++;
+    }
+
+    wk->len = n;
+    return n;
+}
+
+static void *worker_main(void *arg)
+{
+    struct worker *wk = arg;
+
+    if (wk->cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(wk->cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+
+    pthread_barrier_wait(&start_barrier);
+
+    if (wk->sharded) {
+        for (uint32_t i = 0; i < wk->len; i++)
+            vl_seq_update(0, wk->id, wk->trace[i].vl_id, wk->trace[i].seq);
+    } else {
+        for (uint32_t i = 0; i < wk->len; i++)
+            atomic_update(wk->trace[i].vl_id, wk->trace[i].seq);
+    }
+    return NULL;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void run(int nw, uint32_t packets, bool pin)
+{
+    struct worker wk[BENCH_MAX_WORKERS];
+    uint64_t drops = 0, swaps = 0, total = 0;
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+
+    memset(wk, 0, sizeof(wk));
+    for (int w = 0; w < nw; w++) {
+        wk[w].id = w;
+        wk[w].cpu = (pin && ncpu > 0) ? (int)(w % ncpu) : -1;
+        total += build_trace(&wk[w], nw, packets, &drops, &swaps);
+    }
+
+    for (int mode = 0; mode < 2; mode++) {
+        bool sharded = mode == 1;
+        double mpps[BENCH_REPS];
+        uint64_t lost = 0, rx = 0, reordered = 0;
+
+        for (int r = 0; r < BENCH_REPS; r++) {
+            if (sharded)
+                vl_seq_reset();
+            else
+                atomic_reset();
+
+            pthread_barrier_init(&start_barrier, NULL, nw + 1);
+            for (int w = 0; w < nw; w++) {
+                wk[w].sharded = sharded;
+                pthread_create(&wk[w].thread, NULL, worker_main, &wk[w]);
+            }
+            pthread_barrier_wait(&start_barrier);
+            double t0 = now_s();
+            for (int w = 0; w < nw; w++)
+                pthread_join(wk[w].thread, NULL);
+            double dt = now_s() - t0;
+            pthread_barrier_destroy(&start_barrier);
+
+            mpps[r] = total / dt / 1e6;
+        }
+        qsort(mpps, BENCH_REPS, sizeof(double), cmp_double);
+
+        if (sharded) {
+            struct vl_seq_totals t;
+            vl_seq_read_port(0, &t);
+            lost = t.lost;
+            rx = t.rx;
+            reordered = t.reordered;
+        } else {
+            lost = atomic_lost(&rx);
+        }
+
+        bool ok = lost == drops && rx == total && (!sharded || reordered == swaps);
+        printf("  %-8s workers=%d  %8.1f Mpkt/s  rx=%lu lost=%lu (injected %lu)",
+               sharded ? "sharded" : "atomic", nw, mpps[BENCH_REPS / 2], rx, lost, drops);
+        if (sharded)
+            printf(" reordered=%lu (injected %lu)", reordered, swaps);
+        printf("  %s\n", ok ? "ok" : "MISMATCH");
+        printf("SEQ-TRACKER-RESULT mode=%s workers=%d mpps=%.2f lost=%lu injected_lost=%lu ok=%d\n",
+               sharded ? "sharded" : "atomic", nw, mpps[BENCH_REPS / 2], lost, drops, ok);
+    }
+
+    for (int w = 0; w < nw; w++)
+        free(wk[w].trace);
+}
+
+int main(int argc, char *argv[])
+{
+    int workers[BENCH_MAX_WORKERS] = {1, 2, 4, 8};
+    int nb_workers = 4;
+    uint32_t packets = 4000000;
+    bool pin = true;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+            nb_workers = 0;
+            for (char *tok = strtok(argv[++i], ","); tok && nb_workers < BENCH_MAX_WORKERS;
+                 tok = strtok(NULL, ",")) {
+                int w = atoi(tok);
+                if (w >= 1 && w <= BENCH_MAX_WORKERS)
+                    workers[nb_workers++] = w;
+            }
+        } else if (strcmp(argv[i], "--packets") == 0 && i + 1 < argc) {
+            packets = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--vls") == 0 && i + 1 < argc) {
+            bench_vls = (uint16_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--no-pin") == 0) {
+            pin = false;
+        } else {
+            fprintf(stderr, "Usage: %s [--workers 1,2,4,8] [--packets N] [--vls N] [--no-pin]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (bench_vls == 0 || bench_vls > VL_SEQ_MAX_VLS || packets < 2u * bench_vls) {
+        fprintf(stderr, "--vls must be 1..%d and --packets at least 2 x vls\n", VL_SEQ_MAX_VLS);
+        return 2;
+    }
+
+    vl_seq_clear();
+    vl_seq_add_range(0, BENCH_VL_START, bench_vls);
+
+    printf("=== Sequence tracker contention: %u VL-IDs, %u packets per worker, %ld CPUs ===\n",
+           bench_vls, packets, sysconf(_SC_NPROCESSORS_ONLN));
+    for (int i = 0; i < nb_workers; i++)
+        run(workers[i], packets, pin);
+    return 0;
+}
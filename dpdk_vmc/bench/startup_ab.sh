@@ -0,0 +1,97 @@
+#!/bin/bash
+#
+# Startup time A/B on the SW harness (net_ring ports 0..3): the same binary
+# is run alternately with the parallel init and with --serial-init, and the
+# STARTUP-RESULT line (time to ready, time to first packet, every init step)
+# of each run is appended to a CSV. Medians per mode are printed at the end.
+#
+# Usage: bench/startup_ab.sh [-n RUNS] [-d SECONDS] [-l LCORES] [-o OUT.csv]
+#
+#   -n  runs per mode (default 5, alternated to spread page cache / hugepage
+#       state over both modes)
+#   -d  HARNESS_DURATION of each run; the result line is printed within the
+#       first second after the first packet
+#
+# Only the steps both modes have are compared directly (eal_init,
+# port_config, ...); prbs_cache / raw_socket (serial) correspond to the
+# prbs_portN / raw_socket tasks plus init_join (parallel).
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+RUNS=5
+DURATION=3
+LCORES="0-39"
+OUT="bench/startup_results.csv"
+
+usage() {
+    sed -n '3,18p' "$0" | sed 's/^# \{0,1\}//'
+    exit 2
+}
+
+while getopts "n:d:l:o:h" opt; do
+    case $opt in
+        n) RUNS=$OPTARG ;;
+        d) DURATION=$OPTARG ;;
+        l) LCORES=$OPTARG ;;
+        o) OUT=$OPTARG ;;
+        *) usage ;;
+    esac
+done
+
+make -B SW_HARNESS=1 HARNESS_DURATION="$DURATION" STARTUP_PARALLEL=1 > /dev/null
+
+echo "mode,run,step,ms" > "$OUT"
+
+for run in $(seq 1 "$RUNS"); do
+    for mode in parallel serial; do
+        args=""
+        [ "$mode" = "serial" ] && args="--serial-init"
+
+        log=$(mktemp)
+        sudo stdbuf -oL ./dpdk_app -l "$LCORES" -n 4 --no-pci $args > "$log" 2>&1 || true
+        line=$(grep '^STARTUP-RESULT' "$log" | tail -1 || true)
+        rm -f "$log"
+
+        if [ -z "$line" ]; then
+            echo "  run $run $mode: no STARTUP-RESULT (no packet sent within ${DURATION}s?)"
+            continue
+        fi
+        echo "  run $run $mode: $(echo "$line" | cut -d' ' -f3-4)"
+
+        echo "$line" | awk -v run="$run" '{
+            for (i = 2; i <= NF; i++) {
+                split($i, kv, "=")
+                if (kv[1] == "mode") { mode = kv[2]; continue }
+                sub(/_ms$/, "", kv[1])
+                print mode "," run "," kv[1] "," kv[2]
+            }
+        }' >> "$OUT"
+    done
+done
+
+echo "Results: $OUT"
+echo
+echo "Median ms per step:"
+tail -n +2 "$OUT" | sort -t, -k3,3 -k1,1 -k4,4n | awk -F, '
+    function flush() {
+        if (n == 0) return
+        med = (n % 2) ? v[(n + 1) / 2] : (v[n / 2] + v[n / 2 + 1]) / 2
+        m[step, mode] = med
+        if (!(step in seen)) { seen[step] = 1; order[++nsteps] = step }
+        n = 0
+    }
+    { if ($3 != step || $1 != mode) { flush(); step = $3; mode = $1 } v[++n] = $4 }
+    END {
+        flush()
+        printf "  %-24s %10s %10s %8s\n", "step", "serial", "parallel", "delta"
+        for (i = 1; i <= nsteps; i++) {
+            s = order[i]
+            ps = ((s, "serial") in m) ? sprintf("%.1f", m[s, "serial"]) : "-"
+            pp = ((s, "parallel") in m) ? sprintf("%.1f", m[s, "parallel"]) : "-"
+            d = ""
+            if (((s, "serial") in m) && ((s, "parallel") in m))
+                d = sprintf("%+.1f", m[s, "parallel"] - m[s, "serial"])
+            printf "  %-24s %10s %10s %8s\n", s, ps, pp, d
+        }
+    }'
@@ -0,0 +1,337 @@
+/**
+ * TX sequence allocation benchmark
+ *
+ * Standalone binary (make tx-seq-bench): no DPDK, no NIC. One thread per
+ * TX queue (1..8 queues) runs tx_worker's per-packet sequence work over
+ * its own VL-ID range (queue q sends [3 + q*vls, 3 + (q+1)*vls), as the
+ * default tx_vl_ids), writes the sequence into an mbuf stand-in and
+ * commits it after the "send"; every BENCH_FAIL_EVERY-th send fails (TX
+ * queue full) and is not committed.
+ *
+ *   locked  - per-port table indexed by VL-ID, sequence taken under the
+ *             VL's spinlock (get_next_tx_sequence before ownership)
+ *   table   - same per-port table, unlocked peek / commit (previous send
+ *             path, correct only because each VL has one writer)
+ *   private - ownership resolved at start: the queue's own array indexed
+ *             by VL offset, peek / commit, no lock (tx_vl_seq_local)
+ *   atomic  - TX_VL_SHARED_SEQ path: fetch-add on the port table, a
+ *             failed send leaves a gap
+ *
+ * Cycles per packet are thread CPU time x TSC rate, so the result holds
+ * with fewer CPUs than queues. Every mode must end with the same per-VL
+ * sequences (atomic: plus the failed sends).
+ *
+ * Usage: dpdk_app-tx-seq-bench [--queues LIST] [--packets N] [--vls N] [--mbufs N] [--no-pin]
+ *   --queues   comma separated TX queue counts (default 1,4)
+ *   --packets  packets per queue (default 20000000)
+ *   --vls      VL-IDs per queue (default 128, VL_RANGE_SIZE_PER_QUEUE)
+ *   --mbufs    mbuf stand-ins per queue, 2 KB each (default 1024)
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <x86intrin.h>
+
+#define BENCH_MAX_QUEUES 8
+#define BENCH_MAX_VL_ID  4800       // MAX_VL_ID
+#define BENCH_VL_BASE    3          // tx_vl_ids[0] of the default ports
+#define BENCH_MBUF_SIZE  2048
+#define BENCH_FAIL_EVERY 509
+#define BENCH_REPS       3
+#define CACHE_LINE       64
+
+enum bench_mode { MODE_LOCKED, MODE_TABLE, MODE_PRIVATE, MODE_ATOMIC, MODE_COUNT };
+static const char *mode_names[MODE_COUNT] = { "locked", "table", "private", "atomic" };
+
+// Previous per-port layout (tx_rx_manager.c before ownership)
+struct tx_vl_sequence_locked {
+    uint64_t sequence[BENCH_MAX_VL_ID + 1];
+    volatile int locks[BENCH_MAX_VL_ID + 1];
+};
+
+static struct tx_vl_sequence_locked *port_table;
+
+struct queue_thread {
+    pthread_t thread;
+    int queue;
+    int cpu;
+    enum bench_mode mode;
+    uint32_t packets;
+    double cpu_s;
+    uint64_t *final_seq;    // [bench_vls], per VL of the queue after the run
+    uint64_t sink;
+};
+
+static pthread_barrier_t start_barrier;
+static uint16_t bench_vls = 128;
+static uint32_t bench_mbufs = 1024;
+
+static inline void spin_lock(volatile int *l)
+{
+    while (__atomic_exchange_n(l, 1, __ATOMIC_ACQUIRE))
+        while (*l)
+            __builtin_ia32_pause();
+}
+
+static inline void spin_unlock(volatile int *l)
+{
+    __atomic_store_n(l, 0, __ATOMIC_RELEASE);
+}
+
+static double thread_cpu_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double tsc_ghz(void)
+{
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    uint64_t c0 = __rdtsc();
+    do {
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+    } while ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec) < 100e6);
+    uint64_t c1 = __rdtsc();
+    return (c1 - c0) / ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec));
+}
+
+static void *queue_thread_main(void *arg)
+{
+    struct queue_thread *qt = arg;
+    const uint16_t vl_start = BENCH_VL_BASE + (uint16_t)(qt->queue * bench_vls);
+    uint64_t *own_seq = NULL;
+    uint8_t *mbufs;
+
+    if (qt->cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(qt->cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+
+    // Queue's own state, first touched by its thread
+    mbufs = aligned_alloc(CACHE_LINE, (size_t)bench_mbufs * BENCH_MBUF_SIZE);
+    own_seq = aligned_alloc(CACHE_LINE, ((bench_vls * sizeof(uint64_t)) + CACHE_LINE - 1) /
+                                            CACHE_LINE * CACHE_LINE);
+    if (!mbufs || !own_seq) {
+        fprintf(stderr, "queue %d: allocation failed\n", qt->queue);
+        exit(1);
+    }
+    memset(mbufs, 0, (size_t)bench_mbufs * BENCH_MBUF_SIZE);
+    memset(own_seq, 0, bench_vls * sizeof(uint64_t));
+
+    pthread_barrier_wait(&start_barrier);
+    double t0 = thread_cpu_s();
+
+    uint16_t off = 0;
+    uint32_t mbuf_idx = 0;
+    uint64_t sink = 0;
+    for (uint32_t i = 0; i < qt->packets; i++) {
+        uint16_t vl = vl_start + off;
+        uint64_t seq;
+
+        switch (qt->mode) {
+        case MODE_LOCKED:
+            spin_lock(&port_table->locks[vl]);
+            seq = port_table->sequence[vl];
+            spin_unlock(&port_table->locks[vl]);
+            break;
+        case MODE_TABLE:
+            seq = (vl <= BENCH_MAX_VL_ID) ? port_table->sequence[vl] : 0;
+            break;
+        case MODE_PRIVATE:
+            seq = own_seq[off];
+            break;
+        default:
+            seq = __atomic_fetch_add(&port_table->sequence[vl], 1, __ATOMIC_RELAXED);
+            break;
+        }
+
+        // Header + sequence into the mbuf, as build_packet / fill_payload
+        uint8_t *m = mbufs + (size_t)mbuf_idx * BENCH_MBUF_SIZE;
+        m[4] = (uint8_t)(vl >> 8);
+        m[5] = (uint8_t)vl;
+        memcpy(m + 46, &seq, sizeof(seq));
+        if (++mbuf_idx == bench_mbufs)
+            mbuf_idx = 0;
+
+        bool sent = (i % BENCH_FAIL_EVERY) != BENCH_FAIL_EVERY - 1;
+        if (sent) {
+            switch (qt->mode) {
+            case MODE_LOCKED:
+                spin_lock(&port_table->locks[vl]);
+                port_table->sequence[vl]++;
+                spin_unlock(&port_table->locks[vl]);
+                break;
+            case MODE_TABLE:
+                if (vl <= BENCH_MAX_VL_ID)
+                    port_table->sequence[vl]++;
+                break;
+            case MODE_PRIVATE:
+                own_seq[off]++;
+                break;
+            default:
+                break;
+            }
+            sink += m[46];
+        }
+
+        if (++off >= bench_vls)
+            off = 0;
+    }
+
+    qt->cpu_s = thread_cpu_s() - t0;
+    qt->sink = sink;
+
+    for (uint16_t v = 0; v < bench_vls; v++)
+        qt->final_seq[v] = (qt->mode == MODE_PRIVATE) ? own_seq[v] : port_table->sequence[vl_start + v];
+
+    free(own_seq);
+    free(mbufs);
+    return NULL;
+}
+
+/* Expected final sequence of VL offset v: committed (or taken, atomic) sends */
+static uint64_t expected_seq(uint16_t v, uint32_t packets, bool count_failed)
+{
+    uint64_t n = 0;
+    for (uint32_t i = v; i < packets; i += bench_vls)
+        if (count_failed || (i % BENCH_FAIL_EVERY) != BENCH_FAIL_EVERY - 1)
+            n++;
+    return n;
+}
+
+/* Mean cycles per packet over the queues of one run */
+static double run_queues(int nb_queues, enum bench_mode mode, uint32_t packets, bool pin,
+                         double ghz, bool *ok)
+{
+    struct queue_thread qts[BENCH_MAX_QUEUES];
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+
+    memset(port_table, 0, sizeof(*port_table));
+
+    pthread_barrier_init(&start_barrier, NULL, nb_queues);
+    for (int q = 0; q < nb_queues; q++) {
+        qts[q] = (struct queue_thread){
+            .queue = q,
+            .cpu = pin ? (int)(q % ncpu) : -1,
+            .mode = mode,
+            .packets = packets,
+            .final_seq = calloc(bench_vls, sizeof(uint64_t)),
+        };
+        if (!qts[q].final_seq) {
+            fprintf(stderr, "allocation failed\n");
+            exit(1);
+        }
+        pthread_create(&qts[q].thread, NULL, queue_thread_main, &qts[q]);
+    }
+
+    double cycles = 0;
+    for (int q = 0; q < nb_queues; q++) {
+        pthread_join(qts[q].thread, NULL);
+        for (uint16_t v = 0; v < bench_vls; v++) {
+            if (qts[q].final_seq[v] != expected_seq(v, packets, mode == MODE_ATOMIC)) {
+                *ok = false;
+                break;
+            }
+        }
+        cycles += qts[q].cpu_s * ghz * 1e9 / packets;
+        free(qts[q].final_seq);
+    }
+    pthread_barrier_destroy(&start_barrier);
+    return cycles / nb_queues;
+}
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [--queues LIST] [--packets N] [--vls N] [--mbufs N] [--no-pin]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    int queue_counts[BENCH_MAX_QUEUES];
+    int nb_counts = 0;
+    uint32_t packets = 20000000;
+    bool pin = true;
+    const char *queues_arg = "1,4";
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--queues") && i + 1 < argc)
+            queues_arg = argv[++i];
+        else if (!strcmp(argv[i], "--packets") && i + 1 < argc)
+            packets = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--vls") && i + 1 < argc)
+            bench_vls = (uint16_t)strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--mbufs") && i + 1 < argc)
+            bench_mbufs = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--no-pin"))
+            pin = false;
+        else {
+            usage(argv[0]);
+            return !strcmp(argv[i], "--help") ? 0 : 2;
+        }
+    }
+
+    char buf[128];
+    snprintf(buf, sizeof(buf), "%s", queues_arg);
+    for (char *tok = strtok(buf, ","); tok && nb_counts < BENCH_MAX_QUEUES; tok = strtok(NULL, ",")) {
+        int n = atoi(tok);
+        if (n >= 1 && n <= BENCH_MAX_QUEUES)
+            queue_counts[nb_counts++] = n;
+    }
+    if (nb_counts == 0 || bench_vls == 0 || bench_mbufs == 0 ||
+        BENCH_VL_BASE + BENCH_MAX_QUEUES * bench_vls > BENCH_MAX_VL_ID + 1) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    port_table = aligned_alloc(CACHE_LINE, sizeof(*port_table));
+    if (!port_table) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+
+    double ghz = tsc_ghz();
+    printf("TX sequence allocation: %u packets/queue, %u VL-IDs/queue, %u mbufs, %.2f GHz TSC, "
+           "%ld CPUs, %s\n", packets, bench_vls, bench_mbufs, ghz,
+           sysconf(_SC_NPROCESSORS_ONLN), pin ? "pinned" : "unpinned");
+    printf("%-7s %9s %9s %9s %9s %14s %14s\n", "queues", "locked", "table", "private", "atomic",
+           "saved/locked", "saved/table");
+
+    bool ok = true;
+    for (int c = 0; c < nb_counts; c++) {
+        int n = queue_counts[c];
+        double best[MODE_COUNT];
+        for (int m = 0; m < MODE_COUNT; m++)
+            best[m] = 1e30;
+        for (int r = 0; r < BENCH_REPS; r++) {
+            for (int m = 0; m < MODE_COUNT; m++) {
+                double cyc = run_queues(n, (enum bench_mode)m, packets, pin, ghz, &ok);
+                if (cyc < best[m])
+                    best[m] = cyc;
+            }
+        }
+        double saved_locked = best[MODE_LOCKED] - best[MODE_PRIVATE];
+        double saved_table = best[MODE_TABLE] - best[MODE_PRIVATE];
+        printf("%-7d %9.2f %9.2f %9.2f %9.2f %14.2f %14.2f\n", n, best[MODE_LOCKED],
+               best[MODE_TABLE], best[MODE_PRIVATE], best[MODE_ATOMIC], saved_locked, saved_table);
+        printf("TX-SEQ-RESULT queues=%d", n);
+        for (int m = 0; m < MODE_COUNT; m++)
+            printf(" %s_cyc=%.2f", mode_names[m], best[m]);
+        printf(" saved_vs_locked=%.2f saved_vs_table=%.2f\n", saved_locked, saved_table);
+    }
+    printf("TX-SEQ-RESULT ok=%d\n", ok ? 1 : 0);
+
+    free(port_table);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+#ifndef ADAPTIVE_POLL_H
+#define ADAPTIVE_POLL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <rte_common.h>
+#include <rte_cycles.h>
+#include <rte_pause.h>
+#include <rte_ethdev.h>
+#include <rte_power_intrinsics.h>
+#include "config.h"
+#include "port.h"
+
+// ==========================================
+// ADAPTIVE POLLING (POWER-AWARE IDLE)
+// ==========================================
+// One struct adaptive_poll per worker queue, registered and used only by the
+// worker's own thread. After every RX poll the worker reports how many
+// packets it got; the empty-poll streak selects the idle action:
+//   streak < PAUSE_THRESH    spin (nothing)
+//   streak < MONITOR_THRESH  rte_pause
+//   streak < INTR_THRESH     rte_power_monitor on the queue's next RX
+//                            descriptor (UMWAIT), deadline MONITOR_US
+//   otherwise                RX interrupt + rte_epoll_wait, INTR_TIMEOUT_MS
+// The level is capped per port (FAST / MID / SLOW) and drops to the next
+// lower level the CPU / PMD supports. The first packet resets it to spin.
+//
+// TX pacing uses adaptive_poll_wait_until: gaps longer than TX_MIN_SLEEP_NS
+// sleep in TPAUSE (rte_power_pause) until TX_GUARD_NS before the deadline,
+// the rest is spun as before.
+//
+// Stats per worker: share of the core spent asleep (utilisation saved),
+// sleeps per level, and the wake latency the worker can see:
+//   RX: sleep return -> first non-empty burst (software wake path)
+//   TX: send time - scheduled time after a TPAUSE (pacing overshoot)
+// C-state exit / interrupt delivery before the sleep returns is not visible
+// here; the latency test run with ADAPTIVE_POLL=1 vs 0 gives it end to end.
+
+#if ADAPTIVE_POLL_ENABLED
+
+#define ADAPTIVE_POLL_NB_LEVELS (ADAPTIVE_POLL_LEVEL_INTR + 1)
+
+enum adaptive_poll_role
+{
+    ADAPTIVE_POLL_RX = 0,
+    ADAPTIVE_POLL_TX,
+    ADAPTIVE_POLL_PTP,
+    ADAPTIVE_POLL_LATENCY,
+    ADAPTIVE_POLL_EXT_TX,
+    ADAPTIVE_POLL_FWD,
+};
+
+struct adaptive_poll
+{
+    // Hot state (worker thread only)
+    uint32_t empty_streak;
+    uint8_t level;
+    uint8_t max_level;          // Port cap, lowered if monitor / interrupt unsupported
+    uint8_t last_sleep;         // Level of the sleep before the current poll, 0 = none
+    bool monitor_ok;
+    bool intr_ok;               // Queue's interrupt is in this thread's epoll set
+    bool tpause_ok;
+    uint16_t port_id;
+    uint16_t queue_id;
+    uint64_t sleep_end_tsc;
+    uint64_t monitor_cycles;
+    uint64_t tx_min_sleep_cycles;
+    uint64_t tx_guard_cycles;
+
+    // Stats (single writer)
+    uint8_t role;
+    uint64_t start_tsc;
+    uint64_t polls;
+    uint64_t empty_polls;
+    uint64_t sleeps[ADAPTIVE_POLL_NB_LEVELS];
+    uint64_t idle_cycles[ADAPTIVE_POLL_NB_LEVELS];
+    uint64_t wakes[ADAPTIVE_POLL_NB_LEVELS];        // Sleeps followed by data / TX send
+    uint64_t wake_cycles_sum[ADAPTIVE_POLL_NB_LEVELS];
+    uint64_t wake_cycles_max[ADAPTIVE_POLL_NB_LEVELS];
+    uint64_t intr_timeouts;     // epoll returned without an interrupt
+} __rte_cache_aligned;
+
+/**
+ * Per-port level cap (FAST / MID / SLOW class from config.h)
+ */
+uint8_t adaptive_poll_port_max_level(uint16_t port_id);
+
+/**
+ * Request RX queue interrupts in the port configuration when the port's
+ * cap allows the interrupt level (call before rte_eth_dev_configure)
+ */
+void adaptive_poll_port_conf(uint16_t port_id, struct rte_eth_conf *port_conf);
+
+/**
+ * Configure failed with RX interrupts: caller retries without them
+ * @return true if interrupts were requested (and are now cleared)
+ */
+bool adaptive_poll_port_conf_fallback(uint16_t port_id, struct rte_eth_conf *port_conf);
+
+/**
+ * Register a worker queue (call from the worker's own thread: the RX
+ * interrupt goes into that thread's epoll set)
+ * @param max_level cap, normally adaptive_poll_port_max_level(port_id)
+ * @return NULL when all ADAPTIVE_POLL_MAX_WORKERS slots are used (worker spins)
+ */
+struct adaptive_poll *adaptive_poll_register(uint8_t role, uint16_t port_id, uint16_t queue_id,
+                                             uint8_t max_level);
+
+/**
+ * Remove the queue interrupt from the thread's epoll set (worker exit)
+ */
+void adaptive_poll_release(struct adaptive_poll *ap);
+
+/**
+ * Empty-poll streak reached the pause threshold: pause / monitor / interrupt
+ */
+void adaptive_poll_sleep(struct adaptive_poll *ap);
+
+/**
+ * Utilisation saved and wake latency per worker (call once per second)
+ */
+void adaptive_poll_print_stats(void);
+
+/**
+ * Zero the counters (snapshot, workers keep writing)
+ */
+void adaptive_poll_reset_stats(void);
+
+// Report a poll result (after every RX poll or group of polls)
+static inline void adaptive_poll_update(struct adaptive_poll *ap, uint32_t nb_rx)
+{
+    if (unlikely(ap == NULL))
+        return;
+
+    ap->polls++;
+    if (likely(nb_rx > 0)) {
+        if (unlikely(ap->last_sleep != 0)) {
+            uint64_t wake = rte_rdtsc() - ap->sleep_end_tsc;
+            uint8_t l = ap->last_sleep;
+            ap->wakes[l]++;
+            ap->wake_cycles_sum[l] += wake;
+            if (wake > ap->wake_cycles_max[l])
+                ap->wake_cycles_max[l] = wake;
+            ap->last_sleep = 0;
+        }
+        ap->empty_streak = 0;
+        ap->level = ADAPTIVE_POLL_LEVEL_SPIN;
+        return;
+    }
+
+    ap->empty_polls++;
+    if (++ap->empty_streak >= ADAPTIVE_POLL_PAUSE_THRESH)
+        adaptive_poll_sleep(ap);
+}
+
+/**
+ * Wait until 'deadline' (TSC), sleeping in TPAUSE for long gaps
+ * @param now current TSC
+ * @return TSC after the wait
+ */
+static inline uint64_t adaptive_poll_wait_until(struct adaptive_poll *ap, uint64_t now,
+                                                uint64_t deadline)
+{
+    if (now >= deadline)
+        return now;
+
+    bool slept = false;
+    if (ap != NULL && ap->tpause_ok && deadline - now > ap->tx_min_sleep_cycles) {
+        rte_power_pause(deadline - ap->tx_guard_cycles);
+        uint64_t woke = rte_get_tsc_cycles();
+        ap->sleeps[ADAPTIVE_POLL_LEVEL_MONITOR]++;
+        ap->idle_cycles[ADAPTIVE_POLL_LEVEL_MONITOR] += woke - now;
+        now = woke;
+        slept = true;
+    }
+
+    while (now < deadline) {
+        rte_pause();
+        now = rte_get_tsc_cycles();
+    }
+
+    if (slept) {
+        uint64_t late = now - deadline;
+        ap->wakes[ADAPTIVE_POLL_LEVEL_MONITOR]++;
+        ap->wake_cycles_sum[ADAPTIVE_POLL_LEVEL_MONITOR] += late;
+        if (late > ap->wake_cycles_max[ADAPTIVE_POLL_LEVEL_MONITOR])
+            ap->wake_cycles_max[ADAPTIVE_POLL_LEVEL_MONITOR] = late;
+    }
+    return now;
+}
+
+#endif /* ADAPTIVE_POLL_ENABLED */
+
+#endif /* ADAPTIVE_POLL_H */
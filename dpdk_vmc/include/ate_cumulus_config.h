@@ -12,6 +12,13 @@
  *   if (ate_configure_cumulus() == 0) {
  *       printf("ATE Cumulus config basarili!\n");
  *   }
+ *
+ * ate_configure_cumulus tek bir SSH ControlMaster baglantisi uzerinden
+ * calisir: switch'in son uygulanan durumu tek komutla okunur, sadece
+ * degisen kisim (interfaces dosyasi + degisen portlarin VLAN'lari) tek
+ * bir transaction script'i olarak gonderilip tek seferde uygulanir.
+ * Master acilamazsa veya transaction basarisiz olursa degisen port
+ * gruplari paralel SSH oturumlari ile uygulanir.
  */
 
 #ifndef ATE_CUMULUS_CONFIG_H
@@ -34,9 +41,24 @@ extern "C" {
 // ATE INTERFACES FILE PATH
 // ==========================================
 // Sunucuda DPDK deploy dizininde bulunur
+#ifndef ATE_INTERFACES_LOCAL_PATH
 #define ATE_INTERFACES_LOCAL_PATH   "/home/user/Desktop/dpdk/ate_cumulus/interfaces"
+#endif
 #define ATE_INTERFACES_REMOTE_PATH  "/etc/network/interfaces"
 
+// ==========================================
+// PROVISIONING (BATCHED / MULTIPLEXED)
+// ==========================================
+// ssh / scp komutlari: ATE_CUMULUS_SSH / ATE_CUMULUS_SCP ortam degiskenleri
+// ile degistirilebilir (bench/fake_cumulus.sh, switch'siz test)
+#define ATE_CUMULUS_CONTROL_PATH    "/tmp/ate_cumulus_%r@%h:%p"
+#define ATE_CUMULUS_CONTROL_PERSIST 60      // s, master ilk komuttan sonra kapanmazsa
+// Switch'te son uygulanan VLAN durumu (tmpfs: reboot sonrasi her sey yeniden uygulanir)
+#define ATE_CUMULUS_STATE_PATH      "/run/ate_cumulus.applied"
+#define ATE_CUMULUS_TXN_LOCAL_PATH  "/tmp/ate_cumulus_txn.sh"
+#define ATE_CUMULUS_TXN_REMOTE_PATH "/tmp/ate_cumulus_txn.sh"
+#define ATE_CUMULUS_SETTLE_S        2       // ifreload sonrasi bekleme
+
 // ==========================================
 // API
 // ==========================================
@@ -68,17 +90,60 @@ bool ate_cumulus_deploy_interfaces(void);
  */
 bool ate_cumulus_configure_sequence(void);
 
+enum ate_provision_phase
+{
+    ATE_PHASE_CONNECT = 0,      // ControlMaster
+    ATE_PHASE_QUERY,            // Remote interfaces md5 + applied VLAN state
+    ATE_PHASE_RENDER,           // Diff + transaction script
+    ATE_PHASE_APPLY,            // Transfer + apply (or parallel fallback)
+    ATE_PHASE_CLOSE,
+    ATE_PHASE_COUNT
+};
+
+struct ate_provision_report
+{
+    double phase_ms[ATE_PHASE_COUNT];
+    double total_ms;
+    int ports_total;
+    int ports_changed;          // VLAN entries sent (all after an ifreload)
+    bool interfaces_changed;
+    bool multiplexed;           // One ControlMaster connection for all steps
+    bool fallback;              // Parallel per-port-group sessions were used
+};
+
 /**
  * @brief Full ATE Cumulus configuration (deploy + configure)
  *
- * 1. Test connection
- * 2. Deploy ATE interfaces file
- * 3. Run bridge VLAN configuration sequence
+ * ate_cumulus_provision(ATE_INTERFACES_LOCAL_PATH, false, NULL)
  *
  * @return 0 on success, -1 on failure
  */
 int ate_configure_cumulus(void);
 
+/**
+ * @brief Bring the switch to the desired ATE state, only what changed
+ *
+ * 1. Open one multiplexed connection (ControlMaster)
+ * 2. Read remote interfaces md5 + last applied VLAN state (one command)
+ * 3. Render a transaction script: new interfaces file + ifreload if the
+ *    file differs, bridge VLAN commands for changed ports, new state
+ * 4. Send and run it in one session (sudo sh)
+ * Fallback (no master / transaction failed): interfaces via scp, changed
+ * port groups in parallel sessions.
+ *
+ * @param interfaces_path Local interfaces file
+ * @param force Ignore the remote state, apply everything
+ * @param report Phase timings and counts (may be NULL)
+ * @return 0 on success, -1 on failure
+ */
+int ate_cumulus_provision(const char *interfaces_path, bool force,
+                          struct ate_provision_report *report);
+
+/**
+ * @brief Print phase timings of a provisioning run
+ */
+void ate_cumulus_print_report(const struct ate_provision_report *report);
+
 // ==========================================
 // LOW-LEVEL HELPERS
 // ==========================================
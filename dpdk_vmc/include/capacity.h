@@ -0,0 +1,71 @@
+#ifndef CAPACITY_H
+#define CAPACITY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "common.h"   // MAX_PORTS, MAX_SOCKET, struct ports_config
+
+// ==========================================
+// RUNTIME CAPACITY (ports, queues, lcores)
+// ==========================================
+// Port capacity is a compile-time ceiling: MAX_PORTS sizes the port_id
+// indexed tables and MAX_PORTS_CONFIG the per-port VLAN / VL-ID configs,
+// so a host with more ports needs a rebuild (and configs for them). What
+// is read from the host once after EAL init:
+//
+//   ports   rte_eth_dev_count_avail()   (only checked against MAX_PORTS)
+//   lcores  EAL lcore set, per socket   (lcorePortAssign / placement)
+//   queues  rte_eth_dev_info max_rx / max_tx_queues per port
+//
+// capacity_check() compares the per-port queue / worker needs against
+// that and prints one summary. Large per-port state (sequence
+// trackers, TX sequences, forward TX locks, remap tables) is allocated
+// with capacity_port_zmalloc for the configured ports only, on the port's
+// socket, so a second card on the other NUMA node does not read remote
+// memory on every packet.
+
+struct runtime_capacity
+{
+    uint16_t nb_ports_avail;                // rte_eth_dev_count_avail()
+    uint16_t nb_lcores;                     // EAL lcores, main included
+    uint16_t nb_sockets;                    // Sockets with at least one EAL lcore
+    uint16_t lcores_per_socket[MAX_SOCKET];
+    uint16_t max_rx_queues[MAX_PORTS];      // By port_id, 0 = not probed
+    uint16_t max_tx_queues[MAX_PORTS];
+};
+
+extern struct runtime_capacity runtime_cap;
+
+/**
+ * Read port / lcore counts from EAL (after rte_eal_init, before the port
+ * scan and the lcore assignment)
+ */
+void capacity_discover(void);
+
+/**
+ * Queues a port is configured with: NUM_TX_CORES (+1 external TX queue 4
+ * on the external TX ports, queue 5 with PTP), NUM_RX_CORES (queue 5 with PTP)
+ */
+uint16_t capacity_port_tx_queues(uint16_t port_id);
+uint16_t capacity_port_rx_queues(uint16_t port_id);
+
+/**
+ * Queue limits of the scanned ports against capacity_port_*_queues,
+ * worker lcores needed against the EAL lcore set. Prints the summary.
+ * @return 0 if every port fits, -1 otherwise
+ */
+int capacity_check(const struct ports_config *config);
+
+/**
+ * NUMA socket of a port (main lcore's socket if unknown)
+ */
+int capacity_port_socket(uint16_t port_id);
+
+/**
+ * Zeroed, cache-line aligned per-port block on the port's socket
+ * (rte_zmalloc_socket, falls back to any socket). NULL on failure.
+ */
+void *capacity_port_zmalloc(const char *name, size_t size, uint16_t port_id);
+
+#endif /* CAPACITY_H */
@@ -0,0 +1,151 @@
+#ifndef CAPTURE_RING_H
+#define CAPTURE_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <rte_common.h>
+#include <rte_cycles.h>
+#include <rte_mbuf.h>
+#include "config.h"
+#include "port.h"
+
+// ==========================================
+// PCAP CAPTURE RING (TRIGGER-ON-ERROR)
+// ==========================================
+// Every RX core keeps its last CAPTURE_RING_SIZE packets (first
+// CAPTURE_SNAP_LEN bytes + TSC) in its own ring, written only by that core.
+// A trigger (CRC / PRBS mismatch, sequence gap > CAPTURE_GAP_TRIGGER) lets
+// CAPTURE_POST_TRIGGER_PKTS more packets in, then the ring freezes. The
+// capture thread (not an lcore) writes the frozen ring as a nanosecond
+// pcap and re-arms it. State changes:
+//   ARMED -> POST_TRIGGER -> FROZEN   (RX core)
+//   FROZEN -> ARMED                   (capture thread, after the file)
+// Armed, not triggered: one TSC read per burst + one snap copy per packet
+// (bench: capture_record).
+
+#if CAPTURE_ENABLED
+
+#define CAPTURE_RING_MASK (CAPTURE_RING_SIZE - 1)
+
+enum capture_state
+{
+    CAPTURE_ARMED = 0,
+    CAPTURE_POST_TRIGGER,
+    CAPTURE_FROZEN,
+    CAPTURE_DISARMED,       // CAPTURE_MAX_FILES reached
+};
+
+enum capture_reason
+{
+    CAPTURE_REASON_CRC = 0,
+    CAPTURE_REASON_PRBS,
+    CAPTURE_REASON_GAP,
+};
+
+struct capture_slot
+{
+    uint64_t tsc;
+    uint16_t orig_len;
+    uint16_t cap_len;
+    uint8_t data[CAPTURE_SNAP_LEN];
+} __rte_cache_aligned;
+
+struct capture_ring
+{
+    struct capture_slot *slots;     // CAPTURE_RING_SIZE, on the port's socket
+    uint64_t head;                  // Packets recorded (RX core only)
+    uint64_t stop_at;               // head at which POST_TRIGGER -> FROZEN
+    volatile uint32_t state;
+    uint16_t port_id;
+    uint16_t queue_id;
+
+    // Trigger (written by the RX core before POST_TRIGGER)
+    uint8_t reason;
+    uint16_t vl_id;
+    uint64_t seq;
+    uint64_t detail;                // Bit errors or gap size
+    uint64_t trigger_pkt;           // head value of the triggering packet
+    uint64_t trigger_tsc;
+
+    uint64_t triggers;              // Fired
+    uint64_t suppressed;            // Not armed when the condition hit
+} __rte_cache_aligned;
+
+/**
+ * Allocate one ring per RX core and start the capture thread
+ * (call after port setup, before the RX workers start)
+ * @return 0 on success, -1 on error
+ */
+int capture_init(const struct ports_config *ports_config);
+
+/**
+ * Ring of (port, RX queue), NULL if capture is not set up for it
+ */
+struct capture_ring *capture_ring_get(uint16_t port_id, uint16_t queue_id);
+
+/**
+ * Stop the capture thread (frozen rings are written first) and free rings
+ */
+void capture_stop(void);
+
+/**
+ * Triggers / files / suppressed per ring
+ */
+void capture_print_stats(void);
+
+// Record a received burst (RX core, before the packets are processed)
+static inline void capture_record_burst(struct capture_ring *r, struct rte_mbuf **pkts,
+                                        uint16_t nb_pkts)
+{
+    uint32_t state = r->state;
+    if (unlikely(state >= CAPTURE_FROZEN))
+        return;
+
+    uint64_t tsc = rte_rdtsc();
+    uint64_t head = r->head;
+
+    for (uint16_t i = 0; i < nb_pkts; i++) {
+        struct capture_slot *s = &r->slots[head & CAPTURE_RING_MASK];
+        uint16_t len = rte_pktmbuf_data_len(pkts[i]);
+        uint16_t cap = len < CAPTURE_SNAP_LEN ? len : CAPTURE_SNAP_LEN;
+
+        s->tsc = tsc;
+        s->orig_len = (uint16_t)rte_pktmbuf_pkt_len(pkts[i]);
+        s->cap_len = cap;
+        memcpy(s->data, rte_pktmbuf_mtod(pkts[i], const uint8_t *), cap);
+        head++;
+    }
+    r->head = head;
+
+    if (unlikely(state == CAPTURE_POST_TRIGGER) && head >= r->stop_at)
+        __atomic_store_n(&r->state, CAPTURE_FROZEN, __ATOMIC_RELEASE);
+}
+
+/**
+ * Fire a trigger for packet 'pkt_idx' of the burst just recorded
+ * (nb_pkts = burst size). No-op while a previous trigger is pending.
+ */
+static inline void capture_trigger(struct capture_ring *r, uint8_t reason, uint16_t vl_id,
+                                   uint64_t seq, uint64_t detail,
+                                   uint16_t pkt_idx, uint16_t nb_pkts)
+{
+    if (r->state != CAPTURE_ARMED) {
+        r->suppressed++;
+        return;
+    }
+
+    r->reason = reason;
+    r->vl_id = vl_id;
+    r->seq = seq;
+    r->detail = detail;
+    r->trigger_pkt = r->head - nb_pkts + pkt_idx;
+    r->trigger_tsc = rte_rdtsc();
+    r->stop_at = r->head + CAPTURE_POST_TRIGGER_PKTS;
+    r->triggers++;
+    __atomic_store_n(&r->state, CAPTURE_POST_TRIGGER, __ATOMIC_RELEASE);
+}
+
+#endif /* CAPTURE_ENABLED */
+
+#endif /* CAPTURE_RING_H */
@@ -4,7 +4,7 @@
 extern volatile bool force_quit;
 
 #define MAX_SOCKET 8
-#define MAX_LCORE_PER_SOCKET 32
+#define MAX_LCORE_PER_SOCKET RTE_MAX_LCORE   // One socket may hold every EAL lcore
 
 // Declare variables as extern (declarations only)
 extern struct ports_config ports_config;
@@ -60,7 +60,9 @@
 //
 // Ortalama paket boyutu: ~964 byte
 
+#ifndef IMIX_ENABLED
 #define IMIX_ENABLED 0
+#endif
 
 // IMIX boyut seviyeleri (Ethernet frame boyutu, VLAN dahil)
 #define IMIX_SIZE_1 100 // En küçük
@@ -88,6 +90,190 @@
     IMIX_SIZE_5, IMIX_SIZE_5, IMIX_SIZE_5,              \
     IMIX_SIZE_6, IMIX_SIZE_6, IMIX_SIZE_6}
 
+// IMIX profil motoru (traffic_profile.c)
+// Ağırlıklı boyut dağılımı, VL başına düşük-tutarsızlıklı (low-discrepancy)
+// sıra; paket boyutu (VL, sequence) ile belirlenir. Pacing her paketin
+// gerçek byte maliyetini kullanır (sabit ortalama yok).
+//   0: legacy  - IMIX_PATTERN_INIT (yukarıdaki 10'lu döngü)
+//   1: simple  - Simple IMIX 64:7, 594:4, 1518:1
+//   2: internet- Internet mix yaklaşımı (64/128/256/576/1024/1518)
+//   3: file    - IMIX_PROFILE_FILE (CDF: "boyut kümülatif" satırları)
+// Çalışma zamanında: --imix-profile <legacy|simple|internet|64:7,594:4|dosya>
+// Minimum altındaki boyutlar IMIX_MIN_PACKET_SIZE'a yükseltilir
+// (header + sequence + PRBS için gereken en küçük frame).
+#ifndef IMIX_PROFILE
+#define IMIX_PROFILE 0
+#endif
+#define IMIX_PROFILE_FILE "/etc/dpdk_app/imix_profile.cdf"
+
+// Profil döngü uzunluğu (legacy hariç); ağırlıklar bu uzunlukta tam sayıya
+// yuvarlanır (1/4096 çözünürlük)
+#define IMIX_PROFILE_SEQ_LEN 4096
+
+// Hedef hıza göre kabul edilen sapma (%), istatistik ekranında kontrol edilir
+#define IMIX_RATE_TOLERANCE_PCT 1.0
+
+// ==========================================
+// PRBS EXTBUF TX (zero-copy payload)
+// ==========================================
+// tx_worker PRBS payload'ını kopyalamaz: paket iki segment olarak gönderilir
+//   seg 0: ETH/VLAN/IP/UDP + sequence (kendi mbuf'ında, ~54 byte)
+//   seg 1: rte_pktmbuf_attach_extbuf ile salt-okunur PRBS cache'e işaret
+// Byte'lar kopyalama moduyla aynı (RX doğrulaması değişmez). NIC multi-seg
+// TX desteklemiyorsa veya cache IOVA-contiguous değilse port kopyalama
+// moduna döner.
+#ifndef PRBS_EXTBUF_TX_ENABLED
+#define PRBS_EXTBUF_TX_ENABLED 0
+#endif
+
+// ==========================================
+// PCAP CAPTURE RING (trigger-on-error)
+// ==========================================
+// Her RX core son CAPTURE_RING_SIZE paketi (ilk CAPTURE_SNAP_LEN byte)
+// kendi halka tamponunda tutar. CRC / PRBS hatası veya sequence gap
+// (> CAPTURE_GAP_TRIGGER) tetiklenince CAPTURE_POST_TRIGGER_PKTS paket daha
+// alınır, halka donar ve capture thread'i (lcore değil) nanosaniye pcap
+// yazar: CAPTURE_DIR/capture_p<port>_q<queue>_<sebep>_<zaman>.pcap
+// Maliyet (tetiklenmemiş): burst başına 1 TSC + paket başına snap kopyası
+// (make bench: capture_record)
+#ifndef CAPTURE_ENABLED
+#define CAPTURE_ENABLED 0
+#endif
+#define CAPTURE_RING_SIZE 4096          // Paket / RX core (2'nin kuvveti)
+#define CAPTURE_SNAP_LEN 128            // Byte / paket (header + seq + PRBS başı)
+#define CAPTURE_POST_TRIGGER_PKTS 256   // Tetikten sonra kaydedilen paket
+#define CAPTURE_GAP_TRIGGER 1           // Gap > X kayıp paket ise tetikle
+#define CAPTURE_MAX_FILES 16            // Sonra halkalar kapanır (disk koruma)
+#define CAPTURE_HOLDOFF_MS 1000         // Aynı halka için dosyalar arası süre
+#define CAPTURE_DIR "/tmp"
+
+// ==========================================
+// PCAP REPLAY TX
+// ==========================================
+// PRBS üreteci yerine bir pcap dosyası gönderilir (müşteri trafiği: boyut
+// dağılımı, burst yapısı, frame arası süreler). Dosya başlangıçta hugepage
+// belleğe yüklenir; frame i, her portta TX queue (i % NUM_TX_CORES) ile TSC
+// zamanlamasına göre gider (TX worker lcore'ları / queue'ları kullanılır).
+//   PCAP_REPLAY_TIMING 1: orijinal zamanlama x PCAP_REPLAY_SPEEDUP
+//   PCAP_REPLAY_TIMING 0: aynı desen, port hedef hızına (TARGET_GBPS_*) ölçeklenir
+// PCAP_REPLAY_REWRITE 1: boyut + zamanlama dosyadan; VL-ID, VLAN, sequence
+// ve PRBS payload queue'nun VL aralığından yazılır (RX doğrulaması çalışır).
+// IMIX kapalıyken RX sadece tam boy frame doğruladığı için tüm frame'ler
+// PACKET_SIZE olur. 0: frame'ler olduğu gibi (mbuf'a önceden çevrilmiş, zero-copy).
+// Runtime: --replay <dosya.pcap>
+// İstatistik: gerçekleşen / beklenen Gbps + zamanlama hatası p50..p99.9
+#ifndef PCAP_REPLAY_ENABLED
+#define PCAP_REPLAY_ENABLED 0
+#endif
+#define PCAP_REPLAY_FILE "/tmp/replay.pcap"
+#ifndef PCAP_REPLAY_TIMING
+#define PCAP_REPLAY_TIMING 1            // 1: orijinal zamanlama, 0: hedef hıza ölçekle
+#endif
+#define PCAP_REPLAY_SPEEDUP 1.0         // Orijinal zamanlama çarpanı (2.0 = iki kat hızlı)
+#ifndef PCAP_REPLAY_REWRITE
+#define PCAP_REPLAY_REWRITE 1
+#endif
+#define PCAP_REPLAY_LOOP 1              // 0: dosya bir kez gönderilir
+#define PCAP_REPLAY_MAX_FRAMES 1048576  // Fazlası yüklenmez
+
+// ==========================================
+// ADAPTIVE POLLING (POWER-AWARE IDLE)
+// ==========================================
+// Boş poll serisi uzadıkça RX kuyruğu kademeli olarak uyutulur:
+//   0 spin -> 1 rte_pause -> 2 UMWAIT (rte_power_monitor, RX descriptor
+//   adresine yazılınca uyanır) -> 3 RX interrupt (epoll)
+// Paket gelince seviye 0'a döner. Uyanma süresi sınırlı: monitor en fazla
+// ADAPTIVE_POLL_MONITOR_US, interrupt kaçsa bile en fazla
+// ADAPTIVE_POLL_INTR_TIMEOUT_MS uyur. CPU / PMD desteklemiyorsa seviye düşer.
+// Port sınıfına göre üst seviye (FAST portlar turbo için spin'e yakın kalır).
+// TX pacing beklemeleri (MONITOR seviyesine izinli portlarda) TPAUSE ile
+// (rte_power_pause) hedef zamandan ADAPTIVE_POLL_TX_GUARD_NS önce uyanır.
+// Raporlama: kuyruk başına kazanılan core zamanı (%) ve uyanma gecikmesi.
+// Uçtan uca ek gecikme: latency testini ADAPTIVE_POLL=1 / 0 ile karşılaştır.
+#ifndef ADAPTIVE_POLL_ENABLED
+#define ADAPTIVE_POLL_ENABLED 0
+#endif
+#define ADAPTIVE_POLL_LEVEL_SPIN 0
+#define ADAPTIVE_POLL_LEVEL_PAUSE 1
+#define ADAPTIVE_POLL_LEVEL_MONITOR 2
+#define ADAPTIVE_POLL_LEVEL_INTR 3
+#define ADAPTIVE_POLL_MAX_LEVEL_FAST ADAPTIVE_POLL_LEVEL_PAUSE
+#define ADAPTIVE_POLL_MAX_LEVEL_MID ADAPTIVE_POLL_LEVEL_MONITOR
+#define ADAPTIVE_POLL_MAX_LEVEL_SLOW ADAPTIVE_POLL_LEVEL_INTR
+#define ADAPTIVE_POLL_MAX_LEVEL_PTP ADAPTIVE_POLL_LEVEL_MONITOR  // State machine her loop'ta çalışmalı
+#define ADAPTIVE_POLL_PAUSE_THRESH 64       // Boş poll sayısı -> rte_pause
+#define ADAPTIVE_POLL_MONITOR_THRESH 1024   // -> UMWAIT
+#define ADAPTIVE_POLL_INTR_THRESH 4096      // -> RX interrupt (~150 ms boşta)
+#define ADAPTIVE_POLL_MONITOR_US 50         // UMWAIT üst sınırı
+#define ADAPTIVE_POLL_INTR_TIMEOUT_MS 10    // epoll üst sınırı (kaçan interrupt)
+#define ADAPTIVE_POLL_TX_MIN_SLEEP_NS 5000  // Daha kısa TX beklemeleri spin
+#define ADAPTIVE_POLL_TX_GUARD_NS 1000      // TPAUSE'dan sonra kalan spin süresi
+#define ADAPTIVE_POLL_MAX_WORKERS 256   // RX + TX + PTP + latency kuyrukları
+
+// ==========================================
+// STARTUP (PARALLEL INIT + TRACE)
+// ==========================================
+// 1: Her portun PRBS cache'i kendi ilk TX lcore'unda üretilir, raw socket
+//    portları ayrı bir thread'de kurulur; ana lcore bu sırada DPDK portlarını
+//    konfigüre eder. Worker'lar başlamadan önce hepsi beklenir.
+// 0: Eski sıralı akış (PRBS -> port config -> raw socket).
+// Runtime: --serial-init her zaman sıralı akışı seçer (A/B ölçümü için).
+// Her adımın süresi ve ilk pakete kadar geçen süre her iki modda da yazdırılır.
+#ifndef STARTUP_PARALLEL_INIT
+#define STARTUP_PARALLEL_INIT 1
+#endif
+
+// ==========================================
+// RX STAGED VERIFICATION PIPELINE
+// ==========================================
+// rx_worker burst'ü paket paket değil üç aşamada işler (rx_pipeline.h):
+//   1. Tüm header'lar prefetch, sonra VL-ID / sequence parse edilir
+//   2. Kendi VL-ID'lerimizin PRBS cache satırları, payload ve tracker
+//      girdileri prefetch edilir
+//   3. Tracker'lar VL-ID başına bir kez güncellenir (burst içi sıra
+//      korunur), CRC / PRBS doğrulaması burst sırasıyla yapılır
+// Sayaçlar, capture tetikleri ve log satırları eski döngüyle aynıdır.
+// Cross-port / external / raw socket paketleri eski yoldan geçer.
+// 0: eski paket başına döngü (A/B). Ölçüm: make rx-pipeline-bench
+#ifndef RX_STAGED_PIPELINE
+#define RX_STAGED_PIPELINE 1
+#endif
+#ifndef RX_VERIFY_SPLITMIX
+#define RX_VERIFY_SPLITMIX 1            // VMC_2 döngüsünden: splitmix64 + CRC32C, sonra PRBS
+#endif
+
+// ==========================================
+// RX FLOW STEERING (rte_flow, VL-ID -> RX queue)
+// ==========================================
+// RSS RETA aynı VL-ID'nin paketlerini tüm data RX queue'larına dağıtır:
+// tracker'lar paylaşımlı (CAS / fetch_add) ve her queue her VL'i doğrular.
+// 1: Worker'lar başlamadan önce her portta queue q'nun VL-ID aralıkları
+//    (kaynak portun TX + bu portun RX aralıkları) rte_flow ile RX queue
+//    q'ya yönlendirilir (rx_flow_steer.h). Sıra: DST MAC prefix blokları,
+//    MAC + VLAN, queue başına VLAN TCI. Kural bütçesi aşılır ya da PMD
+//    reddederse port RSS'te kalır. MAC modlarında her VL tek bir queue'ya
+//    gelir, tracker güncellemesi atomik RMW'siz yapılır.
+// Raporlama: kurulum süresi, kural sayısı, queue başına VL-ID / RX payı.
+#ifndef RX_FLOW_STEERING
+#define RX_FLOW_STEERING 0
+#endif
+#define RX_FLOW_STEER_MAX_RULES 128     // Port başına kural bütçesi (aşılırsa sonraki mod / RSS)
+
+// ==========================================
+// SHARED STATS (secondary process reader)
+// ==========================================
+// 1: RX doğrulama sayaçları, raw socket port sayaçları ve replay
+//    histogramları memzone'lara taşınır; port listesi, VL-ID tracker
+//    adresleri ve latency sonuçları "vmc_stats_dir" memzone'unda yayınlanır
+//    (stats_shm.h). Ayrı bir DPDK secondary process
+//    (make stats-reader, --proc-type=secondary) bunları kilitsiz, sadece
+//    okuyarak yüksek frekansta örnekler ve oranları CSV / JSON yazar.
+//    Primary'nin worker'ları etkilenmez (okunan cache satırları hariç).
+// 0: Sayaçlar .bss'te kalır, sadece primary görür.
+#ifndef STATS_SHM_ENABLED
+#define STATS_SHM_ENABLED 1
+#endif
+
 // ==========================================
 // RAW SOCKET PORT CONFIGURATION (Non-DPDK)
 // ==========================================
@@ -108,6 +294,16 @@
 #define RAW_SOCKET_PORT_ID_START 12
 #define MAX_RAW_TARGETS 8 // Maksimum hedef sayısı per port
 
+// Raw TX header şablonları (raw_tx_template.h): her frame boyutu (IMIX
+// pattern slot'u) için ETH + IP + UDP header'ı, IP total length / UDP
+// length / IP checksum toplamı başlangıçta bir kez hazırlanır. Paket başına
+// sadece VL-ID, checksum, sequence ve PRBS doğrudan TX ring frame'ine
+// yazılır (ara buffer + kopya yok). Frame'ler byte byte aynıdır.
+// 0: paket başına build_raw_packet(_dynamic) + kopya (A/B). Ölçüm: make raw-tx-bench
+#ifndef RAW_TX_TEMPLATE
+#define RAW_TX_TEMPLATE 1
+#endif
+
 // Port 12 configuration (1G copper)
 #define RAW_SOCKET_PORT_12_PCI "01:00.0"
 #define RAW_SOCKET_PORT_12_IFACE "eno12399"
@@ -445,6 +641,7 @@ struct port_vlan_config
   uint16_t rx_vlan_count;
 
   // Init için başlangıç VL-ID'leri (queue index ile eşleşir)
+  // Dinamik kullanımda bu VL aralıklarının içinde döneceksin.
   uint16_t tx_vl_ids[MAX_TX_VLANS_PER_PORT]; // Range 1 start
   uint16_t rx_vl_ids[MAX_RX_VLANS_PER_PORT]; // Range 1 start
 
@@ -470,7 +667,108 @@ struct port_vlan_config
 };
 
 // Port bazlı VLAN/VL-ID şablonu (queue index ↔ VL aralığı başlangıcı eşleşir)
+// Verifier rolü (VMC_1); forwarder tabloları: FWD_PORT_VLAN_CONFIG_INIT
 #define PORT_VLAN_CONFIG_INIT                                                                                                                                                                               \
+  {                                                                                                                                                                                                         \
+    /* Port 0 */                                                                                                                                                                                            \
+    {.tx_vlans = {105, 106, 107, 108}, .tx_vlan_count = 4,                                                                                                                                   \
+     .rx_vlans = {233, 234, 235, 236}, .rx_vlan_count = 4,                                                                                                                                                \
+     .tx_vl_ids = {602, 622, 346, 366},                                                                                                                                                                    \
+     .rx_vl_ids = {592, 612, 336, 356},                                                                                                                                                                    \
+     .tx_vl_range1_size = {10, 6, 10, 6},                                                                                                                                                                  \
+     .rx_vl_range1_size = {10, 6, 10, 6}},                                                                                                                                                    /* Port 1 */  \
+        {.tx_vlans = {109, 110, 111, 112}, .tx_vlan_count = 4,                                                                                                                                   \
+         .rx_vlans = {237, 238, 239, 240}, .rx_vlan_count = 4,                                                                                                                                                \
+         .tx_vl_ids = {522, 542, 562, 582},                                                                                                                                                                    \
+         .rx_vl_ids = {512, 532, 552, 572},                                                                                                                                                                    \
+         .tx_vl_range1_size = {10, 10, 10, 10},                                                                                                                                                                \
+         .rx_vl_range1_size = {10, 10, 10, 10}},                                                                                                                                                 /* Port 2 */  \
+        {.tx_vlans = {97, 98, 99, 100}, .tx_vlan_count = 4, .rx_vlans = {225, 226, 227, 228}, .rx_vlan_count = 4,                                                                                            \
+         .tx_vl_ids = {160, 224, 416, 480},                                                                                                                                                                      \
+         .tx_vl_range1_size = {30, 30, 32, 32},                                                                                                                                                                  \
+         .rx_vl_ids = {128, 192, 384, 448},                                                                                                                                                                      \
+         .rx_vl_range1_size = {30, 30, 32, 32}},                                                                                                                                                     /* Port 3 */  \
+        {.tx_vlans = {101, 102, 103, 104}, .tx_vlan_count = 4,                                                                                                                                   \
+         .rx_vlans = {229, 230, 231, 232}, .rx_vlan_count = 4,                                                                                                                                                \
+         .tx_vl_ids = {266, 286, 306, 326},                                                                                                                                                                    \
+         .rx_vl_ids = {256, 276, 296, 316},                                                                                                                                                                    \
+         .tx_vl_range1_size = {10, 10, 10, 10},                                                                                                                                                                \
+         .rx_vl_range1_size = {10, 10, 10, 10}},                                                                                                                                                  /* Port 4 */ \
+        {.tx_vlans = {113, 114, 115, 116}, .tx_vlan_count = 4, .rx_vlans = {229, 230, 231, 232}, .rx_vlan_count = 4, .tx_vl_ids = {2051, 2179, 2307, 2435}, .rx_vl_ids = {3, 131, 259, 387}}, /* Port 5 */  \
+        {.tx_vlans = {117, 118, 119, 120}, .tx_vlan_count = 4, .rx_vlans = {225, 226, 227, 228}, .rx_vlan_count = 4, .tx_vl_ids = {2563, 2691, 2819, 2947}, .rx_vl_ids = {3, 131, 259, 387}}, /* Port 6 */  \
+        {.tx_vlans = {121, 122, 123, 124}, .tx_vlan_count = 4, .rx_vlans = {237, 238, 239, 240}, .rx_vlan_count = 4, .tx_vl_ids = {3075, 3203, 3331, 3459}, .rx_vl_ids = {3, 131, 259, 387}}, /* Port 7 */  \
+        {.tx_vlans = {125, 126, 127, 128}, .tx_vlan_count = 4, .rx_vlans = {233, 234, 235, 236}, .rx_vlan_count = 4, .tx_vl_ids = {3587, 3715, 3843, 3971}, .rx_vl_ids = {3, 131, 259, 387}}, /* Port 8 */  \
+        {.tx_vlans = {129, 130, 131, 132}, .tx_vlan_count = 4, .rx_vlans = {133, 134, 135, 136}, .rx_vlan_count = 4, .tx_vl_ids = {3, 131, 259, 387}, .rx_vl_ids = {3, 131, 259, 387}},       /* Port 9 */  \
+        {.tx_vlans = {129, 130, 131, 132}, .tx_vlan_count = 4, .rx_vlans = {133, 134, 135, 136}, .rx_vlan_count = 4, .tx_vl_ids = {3, 131, 259, 387}, .rx_vl_ids = {3, 131, 259, 387}},       /* Port 10 */ \
+        {.tx_vlans = {137, 138, 139, 140}, .tx_vlan_count = 4, .rx_vlans = {141, 142, 143, 144}, .rx_vlan_count = 4, .tx_vl_ids = {3, 131, 259, 387}, .rx_vl_ids = {3, 131, 259, 387}},                     \
+    /* Port 11 */                                                                                                                                                                                           \
+    {                                                                                                                                                                                                       \
+      .tx_vlans = {137, 138, 139, 140}, .tx_vlan_count = 4,                                                                                                                                                 \
+      .rx_vlans = {141, 142, 143, 144}, .rx_vlan_count = 4,                                                                                                                                                 \
+      .tx_vl_ids = {3, 131, 259, 387},                                                                                                                                                                      \
+      .rx_vl_ids = {3, 131, 259, 387}                                                                                                                                                                       \
+    }                                                                                                                                                                                                       \
+  }
+
+// ==========================================
+// ATE TEST MODE - PORT VLAN CONFIGURATION
+// ==========================================
+// ATE test modu icin DPDK port VLAN/VL-ID mapping tablosu.
+// Normal moddaki PORT_VLAN_CONFIG_INIT ile ayni yapi.
+// NOT: Bu degerler placeholder'dir, ATE topolojisine gore degistirilecek!
+// Runtime'da g_ate_mode flag'ine gore secilir.
+
+#define ATE_PORT_VLAN_CONFIG_INIT                                                                                                                                                                           \
+  {                                                                                                                                                                                                         \
+    /* Port 0 */                                                                                                                                                                                            \
+    {.tx_vlans = {105, 106, 107, 108}, .tx_vlan_count = 4,                                                                                                                                   \
+     .rx_vlans = {233, 234, 235, 236}, .rx_vlan_count = 4,                                                                                                                                                \
+     .tx_vl_ids = {752, 880, 1008, 1136},                                                                                                                                                                  \
+     .rx_vl_ids = {688, 816, 944, 1072},                                                                                                                                                                   \
+     .tx_vl_range1_size = {64, 64, 64, 64},                                                                                                                                                                \
+     .rx_vl_range1_size = {64, 64, 64, 64}},                                                                                                                                                  /* Port 1 */  \
+        {.tx_vlans = {109, 110, 111, 112}, .tx_vlan_count = 4,                                                                                                                                   \
+         .rx_vlans = {237, 238, 239, 240}, .rx_vlan_count = 4,                                                                                                                                                \
+         .tx_vl_ids = {522, 542, 562, 582},                                                                                                                                                                    \
+         .rx_vl_ids = {512, 532, 552, 572},                                                                                                                                                                    \
+         .tx_vl_range1_size = {10, 10, 10, 10},                                                                                                                                                                \
+         .rx_vl_range1_size = {10, 10, 10, 10}},                                                                                                                                                 /* Port 2 */  \
+        {.tx_vlans = {97, 98, 99, 100}, .tx_vlan_count = 4, .rx_vlans = {225, 226, 227, 228}, .rx_vlan_count = 4,                                                                                            \
+         .tx_vl_ids = {160, 224, 416, 480},                                                                                                                                                                      \
+         .tx_vl_range1_size = {30, 30, 32, 32},                                                                                                                                                                  \
+         .rx_vl_ids = {128, 192, 384, 448},                                                                                                                                                                      \
+         .rx_vl_range1_size = {30, 30, 32, 32}},                                                                                                                                                     /* Port 3 */  \
+        {.tx_vlans = {101, 102, 103, 104}, .tx_vlan_count = 4,                                                                                                                                   \
+         .rx_vlans = {229, 230, 231, 232}, .rx_vlan_count = 4,                                                                                                                                                \
+         .tx_vl_ids = {266, 286, 306, 326},                                                                                                                                                                    \
+         .rx_vl_ids = {256, 276, 296, 316},                                                                                                                                                                    \
+         .tx_vl_range1_size = {10, 10, 10, 10},                                                                                                                                                                \
+         .rx_vl_range1_size = {10, 10, 10, 10}},                                                                                                                                                  /* Port 4 */ \
+        {.tx_vlans = {113, 114, 115, 116}, .tx_vlan_count = 4, .rx_vlans = {245, 246, 247, 248}, .rx_vlan_count = 4, .tx_vl_ids = {2051, 2179, 2307, 2435}, .rx_vl_ids = {3, 131, 259, 387}}, /* Port 5 */  \
+        {.tx_vlans = {117, 118, 119, 120}, .tx_vlan_count = 4, .rx_vlans = {241, 242, 243, 244}, .rx_vlan_count = 4, .tx_vl_ids = {2563, 2691, 2819, 2947}, .rx_vl_ids = {3, 131, 259, 387}}, /* Port 6 */  \
+        {.tx_vlans = {121, 122, 123, 124}, .tx_vlan_count = 4, .rx_vlans = {253, 254, 255, 256}, .rx_vlan_count = 4, .tx_vl_ids = {3075, 3203, 3331, 3459}, .rx_vl_ids = {3, 131, 259, 387}}, /* Port 7 */  \
+        {.tx_vlans = {125, 126, 127, 128}, .tx_vlan_count = 4, .rx_vlans = {249, 250, 251, 252}, .rx_vlan_count = 4, .tx_vl_ids = {3587, 3715, 3843, 3971}, .rx_vl_ids = {3, 131, 259, 387}}, /* Port 8 */  \
+        {.tx_vlans = {129, 130, 131, 132}, .tx_vlan_count = 4, .rx_vlans = {133, 134, 135, 136}, .rx_vlan_count = 4, .tx_vl_ids = {3, 131, 259, 387}, .rx_vl_ids = {3, 131, 259, 387}},       /* Port 9 */  \
+        {.tx_vlans = {129, 130, 131, 132}, .tx_vlan_count = 4, .rx_vlans = {133, 134, 135, 136}, .rx_vlan_count = 4, .tx_vl_ids = {3, 131, 259, 387}, .rx_vl_ids = {3, 131, 259, 387}},       /* Port 10 */ \
+        {.tx_vlans = {137, 138, 139, 140}, .tx_vlan_count = 4, .rx_vlans = {141, 142, 143, 144}, .rx_vlan_count = 4, .tx_vl_ids = {3, 131, 259, 387}, .rx_vl_ids = {3, 131, 259, 387}},                     \
+    /* Port 11 */                                                                                                                                                                                           \
+    {                                                                                                                                                                                                       \
+      .tx_vlans = {137, 138, 139, 140}, .tx_vlan_count = 4,                                                                                                                                                 \
+      .rx_vlans = {141, 142, 143, 144}, .rx_vlan_count = 4,                                                                                                                                                 \
+      .tx_vl_ids = {3, 131, 259, 387},                                                                                                                                                                      \
+      .rx_vl_ids = {3, 131, 259, 387}                                                                                                                                                                       \
+    }                                                                                                                                                                                                       \
+  }
+
+// ==========================================
+// FORWARDER ROLE - PORT VLAN CONFIGURATION
+// ==========================================
+// --role forwarder (VMC_2) icin tablolar. tx_vl_ids / tx_vl_ids2 gelen
+// (VMC_1'in gonderdigi) VL-ID araliklari; vl_id_remap_offset(2) ile geri
+// gonderilen VL-ID'ye, r2_fwd_vlan / r2_fwd_port ile R2 cross-port hedefine
+// cevrilir. Normal / ATE secimi verifier ile ayni (port_vlans_load_config).
+
+#define FWD_PORT_VLAN_CONFIG_INIT                                                                                                                                                                           \
   {                                                                                                                                                                                                         \
     /* Port 0 */                                                                                                                                                                                            \
     {.tx_vlans = {105, 106, 107, 108}, .tx_vlan_count = 4,                                                                                                                                                 \
@@ -518,15 +816,7 @@ struct port_vlan_config
     }                                                                                                                                                                                                       \
   }
 
-// ==========================================
-// ATE TEST MODE - PORT VLAN CONFIGURATION
-// ==========================================
-// ATE test modu icin DPDK port VLAN/VL-ID mapping tablosu.
-// Normal moddaki PORT_VLAN_CONFIG_INIT ile ayni yapi.
-// NOT: Bu degerler placeholder'dir, ATE topolojisine gore degistirilecek!
-// Runtime'da g_ate_mode flag'ine gore secilir.
-
-#define ATE_PORT_VLAN_CONFIG_INIT                                                                                                                                                                           \
+#define FWD_ATE_PORT_VLAN_CONFIG_INIT                                                                                                                                                                       \
   {                                                                                                                                                                                                         \
     /* Port 0 */                                                                                                                                                                                            \
     {.tx_vlans = {105, 106, 107, 108}, .tx_vlan_count = 4,                                                                                                                                   \
@@ -578,17 +868,92 @@ struct port_vlan_config
 #define NUM_TX_CORES 4
 #endif
 
+#ifndef NUM_RX_CORES
+#define NUM_RX_CORES 4
+#endif
+
 // ==========================================
-// FORWARD MODE (VMC_2 Loopback)
+// VMC ROLE (verifier / forwarder)
 // ==========================================
-// VMC_2 receives packets from VMC_1 and forwards them back
-// No independent TX, no PRBS verification, just RX -> TX loopback
-#ifndef FORWARD_MODE
-#define FORWARD_MODE 1
+// Tek binary, rol başlangıçta seçilir: --role verifier|forwarder
+// 0 = verifier  (VMC_1: PRBS TX + RX doğrulama)
+// 1 = forwarder (VMC_2: RX -> remap + splitmix64 -> TX, eski FORWARD_MODE)
+// Makefile: ROLE=forwarder (derleme varsayılanı + run hedeflerinin --role değeri)
+#ifndef VMC_ROLE_DEFAULT
+#define VMC_ROLE_DEFAULT 0
 #endif
 
-#ifndef NUM_RX_CORES
-#define NUM_RX_CORES 4
+// ==========================================
+// FORWARD REMAP TABLE (forwarder role)
+// ==========================================
+// forward_worker VL-ID / VLAN remap'ini her paket için R1 / R2 aralık
+// taraması yerine port başına VL-ID indeksli tablodan yapar (fwd_remap.h):
+// çıkış VL-ID, VLAN, hedef port ve IPv4 checksum farkı (RFC 1624) önceden
+// hesaplanır, burst bir kerede işlenir. IP checksum artık güncellenir.
+// Tablo başlangıçta her VL-ID için paket başına yolla karşılaştırılır,
+// fark varsa o port eski yoldan devam eder.
+// 0: paket başına process_packet (A/B). Ölçüm: make fwd-remap-bench
+#ifndef FWD_REMAP_TABLE
+#define FWD_REMAP_TABLE 1
+#endif
+
+// ==========================================
+// TX VL-ID SEQUENCE OWNERSHIP
+// ==========================================
+// Her VL-ID'nin TX sequence'ını tek bir TX queue (worker) yazar; sahiplik
+// başlangıçta tx_vl_ids / tx_vl_ids2 aralıklarından çözülür ve sahip worker
+// sayaçları kilitsiz, kendi özel dizisinde tutar. İki queue aynı VL-ID'yi
+// gönderiyorsa (çakışan aralıklar, tx_vlan_count < NUM_TX_CORES):
+// 0 = başlangıç reddedilir (config hatası)
+// 1 = çakışan VL-ID'ler atomic fetch-add ile paylaşılır (TX queue dolu
+//     olduğunda o VL-ID'de RX bir sequence kayıp görür)
+#ifndef TX_VL_SHARED_SEQ
+#define TX_VL_SHARED_SEQ 0
+#endif
+
+// ==========================================
+// NUMA / SMT LCORE PLACEMENT (src/placement.c)
+// ==========================================
+// Her portun TX/RX (forward), external TX ve PTP lcore'ları portun
+// soketinden seçilir; sıcak roller (TX/RX/ext TX) aynı fiziksel çekirdeği
+// başka bir meşgul lcore ile paylaşmaz. Seçilen yerleşim ve cross-socket /
+// SMT cezaları başlangıçta yazdırılır.
+// 0 = eski lcorePortAssign
+// Dry run (yerleşimi yazdır, trafik başlatma): --placement-dry-run
+// veya PLACEMENT_DRY_RUN=1
+#ifndef PLACEMENT_ENABLED
+#define PLACEMENT_ENABLED 1
+#endif
+
+// 1 = SMT kardeşi meşgul olan lcore'lar son tercih
+#ifndef PLACEMENT_AVOID_SMT
+#define PLACEMENT_AVOID_SMT 1
+#endif
+
+#ifndef PLACEMENT_DRY_RUN
+#define PLACEMENT_DRY_RUN 0
+#endif
+
+// ==========================================
+// MBUF POOL SIZING
+// ==========================================
+// Her port için ayrı RX ve TX havuzu (aynı sokette). mbuf sayısı ring
+// derinliği, burst, lcore cache'leri ve forward'da TX ringlerinde bekleyen
+// RX mbuf'larından hesaplanır; buffer boyutu maksimum frame'e (1518 + VLAN)
+// kırpılır. Plan ve eski sabit havuza göre kazanç başlangıçta yazdırılır.
+// 1 = eski davranış (port başına tek havuz, 524287 x 2176B, cache 512) - A/B
+#ifndef MBUF_POOL_LEGACY
+#define MBUF_POOL_LEGACY 0
+#endif
+
+// Lcore başına mempool cache (burst'ün katı; küçük cache = daha az L2 baskısı)
+#ifndef MBUF_CACHE_SIZE
+#define MBUF_CACHE_SIZE 256
+#endif
+
+// Hesaplanan mbuf sayısına eklenen güvenlik payı (%)
+#ifndef MBUF_POOL_MARGIN_PCT
+#define MBUF_POOL_MARGIN_PCT 25
 #endif
 
 // ==========================================
@@ -885,7 +1250,8 @@ struct dpdk_ext_tx_port_config
 //
 // Mode: One-step (no Follow_Up messages)
 // Transport: Layer 2 (EtherType 0x88F7)
-// Timestamps: Software (rte_rdtsc) for t2 and t3
+// Timestamps: NIC (rte_eth_timesync) for t2 and t3 when the PMD supports it,
+//             software (rte_rdtsc / clock_gettime) as fallback
 //             Hardware timestamps from DTN for t1 and t4
 
 #ifndef PTP_ENABLED
@@ -938,6 +1304,56 @@ struct dpdk_ext_tx_port_config
 #define PTP_RAW_DEBUG_PRINT 0
 #endif
 
+// PTP hardware timestamping (rte_eth_timesync_* on Queue 5)
+// 1 = PMD destekliyorsa t2/t3 NIC'ten okunur, desteklemiyorsa yazılım timestamp
+// 0 = sadece yazılım timestamp (rte_rdtsc / clock_gettime)
+// Her iki modun offset/delay jitter'ı ayrı ayrı raporlanır
+#ifndef PTP_HW_TIMESTAMP_ENABLED
+#define PTP_HW_TIMESTAMP_ENABLED 1
+#endif
+
+// Delay_Req TX timestamp latch polling limit (in us)
+#define PTP_HW_TX_TS_POLL_US 100
+
+// PTP simulated master (net_ring pair, no NIC/DTN required)
+// Master Sync gönderir, Delay_Req'e Delay_Resp ile cevap verir ve
+// NIC timestamp latch'ini emüle eder (timestamp plumbing testi için)
+#ifndef PTP_SIM_MASTER_ENABLED
+#define PTP_SIM_MASTER_ENABLED 0
+#endif
+
+#define PTP_SIM_SYNC_INTERVAL_MS 250      // Sync period
+#define PTP_SIM_MASTER_OFFSET_NS 1500     // Master clock ahead of slave (expected offset = -1500)
+#define PTP_SIM_PATH_DELAY_NS 800         // Emulated one-way wire delay
+#define PTP_SIM_RX_VLAN 225               // Sync/Delay_Resp VLAN
+#define PTP_SIM_TX_VLAN 97                // Delay_Req VLAN
+#define PTP_SIM_TX_VL_IDX 4420            // Delay_Req VL-IDX
+
+// PTP servo (PI + lucky-packet filter, src/ptp/ptp_servo.c)
+// Her session için TSC -> master zamanı eşleyen disiplinli bir saat tutar.
+// Latency ölçümleri ptp_clock_tsc_to_master_ns() ile ortak zaman tabanı kullanabilir.
+#define PTP_SERVO_KP 0.7                    // Proportional gain (ppb per ns/s)
+#define PTP_SERVO_KI 0.3                    // Integral gain (ppb per ns/s)
+#define PTP_SERVO_STEP_THRESHOLD_NS 1000000 // |offset| above this steps the clock instead of slewing
+#define PTP_SERVO_MAX_FREQ_PPB 500000.0     // Frequency adjustment clamp
+#define PTP_SERVO_LOCK_THRESHOLD_NS 2000    // |offset| below this counts towards lock
+#define PTP_SERVO_LOCK_COUNT 8              // Consecutive in-threshold samples to declare LOCKED
+#define PTP_SERVO_OUTLIER_NS 20000          // Delay above window median + this is rejected
+#define PTP_SERVO_LUCKY_MARGIN_NS 500       // Only samples within this of window min delay drive the PI
+
+// Path delay estimator: 1 = median of window, 0 = moving average of window
+#ifndef PTP_SERVO_DELAY_MEDIAN
+#define PTP_SERVO_DELAY_MEDIAN 1
+#endif
+
+// PTP worker debug çıktısı: worker printf yapmaz, port başına lock-free event
+// ring'e yazar; realtime olmayan bir thread ring'leri bu aralıkla boşaltır.
+#define PTP_EVENT_DRAIN_INTERVAL_US 10000
+
+// Worker loop başına state machine tick'lenen session sayısı (round-robin).
+// Session sayısı arttıkça loop süresini sınırlar.
+#define PTP_TICK_BUDGET 8
+
 // Number of PTP ports (DPDK ports 0-7)
 #define PTP_PORT_COUNT 8
 
@@ -1013,15 +1429,60 @@ struct ptp_session_config
     {.rx_port_id = 0, .rx_vlan = 256, .tx_port_id = 7, .tx_vlan = 128, .tx_vl_idx = 4482}, /* DTN Port 0: RX=Port5/VLAN225, TX=Port2/VLAN97/VL-IDX4420 */ \
 }
 
+// ==========================================
+// SOFTWARE THROUGHPUT HARNESS (NIC-free)
+// ==========================================
+// Port 0..3 yerine net_ring (veya net_null) vdev'leri kullanılır; switch ve
+// karşı VMC bir "fabric" lcore'u tarafından yazılımda taklit edilir.
+// Tekrarlanabilir, sadece yazılım throughput baseline'ı verir (make SW_HARNESS=1).
+//
+//   loopback (verifier):  tx_worker -> TX ring -> fabric (VL/VLAN remap +
+//                         splitmix64) -> RX ring -> rx_worker
+//   source   (forwarder): fabric gen -> RX ring -> forward_worker -> TX ring -> fabric sink
+//   null     (NULL=1):    tx_worker -> net_null (sadece TX, fabric yok, verifier)
+//
+// --no-pci ile çalıştırılmalı (vdev port ID'leri 0..3 olmalı).
+
+#ifndef SW_HARNESS_ENABLED
+#define SW_HARNESS_ENABLED 0
+#endif
+
+#ifndef SW_HARNESS_NULL
+#define SW_HARNESS_NULL 0               // 1 = net_null, TX-only (no-rx=1)
+#endif
+
+#ifndef SW_HARNESS_REMAP
+#define SW_HARNESS_REMAP 1              // Loopback: TX VL-ID/VLAN -> RX VL-ID/VLAN (switch + VMC_2)
+#endif
+
+#ifndef SW_HARNESS_FABRIC_CORES
+#define SW_HARNESS_FABRIC_CORES 2       // Fabric lcore sayısı (port % n ile paylaşılır)
+#endif
+
+#ifndef SW_HARNESS_DURATION_S
+#define SW_HARNESS_DURATION_S 0         // Warmup sonrası ölçüm süresi, 0 = Ctrl+C'ye kadar
+#endif
+
+#define SW_HARNESS_PORTS 4              // Port 0..3
+#define SW_HARNESS_QUEUES 8             // Ring sayısı/port/yön (>= TX/RX/PTP queue sayısı)
+#define SW_HARNESS_RING_SIZE 4096
+#define SW_HARNESS_BURST 32
+#define SW_HARNESS_POOL_SIZE 65535      // Source modu mbuf pool'u (port başına)
+#define SW_HARNESS_WARMUP_S 2           // Özete dahil edilmeyen ilk saniyeler
+
 // ==========================================
 // HEALTH MONITOR CONFIGURATION
 // ==========================================
 // Health Monitor sends periodic queries to DTN and receives status responses.
 // Runs on Port 13 (eno12409) independently from PRBS traffic.
 //
-// Query: 64 byte packet sent every 1 second
+// Query: 64 byte packet, HEALTH_MONITOR_QUERY_INTERVAL_MS (default 1 s, min 10 ms)
 // Response: 6 packets with VL_IDX=4484 (0x1184) in DST MAC[4:5]
-// Timeout: 500ms per cycle
+// Timeout: 500ms per cycle (capped at query interval)
+//
+// Event-driven: timerfd + epoll, kernel BPF filter on VL_IDX (PRBS trafiği
+// user space'e gelmez), recvmmsg batch RX. Tablolar ayrı render thread'inde
+// basılır, query -> response latency istatistiği tutulur.
 
 #ifndef HEALTH_MONITOR_ENABLED
 #define HEALTH_MONITOR_ENABLED 0
@@ -1043,12 +1504,12 @@ struct ptp_session_config
 #endif
 
 #define PACKET_TRACE_PORT      2      // Izlenecek port
-#define PACKET_TRACE_VL_IDX_TX 160    // Izlenecek VL-IDX (RX tarafinda, remap oncesi)
-#define PACKET_TRACE_VL_IDX_RX 128    // Izlenecek VL-IDX (TX tarafinda, remap sonrasi: 160-32=128)
+#define PACKET_TRACE_VL_IDX_TX 160    // Izlenecek VL-IDX (TX tarafinda, remap oncesi)
+#define PACKET_TRACE_VL_IDX_RX 128    // Izlenecek VL-IDX (RX tarafinda, remap sonrasi: 160-32=128)
 #define PACKET_TRACE_SEQ       10000  // Her N pakette bir trace (0 = hepsini trace et)
 #define PACKET_TRACE_COUNT     1      // Kac paket trace edilecek (SEQ=0 ise)
 
-// Second trace target: Port 0, VL-IDX 622 (RX from VMC_1) → 356 (TX back, cross-remap -266)
+// Second trace target: Port 0, VL-IDX 622 (TX) → 356 (RX, cross-remap -266)
 #define PACKET_TRACE2_PORT      0
 #define PACKET_TRACE2_VL_IDX_TX 622
 #define PACKET_TRACE2_VL_IDX_RX 356
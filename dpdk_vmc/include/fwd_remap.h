@@ -0,0 +1,396 @@
+#ifndef FWD_REMAP_H
+#define FWD_REMAP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <rte_byteorder.h>
+#include <rte_mbuf.h>
+#include <rte_prefetch.h>
+#include "config.h"
+#include "tx_rx_manager.h"  // port_vlans, BURST_SIZE, MAX_VL_ID, VL_RANGE_SIZE_PER_QUEUE
+
+// ==========================================
+// FORWARD VL-ID / VLAN REMAP TABLE
+// ==========================================
+// forward_worker's remap used to scan the port's R1 / R2 ranges for every
+// packet (process_packet). The result only depends on the incoming VL-ID,
+// so it is resolved once per port into a table indexed by VL-ID:
+//
+//   vl_be      - outgoing VL-ID, stored as-is at DST MAC[4..5] and DST IP[2..3]
+//   csum_delta - RFC 1624 ~m + m' for the IPv4 header checksum
+//   vlan       - new VID, or (VLAN_REMAP_OFFSET | FWD_REMAP_VID_KEEP) added
+//                to the incoming VID; priority + DEI are always kept
+//   port       - TX port (R2 cross-port forwarding)
+//
+// fwd_remap_burst looks up the whole burst first (and prefetches the
+// payload line splitmix64_transform reads next), then rewrites it: no
+// range scan, no branch on the range type, no allocation. Both paths
+// update the IPv4 checksum for the rewritten DST IP (fwd_remap_csum_adjust).
+//
+// Untagged frames, VL-IDs above MAX_VL_ID and frames whose DST IP VL-ID
+// differs from the DST MAC one take process_packet, which stays the
+// reference: fwd_remap_check compares both for every VL-ID at startup and
+// in bench/fwd_remap_bench.c.
+
+// VLAN remapping offset: RX VLAN + offset = TX VLAN
+// VMC_2 receives 225,226,227,228 -> sends back as 97,98,99,100 (offset = -128)
+#define VLAN_REMAP_OFFSET (-128)
+
+#define FWD_REMAP_VID_KEEP   0x8000  // fwd_remap_entry.vlan: add to the incoming VID
+#define FWD_REMAP_TCI_OFF    14
+#define FWD_REMAP_MAC_VL_OFF 4       // DST MAC[4..5]
+#define FWD_REMAP_CSUM_OFF   28      // IPv4 header checksum (VLAN frame)
+#define FWD_REMAP_IP_VL_OFF  36      // DST IP[2..3] (VLAN frame)
+#define FWD_REMAP_PROBE_LEN  64
+
+struct fwd_remap_entry {
+    uint16_t vl_be;        // Outgoing VL-ID, network order
+    uint16_t csum_delta;   // ~m + m' in network order, 0 when the VL-ID is kept
+    uint16_t vlan;
+    uint16_t port;
+};
+
+struct fwd_remap_table {
+    struct fwd_remap_entry e[MAX_VL_ID + 1];
+};
+
+/**
+ * RFC 1624 eqn. 3 on the IPv4 header checksum of a VLAN frame:
+ * HC' = ~(~HC + delta), delta = ~m + m' folded. Network order throughout
+ * (one's complement sums are byte order independent, RFC 1071).
+ */
+static inline void fwd_remap_csum_adjust(uint8_t *pkt, uint16_t delta_be)
+{
+    uint16_t csum;
+
+    memcpy(&csum, pkt + FWD_REMAP_CSUM_OFF, sizeof(csum));
+    uint32_t sum = (uint32_t)(uint16_t)~csum + delta_be;
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    csum = (uint16_t)~sum;
+    memcpy(pkt + FWD_REMAP_CSUM_OFF, &csum, sizeof(csum));
+}
+
+/**
+ * New VL-ID into DST MAC[4..5] and DST IP[2..3]; on VLAN frames the IPv4
+ * checksum follows the DST IP word it had before.
+ */
+static inline void fwd_remap_set_vl(uint8_t *pkt, uint16_t new_vl)
+{
+    uint16_t old_be, new_be = rte_cpu_to_be_16(new_vl);
+
+    memcpy(&old_be, pkt + FWD_REMAP_IP_VL_OFF, sizeof(old_be));
+    memcpy(pkt + FWD_REMAP_MAC_VL_OFF, &new_be, sizeof(new_be));
+    memcpy(pkt + FWD_REMAP_IP_VL_OFF, &new_be, sizeof(new_be));
+
+    if (likely(pkt[12] == 0x81 && pkt[13] == 0x00)) {
+        uint32_t delta = (uint32_t)(uint16_t)~old_be + new_be;
+        delta = (delta & 0xFFFF) + (delta >> 16);
+        fwd_remap_csum_adjust(pkt, (uint16_t)delta);
+    }
+}
+
+/**
+ * Remap VLAN tag in packet before forwarding back.
+ * VLAN TCI is at offset 14-15 in Ethernet frame (after 12B MACs + 2B 0x8100).
+ * Only modifies the 12-bit VLAN ID, preserves 3-bit priority + DEI.
+ */
+static inline void remap_vlan_tag(struct rte_mbuf *mbuf)
+{
+    uint8_t *pkt = rte_pktmbuf_mtod(mbuf, uint8_t *);
+
+    // Check if VLAN tagged (EtherType at offset 12-13 == 0x8100)
+    uint16_t ether_type = ((uint16_t)pkt[12] << 8) | pkt[13];
+    if (likely(ether_type == 0x8100)) {
+        uint16_t tci = ((uint16_t)pkt[14] << 8) | pkt[15];
+        uint16_t vlan_id = tci & 0x0FFF;
+        uint16_t priority_dei = tci & 0xF000;  // preserve priority + DEI
+        uint16_t new_vlan = vlan_id + VLAN_REMAP_OFFSET;
+        uint16_t new_tci = priority_dei | (new_vlan & 0x0FFF);
+        pkt[14] = (uint8_t)(new_tci >> 8);
+        pkt[15] = (uint8_t)(new_tci & 0xFF);
+    }
+}
+
+/**
+ * Process a single packet: remap VL-ID + determine cross-port routing.
+ * Returns the target port_id for this packet.
+ * Also sets the VLAN tag: either normal remap or cross-port VLAN override.
+ * Per-packet reference of the remap table, fallback of fwd_remap_burst.
+ */
+static inline uint16_t process_packet(struct rte_mbuf *mbuf, uint16_t rx_port_id)
+{
+    if (rx_port_id >= MAX_PORTS_CONFIG)
+        return rx_port_id;
+
+    uint8_t *pkt = rte_pktmbuf_mtod(mbuf, uint8_t *);
+    uint16_t vl_id = ((uint16_t)pkt[4] << 8) | pkt[5];
+
+    const struct port_vlan_config *cfg = &port_vlans[rx_port_id];
+    uint16_t queue_count = cfg->tx_vlan_count;
+
+    for (uint16_t q = 0; q < queue_count; q++)
+    {
+        // Check Range 1
+        uint16_t r1_start = cfg->tx_vl_ids[q];
+        uint16_t r1_size = (cfg->tx_vl_range1_size[q] > 0)
+                           ? cfg->tx_vl_range1_size[q]
+                           : VL_RANGE_SIZE_PER_QUEUE;
+        if (vl_id >= r1_start && vl_id < r1_start + r1_size) {
+            // Range 1: always same-port, apply VL-ID remap + normal VLAN remap
+            int16_t offset = cfg->vl_id_remap_offset[q];
+            if (offset != 0)
+                fwd_remap_set_vl(pkt, (uint16_t)((int32_t)vl_id + offset));
+            remap_vlan_tag(mbuf);
+            return rx_port_id;
+        }
+
+        // Check Range 2
+        uint16_t r2_start = cfg->tx_vl_ids2[q];
+        if (r2_start > 0) {
+            uint16_t r2_size = cfg->tx_vl_range2_size[q];
+            if (vl_id >= r2_start && vl_id < r2_start + r2_size) {
+                // Apply VL-ID remap if configured
+                int16_t offset = cfg->vl_id_remap_offset2[q];
+                if (offset != 0)
+                    fwd_remap_set_vl(pkt, (uint16_t)((int32_t)vl_id + offset));
+
+                // Check VLAN override / cross-port forwarding
+                uint16_t fwd_port = cfg->r2_fwd_port[q];
+                uint16_t fwd_vlan = cfg->r2_fwd_vlan[q];
+                if (fwd_vlan > 0) {
+                    // VLAN override: set specific VLAN instead of normal remap
+                    // fwd_port > 0 → cross-port, fwd_port == 0 → same-port
+                    uint16_t ether_type = ((uint16_t)pkt[12] << 8) | pkt[13];
+                    if (likely(ether_type == 0x8100)) {
+                        uint16_t tci = ((uint16_t)pkt[14] << 8) | pkt[15];
+                        uint16_t priority_dei = tci & 0xF000;
+                        uint16_t new_tci = priority_dei | (fwd_vlan & 0x0FFF);
+                        pkt[14] = (uint8_t)(new_tci >> 8);
+                        pkt[15] = (uint8_t)(new_tci & 0xFF);
+                    }
+                    return (fwd_port > 0) ? fwd_port : rx_port_id;
+                }
+
+                // Same-port: normal VLAN remap
+                remap_vlan_tag(mbuf);
+                return rx_port_id;
+            }
+        }
+    }
+
+    // VL-ID not found in any range, just do normal VLAN remap
+    remap_vlan_tag(mbuf);
+    return rx_port_id;
+}
+
+/**
+ * Resolve one VL-ID the way process_packet does (first matching queue,
+ * R1 before R2) and store the precomputed rewrite.
+ */
+static inline void fwd_remap_resolve(struct fwd_remap_entry *e,
+                                     const struct port_vlan_config *cfg,
+                                     uint16_t rx_port_id, uint16_t vl_id)
+{
+    uint16_t new_vl = vl_id;
+    uint16_t vlan = (VLAN_REMAP_OFFSET & 0x0FFF) | FWD_REMAP_VID_KEEP;
+    uint16_t port = rx_port_id;
+
+    for (uint16_t q = 0; q < cfg->tx_vlan_count; q++) {
+        uint16_t r1_start = cfg->tx_vl_ids[q];
+        uint16_t r1_size = (cfg->tx_vl_range1_size[q] > 0)
+                           ? cfg->tx_vl_range1_size[q]
+                           : VL_RANGE_SIZE_PER_QUEUE;
+        if (vl_id >= r1_start && vl_id < r1_start + r1_size) {
+            new_vl = (uint16_t)((int32_t)vl_id + cfg->vl_id_remap_offset[q]);
+            break;
+        }
+
+        uint16_t r2_start = cfg->tx_vl_ids2[q];
+        if (r2_start > 0 && vl_id >= r2_start &&
+            vl_id < r2_start + cfg->tx_vl_range2_size[q]) {
+            new_vl = (uint16_t)((int32_t)vl_id + cfg->vl_id_remap_offset2[q]);
+            if (cfg->r2_fwd_vlan[q] > 0) {
+                vlan = cfg->r2_fwd_vlan[q] & 0x0FFF;
+                if (cfg->r2_fwd_port[q] > 0)
+                    port = cfg->r2_fwd_port[q];
+            }
+            break;
+        }
+    }
+
+    // RFC 1624 eqn. 3: HC' = ~(~HC + ~m + m'), ~m + m' folded here
+    uint32_t delta = 0;
+    if (new_vl != vl_id) {
+        delta = (uint32_t)(uint16_t)~vl_id + new_vl;
+        delta = (delta & 0xFFFF) + (delta >> 16);
+    }
+
+    e->vl_be = rte_cpu_to_be_16(new_vl);
+    e->csum_delta = rte_cpu_to_be_16((uint16_t)delta);
+    e->vlan = vlan;
+    e->port = port;
+}
+
+/**
+ * Fill the table of rx_port_id from port_vlans (forwarder config loaded)
+ */
+static inline void fwd_remap_build(struct fwd_remap_table *t, uint16_t rx_port_id)
+{
+    const struct port_vlan_config *cfg = &port_vlans[rx_port_id];
+
+    for (uint32_t vl = 0; vl <= MAX_VL_ID; vl++)
+        fwd_remap_resolve(&t->e[vl], cfg, rx_port_id, (uint16_t)vl);
+}
+
+/**
+ * Rewrite one tagged frame from its entry, returns the TX port.
+ * Only the TCI is byte-swapped, VL-ID and checksum stay in network order.
+ */
+static inline uint16_t fwd_remap_apply(const struct fwd_remap_entry *e, uint8_t *pkt)
+{
+    uint16_t tci_be;
+
+    memcpy(&tci_be, pkt + FWD_REMAP_TCI_OFF, sizeof(tci_be));
+    uint16_t tci = rte_be_to_cpu_16(tci_be);
+    uint16_t keep = (uint16_t)(0u - (e->vlan >> 15)) & 0x0FFF;
+    tci = (tci & 0xF000) | (((tci & keep) + e->vlan) & 0x0FFF);
+    tci_be = rte_cpu_to_be_16(tci);
+    memcpy(pkt + FWD_REMAP_TCI_OFF, &tci_be, sizeof(tci_be));
+
+    memcpy(pkt + FWD_REMAP_MAC_VL_OFF, &e->vl_be, sizeof(e->vl_be));
+    memcpy(pkt + FWD_REMAP_IP_VL_OFF, &e->vl_be, sizeof(e->vl_be));
+
+    fwd_remap_csum_adjust(pkt, e->csum_delta);
+
+    return e->port;
+}
+
+/**
+ * Remap a burst: entry lookup for every packet first, then the rewrites.
+ * t == NULL (no table for the port, FWD_REMAP_TABLE=0): process_packet.
+ */
+static inline void fwd_remap_burst(const struct fwd_remap_table *t, struct rte_mbuf **bufs,
+                                   uint16_t nb, uint16_t rx_port_id, uint16_t *targets)
+{
+    const struct fwd_remap_entry *ent[BURST_SIZE];
+
+    if (t == NULL) {
+        for (uint16_t i = 0; i < nb; i++)
+            targets[i] = process_packet(bufs[i], rx_port_id);
+        return;
+    }
+
+    for (uint16_t i = 0; i < nb; i++) {
+        const uint8_t *pkt = rte_pktmbuf_mtod(bufs[i], const uint8_t *);
+        uint16_t ether_type, mac_vl, ip_vl;
+        memcpy(&ether_type, pkt + 12, sizeof(ether_type));
+        memcpy(&mac_vl, pkt + FWD_REMAP_MAC_VL_OFF, sizeof(mac_vl));
+        memcpy(&ip_vl, pkt + FWD_REMAP_IP_VL_OFF, sizeof(ip_vl));
+        uint16_t vl_id = rte_be_to_cpu_16(mac_vl);
+        rte_prefetch0(pkt + RTE_CACHE_LINE_SIZE);   // splitmix64_transform's payload line
+
+        if (likely(ether_type == rte_cpu_to_be_16(0x8100) && vl_id <= MAX_VL_ID &&
+                   ip_vl == mac_vl))
+            ent[i] = &t->e[vl_id];
+        else
+            ent[i] = NULL;
+    }
+
+    for (uint16_t i = 0; i < nb; i++) {
+        if (likely(ent[i] != NULL))
+            targets[i] = fwd_remap_apply(ent[i], rte_pktmbuf_mtod(bufs[i], uint8_t *));
+        else
+            targets[i] = process_packet(bufs[i], rx_port_id);
+    }
+}
+
+// One's complement sum of a 20-byte IPv4 header, 0xFFFF when the checksum is valid
+static inline uint16_t fwd_remap_ip_sum(const uint8_t *ip)
+{
+    uint32_t sum = 0;
+    for (int i = 0; i < 20; i += 2)
+        sum += ((uint32_t)ip[i] << 8) | ip[i + 1];
+    while (sum >> 16)
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    return (uint16_t)sum;
+}
+
+/**
+ * VLAN + IPv4/UDP probe frame as VMC_1 sends it: VL-ID in DST MAC and
+ * DST IP (224.224.x.y), valid header checksum
+ */
+static inline void fwd_remap_probe_frame(uint8_t *pkt, uint16_t vl_id, uint16_t tci)
+{
+    memset(pkt, 0, FWD_REMAP_PROBE_LEN);
+    pkt[0] = 0x03;
+    pkt[4] = (uint8_t)(vl_id >> 8);
+    pkt[5] = (uint8_t)vl_id;
+    pkt[6] = 0x02;
+    pkt[12] = 0x81;
+    pkt[14] = (uint8_t)(tci >> 8);
+    pkt[15] = (uint8_t)tci;
+    pkt[16] = 0x08;
+
+    uint8_t *ip = pkt + 18;
+    ip[0] = 0x45;
+    ip[3] = FWD_REMAP_PROBE_LEN - 18;
+    ip[8] = 1;
+    ip[9] = 17;
+    ip[12] = 10;
+    ip[15] = 1;
+    ip[16] = 224;
+    ip[17] = 224;
+    ip[18] = (uint8_t)(vl_id >> 8);
+    ip[19] = (uint8_t)vl_id;
+    uint16_t csum = (uint16_t)~fwd_remap_ip_sum(ip);
+    ip[10] = (uint8_t)(csum >> 8);
+    ip[11] = (uint8_t)csum;
+}
+
+/**
+ * Table vs process_packet for every VL-ID 0..MAX_VL_ID, with the port's RX
+ * VLANs and edge VIDs under two priorities. Frames must match byte for
+ * byte with a valid IPv4 checksum; same TX port.
+ * @return number of mismatching probes (0 = table usable)
+ */
+static inline uint32_t fwd_remap_check(const struct fwd_remap_table *t, uint16_t rx_port_id)
+{
+    const struct port_vlan_config *cfg = &port_vlans[rx_port_id];
+    uint16_t vids[MAX_RX_VLANS_PER_PORT + 4] = { 0, 127, 128, 0x0FFF };
+    uint16_t nb_vids = 4;
+    uint8_t ref_pkt[FWD_REMAP_PROBE_LEN], tbl_pkt[FWD_REMAP_PROBE_LEN];
+    struct rte_mbuf ref_m, tbl_m;
+    uint32_t bad = 0;
+
+    for (uint16_t i = 0; i < cfg->rx_vlan_count && i < MAX_RX_VLANS_PER_PORT; i++)
+        vids[nb_vids++] = cfg->rx_vlans[i] & 0x0FFF;
+
+    memset(&ref_m, 0, sizeof(ref_m));
+    memset(&tbl_m, 0, sizeof(tbl_m));
+    ref_m.buf_addr = ref_pkt;
+    tbl_m.buf_addr = tbl_pkt;
+    ref_m.pkt_len = ref_m.data_len = FWD_REMAP_PROBE_LEN;
+    tbl_m.pkt_len = tbl_m.data_len = FWD_REMAP_PROBE_LEN;
+
+    for (uint32_t vl = 0; vl <= MAX_VL_ID; vl++) {
+        for (uint16_t v = 0; v < nb_vids * 2; v++) {
+            uint16_t tci = vids[v >> 1] | ((v & 1) ? 0xB000 : 0x2000);
+            struct rte_mbuf *ref_p = &ref_m, *tbl_p = &tbl_m;
+            uint16_t ref_port, tbl_port;
+
+            fwd_remap_probe_frame(ref_pkt, (uint16_t)vl, tci);
+            memcpy(tbl_pkt, ref_pkt, FWD_REMAP_PROBE_LEN);
+            ref_port = process_packet(ref_p, rx_port_id);
+            fwd_remap_burst(t, &tbl_p, 1, rx_port_id, &tbl_port);
+
+            if (ref_port != tbl_port ||
+                memcmp(ref_pkt, tbl_pkt, FWD_REMAP_PROBE_LEN) != 0 ||
+                fwd_remap_ip_sum(tbl_pkt + 18) != 0xFFFF)
+                bad++;
+        }
+    }
+    return bad;
+}
+
+#endif /* FWD_REMAP_H */
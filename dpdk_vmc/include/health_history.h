@@ -0,0 +1,142 @@
+#ifndef HEALTH_HISTORY_H
+#define HEALTH_HISTORY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "health_types.h"
+
+// ==========================================
+// HEALTH HISTORY CONFIGURATION
+// ==========================================
+// Last HEALTH_HISTORY_DEPTH cycles are kept as compact samples (fixed memory).
+// The monitor thread only extracts the sample; deltas, rates, summaries,
+// alarms and CSV dumps run on the render thread.
+
+#define HEALTH_HISTORY_DEPTH 512                    // Cycles kept (power of 2)
+#define HEALTH_HISTORY_SUMMARY_INTERVAL_MS 10000    // Summary table print period
+#define HEALTH_HISTORY_CSV_PATH "/tmp/health_history.csv"  // SIGUSR1 dump target
+
+// Alarm thresholds
+#define HEALTH_ALARM_FPGA_TEMP_C 95.0               // FPGA temperature high
+#define HEALTH_ALARM_BOARD_TEMP_C 85.0              // MCU board temperature high
+#define HEALTH_ALARM_TEMP_RISE_C_PER_S 2.0          // Temperature rate-of-change
+#define HEALTH_ALARM_VOLT_12V_MIN 11.4              // 12V rail low
+#define HEALTH_ALARM_VOLT_12V_MAX 12.6              // 12V rail high
+#define HEALTH_ALARM_ERR_RATE_PER_S 1.0             // Any FPGA error counter rate
+#define HEALTH_ALARM_PORT_ERR_DELTA 1               // Per-port error counter jump in one cycle
+#define HEALTH_ALARM_MISSED_CYCLES 3                // Consecutive incomplete cycles
+
+// ==========================================
+// METRICS
+// ==========================================
+
+typedef enum {
+    HM_RESPONSES = 0,
+    // Assistant FPGA
+    HM_AST_TEMP_C,
+    HM_AST_VOLT_V,
+    HM_AST_TX_TOTAL,
+    HM_AST_RX_TOTAL,
+    HM_AST_TX_ERR,
+    HM_AST_RX_ERR,
+    HM_AST_CRC_ERR,
+    HM_AST_POLICY_DROP,
+    HM_AST_VLID_DROP,
+    HM_AST_QUEUE_OVF,
+    // Manager FPGA
+    HM_MGR_TEMP_C,
+    HM_MGR_VOLT_V,
+    HM_MGR_TX_TOTAL,
+    HM_MGR_RX_TOTAL,
+    HM_MGR_TX_ERR,
+    HM_MGR_RX_ERR,
+    HM_MGR_CRC_ERR,
+    HM_MGR_POLICY_DROP,
+    HM_MGR_VLID_DROP,
+    HM_MGR_QUEUE_OVF,
+    // MCU
+    HM_MCU_BOARD_TEMP_C,
+    HM_MCU_FO_TEMP_C,
+    HM_MCU_VOLT_12V,
+    HM_MCU_CURR_12V,
+    HM_METRIC_COUNT
+} health_metric_t;
+
+typedef enum {
+    HM_KIND_GAUGE = 0,    // Instantaneous value (temperature, voltage)
+    HM_KIND_COUNTER = 1   // Monotonic counter, summarized as rate (per second)
+} health_metric_kind_t;
+
+/**
+ * @brief One cycle, compact form
+ */
+struct health_history_sample {
+    uint64_t seq;                               // Cycle number + 1, 0 while being written
+    uint64_t time_ms;                           // CLOCK_MONOTONIC at cycle end
+    uint64_t valid_mask;                        // Bit per metric (source received)
+    double   value[HM_METRIC_COUNT];
+    uint64_t port_err[FPGA_TYPE_COUNT][HEALTH_MAX_PORTS];  // Sum of per-port error counters
+    uint64_t port_valid[FPGA_TYPE_COUNT];                  // Bit per port
+};
+
+/**
+ * @brief Summary of one metric over the ring
+ */
+struct health_metric_summary {
+    uint32_t samples;
+    double   last;
+    double   min;
+    double   max;
+    double   mean;
+    double   p50;
+    double   p95;
+    double   p99;
+};
+
+// ==========================================
+// FUNCTION DECLARATIONS
+// ==========================================
+
+/**
+ * @brief Reset history ring and alarm state
+ */
+void health_history_reset(void);
+
+/**
+ * @brief Record a finished cycle (monitor thread, O(ports), no allocation)
+ * @param cycle Parsed cycle data
+ * @param time_ms CLOCK_MONOTONIC at cycle end
+ */
+void health_history_record(const struct health_cycle_data *cycle, uint64_t time_ms);
+
+/**
+ * @brief Process new samples: deltas, rates, alarms (render thread)
+ * @return Number of alarms raised
+ */
+int health_history_analyze(void);
+
+/**
+ * @brief Summarize one metric over the ring (value for gauges, rate for counters)
+ * @param metric Metric index
+ * @param out Output summary
+ */
+void health_history_summary(health_metric_t metric, struct health_metric_summary *out);
+
+/**
+ * @brief Print summary table of all metrics
+ */
+void health_history_print_summary(void);
+
+/**
+ * @brief Dump ring to CSV (values and per-second rates)
+ * @param path Output file path
+ * @return Number of rows written, -1 on failure
+ */
+int health_history_dump_csv(const char *path);
+
+/**
+ * @brief Total alarms raised since reset
+ */
+uint64_t health_history_alarm_count(void);
+
+#endif // HEALTH_HISTORY_H
@@ -11,8 +11,13 @@
 // ==========================================
 
 #define HEALTH_MONITOR_INTERFACE "eno12409"  // Port 13 interface
-#define HEALTH_MONITOR_QUERY_INTERVAL_MS 1000  // Query interval (1 second)
-#define HEALTH_MONITOR_RESPONSE_TIMEOUT_MS 500  // Response timeout (500ms)
+#ifndef HEALTH_MONITOR_QUERY_INTERVAL_MS
+#define HEALTH_MONITOR_QUERY_INTERVAL_MS 1000  // Query interval (1 second, runtime: set_health_monitor_interval)
+#endif
+#define HEALTH_MONITOR_MIN_INTERVAL_MS 10  // Lowest accepted query interval
+#define HEALTH_MONITOR_RESPONSE_TIMEOUT_MS 500  // Response timeout (500ms, capped at query interval)
+#define HEALTH_MONITOR_RENDER_INTERVAL_MS 1000  // Table print period (render thread)
+#define HEALTH_MONITOR_RX_BATCH 8  // recvmmsg batch size
 #define HEALTH_MONITOR_EXPECTED_RESPONSES HEALTH_TOTAL_EXPECTED_PACKETS  // 6 (2 assistant + 3 manager + 1 MCU)
 #define HEALTH_MONITOR_QUERY_SIZE 64  // Query packet size
 #define HEALTH_MONITOR_SEQ_INIT 0x2F  // Initial sequence number (47)
@@ -31,9 +36,18 @@ struct health_monitor_stats {
     uint64_t queries_sent;        // Total queries sent
     uint64_t responses_received;  // Total responses received
     uint64_t timeouts;            // Cycles with incomplete responses
+    uint64_t unexpected_packets;  // Accepted by filter but not parseable
     uint8_t  current_sequence;    // Current sequence number
     uint64_t last_cycle_time_ms;  // Last cycle duration in ms
     uint8_t  last_response_count; // Responses in last cycle
+
+    // Query -> response latency (us, kernel RX timestamp based)
+    uint64_t last_first_latency_us;  // Query -> first response (last cycle)
+    uint64_t last_latency_us;        // Query -> last response (last cycle)
+    uint64_t resp_latency_min_us;    // Per response, all cycles
+    uint64_t resp_latency_max_us;
+    uint64_t resp_latency_sum_us;
+    uint64_t resp_latency_samples;
 };
 
 // ==========================================
@@ -45,11 +59,25 @@ struct health_monitor_state {
     pthread_t thread;
     volatile bool running;
 
+    // Render thread (prints tables off the query/response path)
+    pthread_t render_thread;
+    pthread_mutex_t render_lock;
+    pthread_cond_t render_cond;
+    struct health_cycle_data render_cycle;  // Last completed cycle (under render_lock)
+    uint64_t render_seq;                    // Completed cycle counter (under render_lock)
+
     // Sockets
     int tx_socket;
     int rx_socket;
     int if_index;
 
+    // Event loop (epoll: query timer, response deadline, RX socket, stop)
+    int epoll_fd;
+    int query_timer_fd;
+    int deadline_timer_fd;
+    int wake_fd;
+    volatile uint32_t interval_ms;
+
     // Query packet (template)
     uint8_t query_packet[HEALTH_MONITOR_QUERY_SIZE];
 
@@ -94,6 +122,13 @@ void cleanup_health_monitor(void);
  */
 void get_health_monitor_stats(struct health_monitor_stats *stats);
 
+/**
+ * @brief Change query interval at runtime
+ * @param interval_ms Query interval (>= HEALTH_MONITOR_MIN_INTERVAL_MS)
+ * @return 0 on success, -1 on failure
+ */
+int set_health_monitor_interval(uint32_t interval_ms);
+
 /**
  * @brief Print health monitor statistics
  */
@@ -314,8 +314,32 @@ struct health_cycle_data {
     struct health_fpga_data  manager;               // Manager FPGA data
     struct health_mcu_info   mcu;                   // MCU data
     uint8_t  total_responses_received;              // Total responses this cycle
+    uint8_t  unexpected_packets;                    // Filtered in but not parseable
     uint8_t  last_fpga_type;                        // Last identified FPGA from 1187-byte packet
                                                     // 0=none, STATUS_ENABLE_ASSISTANT or STATUS_ENABLE_MANAGER
 };
 
+// ==========================================
+// CONVERSION HELPERS
+// ==========================================
+
+// FPGA voltage: [14:3] integer mV, [2:0] tenths of mV
+static inline double convert_fpga_voltage(uint16_t raw)
+{
+    uint16_t integer_part = (raw & 0x7FF8) >> 3;
+    uint16_t fractional_part = raw & 0x7;
+    double milli_volt = (double)integer_part + (double)fractional_part / 10.0;
+    return milli_volt / 1000.0;
+}
+
+// FPGA temperature: [14:4] integer K, [3:0] fraction
+static inline double convert_fpga_temperature(uint16_t raw)
+{
+    uint16_t integer_part = (raw & 0x7FF0) >> 4;
+    uint16_t fractional_part = raw & 0xF;
+    double divisor = (fractional_part >= 10) ? 100.0 : 10.0;
+    double kelvin = (double)integer_part + (double)fractional_part / divisor;
+    return kelvin - 273.15;
+}
+
 #endif // HEALTH_TYPES_H
\ No newline at end of file
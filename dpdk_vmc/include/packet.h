@@ -7,6 +7,7 @@
 #include <rte_ip.h>
 #include <rte_udp.h>
 #include <rte_mbuf.h>
+#include <rte_memzone.h>
 #include "config.h"  // IMIX configuration
 
 /*
@@ -114,7 +115,7 @@
 
 #define ETHER_TYPE_IPv4 0x0800
 #define ETHER_TYPE_VLAN 0x8100
-#define MAX_PRBS_CACHE_PORTS 12
+#define MAX_PRBS_CACHE_PORTS 16   // Indexed by port_id, >= MAX_PORTS
 
 struct ports_config; 
 
@@ -180,6 +181,11 @@ struct prbs_cache {
     uint32_t  initial_state; // Initial PRBS-31 state
     bool      initialized;
     int       socket_id;
+#if PRBS_EXTBUF_TX_ENABLED
+    const struct rte_memzone *cache_ext_mz; // IOVA-contiguous zone of cache_ext, NULL: rte_malloc
+    rte_iova_t cache_ext_iova; // IOVA of cache_ext (contiguous)
+    bool      extbuf_ready;  // cache_ext usable as TX extbuf
+#endif
 };
 
 // global PRBS cache
@@ -192,6 +198,10 @@ extern struct prbs_cache port_prbs_cache[MAX_PRBS_CACHE_PORTS];
 // PRBS utilities
 void init_prbs_cache_for_all_ports(uint16_t nb_ports, const struct ports_config *ports);
 void cleanup_prbs_cache(void);
+// Parallel startup: generate each port's cache on its first TX lcore while the
+// main lcore configures ports; prbs_cache_wait before any TX worker starts
+int  prbs_cache_start_async(uint16_t nb_ports, const struct ports_config *ports);
+void prbs_cache_wait(void);
 uint8_t* get_prbs_cache_for_port(uint16_t port_id);
 uint8_t* get_prbs_cache_ext_for_port(uint16_t port_id);
 
@@ -212,6 +222,17 @@ void fill_payload_with_prbs31_dynamic(struct rte_mbuf *mbuf, uint16_t port_id,
                                        uint64_t sequence_number, uint16_t l2_len,
                                        uint16_t prbs_len);
 
+#if PRBS_EXTBUF_TX_ENABLED
+// Zero-copy PRBS payload: init per-worker shared info (never freed), then
+// per packet write seq into the header mbuf and chain a segment from
+// seg_pool attached to cache_ext at the sequence's PRBS offset.
+// Returns -1 if no segment could be allocated (pkt left untouched).
+void prbs_extbuf_shinfo_init(struct rte_mbuf_ext_shared_info *shinfo);
+int  attach_prbs_extbuf(struct rte_mbuf *pkt, struct rte_mempool *seg_pool,
+                        struct rte_mbuf_ext_shared_info *shinfo, uint16_t port_id,
+                        uint64_t sequence_number, uint16_t l2_len, uint16_t prbs_len);
+#endif
+
 // Legacy wrapper (sabit boyut için geriye uyumluluk)
 static inline void fill_payload_with_prbs31(struct rte_mbuf *mbuf, uint16_t port_id,
                                              uint64_t sequence_number, uint16_t l2_len)
@@ -0,0 +1,107 @@
+#ifndef PAYLOAD_TRANSFORM_H
+#define PAYLOAD_TRANSFORM_H
+
+#include <stdint.h>
+#include <nmmintrin.h>  // SSE4.2 CRC32C
+#include <rte_mbuf.h>
+#include "packet.h"
+
+// ==========================================
+// SPLITMIX64 PAYLOAD TRANSFORM
+// VMC_2 transforms the payload to prove it processed the packet.
+// 1. XOR payload[8..71] with splitmix64-generated 64 bytes (keyed by seq)
+// 2. Write CRC32C over (seq + XOR'd data) at payload[72..75]
+// 3. Remaining payload (offset 76+) stays untouched
+// VMC_1 verifies CRC32C, then checks PRBS on remaining payload[76+].
+//
+// Hot-path primitives shared by the workers and the bench/ suite, so the
+// benchmark measures exactly the code that runs on the lcores.
+// ==========================================
+
+#define SPLITMIX_XOR_BYTES   64
+#define SPLITMIX_CRC_BYTES   4
+#define SPLITMIX_TOTAL_OVERHEAD (SPLITMIX_XOR_BYTES + SPLITMIX_CRC_BYTES)  // 68
+#define SPLITMIX_MIN_PAYLOAD (SEQ_BYTES + SPLITMIX_TOTAL_OVERHEAD)         // 76
+
+static inline uint64_t splitmix64(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Hardware CRC32C over arbitrary length (SSE4.2)
+static inline uint32_t hw_crc32c(const void *data, uint32_t len)
+{
+    uint64_t crc = 0xFFFFFFFF;
+    const uint64_t *p64 = (const uint64_t *)data;
+    uint32_t n64 = len / 8;
+    for (uint32_t i = 0; i < n64; i++)
+        crc = _mm_crc32_u64(crc, p64[i]);
+    const uint8_t *p8 = (const uint8_t *)(p64 + n64);
+    for (uint32_t i = 0; i < (len & 7); i++)
+        crc = _mm_crc32_u8((uint32_t)crc, p8[i]);
+    return (uint32_t)(crc ^ 0xFFFFFFFF);
+}
+
+// XOR payload[8..71] with splitmix64 and write CRC32C at [72..75]
+static inline void splitmix64_transform_payload(uint8_t *payload)
+{
+    uint64_t seq = *(uint64_t *)payload;
+
+    // XOR payload[8..71] with 8 splitmix64 outputs
+    uint64_t *data = (uint64_t *)(payload + SEQ_BYTES);
+    for (int i = 0; i < 8; i++)
+        data[i] ^= splitmix64(seq * 8 + i);
+
+    // CRC32C over seq(8B) + XOR'd data(64B) = 72 bytes
+    uint32_t crc = hw_crc32c(payload, SEQ_BYTES + SPLITMIX_XOR_BYTES);
+    *(uint32_t *)(payload + SEQ_BYTES + SPLITMIX_XOR_BYTES) = crc;
+}
+
+// Transform payload: XOR 64 bytes with splitmix64, write CRC32C
+static inline void splitmix64_transform(struct rte_mbuf *mbuf)
+{
+    uint8_t *pkt = rte_pktmbuf_mtod(mbuf, uint8_t *);
+    uint32_t payload_off = L2_HEADER_SIZE + IP_HDR_SIZE + UDP_HDR_SIZE;  // 46 (VLAN)
+
+    // Check minimum size
+    if (unlikely(mbuf->pkt_len < payload_off + SPLITMIX_MIN_PAYLOAD))
+        return;
+
+    splitmix64_transform_payload(pkt + payload_off);
+}
+
+// Check CRC32C written by splitmix64_transform_payload
+static inline bool splitmix64_crc_ok(const uint8_t *payload)
+{
+    uint32_t calc_crc = hw_crc32c(payload, SEQ_BYTES + SPLITMIX_XOR_BYTES);
+    uint32_t recv_crc = *(const uint32_t *)(payload + SEQ_BYTES + SPLITMIX_XOR_BYTES);
+    return calc_crc == recv_crc;
+}
+
+// ==========================================
+// PRBS BIT ERROR COUNT
+// ==========================================
+
+// Differing bits between received and expected PRBS (8B words + byte tail)
+static inline uint64_t prbs_bit_errors(const uint8_t *recv, const uint8_t *exp, uint32_t len)
+{
+    uint64_t berr = 0;
+    const uint64_t *r64 = (const uint64_t *)recv;
+    const uint64_t *e64 = (const uint64_t *)exp;
+    const uint32_t nq = len / 8;
+
+    for (uint32_t k = 0; k < nq; k++)
+        berr += __builtin_popcountll(r64[k] ^ e64[k]);
+
+    const uint8_t *r8 = (const uint8_t *)(r64 + nq);
+    const uint8_t *e8 = (const uint8_t *)(e64 + nq);
+    for (uint32_t k = 0; k < (len & 7); k++)
+        berr += __builtin_popcount(r8[k] ^ e8[k]);
+
+    return berr;
+}
+
+#endif /* PAYLOAD_TRANSFORM_H */
@@ -0,0 +1,112 @@
+#ifndef PCAP_REPLAY_H
+#define PCAP_REPLAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <rte_common.h>
+#include "config.h"
+#include "port.h"
+
+// ==========================================
+// PCAP REPLAY TX
+// ==========================================
+// A pcap file is loaded once into hugepage memory (frame table: TSC offset
+// from the first frame + length) and replayed by the normal TX workers'
+// lcores and queues instead of the PRBS generator. Frame i of the file goes
+// out on queue (i % NUM_TX_CORES) of every port, each frame at
+//   start + loop * loop_cycles + off_cycles * scale
+// so the per-port stream keeps the file's inter-frame timing and bursts.
+// scale = 1 / PCAP_REPLAY_SPEEDUP (original timing) or the factor that puts
+// the file's mean rate on the port's TARGET_GBPS (rate mode). Frames that
+// are due together leave in one tx_burst.
+//
+// PCAP_REPLAY_REWRITE=1: size and timing from the file, content rebuilt as a
+// test frame of the queue's VL range (VL-ID, VLAN, per-VL sequence, PRBS),
+// so RX verification works. PCAP_REPLAY_REWRITE=0: the captured bytes are
+// pre-converted into one mbuf per frame (per port pool) and sent zero-copy
+// (refcnt held, never rewritten).
+//
+// Timing error = TSC when the frame's burst is handed to the driver minus
+// its scheduled TSC (software schedule, not wire time).
+
+#if PCAP_REPLAY_ENABLED
+
+// Log-linear histogram of timing error (ns): 16 sub-buckets per power of 2
+#define REPLAY_HIST_SUB_BITS 4
+#define REPLAY_HIST_SUB      (1u << REPLAY_HIST_SUB_BITS)
+#define REPLAY_HIST_BUCKETS  (64 * REPLAY_HIST_SUB)
+
+struct replay_frame
+{
+    uint64_t off_cycles;    // TSC offset from the first frame (original timing)
+    uint16_t len;           // Bytes sent (clamped to the test frame sizes in rewrite mode)
+    uint16_t orig_len;      // Wire length in the file
+};
+
+// Per TX worker, single writer
+struct replay_stats
+{
+    uint64_t frames;
+    uint64_t bytes;
+    uint64_t drops;         // TX queue full, frame slot skipped
+    uint64_t loops;         // Completed passes over the file
+    uint64_t err_max_ns;
+    uint64_t hist[REPLAY_HIST_BUCKETS];
+} __rte_cache_aligned;
+
+// [port_id][queue_id] (memzone after stats_shm_init)
+extern struct replay_stats (*replay_stats)[NUM_TX_CORES];
+
+/**
+ * Load a pcap (Ethernet, usec or nsec timestamps, either byte order) and,
+ * in verbatim mode, pre-convert it into mbufs on every port's socket
+ * (call after port setup, before the TX workers start)
+ * @param path NULL = PCAP_REPLAY_FILE
+ * @return 0 on success, -1 on error
+ */
+int pcap_replay_load(const char *path, const struct ports_config *ports_config);
+
+/**
+ * Replay TX worker (lcore entry, arg = struct tx_worker_params *)
+ */
+int pcap_replay_tx_worker(void *arg);
+
+/**
+ * Achieved vs expected rate and timing error percentiles per port
+ * (call once per second)
+ */
+void pcap_replay_print_stats(const struct ports_config *ports_config);
+
+/**
+ * Zero the replay counters and histograms (snapshot, workers keep writing)
+ */
+void pcap_replay_reset_stats(void);
+
+/**
+ * Free the frame table and the pre-converted mbufs (after ports are stopped)
+ */
+void pcap_replay_cleanup(void);
+
+static inline uint32_t replay_hist_bucket(uint64_t ns)
+{
+    if (ns < REPLAY_HIST_SUB)
+        return (uint32_t)ns;
+    uint32_t msb = 63 - __builtin_clzll(ns);
+    uint32_t sub = (uint32_t)(ns >> (msb - REPLAY_HIST_SUB_BITS)) & (REPLAY_HIST_SUB - 1);
+    return (msb - REPLAY_HIST_SUB_BITS + 1) * REPLAY_HIST_SUB + sub;
+}
+
+// Upper bound (ns) of a histogram bucket
+static inline uint64_t replay_hist_bucket_max(uint32_t bucket)
+{
+    if (bucket < REPLAY_HIST_SUB)
+        return bucket;
+    uint32_t msb = bucket / REPLAY_HIST_SUB + REPLAY_HIST_SUB_BITS - 1;
+    uint64_t sub = bucket % REPLAY_HIST_SUB;
+    uint32_t shift = msb - REPLAY_HIST_SUB_BITS;
+    return ((REPLAY_HIST_SUB + sub + 1) << shift) - 1;
+}
+
+#endif /* PCAP_REPLAY_ENABLED */
+
+#endif /* PCAP_REPLAY_H */
@@ -0,0 +1,35 @@
+#ifndef PLACEMENT_H
+#define PLACEMENT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "port.h"
+
+// ==========================================
+// NUMA / SMT LCORE PLACEMENT
+// ==========================================
+// Replaces lcorePortAssign: every port's TX, RX (forward), external TX and
+// PTP lcores are taken from the port's socket, hot roles avoid sharing a
+// physical core with another busy lcore, and the chosen layout with any
+// cross-socket / SMT penalties is printed. Memory (mbuf pool, queue rings,
+// PRBS cache) follows ports[].numa_node, so it lands on the same socket.
+
+#if PLACEMENT_ENABLED
+
+/**
+ * Assign lcores to all port roles (call after portNumaNodesMatch and
+ * socketToLcore). Assigned lcores are removed from unused_socket_to_lcore
+ * so get_unused_cores keeps working for the remaining threads.
+ * @return 0 on success, -1 if a hot role could not be placed at all
+ */
+int placement_assign(struct ports_config *config);
+
+/**
+ * Print the layout chosen by placement_assign
+ */
+void placement_print(const struct ports_config *config);
+
+#endif /* PLACEMENT_ENABLED */
+
+#endif /* PLACEMENT_H */
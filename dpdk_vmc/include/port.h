@@ -1,8 +1,15 @@
 #pragma once
 #include <rte_ethdev.h>
 
-#define MAX_PORTS 4
-#define MAX_LCORE 32
+// Compile-time ceiling of every port_id indexed table (worker params,
+// stats, steering, remap / lock pointers) next to the MAX_PORTS_CONFIG
+// port configs. Not discovered: capacity_discover only reports hosts with
+// more ports. The large per-port blocks (trackers, TX sequences, forward
+// locks, remap tables) are allocated at startup for configured ports only,
+// on the port's NUMA node (capacity.h).
+#ifndef MAX_PORTS
+#define MAX_PORTS 16
+#endif
 #define PCI_ADDR_LEN 32
 
 // These will be defined in common.h but we need forward declaration
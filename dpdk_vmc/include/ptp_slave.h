@@ -32,7 +32,7 @@ int ptp_configure_split_sessions(const struct ptp_session_config *sessions,
  * Note: For split TX/RX ports, use ptp_configure_split_sessions instead
  * @param port_id DPDK port ID
  * @param sessions Array of session configurations
- * @param session_count Number of sessions (should be 4)
+ * @param session_count Number of sessions (max PTP_MAX_SESSIONS_PER_PORT)
  * @return 0 on success, negative on error
  */
 int ptp_port_configure_sessions(uint16_t port_id,
@@ -44,7 +44,7 @@ int ptp_port_configure_sessions(uint16_t port_id,
  * @param port_id DPDK port ID
  * @param rx_vlans Array of RX VLAN IDs (for receiving Sync/Delay_Resp)
  * @param tx_vlans Array of TX VLAN IDs (for sending Delay_Req)
- * @param vlan_count Number of VLANs (should be PTP_SESSIONS_PER_PORT)
+ * @param vlan_count Number of VLANs (max PTP_MAX_SESSIONS_PER_PORT)
  * @return 0 on success, negative on error
  */
 int ptp_port_configure(uint16_t port_id,
@@ -123,12 +123,12 @@ int ptp_assign_lcore(uint16_t port_id, uint16_t lcore_id);
  * Parse received PTP packet and update session state
  * @param session PTP session to update
  * @param mbuf Received mbuf containing PTP packet
- * @param rx_tsc TSC timestamp when packet was received
+ * @param rx RX stamp (burst TSC/realtime, NIC timestamp of this packet)
  * @return 0 on success, negative on error
  */
 int ptp_packet_process(ptp_session_t *session,
                        struct rte_mbuf *mbuf,
-                       uint64_t rx_tsc);
+                       const ptp_rx_stamp_t *rx);
 
 /**
  * Build and send Delay_Req packet
@@ -169,6 +169,198 @@ uint16_t ptp_get_vlan_id(struct rte_mbuf *mbuf);
  */
 void ptp_init_port_identity(ptp_session_t *session, uint16_t port_id);
 
+// ==========================================
+// PTP TIMESTAMP API
+// ==========================================
+
+/**
+ * Enable timestamping on a port (HW if the PMD supports timesync, else SW)
+ * Ports attached to the simulated master keep SIM mode.
+ * @param port_id DPDK port ID
+ * @return 0 on success, negative on error
+ */
+int ptp_ts_port_enable(uint16_t port_id);
+
+/**
+ * Disable timestamping on all ports enabled by ptp_ts_port_enable
+ */
+void ptp_ts_disable_all(void);
+
+/**
+ * Get timestamp mode of a port
+ * @param port_id DPDK port ID
+ * @return PTP_TS_MODE_HW, PTP_TS_MODE_SIM or PTP_TS_MODE_SW
+ */
+ptp_ts_mode_t ptp_ts_port_mode(uint16_t port_id);
+
+/**
+ * Read RX timestamp of a received PTP event message
+ * Must be called for every received Sync so the NIC latch is released.
+ * @param port_id DPDK port ID the mbuf was received on
+ * @param mbuf Received mbuf
+ * @param rx_ns Output: RX timestamp in ns (NIC clock)
+ * @return true if a timestamp was read
+ */
+bool ptp_ts_read_rx(uint16_t port_id, struct rte_mbuf *mbuf, uint64_t *rx_ns);
+
+/**
+ * Request TX timestamp for an mbuf (call before rte_eth_tx_burst)
+ * @param port_id DPDK port ID the mbuf will be sent on
+ * @param mbuf Mbuf to be sent
+ */
+void ptp_ts_prepare_tx(uint16_t port_id, struct rte_mbuf *mbuf);
+
+/**
+ * Poll latched TX timestamp (up to PTP_HW_TX_TS_POLL_US)
+ * @param port_id DPDK port ID
+ * @param tx_ns Output: TX timestamp in ns (NIC clock)
+ * @return true if a timestamp was read
+ */
+bool ptp_ts_read_tx(uint16_t port_id, uint64_t *tx_ns);
+
+/**
+ * Switch a port to the emulated NIC latch (simulated master)
+ * @param port_id DPDK port ID
+ */
+void ptp_ts_sim_attach(uint16_t port_id);
+
+/**
+ * Latch emulated Sync RX timestamp (simulated master)
+ * @param port_id Slave DPDK port ID
+ * @param rx_ns RX timestamp in ns (slave clock)
+ */
+void ptp_ts_sim_latch_rx(uint16_t port_id, uint64_t rx_ns);
+
+/**
+ * Latch emulated Delay_Req TX timestamp (simulated master)
+ * @param port_id Slave DPDK port ID
+ * @param tx_ns TX timestamp in ns (slave clock)
+ */
+void ptp_ts_sim_latch_tx(uint16_t port_id, uint64_t tx_ns);
+
+// ==========================================
+// PTP SERVO / DISCIPLINED CLOCK API
+// ==========================================
+
+/**
+ * Feed a completed exchange (t1..t4, offset_ns/delay_ns) to the servo
+ * @param session PTP session
+ */
+void ptp_servo_update(ptp_session_t *session);
+
+/**
+ * Reset servo counters and steady-state statistics (clock is kept)
+ * @param servo Session servo
+ */
+void ptp_servo_reset_stats(ptp_servo_t *servo);
+
+/**
+ * Read a disciplined clock at a TSC value (safe from any lcore)
+ * @param clk Disciplined clock
+ * @param tsc TSC value (rte_rdtsc)
+ * @param master_ns Output: master time in ns (PTP epoch)
+ * @return true if the clock is valid
+ */
+bool ptp_servo_clock_read(const ptp_disc_clock_t *clk, uint64_t tsc, uint64_t *master_ns);
+
+/**
+ * Read the disciplined clock of a session
+ * @param session PTP session
+ * @param tsc TSC value (rte_rdtsc)
+ * @param master_ns Output: master time in ns (PTP epoch)
+ * @return true if the session servo has a clock
+ */
+bool ptp_session_clock_read(const ptp_session_t *session, uint64_t tsc, uint64_t *master_ns);
+
+/**
+ * Common time base: convert TSC to master time using the first LOCKED session
+ * @param tsc TSC value (rte_rdtsc)
+ * @param master_ns Output: master time in ns (PTP epoch)
+ * @return true if a LOCKED session exists
+ */
+bool ptp_clock_tsc_to_master_ns(uint64_t tsc, uint64_t *master_ns);
+
+// ==========================================
+// PTP EVENT RING API (worker -> drain thread)
+// ==========================================
+
+/**
+ * Allocate event ring for a port (NUMA local)
+ * @param port PTP port
+ * @param socket_id NUMA socket of the port
+ * @return 0 on success, negative on error
+ */
+int ptp_event_ring_create(ptp_port_t *port, int socket_id);
+
+/**
+ * Free event ring of a port
+ * @param port PTP port
+ */
+void ptp_event_ring_free(ptp_port_t *port);
+
+/**
+ * Reserve next event slot (worker of the port only)
+ * Fields up to data are zeroed; fill the event, then call ptp_event_post.
+ * @param port_id DPDK port ID
+ * @param type Event type
+ * @return Event slot, or NULL if the ring is full/missing (event dropped)
+ */
+ptp_event_t *ptp_event_alloc(uint16_t port_id, ptp_event_type_t type);
+
+/**
+ * Publish the slot reserved by ptp_event_alloc
+ * @param port_id DPDK port ID
+ */
+void ptp_event_post(uint16_t port_id);
+
+/**
+ * Format and print all pending events
+ * @return Number of events drained
+ */
+unsigned ptp_event_drain(void);
+
+/**
+ * Start non-realtime drain thread
+ * @return 0 on success, negative on error
+ */
+int ptp_event_thread_start(void);
+
+/**
+ * Stop drain thread (pending events are printed)
+ */
+void ptp_event_thread_stop(void);
+
+/**
+ * Total events dropped on full rings
+ * @return Dropped event count
+ */
+uint64_t ptp_event_dropped(void);
+
+#if PTP_SIM_MASTER_ENABLED
+// ==========================================
+// PTP SIMULATED MASTER API (net_ring pair)
+// ==========================================
+
+/**
+ * Create net_ring slave/master port pair and configure one slave session
+ * @param slave_lcore_id Lcore for the PTP slave worker
+ * @param master_lcore_id Lcore for the simulated master
+ * @return 0 on success, negative on error
+ */
+int ptp_sim_master_setup(uint16_t slave_lcore_id, uint16_t master_lcore_id);
+
+/**
+ * Launch simulated master (call after ptp_start)
+ * @return 0 on success, negative on error
+ */
+int ptp_sim_master_start(void);
+
+/**
+ * Stop simulated master (call before ptp_stop)
+ */
+void ptp_sim_master_stop(void);
+#endif
+
 // ==========================================
 // PTP STATE MACHINE API
 // ==========================================
@@ -188,12 +380,12 @@ void ptp_state_machine_tick(ptp_session_t *session,
  * @param session PTP session
  * @param header PTP header
  * @param timestamp Origin timestamp from Sync
- * @param rx_tsc RX timestamp (TSC)
+ * @param rx RX stamp (burst TSC/realtime, NIC timestamp in ns or 0)
  */
 void ptp_handle_sync(ptp_session_t *session,
                      const ptp_header_t *header,
                      const ptp_timestamp_t *timestamp,
-                     uint64_t rx_tsc);
+                     const ptp_rx_stamp_t *rx);
 
 /**
  * Handle Delay_Resp message received
@@ -218,7 +410,7 @@ void ptp_calculate_offset_delay(ptp_session_t *session);
  * @param session PTP session to initialize
  * @param rx_port_id RX port ID - where Sync/Delay_Resp arrives (session owner)
  * @param tx_port_id TX port ID - for sending Delay_Req (may differ from rx_port_id)
- * @param session_idx Session index within port (0-3)
+ * @param session_idx Session index within port
  * @param rx_vlan_id RX VLAN ID (for Sync/Delay_Resp)
  * @param tx_vlan_id TX VLAN ID (for Delay_Req)
  * @param tx_vl_idx TX VL-IDX (for Delay_Req packet)
@@ -227,7 +419,7 @@ void ptp_calculate_offset_delay(ptp_session_t *session);
 void ptp_session_init(ptp_session_t *session,
                       uint16_t rx_port_id,
                       uint16_t tx_port_id,
-                      uint8_t session_idx,
+                      uint16_t session_idx,
                       uint16_t rx_vlan_id,
                       uint16_t tx_vlan_id,
                       uint16_t tx_vl_idx);
@@ -252,20 +444,23 @@ void ptp_session_get_stats(const ptp_session_t *session,
 
 /**
  * Get statistics for all PTP sessions
- * @param stats Output array (must be PTP_MAX_SESSIONS size)
- * @param count Output: number of sessions
+ * @param stats Output array
+ * @param max_stats Capacity of stats array
+ * @param count Output: number of sessions written
  */
-void ptp_get_stats(ptp_session_stats_t *stats, uint8_t *count);
+void ptp_get_stats(ptp_session_stats_t *stats, uint16_t max_stats, uint16_t *count);
 
 /**
  * Get statistics for a specific port
  * @param port_id DPDK port ID
- * @param stats Output array (must be PTP_SESSIONS_PER_PORT size)
- * @param count Output: number of sessions
+ * @param stats Output array
+ * @param max_stats Capacity of stats array
+ * @param count Output: number of sessions written
  */
 void ptp_get_port_stats(uint16_t port_id,
                         ptp_session_stats_t *stats,
-                        uint8_t *count);
+                        uint16_t max_stats,
+                        uint16_t *count);
 
 /**
  * Print PTP statistics to stdout
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <rte_common.h>
 #include <rte_ether.h>
 
 // ==========================================
@@ -63,8 +64,12 @@
 // ==========================================
 
 #define PTP_MAX_PORTS           8
-#define PTP_SESSIONS_PER_PORT   4
-#define PTP_MAX_SESSIONS        (PTP_MAX_PORTS * PTP_SESSIONS_PER_PORT)  // 32
+#define PTP_DEFAULT_SESSIONS_PER_PORT 4                 // Legacy default, session array is sized at runtime
+#define PTP_MAX_SESSIONS_PER_PORT     4094              // One session per RX VLAN
+
+// VLAN -> session index map (direct lookup in worker RX path)
+#define PTP_VLAN_MAP_SIZE       4096
+#define PTP_SESSION_NONE        0xFFFF
 
 // PTP Queue assignments
 #define PTP_TX_QUEUE_ID         5
@@ -73,6 +78,9 @@
 // VL-ID range for PTP (starts at 4500+)
 #define PTP_VL_ID_BASE          4500
 
+// Servo filter window (exchanges kept for min-delay / median filtering)
+#define PTP_SERVO_WINDOW        16
+
 // ==========================================
 // PTP STATE MACHINE
 // ==========================================
@@ -86,6 +94,106 @@ typedef enum {
     PTP_STATE_ERROR              // Error state
 } ptp_state_t;
 
+// ==========================================
+// PTP TIMESTAMP SOURCE
+// ==========================================
+
+typedef enum {
+    PTP_TS_MODE_SW = 0,          // Software: rte_rdtsc / clock_gettime (fallback)
+    PTP_TS_MODE_HW,              // NIC timestamp via rte_eth_timesync_* API
+    PTP_TS_MODE_SIM              // Emulated NIC latch (net_ring simulated master)
+} ptp_ts_mode_t;
+
+// Jitter buckets: every exchange is scored with software timestamps,
+// exchanges that also have NIC (or simulated) t2/t3 are scored as HW too
+#define PTP_JITTER_SW           0
+#define PTP_JITTER_HW           1
+#define PTP_JITTER_BUCKETS      2
+
+// Running offset/delay statistics (Welford mean/variance + min/max)
+typedef struct {
+    uint64_t samples;
+    double   offset_mean;
+    double   offset_m2;          // Sum of squared deviations from mean
+    double   delay_mean;
+    double   delay_m2;
+    int64_t  offset_min;
+    int64_t  offset_max;
+    int64_t  delay_min;
+    int64_t  delay_max;
+} ptp_jitter_stats_t;
+
+// ==========================================
+// PTP SERVO / DISCIPLINED CLOCK
+// ==========================================
+
+typedef enum {
+    PTP_SERVO_UNLOCKED = 0,      // No valid exchange yet
+    PTP_SERVO_LOCKING,           // Clock stepped, PI converging
+    PTP_SERVO_LOCKED             // |offset| within lock threshold
+} ptp_servo_state_t;
+
+// One accepted two-step exchange
+typedef struct {
+    uint64_t t1_ns;              // Master Sync TX (PTP epoch)
+    uint64_t t2_tsc;             // Our Sync RX (TSC)
+    int64_t  offset_ns;          // Raw offset of the exchange
+    int64_t  delay_ns;           // Raw path delay of the exchange
+} ptp_servo_sample_t;
+
+// TSC -> master time mapping:
+//   master_ns = base_master_ns + (tsc - base_tsc) * ns_per_tsc
+// Written by the PTP worker, read from any lcore (seq is odd while updating)
+typedef struct {
+    uint32_t seq;
+    bool     valid;
+    uint64_t base_tsc;
+    uint64_t base_master_ns;
+    double   ns_per_tsc;         // Nominal 1e9/tsc_hz, corrected by servo frequency
+} ptp_disc_clock_t;
+
+typedef struct {
+    ptp_servo_state_t state;
+
+    // Filter window (ring of accepted exchanges)
+    ptp_servo_sample_t window[PTP_SERVO_WINDOW];
+    uint8_t  win_count;
+    uint8_t  win_head;
+    uint8_t  consecutive_outliers;
+
+    // Filter outputs
+    int64_t  path_delay_ns;      // Median (or mean) path delay of window
+    int64_t  filtered_offset_ns; // Offset of min-delay (lucky) exchange in window
+    int64_t  clock_offset_ns;    // Disciplined clock error at last PI update
+
+    // PI state
+    double   freq_ppb;           // Current frequency correction
+    double   integral_ppb;       // Integral term
+    uint64_t last_update_tsc;    // t2_tsc of last PI update
+
+    // Convergence
+    uint64_t first_sample_tsc;   // t2_tsc of first exchange (or last step)
+    uint32_t lock_count;         // Consecutive samples within lock threshold
+    uint64_t converge_ms;        // Time from first sample to LOCKED (0 = not yet)
+
+    // Counters
+    uint64_t samples;            // Exchanges fed to the servo
+    uint64_t outliers;           // Rejected by delay filter
+    uint64_t steps;              // Clock steps
+
+    // Steady-state statistics while LOCKED (offset = clock_offset_ns, delay = path_delay_ns)
+    ptp_jitter_stats_t steady;
+
+    ptp_disc_clock_t clock;
+} ptp_servo_t;
+
+// RX timestamps of one worker burst (t2 candidates)
+typedef struct {
+    uint64_t tsc;                // rte_rdtsc right after rte_eth_rx_burst
+    uint64_t realtime_ns;        // CLOCK_REALTIME right after rte_eth_rx_burst
+    uint64_t hw_ns;              // NIC RX timestamp (0 = not available)
+} ptp_rx_stamp_t;
+
 // ==========================================
 // PTP TIMESTAMP (IEEE 1588 format)
 // ==========================================
@@ -156,7 +264,7 @@ typedef struct {
     uint16_t tx_vlan_id;         // TX VLAN ID (for Delay_Req)
     uint16_t tx_vl_idx;          // TX VL-IDX (for Delay_Req) - configured
     uint16_t rx_vl_idx;          // RX VL-IDX (read from Sync packet) - runtime
-    uint8_t  session_idx;        // Session index within port (0-3)
+    uint16_t session_idx;        // Session index within port
 
     // State machine
     ptp_state_t state;
@@ -187,9 +295,20 @@ typedef struct {
     uint64_t t3_realtime_ns;     // Our TX time (clock_gettime) - for offset calc
     uint64_t t4_ns;              // Master RX time (from Delay_Resp) - PTP epoch
 
+    // NIC timestamps (rte_eth_timesync), 0 = not available for this exchange
+    uint64_t t2_hw_ns;           // Our Sync RX time (NIC clock)
+    uint64_t t3_hw_ns;           // Our Delay_Req TX time (NIC clock of tx_port_id)
+
     // Calculated values (in nanoseconds)
     int64_t  offset_ns;          // Clock offset = ((t2-t1) - (t4-t3)) / 2
     int64_t  delay_ns;           // Path delay = ((t2-t1) + (t4-t3)) / 2
+    ptp_ts_mode_t ts_mode;       // Timestamp source behind offset_ns/delay_ns
+
+    // Offset/delay jitter per timestamp source (PTP_JITTER_SW / PTP_JITTER_HW)
+    ptp_jitter_stats_t jitter[PTP_JITTER_BUCKETS];
+
+    // Filtered offset/delay, PI servo and disciplined clock
+    ptp_servo_t servo;
 
     // TSC to nanoseconds conversion
     uint64_t tsc_hz;             // TSC frequency (from rte_get_tsc_hz)
@@ -210,17 +329,76 @@ typedef struct {
     uint32_t sync_count;         // Successful sync count
 } ptp_session_t;
 
+// ==========================================
+// PTP EVENT RING (worker -> drain thread)
+// ==========================================
+// Debug output of the worker is posted as fixed-size events into a per-port
+// single-producer/single-consumer ring and printed by a non-realtime thread,
+// so no printf runs between rte_eth_rx_burst and t2/t3 stamping.
+
+#define PTP_EVENT_RING_SIZE     1024    // Power of 2
+#define PTP_EVENT_DATA_LEN      72      // Largest PTP frame we dump (Delay_Resp)
+
+typedef enum {
+    PTP_EVT_RAW_RX = 0,          // First frames seen on queue 5
+    PTP_EVT_SYNC_RX,             // Sync received
+    PTP_EVT_DELAY_RESP_RX,       // Delay_Resp received
+    PTP_EVT_DELAY_REQ_TX,        // Delay_Req sent (with hex dump)
+    PTP_EVT_CALC,                // Offset/delay calculation
+    PTP_EVT_NO_SESSION,          // PTP frame for unknown VLAN
+    PTP_EVT_COUNTERS,            // Periodic queue 5 counters
+    PTP_EVT_SERVO_STEP,          // Servo stepped the clock
+    PTP_EVT_SERVO_LOCKED,        // Servo locked
+    PTP_EVT_SERVO_PATH_CHANGE    // Servo window restarted
+} ptp_event_type_t;
+
+typedef struct {
+    uint8_t  type;               // ptp_event_type_t
+    uint8_t  flags;              // Event specific
+    uint16_t port_id;
+    uint16_t vlan_id;
+    uint16_t seq_id;
+    uint16_t data_len;
+    uint64_t v[8];               // Event specific values
+    double   d;                  // Event specific value
+    uint8_t  data[PTP_EVENT_DATA_LEN];
+} ptp_event_t;
+
+typedef struct {
+    uint32_t head __rte_cache_aligned;   // Written by worker only
+    uint32_t tail __rte_cache_aligned;   // Written by drain thread only
+    uint64_t dropped __rte_cache_aligned;// Ring full (worker side)
+    ptp_event_t ev[PTP_EVENT_RING_SIZE];
+} ptp_event_ring_t;
+
+// ==========================================
+// PTP WORKER LOOP HISTOGRAM
+// ==========================================
+// Bucket 0: < 256 ns, bucket i: [128 << i, 256 << i) ns, last bucket open-ended
+
+#define PTP_LOOP_HIST_BUCKETS   16
+#define PTP_LOOP_HIST_BASE_SHIFT 8
+
 // ==========================================
 // PTP PORT DATA (Per DPDK Port)
 // ==========================================
 
 typedef struct {
     uint16_t        port_id;                        // DPDK port ID
-    uint16_t        session_count;                  // Number of sessions (4)
-    ptp_session_t   sessions[PTP_SESSIONS_PER_PORT]; // 4 sessions per port
+    uint16_t        session_count;                  // Configured sessions
+    uint16_t        session_capacity;               // Allocated session slots (sized at configure)
+    ptp_session_t  *sessions;                       // Session array (rte_zmalloc, NUMA local)
+    uint16_t        vlan_map[PTP_VLAN_MAP_SIZE];    // RX VLAN -> session index (PTP_SESSION_NONE)
+    uint16_t        tick_next;                      // Round-robin state machine cursor
     bool            enabled;                        // PTP enabled on this port
     struct rte_mempool *tx_mbuf_pool;              // TX mbuf pool for PTP packets
     uint16_t        ptp_lcore_id;                  // Assigned lcore for PTP
+    ptp_event_ring_t *events;                       // Debug/event ring (worker -> drain thread)
+
+    // Worker loop time (written by worker, read by stats)
+    uint64_t        loop_hist[PTP_LOOP_HIST_BUCKETS];
+    uint64_t        loop_count;
+    uint64_t        loop_max_ns;
 } ptp_port_t;
 
 // ==========================================
@@ -281,6 +459,48 @@ static inline uint64_t tsc_to_ns(uint64_t tsc, uint64_t tsc_hz) {
     return (tsc * 1000000000ULL) / tsc_hz;
 }
 
+// Add one offset/delay sample to jitter statistics
+static inline void ptp_jitter_add(ptp_jitter_stats_t *js, int64_t offset_ns, int64_t delay_ns) {
+    if (js->samples == 0) {
+        js->offset_min = js->offset_max = offset_ns;
+        js->delay_min = js->delay_max = delay_ns;
+    } else {
+        if (offset_ns < js->offset_min) js->offset_min = offset_ns;
+        if (offset_ns > js->offset_max) js->offset_max = offset_ns;
+        if (delay_ns < js->delay_min) js->delay_min = delay_ns;
+        if (delay_ns > js->delay_max) js->delay_max = delay_ns;
+    }
+    js->samples++;
+
+    double d = (double)offset_ns - js->offset_mean;
+    js->offset_mean += d / (double)js->samples;
+    js->offset_m2 += d * ((double)offset_ns - js->offset_mean);
+
+    d = (double)delay_ns - js->delay_mean;
+    js->delay_mean += d / (double)js->samples;
+    js->delay_m2 += d * ((double)delay_ns - js->delay_mean);
+}
+
+// Get servo state name string
+static inline const char *ptp_servo_state_to_str(ptp_servo_state_t state) {
+    switch (state) {
+        case PTP_SERVO_UNLOCKED: return "UNLOCKED";
+        case PTP_SERVO_LOCKING:  return "LOCKING";
+        case PTP_SERVO_LOCKED:   return "LOCKED";
+        default:                 return "UNKNOWN";
+    }
+}
+
+// Get timestamp source name string
+static inline const char *ptp_ts_mode_to_str(ptp_ts_mode_t mode) {
+    switch (mode) {
+        case PTP_TS_MODE_SW:  return "SW";
+        case PTP_TS_MODE_HW:  return "HW";
+        case PTP_TS_MODE_SIM: return "SIM";
+        default:              return "UNKNOWN";
+    }
+}
+
 // Get state name string
 static inline const char *ptp_state_to_str(ptp_state_t state) {
     switch (state) {
@@ -118,12 +118,10 @@ struct raw_target_stats {
 // VL-ID SEQUENCE TRACKER
 // ==========================================
 
+// RX side: vl_seq_tracker (per raw port, sharded per fanout worker)
 struct raw_vl_sequence {
     uint64_t tx_sequence;       // TX sequence counter
-    uint64_t rx_expected_seq;   // Expected RX sequence
-    bool rx_initialized;        // RX tracker initialized?
     pthread_spinlock_t tx_lock;
-    pthread_spinlock_t rx_lock;
 };
 
 // ==========================================
@@ -237,7 +235,7 @@ struct raw_socket_port {
 };
 
 // Global raw socket ports array
-extern struct raw_socket_port raw_ports[MAX_RAW_SOCKET_PORTS];
+extern struct raw_socket_port *raw_ports;   // [MAX_RAW_SOCKET_PORTS]
 extern struct raw_socket_port_config raw_port_configs[MAX_RAW_SOCKET_PORTS];
 
 // ==========================================
@@ -272,12 +270,7 @@ void *raw_tx_worker(void *arg);
 void *raw_rx_worker(void *arg);
 void stop_raw_socket_workers(void);
 
-// ==========================================
-// PACKET BUILDING FUNCTIONS
-// ==========================================
-
-int build_raw_packet(uint8_t *buffer, const uint8_t *src_mac,
-                     uint16_t vl_id, uint64_t sequence, const uint8_t *prbs_data);
+// build_raw_packet / build_raw_packet_dynamic: raw_tx_template.h
 
 // ==========================================
 // RATE LIMITER FUNCTIONS
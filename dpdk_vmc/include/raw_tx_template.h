@@ -0,0 +1,201 @@
+#ifndef RAW_TX_TEMPLATE_H
+#define RAW_TX_TEMPLATE_H
+
+#include <stdint.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include "raw_socket_port.h"
+
+// ==========================================
+// RAW TX PACKET BUILDERS + HEADER TEMPLATES
+// ==========================================
+// build_raw_packet(_dynamic) write the 42-byte ETH + IP + UDP header byte
+// by byte (IP checksum over all 10 words); raw_tx_worker used to do that
+// in a stack buffer for every packet and then copy the whole frame into
+// the TX ring. The header only depends on the frame size and the VL-ID,
+// so one template per frame size (IMIX pattern slot) is taken from the
+// builder's own output with VL-ID 0 (raw_tx_template_build): IP total
+// length, UDP length and the IP header sum are fixed there.
+//
+// raw_tx_template_fill writes straight into the ring frame: header copy,
+// VL-ID patched into DST MAC[4..5] and DST IP[2..3], IP checksum from the
+// precomputed sum + VL-ID, then sequence and PRBS. The IP id stays 0 as in
+// build_raw_packet / build_raw_packet_dynamic, so the frames are byte for
+// byte the same. That includes the checksum byte order: the builders store
+// htons(~sum) high byte first, i.e. the host order value, kept here.
+// Builders and templates are shared by raw_socket_port.c (raw_tx_worker,
+// RAW_TX_TEMPLATE=0 path) and bench/raw_tx_bench.c.
+
+#define RAW_TX_TPL_HDR_SIZE  (RAW_PKT_ETH_HDR_SIZE + RAW_PKT_IP_HDR_SIZE + RAW_PKT_UDP_HDR_SIZE)
+#define RAW_TX_TPL_CSUM_OFF  (RAW_PKT_ETH_HDR_SIZE + 10)
+#define RAW_TX_TPL_IP_VL_OFF (RAW_PKT_ETH_HDR_SIZE + 18)   // DST IP[2..3]
+
+#if IMIX_ENABLED
+#define RAW_TX_TPL_COUNT IMIX_PATTERN_SIZE   // Indexed like get_raw_imix_packet_size
+#else
+#define RAW_TX_TPL_COUNT 1
+#endif
+
+static inline uint16_t calculate_ip_checksum_raw(const void *ip_header)
+{
+    const uint16_t *ptr = (const uint16_t *)ip_header;
+    uint32_t sum = 0;
+
+    for (int i = 0; i < 10; i++) {
+        sum += ntohs(ptr[i]);
+    }
+
+    while (sum >> 16) {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+
+    return htons(~sum & 0xFFFF);
+}
+
+// Dinamik boyutlu paket oluştur (IMIX; sabit boyut da bunu kullanır)
+static inline int build_raw_packet_dynamic(uint8_t *buffer, const uint8_t *src_mac,
+                                           uint16_t vl_id, uint64_t sequence,
+                                           const uint8_t *prbs_data, uint16_t prbs_len,
+                                           uint16_t pkt_size)
+{
+    static const uint8_t fixed_src_mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x20};
+    (void)src_mac;
+
+    // Ethernet Header
+    buffer[0] = 0x03;
+    buffer[1] = 0x00;
+    buffer[2] = 0x00;
+    buffer[3] = 0x00;
+    buffer[4] = (vl_id >> 8) & 0xFF;
+    buffer[5] = vl_id & 0xFF;
+    memcpy(buffer + 6, fixed_src_mac, 6);
+    buffer[12] = 0x08;
+    buffer[13] = 0x00;
+
+    // IPv4 Header (dinamik total_length)
+    uint8_t *ip = buffer + RAW_PKT_ETH_HDR_SIZE;
+    uint16_t payload_size = pkt_size - RAW_PKT_ETH_HDR_SIZE - RAW_PKT_IP_HDR_SIZE - RAW_PKT_UDP_HDR_SIZE;
+    uint16_t ip_total_len = RAW_PKT_IP_HDR_SIZE + RAW_PKT_UDP_HDR_SIZE + payload_size;
+
+    ip[0] = 0x45;
+    ip[1] = 0x00;
+    ip[2] = (ip_total_len >> 8) & 0xFF;
+    ip[3] = ip_total_len & 0xFF;
+    ip[4] = 0x00;
+    ip[5] = 0x00;
+    ip[6] = 0x40;
+    ip[7] = 0x00;
+    ip[8] = 0x01;
+    ip[9] = 0x11;
+    ip[10] = 0x00;
+    ip[11] = 0x00;
+    ip[12] = 0x0A;
+    ip[13] = 0x00;
+    ip[14] = 0x00;
+    ip[15] = 0x00;
+    ip[16] = 0xE0;
+    ip[17] = 0xE0;
+    ip[18] = (vl_id >> 8) & 0xFF;
+    ip[19] = vl_id & 0xFF;
+
+    // IP Checksum
+    uint16_t ip_checksum = calculate_ip_checksum_raw(ip);
+    ip[10] = (ip_checksum >> 8) & 0xFF;
+    ip[11] = ip_checksum & 0xFF;
+
+    // UDP Header (dinamik dgram_len)
+    uint8_t *udp = ip + RAW_PKT_IP_HDR_SIZE;
+    udp[0] = 0x00;
+    udp[1] = 0x64;
+    udp[2] = 0x00;
+    udp[3] = 0x64;
+    uint16_t udp_len = RAW_PKT_UDP_HDR_SIZE + payload_size;
+    udp[4] = (udp_len >> 8) & 0xFF;
+    udp[5] = udp_len & 0xFF;
+    udp[6] = 0x00;
+    udp[7] = 0x00;
+
+    // Payload (dinamik PRBS boyutu)
+    uint8_t *payload = udp + RAW_PKT_UDP_HDR_SIZE;
+    memcpy(payload, &sequence, RAW_PKT_SEQ_BYTES);
+    memcpy(payload + RAW_PKT_SEQ_BYTES, prbs_data, prbs_len);
+
+    return pkt_size;
+}
+
+// Sabit boyut (RAW_PKT_TOTAL_SIZE)
+static inline int build_raw_packet(uint8_t *buffer, const uint8_t *src_mac,
+                                   uint16_t vl_id, uint64_t sequence, const uint8_t *prbs_data)
+{
+    return build_raw_packet_dynamic(buffer, src_mac, vl_id, sequence, prbs_data,
+                                    RAW_PKT_PRBS_BYTES, RAW_PKT_TOTAL_SIZE);
+}
+
+// Raw PRBS boyutu hesapla
+static inline uint16_t calc_raw_prbs_size(uint16_t pkt_size)
+{
+    return pkt_size - RAW_PKT_ETH_HDR_SIZE - RAW_PKT_IP_HDR_SIZE - RAW_PKT_UDP_HDR_SIZE - RAW_PKT_SEQ_BYTES;
+}
+
+struct raw_tx_template {
+    uint8_t hdr[RAW_TX_TPL_HDR_SIZE];   // VL-ID 0, checksum of the VL-ID 0 header
+    uint16_t ip_sum;                    // Folded IP header sum without the VL-ID word (host order)
+    uint16_t pkt_size;
+    uint16_t prbs_len;
+};
+
+/**
+ * Template from a frame the builder made with VL-ID 0
+ */
+static inline void raw_tx_template_from_frame(struct raw_tx_template *tpl, const uint8_t *frame,
+                                              uint16_t pkt_size)
+{
+    uint16_t csum;
+
+    memcpy(tpl->hdr, frame, RAW_TX_TPL_HDR_SIZE);
+    memcpy(&csum, frame + RAW_TX_TPL_CSUM_OFF, sizeof(csum));
+    tpl->ip_sum = (uint16_t)~csum;
+    tpl->pkt_size = pkt_size;
+    tpl->prbs_len = pkt_size - RAW_TX_TPL_HDR_SIZE - RAW_PKT_SEQ_BYTES;
+}
+
+/**
+ * Template of one frame size from build_raw_packet_dynamic with VL-ID 0
+ */
+static inline void raw_tx_template_build(struct raw_tx_template *tpl, uint16_t pkt_size)
+{
+    static const uint8_t zero_prbs[RAW_PKT_PRBS_BYTES];
+    uint8_t frame[RAW_PKT_TOTAL_SIZE];
+
+    build_raw_packet_dynamic(frame, NULL, 0, 0, zero_prbs, calc_raw_prbs_size(pkt_size), pkt_size);
+    raw_tx_template_from_frame(tpl, frame, pkt_size);
+}
+
+/**
+ * Frame for vl_id / sequence from the template, returns the frame size
+ */
+static inline uint16_t raw_tx_template_fill(uint8_t *frame, const struct raw_tx_template *tpl,
+                                            uint16_t vl_id, uint64_t sequence,
+                                            const uint8_t *prbs_data)
+{
+    memcpy(frame, tpl->hdr, RAW_TX_TPL_HDR_SIZE);
+
+    frame[4] = (uint8_t)(vl_id >> 8);
+    frame[5] = (uint8_t)vl_id;
+    frame[RAW_TX_TPL_IP_VL_OFF] = (uint8_t)(vl_id >> 8);
+    frame[RAW_TX_TPL_IP_VL_OFF + 1] = (uint8_t)vl_id;
+
+    // The VL-ID word was 0 in the template: add it, fold, complement
+    uint32_t sum = (uint32_t)tpl->ip_sum + vl_id;
+    sum = (sum & 0xFFFF) + (sum >> 16);
+    uint16_t csum = (uint16_t)~sum;
+    memcpy(frame + RAW_TX_TPL_CSUM_OFF, &csum, sizeof(csum));
+
+    uint8_t *payload = frame + RAW_TX_TPL_HDR_SIZE;
+    memcpy(payload, &sequence, RAW_PKT_SEQ_BYTES);
+    memcpy(payload + RAW_PKT_SEQ_BYTES, prbs_data, tpl->prbs_len);
+
+    return tpl->pkt_size;
+}
+
+#endif /* RAW_TX_TEMPLATE_H */
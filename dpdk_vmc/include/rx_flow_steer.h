@@ -0,0 +1,68 @@
+#ifndef RX_FLOW_STEER_H
+#define RX_FLOW_STEER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "port.h"
+
+// ==========================================
+// RX FLOW STEERING (rte_flow, VL-ID -> queue)
+// ==========================================
+// RSS RETA spreads the packets of one VL-ID over every data RX queue, so
+// all workers write the same tracker and every queue has to validate every
+// VL. With steering each VL-ID range of queue q (source port TX ranges,
+// then this port's RX ranges, first owner wins) goes to RX queue
+// q % NUM_RX_CORES through rte_flow rules, same ladder as
+// ptp_flow_rule_install:
+//
+//   1. ETH dst (VL-ID = last 16 bits) prefix blocks      -> exclusive
+//   2. ETH type 0x8100 + dst prefix blocks + VLAN         -> exclusive
+//   3. VLAN TCI = rx_vlans[q], one rule per queue
+//
+// A range becomes aligned power-of-two blocks (one rule each). Over
+// RX_FLOW_STEER_MAX_RULES, or when the PMD rejects a rule, the attempt is
+// rolled back and the next one tried; after the last one the port stays on
+// RSS. Unmatched traffic (PTP, external, raw) keeps the RETA / PTP rule.
+//
+// Exclusive modes: a VL-ID with a prefix-block rule reaches exactly one
+// queue, whose RX worker updates its tracker without CAS / fetch_add
+// (rx_pipe_track). VL-IDs without a rule stay on RSS and keep the atomics.
+
+#if RX_FLOW_STEERING
+
+enum rx_flow_steer_mode
+{
+    RX_FLOW_STEER_RSS = 0,      // No rules (fallback)
+    RX_FLOW_STEER_MAC,
+    RX_FLOW_STEER_MAC_VLAN,
+    RX_FLOW_STEER_VLAN,
+};
+
+/**
+ * Install the VL-ID -> queue rules of a started port
+ * @param src_port_id  port whose TX ranges arrive here (PRBS source)
+ * @return steering mode in effect (RX_FLOW_STEER_RSS = fallback)
+ */
+enum rx_flow_steer_mode rx_flow_steer_install(uint16_t port_id, uint16_t src_port_id);
+
+/**
+ * Destroy the port's steering rules (RSS only afterwards)
+ */
+void rx_flow_steer_remove(uint16_t port_id);
+
+/**
+ * VL-IDs (0..MAX_VL_ID) that a MAC / MAC+VLAN rule sends to queue_id only
+ * @param map  one bit per VL-ID, 65536 / 8 bytes (RX_PIPE_VL_MAP_BYTES)
+ * @return true if any bit is set
+ */
+bool rx_flow_steer_exclusive_map(uint16_t port_id, uint16_t queue_id, uint8_t *map);
+
+/**
+ * Per-queue RX share of the steered ports (stats thread)
+ */
+void rx_flow_steer_print_stats(const struct ports_config *ports_config);
+
+#endif /* RX_FLOW_STEERING */
+
+#endif /* RX_FLOW_STEER_H */
@@ -0,0 +1,273 @@
+#ifndef RX_PIPELINE_H
+#define RX_PIPELINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <rte_mbuf.h>
+#include <rte_prefetch.h>
+#include "config.h"
+#include "packet.h"
+#include "payload_transform.h"
+#include "tx_rx_manager.h"  // struct vl_sequence_tracker, BURST_SIZE, MAX_VL_ID
+#include "vl_range.h"
+
+// ==========================================
+// RX STAGED VERIFICATION PIPELINE
+// ==========================================
+// rx_worker splits a burst into three passes instead of finishing every
+// packet before looking at the next one:
+//
+//   1. rx_pipe_parse    - prefetch all headers, then pick the packets of
+//                         our own VL-IDs (VLAN, long enough) and read
+//                         VL-ID + sequence from the first cache line
+//   2. rx_pipe_prefetch - PRBS cache position, prefetch of the first two
+//                         lines of expected / received PRBS and the VL's
+//                         tracker
+//   3. rx_pipe_track    - trackers updated once per VL-ID of the burst
+//                         (plain stores for the VL-IDs rte_flow steering
+//                         sends to this queue only, rx_flow_steer.h)
+//      rx_pipe_verify   - CRC / PRBS compare, in burst order
+//
+// Every other packet (PTP, raw socket, cross-port, external, short) keeps
+// the per-packet path of rx_worker; those VL-IDs never hit the own map, so
+// per-VL tracker order is unchanged. Hot-path primitives shared by the
+// workers and bench/rx_pipeline_bench.c.
+
+#define RX_PIPE_VL_MAP_BYTES (65536 / 8)   // One bit per VL-ID (DST MAC last 16 bits)
+#define RX_PIPE_PAYLOAD_OFF  (sizeof(struct rte_ether_hdr) + sizeof(struct vlan_hdr) + 20 + 8)  // 46
+
+#if RX_VERIFY_SPLITMIX
+#define RX_PIPE_PRBS_SKIP SPLITMIX_TOTAL_OVERHEAD  // 64 XOR'd + 4 CRC
+#else
+#define RX_PIPE_PRBS_SKIP 0
+#endif
+
+struct rx_pipe_pkt {
+    const uint8_t *recv;       // Received PRBS (after seq and splitmix bytes)
+    const uint8_t *exp;        // Expected PRBS in the cache (stage 2)
+    uint64_t seq;
+    uint64_t gap;              // Stage 3: seq - expected_seq, 0 = no loss
+    uint32_t check_len;        // PRBS bytes compared
+    uint16_t vl_id;
+    uint16_t idx;              // Index in the rx burst
+};
+
+struct rx_pipe_burst {
+    struct rx_pipe_pkt pkt[BURST_SIZE];
+    uint8_t own[BURST_SIZE];   // Burst index -> pkt[] index + 1, 0 = per-packet path
+    uint16_t nb;
+};
+
+static inline bool rx_pipe_vl_is_own(const uint8_t *map, uint16_t vl_id)
+{
+    return map[vl_id >> 3] & (1u << (vl_id & 7));
+}
+
+/**
+ * VL-IDs verified against our own PRBS cache: the source port's TX ranges,
+ * plus this port's RX ranges when the peer remaps VL-IDs (rx_ranges).
+ * Built once per worker, replaces the range scans on the hot path.
+ */
+static inline void rx_pipe_own_map_build(uint8_t *map, uint16_t port_id,
+                                         uint16_t src_port_id, bool rx_ranges)
+{
+    memset(map, 0, RX_PIPE_VL_MAP_BYTES);
+    for (uint32_t vl = 0; vl < 65536; vl++) {
+        if (is_valid_tx_vl_id_for_source_port((uint16_t)vl, src_port_id) ||
+            (rx_ranges && is_valid_rx_vl_id_for_port((uint16_t)vl, port_id)))
+            map[vl >> 3] |= (uint8_t)(1u << (vl & 7));
+    }
+}
+
+/**
+ * Stage 1: own packets of the burst (VLAN, >= min_len, VL-ID in own_map)
+ */
+static inline void rx_pipe_parse(struct rx_pipe_burst *b, struct rte_mbuf **pkts,
+                                 uint16_t nb_rx, const uint8_t *own_map, uint32_t min_len)
+{
+    for (uint16_t i = 0; i < nb_rx; i++)
+        rte_prefetch0(rte_pktmbuf_mtod(pkts[i], void *));
+
+    b->nb = 0;
+    for (uint16_t i = 0; i < nb_rx; i++) {
+        const struct rte_mbuf *m = pkts[i];
+        const uint8_t *pkt = rte_pktmbuf_mtod(m, const uint8_t *);
+
+        b->own[i] = 0;
+        if (pkt[12] != 0x81 || pkt[13] != 0x00 || m->pkt_len < min_len)
+            continue;
+
+        uint16_t vl_id = ((uint16_t)pkt[4] << 8) | pkt[5];
+        if (!rx_pipe_vl_is_own(own_map, vl_id))
+            continue;
+
+        struct rx_pipe_pkt *p = &b->pkt[b->nb];
+        p->vl_id = vl_id;
+        p->idx = i;
+        memcpy(&p->seq, pkt + RX_PIPE_PAYLOAD_OFF, sizeof(p->seq));
+        p->recv = pkt + RX_PIPE_PAYLOAD_OFF + SEQ_BYTES + RX_PIPE_PRBS_SKIP;
+#if IMIX_ENABLED
+        uint16_t total = m->pkt_len - RX_PIPE_PAYLOAD_OFF - SEQ_BYTES;
+        if (total > MAX_PRBS_BYTES) total = MAX_PRBS_BYTES;
+        p->check_len = (total > RX_PIPE_PRBS_SKIP) ? total - RX_PIPE_PRBS_SKIP : 0;
+#else
+        p->check_len = NUM_PRBS_BYTES - RX_PIPE_PRBS_SKIP;
+#endif
+        b->own[i] = (uint8_t)++b->nb;
+    }
+}
+
+/**
+ * Stage 2: PRBS cache position of every own packet, prefetch of the first
+ * two lines of both PRBS blocks and the tracker entry (the rest of the
+ * compare is sequential, the hardware prefetcher takes over)
+ */
+static inline void rx_pipe_prefetch(struct rx_pipe_burst *b, const uint8_t *prbs_cache_ext,
+                                    struct vl_sequence_tracker *trackers)
+{
+    for (uint16_t k = 0; k < b->nb; k++) {
+        struct rx_pipe_pkt *p = &b->pkt[k];
+#if IMIX_ENABLED
+        uint64_t off = (p->seq * (uint64_t)MAX_PRBS_BYTES) % (uint64_t)PRBS_CACHE_SIZE;
+#else
+        uint64_t off = (p->seq * (uint64_t)NUM_PRBS_BYTES) % (uint64_t)PRBS_CACHE_SIZE;
+#endif
+        p->exp = prbs_cache_ext + off + RX_PIPE_PRBS_SKIP;
+        rte_prefetch0(p->exp);
+        rte_prefetch0(p->exp + 64);
+        rte_prefetch0(p->recv);
+        rte_prefetch0(p->recv + 64);
+        if (p->vl_id <= MAX_VL_ID)
+            rte_prefetch0(&trackers[p->vl_id]);
+    }
+}
+
+/**
+ * Stage 3a: sequence trackers, one pass per VL-ID of the burst.
+ * Same result as one update per packet in burst order: the first packet
+ * of an uninitialized VL claims it, every later one is checked against
+ * expected_seq (gap -> p->gap), then one expected_seq store, one max_seq
+ * CAS and one pkt_count add per VL-ID.
+ * excl_map: VL-IDs this queue is the only writer of (a steering rule to
+ * this queue, rx_flow_steer_exclusive_map), NULL = none. For those the
+ * claim, max_seq and pkt_count are plain load / store, no locked RMW;
+ * every other VL-ID keeps CAS / fetch_add.
+ * @return lost packets (sum of gaps)
+ */
+static inline uint64_t rx_pipe_track(struct rx_pipe_burst *b, struct vl_sequence_tracker *trackers,
+                                     const uint8_t *excl_map)
+{
+    uint8_t order[BURST_SIZE];
+    uint64_t lost = 0;
+
+    // Stable insertion sort by VL-ID (burst order kept inside a VL)
+    for (uint16_t k = 0; k < b->nb; k++) {
+        uint16_t vl_id = b->pkt[k].vl_id;
+        uint16_t j = k;
+        while (j > 0 && b->pkt[order[j - 1]].vl_id > vl_id) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = (uint8_t)k;
+    }
+
+    for (uint16_t r = 0; r < b->nb; ) {
+        uint16_t vl_id = b->pkt[order[r]].vl_id;
+        uint16_t end = r + 1;
+        while (end < b->nb && b->pkt[order[end]].vl_id == vl_id)
+            end++;
+
+        if (vl_id > MAX_VL_ID) {
+            for (uint16_t k = r; k < end; k++)
+                b->pkt[order[k]].gap = 0;
+            r = end;
+            continue;
+        }
+
+        struct vl_sequence_tracker *t = &trackers[vl_id];
+        bool exclusive = excl_map != NULL && rx_pipe_vl_is_own(excl_map, vl_id);
+        uint16_t k = r;
+        uint64_t run_max = 0;
+
+        if (!__atomic_load_n(&t->initialized, __ATOMIC_ACQUIRE)) {
+            // First packet for this VL-ID
+            struct rx_pipe_pkt *p = &b->pkt[order[k++]];
+            int expected_init = 0;
+            if (exclusive) {
+#if TOKEN_BUCKET_TX_ENABLED
+                __atomic_store_n(&t->min_seq, p->seq, __ATOMIC_RELAXED);
+#endif
+                __atomic_store_n(&t->expected_seq, p->seq + 1, __ATOMIC_RELAXED);
+                __atomic_store_n(&t->initialized, 1, __ATOMIC_RELEASE);
+            } else if (__atomic_compare_exchange_n(&t->initialized, &expected_init, 1,
+                                                   false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+#if TOKEN_BUCKET_TX_ENABLED
+                __atomic_store_n(&t->min_seq, p->seq, __ATOMIC_RELEASE);
+#endif
+                __atomic_store_n(&t->expected_seq, p->seq + 1, __ATOMIC_RELEASE);
+            }
+            p->gap = 0;
+            run_max = p->seq;
+        }
+
+        if (k < end) {
+            uint64_t expected = __atomic_load_n(&t->expected_seq, __ATOMIC_ACQUIRE);
+            bool moved = false;
+            for (; k < end; k++) {
+                struct rx_pipe_pkt *p = &b->pkt[order[k]];
+                p->gap = 0;
+                if (p->seq > expected) {
+                    p->gap = p->seq - expected;
+                    lost += p->gap;
+                }
+                // Even if seq < expected, move forward only
+                if (p->seq >= expected) {
+                    expected = p->seq + 1;
+                    moved = true;
+                }
+                if (p->seq > run_max)
+                    run_max = p->seq;
+            }
+            if (moved)
+                __atomic_store_n(&t->expected_seq, expected, __ATOMIC_RELEASE);
+        }
+
+        if (exclusive) {
+            if (run_max > __atomic_load_n(&t->max_seq, __ATOMIC_RELAXED))
+                __atomic_store_n(&t->max_seq, run_max, __ATOMIC_RELEASE);
+            __atomic_store_n(&t->pkt_count, t->pkt_count + (end - r), __ATOMIC_RELAXED);
+            r = end;
+            continue;
+        }
+
+        uint64_t current_max;
+        do {
+            current_max = __atomic_load_n(&t->max_seq, __ATOMIC_ACQUIRE);
+            if (run_max <= current_max)
+                break;
+        } while (!__atomic_compare_exchange_n(&t->max_seq, &current_max, run_max,
+                                               false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+        __atomic_fetch_add(&t->pkt_count, end - r, __ATOMIC_RELAXED);
+        r = end;
+    }
+    return lost;
+}
+
+/**
+ * Stage 3b: CRC32C (splitmix64 transform, RX_VERIFY_SPLITMIX) and PRBS
+ * compare of one own packet
+ */
+static inline bool rx_pipe_verify(const struct rx_pipe_pkt *p, bool *crc_ok, bool *prbs_ok)
+{
+#if RX_VERIFY_SPLITMIX
+    *crc_ok = splitmix64_crc_ok(p->recv - RX_PIPE_PRBS_SKIP - SEQ_BYTES);
+#else
+    *crc_ok = true;
+#endif
+    *prbs_ok = (p->check_len == 0) || (memcmp(p->recv, p->exp, p->check_len) == 0);
+    return *crc_ok && *prbs_ok;
+}
+
+#endif /* RX_PIPELINE_H */
@@ -0,0 +1,61 @@
+#ifndef STARTUP_TRACE_H
+#define STARTUP_TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+
+// ==========================================
+// STARTUP TRACE
+// ==========================================
+// Wall time (CLOCK_MONOTONIC) of every init step from main() entry to the
+// first DPDK TX burst. The main thread runs one phase at a time
+// (startup_trace_phase closes the running phase and opens the next);
+// steps run next to it on other lcores / threads are recorded as tasks
+// with their own start / end. At "=== Running ===" the table shows each
+// phase and task with its share of the time to ready, and the first
+// startup_trace_poll after the first packet prints
+//   STARTUP-RESULT mode=<parallel|serial> ready_ms=.. first_pkt_ms=.. <phase>_ms=..
+// (bench/startup_ab.sh compares the two modes).
+
+#define STARTUP_TRACE_MAX_STEPS 48
+#define STARTUP_TRACE_NAME_LEN  24
+
+/**
+ * Start the clock (first statement of main)
+ */
+void startup_trace_init(bool parallel);
+
+/**
+ * Main thread: end the running phase, start 'name'
+ */
+void startup_trace_phase(const char *name);
+
+/**
+ * Record a step that ran outside the main thread (thread safe)
+ * @param lcore lcore / thread it ran on, -1 = non-EAL thread
+ */
+void startup_trace_task(const char *name, int lcore, uint64_t start_ns, uint64_t end_ns);
+
+/**
+ * CLOCK_MONOTONIC in ns (same base as the trace)
+ */
+uint64_t startup_trace_now_ns(void);
+
+/**
+ * First TX burst of any worker (only the first call is kept)
+ */
+void startup_trace_first_packet(void);
+
+/**
+ * Workers started: close the last phase, print the table
+ */
+void startup_trace_report(void);
+
+/**
+ * Main loop: print the time to first packet and the STARTUP-RESULT line
+ * once the first packet is out
+ */
+void startup_trace_poll(void);
+
+#endif /* STARTUP_TRACE_H */
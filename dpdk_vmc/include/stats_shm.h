@@ -0,0 +1,97 @@
+#ifndef STATS_SHM_H
+#define STATS_SHM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "port.h"
+#include "tx_rx_manager.h"                      // struct rx_stats, port_vl_tracker, latency_test_state
+#include "raw_socket_port.h"                    // struct raw_socket_port
+#include "pcap_replay.h"                        // struct replay_stats
+#include "embedded_latency/embedded_latency.h"  // struct emb_latency_state
+
+// ==========================================
+// SHARED STATS (secondary process reader)
+// ==========================================
+// The live counters are placed in memzones, so a DPDK secondary process
+// (tools/stats_reader.c, make stats-reader) can sample them while the
+// workers run:
+//
+//   vmc_rx_stats      rx_stats_per_port[MAX_PORTS]
+//   vmc_raw_ports     raw_ports[MAX_RAW_SOCKET_PORTS]
+//   vmc_replay_stats  replay_stats[MAX_PORTS][NUM_TX_CORES]  (PCAP_REPLAY_ENABLED)
+//   vmc_stats_dir     struct stats_shm_dir: layout, port list, the arrays
+//                     above, the VL-ID trackers (rte_malloc, same virtual
+//                     address in the secondary) and the latency results
+//
+// The reader only loads. It takes no lock, does no CAS and writes nothing
+// here, so the workers pay only for the cache lines it reads. Without a
+// memzone (--in-memory, --no-shconf, reserve failure) the arrays stay in
+// .bss and the primary runs as before.
+
+#define STATS_SHM_DIR_NAME "vmc_stats_dir"
+#define STATS_SHM_MAGIC 0x564d4353      // "VMCS"
+#define STATS_SHM_VERSION 1
+
+// Reader built with other sizes / options refuses to attach
+struct stats_shm_layout
+{
+    uint16_t max_ports;
+    uint16_t max_vl_id;
+    uint16_t num_tx_cores;
+    uint16_t num_rx_cores;
+    uint16_t max_raw_ports;
+    uint16_t max_raw_targets;
+    uint32_t dir_size;
+    uint32_t rx_stats_size;
+    uint32_t vl_tracker_size;
+    uint32_t raw_port_size;
+    uint32_t replay_stats_size;     // 0 = PCAP_REPLAY_ENABLED 0
+};
+
+struct stats_shm_dir
+{
+    uint32_t magic;
+    uint32_t version;
+    struct stats_shm_layout layout;
+    uint64_t tsc_hz;
+    uint64_t start_tsc;                         // Primary TSC at stats_shm_init
+    int32_t primary_pid;
+    volatile uint32_t ready;                    // Set by stats_shm_publish (workers starting)
+
+    uint16_t nb_ports;
+    uint16_t port_ids[MAX_PORTS];
+
+    struct rx_stats *rx_stats;                  // [MAX_PORTS], by port_id
+    struct port_vl_tracker *vl_trackers[MAX_PORTS];
+    struct raw_socket_port *raw_ports;          // [MAX_RAW_SOCKET_PORTS], NULL if not shared
+    int raw_port_count;
+#if PCAP_REPLAY_ENABLED
+    struct replay_stats (*replay_stats)[NUM_TX_CORES];  // NULL if not shared
+#endif
+
+    // Latency results (copied when the tests end, latency_seq odd while written)
+    volatile uint32_t latency_seq;
+#if LATENCY_TEST_ENABLED
+    struct latency_test_state latency_test;
+#endif
+    struct emb_latency_state emb_latency;
+};
+
+#if STATS_SHM_ENABLED
+
+/**
+ * Move the counter arrays into memzones and reserve the directory
+ * (primary, right after rte_eal_init, before ports / raw sockets are set up)
+ */
+void stats_shm_init(void);
+
+/**
+ * Publish the port list, VL-ID tracker pointers and latency results, then
+ * mark the directory ready (before the workers start)
+ */
+void stats_shm_publish(const struct ports_config *ports_config);
+
+#endif /* STATS_SHM_ENABLED */
+
+#endif /* STATS_SHM_H */
@@ -0,0 +1,59 @@
+#ifndef SW_HARNESS_H
+#define SW_HARNESS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "port.h"
+
+// ==========================================
+// SOFTWARE THROUGHPUT HARNESS
+// ==========================================
+// Ports 0..3 are net_ring (or net_null) vdevs instead of NICs. Fabric lcores
+// stand in for the switch and the peer VMC:
+//
+//   loopback: tx_worker -> TX ring -> fabric -> RX ring -> rx_worker
+//             (fabric applies the VL-ID/VLAN remap + splitmix64 transform)
+//   source:   fabric gen -> RX ring -> forward_worker -> TX ring -> fabric sink
+//   null:     tx_worker -> net_null (TX-only, no fabric)
+//
+// loopback runs with --role verifier, source with --role forwarder.
+// Per-second Mpps/Gbps for each stage, plus a single HARNESS-RESULT line at
+// shutdown (averaged after SW_HARNESS_WARMUP_S) for sweep scripts.
+// Run with --no-pci so the vdevs get port IDs 0..3.
+
+#if SW_HARNESS_ENABLED
+
+/**
+ * Create the harness vdevs (call right after EAL init, before initialize_ports)
+ * @return 0 on success, -1 on error
+ */
+int sw_harness_create_ports(void);
+
+/**
+ * Launch fabric lcores (call after lcorePortAssign and port setup,
+ * before the TX/RX or forward workers are started)
+ * @return 0 on success, -1 on error
+ */
+int sw_harness_start(const struct ports_config *ports_config, volatile bool *stop_flag);
+
+/**
+ * Per-second stats (call once per main loop iteration)
+ * @return true when SW_HARNESS_DURATION_S has elapsed after warmup
+ */
+bool sw_harness_tick(uint32_t loop_count);
+
+/**
+ * Print averaged results and the HARNESS-RESULT line
+ */
+void sw_harness_print_summary(void);
+
+/**
+ * Return ring contents to their pools and free the generator pools
+ * (call after rte_eal_mp_wait_lcore, before cleanup_ports)
+ */
+void sw_harness_cleanup(void);
+
+#endif /* SW_HARNESS_ENABLED */
+
+#endif /* SW_HARNESS_H */
@@ -0,0 +1,140 @@
+#ifndef TRAFFIC_PROFILE_H
+#define TRAFFIC_PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <rte_common.h>
+#include "config.h"
+#include "port.h"
+
+// ==========================================
+// IMIX TRAFFIC PROFILE ENGINE
+// ==========================================
+// A profile is a weighted set of frame sizes (legacy pattern, Simple IMIX,
+// Internet mix, inline "size:weight,..." or a CDF file). At load time the
+// weights are turned into exact per-cycle counts and one low-discrepancy
+// sequence of bucket indices (smooth weighted round-robin). Each VL walks the
+// sequence by its own TX sequence number from a golden-ratio phase, so every
+// VL sees the full mix in its own order and the size of (VL, seq) is known
+// on both ends. TX pacing charges each packet's exact byte count.
+
+#if IMIX_ENABLED
+
+#define TP_MAX_SIZES      16
+#define TP_BUCKET_OTHER   TP_MAX_SIZES          // RX length not in the profile
+#define TP_NB_BUCKETS     (TP_MAX_SIZES + 1)
+#define TP_TX_SLOT_EXT    NUM_TX_CORES          // External TX worker (queue 4)
+#define TP_TX_SLOTS       (NUM_TX_CORES + 1)
+
+struct traffic_profile
+{
+    char name[64];
+    uint16_t nb_sizes;
+    uint16_t sizes[TP_MAX_SIZES];       // Frame bytes (VLAN dahil), ascending
+    uint32_t counts[TP_MAX_SIZES];      // Occurrences per sequence cycle
+    uint32_t seq_len;                   // Cycle length (IMIX_PATTERN_SIZE for legacy)
+    uint64_t cycle_bytes;               // Sum of frame bytes over one cycle
+    uint8_t seq[IMIX_PROFILE_SEQ_LEN];  // Bucket index per cycle position
+    uint8_t bucket_of_len[IMIX_MAX_PACKET_SIZE + 1];  // RX: frame length -> bucket
+};
+
+extern struct traffic_profile g_traffic_profile;
+
+// Per-size packet counters, one writer per slot (worker lcore)
+struct tp_counters
+{
+    uint64_t pkts[TP_NB_BUCKETS];
+} __rte_cache_aligned;
+
+extern struct tp_counters tp_tx_counters[MAX_PORTS][TP_TX_SLOTS];
+extern struct tp_counters tp_rx_counters[MAX_PORTS][NUM_RX_CORES];
+
+/**
+ * Exact byte-cost pacer: cycles per byte in 32.32 fixed point, the
+ * fractional cycles are carried so there is no drift over any run length.
+ */
+struct tp_pacer
+{
+    uint64_t cycles_per_byte_q32;
+    uint64_t frac;
+};
+
+/**
+ * Load a profile (call once before workers start)
+ * @param spec NULL = IMIX_PROFILE default, "legacy" | "simple" | "internet",
+ *             "size:weight,size:weight,..." or a CDF file path
+ * @return 0 on success, -1 on error
+ */
+int traffic_profile_load(const char *spec);
+
+/**
+ * Print the loaded profile (sizes, weights, exact mean, tolerance)
+ */
+void traffic_profile_print(void);
+
+/**
+ * Register a TX worker's target rate (bytes/sec) for the achieved-rate check
+ */
+void traffic_profile_add_target(uint16_t port_id, uint64_t bytes_per_sec);
+
+/**
+ * Per-size TX/RX table and achieved vs target Gbps (call once per second)
+ */
+void traffic_profile_print_stats(const struct ports_config *ports_config);
+
+/**
+ * Zero the per-size counters (snapshot, workers keep writing)
+ */
+void traffic_profile_reset_stats(void);
+
+// Mean frame bytes of one cycle, rounded
+static inline uint64_t traffic_profile_mean_bytes(void)
+{
+    return (g_traffic_profile.cycle_bytes + g_traffic_profile.seq_len / 2) /
+           g_traffic_profile.seq_len;
+}
+
+// Size bucket of (VL, sequence): per-VL golden-ratio phase into the cycle
+static inline uint8_t traffic_profile_bucket(uint16_t vl_id, uint64_t seq)
+{
+    const struct traffic_profile *tp = &g_traffic_profile;
+    uint32_t phase = (uint32_t)(((uint64_t)(vl_id * 2654435761u) * tp->seq_len) >> 32);
+    return tp->seq[(seq + phase) % tp->seq_len];
+}
+
+static inline uint16_t traffic_profile_size(uint8_t bucket)
+{
+    return g_traffic_profile.sizes[bucket];
+}
+
+static inline void traffic_profile_count_tx(uint16_t port_id, uint16_t slot, uint8_t bucket)
+{
+    tp_tx_counters[port_id][slot].pkts[bucket]++;
+}
+
+static inline void traffic_profile_count_rx(uint16_t port_id, uint16_t queue_id, uint32_t len)
+{
+    uint8_t bucket = (len <= IMIX_MAX_PACKET_SIZE) ? g_traffic_profile.bucket_of_len[len]
+                                                   : TP_BUCKET_OTHER;
+    tp_rx_counters[port_id][queue_id].pkts[bucket]++;
+}
+
+static inline void tp_pacer_init(struct tp_pacer *p, uint64_t tsc_hz, uint64_t bytes_per_sec)
+{
+    p->cycles_per_byte_q32 = bytes_per_sec
+        ? (uint64_t)(((__uint128_t)tsc_hz << 32) / bytes_per_sec)
+        : ((uint64_t)tsc_hz << 32);
+    p->frac = 0;
+}
+
+// Cycles until the next packet may start after sending 'bytes'
+static inline uint64_t tp_pacer_cycles(struct tp_pacer *p, uint16_t bytes)
+{
+    uint64_t c = p->frac + (uint64_t)bytes * p->cycles_per_byte_q32;
+    p->frac = c & 0xFFFFFFFFULL;
+    return c >> 32;
+}
+
+#endif /* IMIX_ENABLED */
+
+#endif /* TRAFFIC_PROFILE_H */
@@ -5,16 +5,25 @@
 #include <rte_mbuf.h>
 #include <rte_ethdev.h>
 #include <rte_atomic.h>
+#include <rte_spinlock.h>
 #include "port.h"
 #include "packet.h"
 #include "config.h"
 
 #define TX_RING_SIZE 2048
 #define RX_RING_SIZE 8192
-#define NUM_MBUFS 524287
-#define MBUF_CACHE_SIZE 512
 #define BURST_SIZE 32
 
+// Mbuf pools (see MBUF POOL SIZING in config.h)
+// Legacy fixed pool, kept for MBUF_POOL_LEGACY=1 and the savings report
+#define NUM_MBUFS 524287
+#define MBUF_LEGACY_CACHE_SIZE 512
+// Largest frame on the wire (1518 + one VLAN tag), no scatter RX
+#define MBUF_MAX_FRAME_SIZE (RTE_ETHER_MAX_LEN + VLAN_HDR_SIZE)
+// Headroom + frame, rounded to whole cache lines (1664B vs 2176B default)
+#define MBUF_DATA_ROOM_SIZE RTE_ALIGN_CEIL(RTE_PKTMBUF_HEADROOM + MBUF_MAX_FRAME_SIZE, \
+                                           RTE_CACHE_LINE_SIZE)
+
 // VL-ID range limits
 // Her port'un tx_vl_ids başlangıç değerleri farklı olabilir (örn: Port 7 → 3971)
 // Her queue için 128 VL-ID aralığı var
@@ -32,9 +41,11 @@
 extern struct port_vlan_config port_vlans[MAX_PORTS_CONFIG];
 
 /**
- * @brief Load VLAN config based on ATE mode
- * Call after g_ate_mode is set (after latency test sequence).
- * Loads ATE_PORT_VLAN_CONFIG_INIT if ATE mode, otherwise keeps default.
+ * @brief Load VLAN config based on role and ATE mode
+ * Call once the role is set (startup) and again after g_ate_mode is set
+ * (after latency test sequence). Verifier: PORT_VLAN_CONFIG_INIT /
+ * ATE_PORT_VLAN_CONFIG_INIT, forwarder: FWD_PORT_VLAN_CONFIG_INIT /
+ * FWD_ATE_PORT_VLAN_CONFIG_INIT.
  */
 void port_vlans_load_config(bool ate_mode);
 
@@ -65,9 +76,9 @@ struct rx_stats
     // Raw socket paketleri (non-VLAN) - DPDK'dan ayrı takip
     rte_atomic64_t raw_socket_rx_pkts; // Raw socket'ten gelen paket sayısı
     rte_atomic64_t raw_socket_rx_bytes; // Raw socket'ten gelen byte sayısı
-};
+} __rte_cache_aligned;   // One line set per port, no sharing between ports
 
-extern struct rx_stats rx_stats_per_port[MAX_PORTS];
+extern struct rx_stats *rx_stats_per_port;   // [MAX_PORTS], by port_id
 
 /**
  * VL-ID based sequence tracking (lock-free, watermark-based)
@@ -91,7 +102,17 @@ struct port_vl_tracker {
     // No lock needed - using lock-free atomic operations per VL-ID
 };
 
-extern struct port_vl_tracker port_vl_trackers[MAX_PORTS];
+extern struct port_vl_tracker *port_vl_trackers[MAX_PORTS];   // On the port's socket, NULL if unused
+
+/**
+ * Forward TX queue lock (forward_worker, cross-port TX)
+ * One cache line per lock, MAX_TX_QUEUES_FWD per port in one block
+ */
+#define MAX_TX_QUEUES_FWD 8
+struct fwd_tx_queue_lock
+{
+    rte_spinlock_t lock;
+} __rte_cache_aligned;
 
 /**
  * TX/RX configuration for a port
@@ -101,7 +122,9 @@ struct txrx_config
     uint16_t port_id;
     uint16_t nb_tx_queues;
     uint16_t nb_rx_queues;
-    struct rte_mempool *mbuf_pool;
+    struct rte_mempool *rx_mbuf_pool;   // RX descriptors (+ forwarded packets)
+    struct rte_mempool *tx_mbuf_pool;   // Locally generated TX / ext TX / latency
+    uint16_t socket_id;     // Queue ring socket (ports[].numa_node, same as the pools)
 };
 
 /**
@@ -117,6 +140,10 @@ struct tx_worker_params
     uint16_t vl_id;         // VL ID for MAC/IP (different from VLAN)
     struct packet_config pkt_config;
     struct rte_mempool *mbuf_pool;
+#if PRBS_EXTBUF_TX_ENABLED
+    struct rte_mempool *extbuf_pool;            // NULL = copy mode on this port
+    struct rte_mbuf_ext_shared_info prbs_shinfo; // Outlives the worker (static params)
+#endif
     volatile bool *stop_flag;
     uint64_t sequence_number;  // Not used anymore - VL-ID based now
     struct rate_limiter limiter;
@@ -182,9 +209,40 @@ void print_vlan_config(void);
 int init_port_txrx(uint16_t port_id, struct txrx_config *config);
 
 /**
- * Create mbuf pool for a socket
+ * Mbuf pool role: RX pools feed the RX descriptor rings, TX pools are
+ * allocated from by tx_worker / external TX / latency test, TX_EXTBUF pools
+ * hold the mbufs that point into the PRBS cache
+ */
+enum mbuf_pool_role
+{
+    MBUF_POOL_RX = 0,
+    MBUF_POOL_TX,
+    MBUF_POOL_TX_EXTBUF,    // Data-room-less payload segments (PRBS_EXTBUF_TX_ENABLED)
+};
+
+/**
+ * Create the RX or TX mbuf pool of a port, sized for nb_queues queues of
+ * that role (ring depth + per-lcore burst and cache + in-flight forwarding)
  */
-struct rte_mempool *create_mbuf_pool(uint16_t socket_id, uint16_t port_id);
+struct rte_mempool *create_mbuf_pool(uint16_t socket_id, uint16_t port_id,
+                                     enum mbuf_pool_role role, uint16_t nb_queues);
+
+/**
+ * Find a pool created by create_mbuf_pool
+ */
+struct rte_mempool *lookup_mbuf_pool(uint16_t socket_id, uint16_t port_id,
+                                     enum mbuf_pool_role role);
+
+/**
+ * Print mbuf count / object size / memory per pool and the saving over the
+ * legacy fixed pool
+ */
+void print_mbuf_pool_report(void);
+
+/**
+ * Total memory of all created mbuf pools (bytes, objects only)
+ */
+uint64_t mbuf_pool_total_bytes(void);
 
 /**
  * Setup TX queue
@@ -207,23 +265,22 @@ int tx_worker(void *arg);
  */
 int rx_worker(void *arg);
 
-#if FORWARD_MODE
 /**
- * Forward worker: RX packets and TX them back on the same port (loopback)
- * Used in VMC_2 to forward packets back to VMC_1 without modification
+ * Start TX/RX workers for all ports
  */
-int forward_worker(void *arg);
+int start_txrx_workers(struct ports_config *ports_config, volatile bool *stop_flag);
 
 /**
- * Start forward workers for all ports (FORWARD_MODE)
+ * Forward worker: RX packets, remap VL-ID / VLAN, splitmix64 transform and
+ * TX them back (same port, or the R2 cross-port target)
+ * Forwarder role (VMC_2) entry point, launched instead of tx_worker / rx_worker
  */
-int start_forward_workers(struct ports_config *ports_config, volatile bool *stop_flag);
-#endif
+int forward_worker(void *arg);
 
 /**
- * Start TX/RX workers for all ports
+ * Start forward workers for all ports (forwarder role)
  */
-int start_txrx_workers(struct ports_config *ports_config, volatile bool *stop_flag);
+int start_forward_workers(struct ports_config *ports_config, volatile bool *stop_flag);
 
 /**
  * Print port statistics from DPDK
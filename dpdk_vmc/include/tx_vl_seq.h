@@ -0,0 +1,94 @@
+#ifndef TX_VL_SEQ_H
+#define TX_VL_SEQ_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <rte_common.h>
+#include <rte_branch_prediction.h>
+#include "config.h"
+#include "tx_rx_manager.h"  // MAX_VL_ID
+
+// ==========================================
+// TX VL-ID SEQUENCE OWNERSHIP
+// ==========================================
+// Her VL-ID'nin sequence'ını tek bir TX queue yazar. Sahiplik başlangıçta
+// tx_vl_ids / tx_vl_ids2 aralıklarından çözülür (init_tx_vl_sequences);
+// sahip worker sayaçlarını kendi özel, VL offset sıralı dizisinde tutar
+// (kilit yok, atomic yok). Birden fazla queue'nun gönderdiği VL-ID
+// SHARED işaretlenir: TX_VL_SHARED_SEQ=0 ise başlangıç reddedilir,
+// 1 ise o VL-ID port tablosunda atomic fetch-add ile ilerler.
+// Hot-path primitives of tx_worker, shared with bench/port_scale_bench.c.
+#define TX_VL_OWNER_NONE 0xFF
+#define TX_VL_OWNER_SHARED 0xFE
+
+// Per-port VL-ID owner table and the shared VL-IDs' sequences
+struct tx_vl_sequence
+{
+    uint8_t owner[MAX_VL_ID + 1];                          // TX queue, NONE or SHARED
+    uint64_t shared_seq[MAX_VL_ID + 1] __rte_cache_aligned; // SHARED VL-IDs only
+};
+
+// TX worker's private sequences, indexed by its VL offset (round-robin order)
+struct tx_vl_seq_local
+{
+    uint64_t *seq;          // [vl_range_size], owned VL-IDs
+    uint8_t *shared;        // [vl_range_size], NULL if no VL-ID of the range is shared
+    uint64_t *shared_seq;   // Port's shared_seq table
+};
+
+// TX queue's VL-ID round-robin: range 1, then range 2 (tx_worker order)
+struct tx_vl_span
+{
+    uint16_t r1_start;
+    uint16_t r1_size;
+    uint16_t r2_start;      // 0 = no range 2
+    uint16_t r2_size;
+};
+
+static inline uint16_t tx_vl_span_at(const struct tx_vl_span *span, uint16_t offset)
+{
+    return (offset < span->r1_size) ? (span->r1_start + offset)
+                                    : (span->r2_start + (offset - span->r1_size));
+}
+
+static inline bool tx_vl_seq_is_shared(const struct tx_vl_seq_local *local, uint16_t offset)
+{
+    return unlikely(local->shared != NULL) && local->shared[offset];
+}
+
+/**
+ * Get next sequence for a VL-ID (consumes it)
+ */
+static inline uint64_t get_next_tx_sequence(struct tx_vl_seq_local *local, uint16_t offset,
+                                            uint16_t vl_id)
+{
+    if (tx_vl_seq_is_shared(local, offset))
+        return __atomic_fetch_add(&local->shared_seq[vl_id], 1, __ATOMIC_RELAXED);
+    return local->seq[offset]++;
+}
+
+/**
+ * Peek current sequence for a VL-ID without incrementing
+ * Use with commit_tx_sequence() for send-then-commit pattern.
+ * A shared VL-ID takes its sequence here (fetch-add): a failed send of a
+ * shared VL-ID shows as one lost sequence on RX.
+ */
+static inline uint64_t peek_tx_sequence(struct tx_vl_seq_local *local, uint16_t offset,
+                                        uint16_t vl_id)
+{
+    if (tx_vl_seq_is_shared(local, offset))
+        return __atomic_fetch_add(&local->shared_seq[vl_id], 1, __ATOMIC_RELAXED);
+    return local->seq[offset];
+}
+
+/**
+ * Commit (increment) sequence for a VL-ID after successful send.
+ * Only call after confirming the packet was actually transmitted.
+ */
+static inline void commit_tx_sequence(struct tx_vl_seq_local *local, uint16_t offset)
+{
+    if (!tx_vl_seq_is_shared(local, offset))
+        local->seq[offset]++;
+}
+
+#endif /* TX_VL_SEQ_H */
@@ -0,0 +1,220 @@
+#ifndef VL_RANGE_H
+#define VL_RANGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "config.h"
+#include "tx_rx_manager.h"  // port_vlans, VL_RANGE_SIZE_PER_QUEUE
+
+// ==========================================
+// VL-ID RANGE LOOKUPS (per port, per queue)
+// ==========================================
+// Range 1: [vl_ids[q], vl_ids[q] + range1_size)   (size 0 = VL_RANGE_SIZE_PER_QUEUE)
+// Range 2: [vl_ids2[q], vl_ids2[q] + range2_size) (start 0 = no range 2)
+// Used on the TX/RX hot path and by the bench/ suite.
+
+/**
+ * Get TX VL ID range start for a port and queue (PORT-AWARE)
+ * Config'deki tx_vl_ids değerini döndürür
+ */
+static inline uint16_t get_tx_vl_id_range_start(uint16_t port_id, uint16_t queue_index)
+{
+    if (port_id >= MAX_PORTS_CONFIG)
+    {
+        printf("Warning: Invalid port_id %u for TX VL ID range start\n", port_id);
+        return 3; // Fallback
+    }
+    if (queue_index >= port_vlans[port_id].tx_vlan_count)
+    {
+        printf("Warning: Invalid queue_index %u for port %u TX VL ID range start\n",
+               queue_index, port_id);
+        return port_vlans[port_id].tx_vl_ids[0]; // Fallback to first
+    }
+    return port_vlans[port_id].tx_vl_ids[queue_index];
+}
+
+/**
+ * Get TX VL ID range 1 size for a port and queue
+ * Returns tx_vl_range1_size if set, otherwise VL_RANGE_SIZE_PER_QUEUE
+ */
+static inline uint16_t get_tx_vl_range1_size(uint16_t port_id, uint16_t queue_index)
+{
+    if (port_id < MAX_PORTS_CONFIG && queue_index < port_vlans[port_id].tx_vlan_count
+        && port_vlans[port_id].tx_vl_range1_size[queue_index] > 0)
+        return port_vlans[port_id].tx_vl_range1_size[queue_index];
+    return VL_RANGE_SIZE_PER_QUEUE;
+}
+
+/**
+ * Get total TX VL-ID count for a port and queue (range1 + range2)
+ */
+static inline uint16_t get_tx_vl_total_count(uint16_t port_id, uint16_t queue_index)
+{
+    uint16_t total = get_tx_vl_range1_size(port_id, queue_index);
+    if (port_id < MAX_PORTS_CONFIG && queue_index < port_vlans[port_id].tx_vlan_count
+        && port_vlans[port_id].tx_vl_ids2[queue_index] > 0)
+        total += port_vlans[port_id].tx_vl_range2_size[queue_index];
+    return total;
+}
+
+/**
+ * Get TX VL ID range end for a port and queue (exclusive, PORT-AWARE)
+ * For backward compat: returns range1 end only
+ */
+static inline uint16_t get_tx_vl_id_range_end(uint16_t port_id, uint16_t queue_index)
+{
+    return get_tx_vl_id_range_start(port_id, queue_index) + get_tx_vl_range1_size(port_id, queue_index);
+}
+
+/**
+ * Get RX VL ID range start for a port and queue (PORT-AWARE)
+ * Config'deki rx_vl_ids değerini döndürür
+ */
+static inline uint16_t get_rx_vl_id_range_start(uint16_t port_id, uint16_t queue_index)
+{
+    if (port_id >= MAX_PORTS_CONFIG)
+    {
+        printf("Warning: Invalid port_id %u for RX VL ID range start\n", port_id);
+        return 3; // Fallback
+    }
+    if (queue_index >= port_vlans[port_id].rx_vlan_count)
+    {
+        printf("Warning: Invalid queue_index %u for port %u RX VL ID range start\n",
+               queue_index, port_id);
+        return port_vlans[port_id].rx_vl_ids[0]; // Fallback to first
+    }
+    return port_vlans[port_id].rx_vl_ids[queue_index];
+}
+
+/**
+ * Get RX VL ID range 1 size for a port and queue
+ */
+static inline uint16_t get_rx_vl_range1_size(uint16_t port_id, uint16_t queue_index)
+{
+    if (port_id < MAX_PORTS_CONFIG && queue_index < port_vlans[port_id].rx_vlan_count
+        && port_vlans[port_id].rx_vl_range1_size[queue_index] > 0)
+        return port_vlans[port_id].rx_vl_range1_size[queue_index];
+    return VL_RANGE_SIZE_PER_QUEUE;
+}
+
+/**
+ * Get RX VL ID range end for a port and queue (exclusive, PORT-AWARE)
+ */
+static inline uint16_t get_rx_vl_id_range_end(uint16_t port_id, uint16_t queue_index)
+{
+    return get_rx_vl_id_range_start(port_id, queue_index) + get_rx_vl_range1_size(port_id, queue_index);
+}
+
+/**
+ * Get VL ID range size for a port/queue (backward compat)
+ */
+static inline uint16_t get_vl_id_range_size(void)
+{
+    return VL_RANGE_SIZE_PER_QUEUE;
+}
+
+/**
+ * Validate if a VL ID is within the valid TX range for a port and queue (dual-range)
+ */
+static inline bool is_valid_tx_vl_id_for_queue(uint16_t vl_id, uint16_t port_id, uint16_t queue_index)
+{
+    uint16_t start = get_tx_vl_id_range_start(port_id, queue_index);
+    uint16_t end = start + get_tx_vl_range1_size(port_id, queue_index);
+    if (vl_id >= start && vl_id < end)
+        return true;
+    // Check range 2
+    if (port_id < MAX_PORTS_CONFIG && queue_index < port_vlans[port_id].tx_vlan_count
+        && port_vlans[port_id].tx_vl_ids2[queue_index] > 0) {
+        uint16_t s2 = port_vlans[port_id].tx_vl_ids2[queue_index];
+        uint16_t e2 = s2 + port_vlans[port_id].tx_vl_range2_size[queue_index];
+        if (vl_id >= s2 && vl_id < e2)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Validate if a VL ID is within the valid RX range for a port and queue (dual-range)
+ */
+static inline bool is_valid_rx_vl_id_for_queue(uint16_t vl_id, uint16_t port_id, uint16_t queue_index)
+{
+    uint16_t start = get_rx_vl_id_range_start(port_id, queue_index);
+    uint16_t end = start + get_rx_vl_range1_size(port_id, queue_index);
+    if (vl_id >= start && vl_id < end)
+        return true;
+    // Check range 2
+    if (port_id < MAX_PORTS_CONFIG && queue_index < port_vlans[port_id].rx_vlan_count
+        && port_vlans[port_id].rx_vl_ids2[queue_index] > 0) {
+        uint16_t s2 = port_vlans[port_id].rx_vl_ids2[queue_index];
+        uint16_t e2 = s2 + port_vlans[port_id].rx_vl_range2_size[queue_index];
+        if (vl_id >= s2 && vl_id < e2)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Check if VL-ID is within valid TX range for source port (any queue)
+ * This is used to detect external packets - if VL-ID doesn't match
+ * what the source port would send, it's from an external source.
+ */
+static inline bool is_valid_tx_vl_id_for_source_port(uint16_t vl_id, uint16_t src_port_id)
+{
+    if (src_port_id >= MAX_PORTS_CONFIG)
+        return false;
+
+    // Check all TX queues for source port (dual-range aware)
+    uint16_t queue_count = port_vlans[src_port_id].tx_vlan_count;
+    for (uint16_t q = 0; q < queue_count; q++)
+    {
+        // Range 1
+        uint16_t start = port_vlans[src_port_id].tx_vl_ids[q];
+        uint16_t r1_size = (port_vlans[src_port_id].tx_vl_range1_size[q] > 0)
+                           ? port_vlans[src_port_id].tx_vl_range1_size[q]
+                           : VL_RANGE_SIZE_PER_QUEUE;
+        if (vl_id >= start && vl_id < start + r1_size)
+            return true;
+        // Range 2
+        uint16_t s2 = port_vlans[src_port_id].tx_vl_ids2[q];
+        if (s2 > 0) {
+            uint16_t r2_size = port_vlans[src_port_id].tx_vl_range2_size[q];
+            if (vl_id >= s2 && vl_id < s2 + r2_size)
+                return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Check if VL-ID is within valid RX range for a given port (any queue).
+ * Used to detect loopback packets - when VMC_2 remaps VL-IDs, the returning
+ * VL-IDs match the port's rx_vl_ids, not tx_vl_ids.
+ */
+static inline bool is_valid_rx_vl_id_for_port(uint16_t vl_id, uint16_t port_id)
+{
+    if (port_id >= MAX_PORTS_CONFIG)
+        return false;
+
+    uint16_t queue_count = port_vlans[port_id].rx_vlan_count;
+    for (uint16_t q = 0; q < queue_count; q++)
+    {
+        // Range 1
+        uint16_t start = port_vlans[port_id].rx_vl_ids[q];
+        uint16_t r1_size = (port_vlans[port_id].rx_vl_range1_size[q] > 0)
+                           ? port_vlans[port_id].rx_vl_range1_size[q]
+                           : VL_RANGE_SIZE_PER_QUEUE;
+        if (vl_id >= start && vl_id < start + r1_size)
+            return true;
+        // Range 2
+        uint16_t s2 = port_vlans[port_id].rx_vl_ids2[q];
+        if (s2 > 0) {
+            uint16_t r2_size = port_vlans[port_id].rx_vl_range2_size[q];
+            if (vl_id >= s2 && vl_id < s2 + r2_size)
+                return true;
+        }
+    }
+    return false;
+}
+
+#endif /* VL_RANGE_H */
@@ -0,0 +1,145 @@
+#ifndef VL_SEQ_TRACKER_H
+#define VL_SEQ_TRACKER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+
+// ==========================================
+// PER-(RAW PORT, VL-ID) SEQUENCE TRACKER
+// ==========================================
+// PACKET_FANOUT RX worker'ları aynı VL-ID'yi farklı queue'lardan alabilir,
+// bu yüzden kayıp tek bir worker'ın gördüğü sıradan hesaplanamaz.
+//
+// Her raw port'un her fanout worker'ı (queue) kendi shard'ına yazar:
+// VL başına min / max sequence, alınan paket sayısı ve shard içinde
+// max'ın altında gelen paketler (reorder). Yazan tek thread olduğu için
+// atomik RMW / CAS yok, sadece relaxed / release store. Okuma tarafı
+// (stats thread) shard'ları birleştirir:
+//
+//   lost       = (max - min + 1) - rx       (rx < span ise)
+//   duplicates = rx - (max - min + 1)       (rx > span ise)
+//   reordered  = shard'ların late toplamı   (queue içi sıra bozulması)
+//
+// VL-ID → slot eşlemesi init'te kaydedilir (DPDK external TX aralıkları ve
+// raw RX kaynakları), hot path'te tek bir tablo okuması.
+// vl_seq_reset() sadece epoch'u artırır: her shard bir sonraki paketinde
+// kendini temizler, okuyucu eski epoch'lu shard'ları boş sayar.
+
+#define VL_SEQ_MAX_PORTS   MAX_RAW_SOCKET_PORTS
+#define VL_SEQ_MAX_SHARDS  8      // Port başına fanout worker (queue) üst sınırı
+#define VL_SEQ_MAX_VLS     512    // Port başına izlenen VL-ID
+#define VL_SEQ_VL_MAP_SIZE 65536  // VL-ID = DST MAC'in son 16 biti
+
+struct vl_seq_slot {
+    uint64_t min_seq;       // UINT64_MAX = henüz paket yok
+    uint64_t max_seq;
+    uint64_t rx_count;
+    uint64_t late;          // Bu shard'ın max'ından küçük gelenler
+};
+
+struct vl_seq_shard {
+    uint32_t epoch;         // vl_seq_epoch ile farklıysa shard boş sayılır
+    struct vl_seq_slot slots[VL_SEQ_MAX_VLS];
+} __attribute__((aligned(64)));
+
+struct vl_seq_port {
+    uint16_t slot_of_vl[VL_SEQ_VL_MAP_SIZE];   // 0 = izlenmiyor, yoksa slot + 1
+    uint16_t slot_vl_id[VL_SEQ_MAX_VLS];
+    uint16_t nb_slots;
+    struct vl_seq_shard shards[VL_SEQ_MAX_SHARDS];
+};
+
+// Merged view of a VL-ID range (vl_seq_read)
+struct vl_seq_totals {
+    uint64_t rx;
+    uint64_t lost;
+    uint64_t reordered;
+    uint64_t duplicates;
+    uint32_t active_vls;
+};
+
+extern struct vl_seq_port vl_seq_ports[VL_SEQ_MAX_PORTS];
+extern uint32_t vl_seq_epoch;
+
+/**
+ * Register [vl_start, vl_start + vl_count) for a raw port (init only,
+ * before RX workers start). Already registered VL-IDs are skipped.
+ * @return 0 on success, -1 if the port's slot table is full
+ */
+int vl_seq_add_range(int raw_index, uint16_t vl_start, uint16_t vl_count);
+
+/**
+ * Forget all registrations and counts (init only)
+ */
+void vl_seq_clear(void);
+
+/**
+ * Drop all counts, keep registrations (safe while workers run)
+ */
+void vl_seq_reset(void);
+
+/**
+ * Merge all shards of a raw port over a VL-ID range (stats thread)
+ */
+void vl_seq_read(int raw_index, uint16_t vl_start, uint16_t vl_count,
+                 struct vl_seq_totals *out);
+
+/**
+ * Merge all shards over every registered VL-ID of a raw port
+ */
+void vl_seq_read_port(int raw_index, struct vl_seq_totals *out);
+
+/**
+ * Debug: first active VL-IDs and the worst one, per-shard rx split
+ */
+void vl_seq_print_debug(int raw_index, uint16_t port_id);
+
+static inline void vl_seq_shard_clear(struct vl_seq_shard *sh, uint32_t epoch)
+{
+    for (int i = 0; i < VL_SEQ_MAX_VLS; i++) {
+        __atomic_store_n(&sh->slots[i].min_seq, UINT64_MAX, __ATOMIC_RELAXED);
+        __atomic_store_n(&sh->slots[i].max_seq, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&sh->slots[i].rx_count, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&sh->slots[i].late, 0, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&sh->epoch, epoch, __ATOMIC_RELEASE);
+}
+
+/**
+ * RX hot path: one packet of vl_id with sequence seq, seen by fanout
+ * worker 'shard' of raw port 'raw_index'. Only that worker may write the
+ * shard. Returns the VL's slot + 1, 0 if the VL-ID is not tracked.
+ */
+static inline uint16_t vl_seq_update(int raw_index, int shard, uint16_t vl_id, uint64_t seq)
+{
+    struct vl_seq_port *tp = &vl_seq_ports[raw_index];
+    uint16_t s = tp->slot_of_vl[vl_id];
+    if (s == 0)
+        return 0;
+
+    struct vl_seq_shard *sh = &tp->shards[shard];
+    uint32_t epoch = __atomic_load_n(&vl_seq_epoch, __ATOMIC_RELAXED);
+    if (__builtin_expect(sh->epoch != epoch, 0))
+        vl_seq_shard_clear(sh, epoch);
+
+    // Sole writer: plain reads of our own fields. Count goes first and
+    // min / max with release after it, so a reader that loads min / max
+    // (acquire) and then the count never sees a span wider than the
+    // count it reads (no transient phantom loss).
+    struct vl_seq_slot *sl = &sh->slots[s - 1];
+    uint64_t cnt = sl->rx_count;
+    __atomic_store_n(&sl->rx_count, cnt + 1, __ATOMIC_RELAXED);
+
+    if (cnt == 0 || seq > sl->max_seq)
+        __atomic_store_n(&sl->max_seq, seq, __ATOMIC_RELEASE);
+    else if (seq < sl->max_seq)
+        __atomic_store_n(&sl->late, sl->late + 1, __ATOMIC_RELAXED);
+
+    if (seq < sl->min_seq)
+        __atomic_store_n(&sl->min_seq, seq, __ATOMIC_RELEASE);
+
+    return s;
+}
+
+#endif /* VL_SEQ_TRACKER_H */
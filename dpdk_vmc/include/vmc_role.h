@@ -0,0 +1,47 @@
+#ifndef VMC_ROLE_H
+#define VMC_ROLE_H
+
+#include <stdbool.h>
+#include "config.h"
+
+// ==========================================
+// VMC ROLE (runtime)
+// ==========================================
+// One binary for both ends of the loop, role chosen at startup:
+//
+//   verifier   (VMC_1): tx_worker PRBS-31 + sequence TX, rx_worker checks
+//              the returning splitmix64 CRC32C / PRBS / per-VL sequences
+//   forwarder  (VMC_2): forward_worker RX -> VL-ID / VLAN remap +
+//              splitmix64 transform -> TX (local or R2 cross-port), no PRBS
+//
+// --role verifier|forwarder (default VMC_ROLE_DEFAULT). The role is read
+// once while the workers are launched: each role has its own worker entry
+// points, the per-packet loops never test it.
+
+enum vmc_role
+{
+    VMC_ROLE_VERIFIER = 0,
+    VMC_ROLE_FORWARDER = 1,
+};
+
+extern enum vmc_role g_vmc_role;
+
+/**
+ * Set the role (main, before anything role dependent is initialized)
+ */
+void vmc_role_set(enum vmc_role role);
+
+/**
+ * Parse "verifier" / "forwarder" (also "vmc1" / "vmc2")
+ * @return 0 on success, -1 on unknown name
+ */
+int vmc_role_parse(const char *name, enum vmc_role *role);
+
+const char *vmc_role_name(enum vmc_role role);
+
+static inline bool vmc_role_forwarder(void)
+{
+    return g_vmc_role == VMC_ROLE_FORWARDER;
+}
+
+#endif /* VMC_ROLE_H */
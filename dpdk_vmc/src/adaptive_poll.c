@@ -0,0 +1,251 @@
+/**
+ * Adaptive polling / power-aware idle
+ *
+ * Slots are handed out to the workers at start-up (adaptive_poll_register,
+ * in the worker thread). Capabilities are checked once per slot: UMWAIT and
+ * TPAUSE from the CPU, the monitor address from the PMD, the RX interrupt
+ * from the port configuration plus a successful epoll registration. A level
+ * that is not available is skipped when the streak escalates.
+ */
+
+#include "config.h"
+
+#if ADAPTIVE_POLL_ENABLED
+
+#include <rte_interrupts.h>
+#include <rte_cpuflags.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "adaptive_poll.h"
+
+static struct adaptive_poll ap_slots[ADAPTIVE_POLL_MAX_WORKERS];
+static uint32_t ap_nb_slots;
+
+// Ports configured with RX queue interrupts
+static bool ap_port_rxq_intr[MAX_PORTS];
+
+static const char *const ap_role_names[] = {"RX", "TX", "PTP", "LAT", "EXT", "FWD"};
+
+uint8_t adaptive_poll_port_max_level(uint16_t port_id)
+{
+    if (IS_FAST_PORT(port_id))
+        return ADAPTIVE_POLL_MAX_LEVEL_FAST;
+    if (IS_MID_PORT(port_id))
+        return ADAPTIVE_POLL_MAX_LEVEL_MID;
+    return ADAPTIVE_POLL_MAX_LEVEL_SLOW;
+}
+
+void adaptive_poll_port_conf(uint16_t port_id, struct rte_eth_conf *port_conf)
+{
+    if (port_id >= MAX_PORTS || adaptive_poll_port_max_level(port_id) < ADAPTIVE_POLL_LEVEL_INTR)
+        return;
+    port_conf->intr_conf.rxq = 1;
+    ap_port_rxq_intr[port_id] = true;
+}
+
+bool adaptive_poll_port_conf_fallback(uint16_t port_id, struct rte_eth_conf *port_conf)
+{
+    if (port_id >= MAX_PORTS || !ap_port_rxq_intr[port_id])
+        return false;
+    printf("[ADAPTIVE] Port %u: configure failed with RX interrupts, retrying without "
+           "(idle level capped at UMWAIT)\n", port_id);
+    port_conf->intr_conf.rxq = 0;
+    ap_port_rxq_intr[port_id] = false;
+    return true;
+}
+
+struct adaptive_poll *adaptive_poll_register(uint8_t role, uint16_t port_id, uint16_t queue_id,
+                                             uint8_t max_level)
+{
+    uint32_t idx = __atomic_fetch_add(&ap_nb_slots, 1, __ATOMIC_RELAXED);
+    if (idx >= ADAPTIVE_POLL_MAX_WORKERS) {
+        printf("[ADAPTIVE] No slot for %s port %u Q%u (max %u), polling without idle\n",
+               ap_role_names[role], port_id, queue_id, ADAPTIVE_POLL_MAX_WORKERS);
+        return NULL;
+    }
+
+    struct adaptive_poll *ap = &ap_slots[idx];
+    struct rte_cpu_intrinsics intr;
+    uint64_t hz = rte_get_tsc_hz();
+
+    memset(ap, 0, sizeof(*ap));
+    rte_cpu_get_intrinsics_support(&intr);
+
+    ap->role = role;
+    ap->port_id = port_id;
+    ap->queue_id = queue_id;
+    ap->max_level = max_level;
+    ap->monitor_cycles = hz / 1000000 * ADAPTIVE_POLL_MONITOR_US;
+    ap->tx_min_sleep_cycles = hz / 1000000 * ADAPTIVE_POLL_TX_MIN_SLEEP_NS / 1000;
+    ap->tx_guard_cycles = hz / 1000000 * ADAPTIVE_POLL_TX_GUARD_NS / 1000;
+    ap->tpause_ok = intr.power_pause && max_level >= ADAPTIVE_POLL_LEVEL_MONITOR;
+
+    if (max_level >= ADAPTIVE_POLL_LEVEL_MONITOR && intr.power_monitor) {
+        struct rte_power_monitor_cond pmc;
+        ap->monitor_ok = rte_eth_get_monitor_addr(port_id, queue_id, &pmc) == 0;
+    }
+
+    if (max_level >= ADAPTIVE_POLL_LEVEL_INTR && port_id < MAX_PORTS &&
+        ap_port_rxq_intr[port_id]) {
+        int ret = rte_eth_dev_rx_intr_ctl_q(port_id, queue_id, RTE_EPOLL_PER_THREAD,
+                                            RTE_INTR_EVENT_ADD, NULL);
+        ap->intr_ok = ret == 0;
+        if (ret != 0)
+            printf("[ADAPTIVE] %s port %u Q%u: RX interrupt not available (%d)\n",
+                   ap_role_names[role], port_id, queue_id, ret);
+    }
+
+    // Highest level actually usable (streak_level also skips a missing monitor)
+    if (ap->max_level == ADAPTIVE_POLL_LEVEL_INTR && !ap->intr_ok)
+        ap->max_level = ADAPTIVE_POLL_LEVEL_MONITOR;
+    if (ap->max_level == ADAPTIVE_POLL_LEVEL_MONITOR && !ap->monitor_ok)
+        ap->max_level = ADAPTIVE_POLL_LEVEL_PAUSE;
+
+    ap->start_tsc = rte_get_tsc_cycles();
+
+    printf("[ADAPTIVE] %s port %u Q%u: max idle level %u (UMWAIT %s, interrupt %s, TPAUSE %s)\n",
+           ap_role_names[role], port_id, queue_id, ap->max_level,
+           ap->monitor_ok ? "yes" : "no", ap->intr_ok ? "yes" : "no",
+           ap->tpause_ok ? "yes" : "no");
+    return ap;
+}
+
+void adaptive_poll_release(struct adaptive_poll *ap)
+{
+    if (ap == NULL || !ap->intr_ok)
+        return;
+    rte_eth_dev_rx_intr_ctl_q(ap->port_id, ap->queue_id, RTE_EPOLL_PER_THREAD,
+                              RTE_INTR_EVENT_DEL, NULL);
+    ap->intr_ok = false;
+}
+
+// Level for the current streak, skipping the unavailable ones
+static uint8_t streak_level(const struct adaptive_poll *ap)
+{
+    uint8_t level = ADAPTIVE_POLL_LEVEL_PAUSE;
+
+    if (ap->empty_streak >= ADAPTIVE_POLL_INTR_THRESH && ap->intr_ok)
+        level = ADAPTIVE_POLL_LEVEL_INTR;
+    else if (ap->empty_streak >= ADAPTIVE_POLL_MONITOR_THRESH && ap->monitor_ok)
+        level = ADAPTIVE_POLL_LEVEL_MONITOR;
+
+    return level < ap->max_level ? level : ap->max_level;
+}
+
+// Sleep until the queue's interrupt fires or the timeout; false if not armed
+static bool intr_sleep(struct adaptive_poll *ap)
+{
+    struct rte_epoll_event ev;
+
+    if (rte_eth_dev_rx_intr_enable(ap->port_id, ap->queue_id) != 0)
+        return false;
+
+    // A packet that landed before the enable may not raise the interrupt
+    if (rte_eth_rx_queue_count(ap->port_id, ap->queue_id) <= 0) {
+        if (rte_epoll_wait(RTE_EPOLL_PER_THREAD, &ev, 1, ADAPTIVE_POLL_INTR_TIMEOUT_MS) == 0)
+            ap->intr_timeouts++;
+    }
+
+    rte_eth_dev_rx_intr_disable(ap->port_id, ap->queue_id);
+    return true;
+}
+
+void adaptive_poll_sleep(struct adaptive_poll *ap)
+{
+    if (ap->max_level == ADAPTIVE_POLL_LEVEL_SPIN)
+        return;
+
+    uint8_t level = streak_level(ap);
+    uint64_t start = rte_get_tsc_cycles();
+    struct rte_power_monitor_cond pmc;
+
+    ap->level = level;
+    switch (level) {
+    case ADAPTIVE_POLL_LEVEL_INTR:
+        if (intr_sleep(ap))
+            break;
+        ap->max_level = ap->monitor_ok ? ADAPTIVE_POLL_LEVEL_MONITOR : ADAPTIVE_POLL_LEVEL_PAUSE;
+        level = ADAPTIVE_POLL_LEVEL_PAUSE;
+        rte_pause();
+        break;
+    case ADAPTIVE_POLL_LEVEL_MONITOR:
+        // Address of the next RX descriptor's status, re-read every time
+        if (rte_eth_get_monitor_addr(ap->port_id, ap->queue_id, &pmc) == 0 &&
+            rte_power_monitor(&pmc, start + ap->monitor_cycles) == 0)
+            break;
+        level = ADAPTIVE_POLL_LEVEL_PAUSE;
+        rte_pause();
+        break;
+    default:
+        rte_pause();
+        break;
+    }
+
+    ap->sleep_end_tsc = rte_get_tsc_cycles();
+    ap->sleeps[level]++;
+    ap->idle_cycles[level] += ap->sleep_end_tsc - start;
+    ap->last_sleep = level;
+}
+
+void adaptive_poll_print_stats(void)
+{
+    uint32_t nb = __atomic_load_n(&ap_nb_slots, __ATOMIC_RELAXED);
+    if (nb > ADAPTIVE_POLL_MAX_WORKERS)
+        nb = ADAPTIVE_POLL_MAX_WORKERS;
+    if (nb == 0)
+        return;
+
+    uint64_t now = rte_get_tsc_cycles();
+    double ns_per_cycle = 1e9 / (double)rte_get_tsc_hz();
+
+    printf("\n=== Adaptive Polling ===\n");
+    printf("Saved = core time asleep. Wake (ns): RX = sleep end -> data burst, "
+           "TX = TPAUSE overshoot\n");
+    printf("%-13s%-4s %7s %7s %10s %14s %10s %9s %9s %9s %9s %9s\n", "Worker", "Lvl", "Saved%",
+           "Empty%", "Pause", "UMWAIT/TPAUSE", "Intr", "Intr t/o", "UMW mean", "UMW max",
+           "Intr mean", "Intr max");
+
+    for (uint32_t i = 0; i < nb; i++) {
+        const struct adaptive_poll *ap = &ap_slots[i];
+        const int m = ADAPTIVE_POLL_LEVEL_MONITOR, n = ADAPTIVE_POLL_LEVEL_INTR;
+        uint64_t elapsed = now - ap->start_tsc;
+        uint64_t idle = 0;
+        for (int l = 0; l < ADAPTIVE_POLL_NB_LEVELS; l++)
+            idle += ap->idle_cycles[l];
+
+        double saved = elapsed ? 100.0 * (double)idle / (double)elapsed : 0.0;
+        double empty = ap->polls ? 100.0 * (double)ap->empty_polls / (double)ap->polls : 0.0;
+        double mon_mean = ap->wakes[m] ? (double)ap->wake_cycles_sum[m] / (double)ap->wakes[m] : 0.0;
+        double intr_mean = ap->wakes[n] ? (double)ap->wake_cycles_sum[n] / (double)ap->wakes[n] : 0.0;
+
+        printf("%-3s P%-2u Q%-2u  %u/%u  %7.2f %7.2f %10lu %14lu %10lu %9lu %9.0f %9.0f %9.0f %9.0f\n",
+               ap_role_names[ap->role], ap->port_id, ap->queue_id, ap->level, ap->max_level,
+               saved, empty, ap->sleeps[ADAPTIVE_POLL_LEVEL_PAUSE], ap->sleeps[m],
+               ap->sleeps[n], ap->intr_timeouts,
+               mon_mean * ns_per_cycle, (double)ap->wake_cycles_max[m] * ns_per_cycle,
+               intr_mean * ns_per_cycle, (double)ap->wake_cycles_max[n] * ns_per_cycle);
+    }
+}
+
+void adaptive_poll_reset_stats(void)
+{
+    uint32_t nb = __atomic_load_n(&ap_nb_slots, __ATOMIC_RELAXED);
+    if (nb > ADAPTIVE_POLL_MAX_WORKERS)
+        nb = ADAPTIVE_POLL_MAX_WORKERS;
+
+    for (uint32_t i = 0; i < nb; i++) {
+        struct adaptive_poll *ap = &ap_slots[i];
+        ap->polls = 0;
+        ap->empty_polls = 0;
+        ap->intr_timeouts = 0;
+        memset(ap->sleeps, 0, sizeof(ap->sleeps));
+        memset(ap->idle_cycles, 0, sizeof(ap->idle_cycles));
+        memset(ap->wakes, 0, sizeof(ap->wakes));
+        memset(ap->wake_cycles_sum, 0, sizeof(ap->wake_cycles_sum));
+        memset(ap->wake_cycles_max, 0, sizeof(ap->wake_cycles_max));
+        ap->start_tsc = rte_get_tsc_cycles();
+    }
+}
+
+#endif /* ADAPTIVE_POLL_ENABLED */
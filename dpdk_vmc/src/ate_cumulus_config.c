@@ -0,0 +1,678 @@
+/**
+ * @file ate_cumulus_config.c
+ * @brief ATE Test Mode - Cumulus Switch Configuration via SSH
+ *
+ * C++ tarafindaki CumulusHelper + SSHDeployer mekanizmasinin
+ * C karsiligi. DPDK sunucusundan (10.1.33.2) dogrudan Cumulus
+ * switch'e (10.1.33.3) SSH ile ATE config gonderir.
+ *
+ * Mekanizma (ate_cumulus_provision):
+ *   1. sshpass + ssh ControlMaster: tek baglanti, diger komutlar bunu kullanir
+ *   2. Tek komut: uzak interfaces md5 + son uygulanan VLAN durumu
+ *   3. Fark -> transaction script (interfaces + ifreload, bridge vlan add,
+ *      yeni durum), stdin ile gonderilip tek oturumda sudo sh ile calisir
+ *   Yedek: scp + ifreload, degisen port gruplari paralel oturumlarda.
+ *
+ * Tek tek komut calistiran eski yol (ate_cumulus_deploy_interfaces +
+ * ate_cumulus_configure_sequence) karsilastirma icin duruyor.
+ */
+
+#include "ate_cumulus_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+// ============================================
+// INTERNAL CONSTANTS
+// ============================================
+
+// Maximum command buffer size
+#define ATE_CMD_BUF_SIZE 1024
+#define ATE_TOOL_BUF_SIZE 256
+#define ATE_STATE_BUF_SIZE 512      // "iface=vlan" x ATE VLAN table
+
+#define ATE_SSH_OPTS "-o StrictHostKeyChecking=no -o ConnectTimeout=10"
+
+// Log prefix
+#define ATE_LOG_PREFIX "[ATE-Cumulus]"
+
+// "-o ControlPath=..." while a provisioning master is open, "" otherwise:
+// every ssh / scp of the helpers below then rides on that one connection
+static const char *ate_mux_opts = "";
+
+// ============================================
+// LOW-LEVEL SSH/SCP HELPERS
+// ============================================
+
+// ssh / scp invocation without options: sshpass + ssh, or the
+// ATE_CUMULUS_SSH / ATE_CUMULUS_SCP override (fake switch)
+static void ate_cumulus_tool(char *buf, size_t len, bool scp)
+{
+    const char *env = getenv(scp ? "ATE_CUMULUS_SCP" : "ATE_CUMULUS_SSH");
+
+    if (env != NULL && env[0] != '\0')
+        snprintf(buf, len, "%s", env);
+    else
+        snprintf(buf, len, "sshpass -p '%s' %s", ATE_CUMULUS_PASSWORD, scp ? "scp" : "ssh");
+}
+
+bool ate_cumulus_ssh_execute(const char *command, bool use_sudo)
+{
+    char cmd[ATE_CMD_BUF_SIZE];
+    char ssh[ATE_TOOL_BUF_SIZE];
+
+    ate_cumulus_tool(ssh, sizeof(ssh), false);
+
+    if (use_sudo) {
+        // echo 'password' | sudo -S command
+        snprintf(cmd, sizeof(cmd),
+                 "%s " ATE_SSH_OPTS " %s %s@%s \"echo '%s' | sudo -S %s\"",
+                 ssh, ate_mux_opts,
+                 ATE_CUMULUS_USER, ATE_CUMULUS_HOST,
+                 ATE_CUMULUS_PASSWORD, command);
+    } else {
+        snprintf(cmd, sizeof(cmd),
+                 "%s " ATE_SSH_OPTS " %s %s@%s \"%s\"",
+                 ssh, ate_mux_opts,
+                 ATE_CUMULUS_USER, ATE_CUMULUS_HOST,
+                 command);
+    }
+
+    printf("%s Executing: %s%s\n", ATE_LOG_PREFIX, command,
+           use_sudo ? " (sudo)" : "");
+
+    int ret = system(cmd);
+    if (ret != 0) {
+        printf("%s Command failed (exit code: %d)\n", ATE_LOG_PREFIX, ret);
+        return false;
+    }
+
+    return true;
+}
+
+bool ate_cumulus_scp_copy(const char *local_path, const char *remote_path)
+{
+    char cmd[ATE_CMD_BUF_SIZE];
+    char scp[ATE_TOOL_BUF_SIZE];
+
+    ate_cumulus_tool(scp, sizeof(scp), true);
+
+    printf("%s SCP: %s -> %s@%s:%s\n", ATE_LOG_PREFIX,
+           local_path, ATE_CUMULUS_USER, ATE_CUMULUS_HOST, remote_path);
+
+    snprintf(cmd, sizeof(cmd),
+             "%s " ATE_SSH_OPTS " %s %s %s@%s:%s",
+             scp, ate_mux_opts,
+             local_path,
+             ATE_CUMULUS_USER, ATE_CUMULUS_HOST, remote_path);
+
+    int ret = system(cmd);
+    if (ret != 0) {
+        printf("%s SCP failed (exit code: %d)\n", ATE_LOG_PREFIX, ret);
+        return false;
+    }
+
+    printf("%s SCP completed successfully\n", ATE_LOG_PREFIX);
+    return true;
+}
+
+// ============================================
+// CONNECTION TEST
+// ============================================
+
+bool ate_cumulus_test_connection(void)
+{
+    printf("%s Testing connection to %s...\n", ATE_LOG_PREFIX, ATE_CUMULUS_HOST);
+
+    bool result = ate_cumulus_ssh_execute("echo 'Connection OK'", false);
+    if (result) {
+        printf("%s Connection successful!\n", ATE_LOG_PREFIX);
+    } else {
+        printf("%s Connection FAILED!\n", ATE_LOG_PREFIX);
+    }
+
+    return result;
+}
+
+// ============================================
+// INTERFACES DEPLOYMENT
+// ============================================
+
+bool ate_cumulus_deploy_interfaces(void)
+{
+    printf("\n========================================\n");
+    printf("%s Deploying ATE Network Interfaces\n", ATE_LOG_PREFIX);
+    printf("========================================\n");
+
+    // Check if local file exists
+    struct stat st;
+    if (stat(ATE_INTERFACES_LOCAL_PATH, &st) != 0) {
+        printf("%s ERROR: ATE interfaces file not found: %s\n",
+               ATE_LOG_PREFIX, ATE_INTERFACES_LOCAL_PATH);
+        return false;
+    }
+
+    printf("%s Using interfaces file: %s\n", ATE_LOG_PREFIX, ATE_INTERFACES_LOCAL_PATH);
+
+    // Step 1: Test connection
+    printf("%s [Step 1/3] Testing connection...\n", ATE_LOG_PREFIX);
+    if (!ate_cumulus_test_connection()) {
+        printf("%s Deploy failed: Cannot connect to switch\n", ATE_LOG_PREFIX);
+        return false;
+    }
+
+    // Step 2: Copy interfaces file via SCP to /tmp first, then sudo mv
+    printf("%s [Step 2/3] Copying interfaces file...\n", ATE_LOG_PREFIX);
+
+    // SCP to /tmp/interfaces (no sudo needed for /tmp)
+    if (!ate_cumulus_scp_copy(ATE_INTERFACES_LOCAL_PATH, "/tmp/interfaces")) {
+        printf("%s Deploy failed: Cannot copy interfaces file\n", ATE_LOG_PREFIX);
+        return false;
+    }
+
+    // sudo mv /tmp/interfaces /etc/network/interfaces
+    if (!ate_cumulus_ssh_execute("mv /tmp/interfaces /etc/network/interfaces", true)) {
+        printf("%s Deploy failed: Cannot move interfaces file\n", ATE_LOG_PREFIX);
+        return false;
+    }
+
+    // Step 3: Run ifreload -a to apply configuration
+    printf("%s [Step 3/3] Reloading network interfaces (ifreload -a)...\n", ATE_LOG_PREFIX);
+    if (!ate_cumulus_ssh_execute("ifreload -a", true)) {
+        // ifreload may return non-zero but still apply changes
+        printf("%s Warning: ifreload -a returned non-zero (changes may still be applied)\n",
+               ATE_LOG_PREFIX);
+    }
+
+    printf("\n========================================\n");
+    printf("%s ATE Network Interfaces Deployed Successfully!\n", ATE_LOG_PREFIX);
+    printf("========================================\n\n");
+
+    return true;
+}
+
+// ============================================
+// BRIDGE VLAN HELPER
+// ============================================
+
+bool ate_cumulus_egress_untagged(const char *interface, int vlan_id)
+{
+    char cmd[ATE_CMD_BUF_SIZE];
+
+    printf("%s Bridge: Adding VLAN %d to %s (untagged)\n",
+           ATE_LOG_PREFIX, vlan_id, interface);
+
+    // sudo bridge vlan add dev swpXXsY vid VV untagged
+    snprintf(cmd, sizeof(cmd),
+             "bridge vlan add dev %s vid %d untagged",
+             interface, vlan_id);
+
+    return ate_cumulus_ssh_execute(cmd, true);
+}
+
+// ============================================
+// ATE VLAN CONFIGURATION SEQUENCE
+// ============================================
+// CumulusHelper::configureSequence() mantigi ile birebir ayni.
+// Her swp port grubu icin egressUntagged komutlari calistirir.
+// NOT: Icerik kullanici tarafindan degistirilecek!
+
+struct ate_vlan_port
+{
+    const char *group;      // Breakout group (log + parallel fallback session)
+    const char *iface;
+    int vlan_id;
+};
+
+// NOT: Bu degerler placeholder'dir, kullanici ATE icin degistirecek
+static const struct ate_vlan_port ate_vlan_table[] = {
+    { "swp13/swp25", "swp25s0", 97 },  { "swp13/swp25", "swp25s1", 98 },
+    { "swp13/swp25", "swp25s2", 99 },  { "swp13/swp25", "swp25s3", 100 },
+    { "swp14/swp26", "swp26s0", 101 }, { "swp14/swp26", "swp26s1", 102 },
+    { "swp14/swp26", "swp26s2", 103 }, { "swp14/swp26", "swp26s3", 104 },
+    { "swp15/swp27", "swp27s0", 105 }, { "swp15/swp27", "swp27s1", 106 },
+    { "swp15/swp27", "swp27s2", 107 }, { "swp15/swp27", "swp27s3", 108 },
+    { "swp16/swp28", "swp28s0", 109 }, { "swp16/swp28", "swp28s1", 110 },
+    { "swp16/swp28", "swp28s2", 111 }, { "swp16/swp28", "swp28s3", 112 },
+    { "swp17/swp29", "swp29s0", 113 }, { "swp17/swp29", "swp29s1", 114 },
+    { "swp17/swp29", "swp29s2", 115 }, { "swp17/swp29", "swp29s3", 116 },
+    { "swp18/swp30", "swp30s0", 117 }, { "swp18/swp30", "swp30s1", 118 },
+    { "swp18/swp30", "swp30s2", 119 }, { "swp18/swp30", "swp30s3", 120 },
+    { "swp19/swp31", "swp31s0", 121 }, { "swp19/swp31", "swp31s1", 122 },
+    { "swp19/swp31", "swp31s2", 123 }, { "swp19/swp31", "swp31s3", 124 },
+    { "swp20/swp32", "swp32s0", 125 }, { "swp20/swp32", "swp32s1", 126 },
+    { "swp20/swp32", "swp32s2", 127 }, { "swp20/swp32", "swp32s3", 128 },
+};
+
+#define ATE_VLAN_PORTS ((int)(sizeof(ate_vlan_table) / sizeof(ate_vlan_table[0])))
+
+bool ate_cumulus_configure_sequence(void)
+{
+    printf("\n========================================\n");
+    printf("%s Starting ATE VLAN Configuration Sequence\n", ATE_LOG_PREFIX);
+    printf("========================================\n");
+
+    // Test connection first
+    if (!ate_cumulus_test_connection()) {
+        printf("%s Configuration failed: Cannot connect to switch\n", ATE_LOG_PREFIX);
+        return false;
+    }
+
+    // Configure all port groups, one command (one ssh session) per port
+    for (int i = 0; i < ATE_VLAN_PORTS; i++) {
+        const struct ate_vlan_port *p = &ate_vlan_table[i];
+        bool first = (i == 0 || strcmp(p->group, ate_vlan_table[i - 1].group) != 0);
+        bool last = (i == ATE_VLAN_PORTS - 1 || strcmp(p->group, ate_vlan_table[i + 1].group) != 0);
+
+        if (first)
+            printf("%s Configuring %s...\n", ATE_LOG_PREFIX, p->group);
+        if (!ate_cumulus_egress_untagged(p->iface, p->vlan_id))
+            return false;
+        if (last)
+            printf("%s %s VLAN configuration completed\n", ATE_LOG_PREFIX, p->group);
+    }
+
+    printf("\n========================================\n");
+    printf("%s ATE VLAN Configuration Completed Successfully!\n", ATE_LOG_PREFIX);
+    printf("========================================\n\n");
+
+    return true;
+}
+
+// ============================================
+// BATCHED PROVISIONING
+// ============================================
+// Remote state: "<iface>=<vlan> ..." on one line in ATE_CUMULUS_STATE_PATH,
+// written by the same transaction that applied it. An ifreload drops the
+// runtime bridge VLANs, so a changed interfaces file re-applies all ports.
+
+static const char *ate_phase_names[ATE_PHASE_COUNT] = {
+    "connect", "query", "render", "apply", "close"
+};
+
+static double ate_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+// Open the ControlMaster (background, kept until ate_mux_close)
+static bool ate_mux_open(void)
+{
+    char cmd[ATE_CMD_BUF_SIZE];
+    char ssh[ATE_TOOL_BUF_SIZE];
+
+    ate_cumulus_tool(ssh, sizeof(ssh), false);
+    snprintf(cmd, sizeof(cmd),
+             "%s " ATE_SSH_OPTS " -o ControlMaster=yes -o ControlPath=%s "
+             "-o ControlPersist=%d -N -f %s@%s",
+             ssh, ATE_CUMULUS_CONTROL_PATH, ATE_CUMULUS_CONTROL_PERSIST,
+             ATE_CUMULUS_USER, ATE_CUMULUS_HOST);
+
+    if (system(cmd) != 0) {
+        printf("%s ControlMaster not available, using separate sessions\n", ATE_LOG_PREFIX);
+        return false;
+    }
+
+    ate_mux_opts = "-o ControlPath=" ATE_CUMULUS_CONTROL_PATH;
+    return true;
+}
+
+static void ate_mux_close(void)
+{
+    char cmd[ATE_CMD_BUF_SIZE];
+    char ssh[ATE_TOOL_BUF_SIZE];
+
+    if (ate_mux_opts[0] == '\0')
+        return;
+
+    ate_cumulus_tool(ssh, sizeof(ssh), false);
+    snprintf(cmd, sizeof(cmd), "%s %s -O exit %s@%s > /dev/null 2>&1",
+             ssh, ate_mux_opts, ATE_CUMULUS_USER, ATE_CUMULUS_HOST);
+    if (system(cmd) != 0)
+        printf("%s Warning: ControlMaster did not exit (expires in %d s)\n",
+               ATE_LOG_PREFIX, ATE_CUMULUS_CONTROL_PERSIST);
+    ate_mux_opts = "";
+}
+
+// md5 (32 hex) of a local file, false if it cannot be read
+static bool ate_local_md5(const char *path, char md5[33])
+{
+    char cmd[ATE_CMD_BUF_SIZE];
+
+    snprintf(cmd, sizeof(cmd), "md5sum '%s' 2>/dev/null", path);
+    FILE *f = popen(cmd, "r");
+    if (f == NULL)
+        return false;
+
+    bool ok = (fscanf(f, "%32s", md5) == 1 && strlen(md5) == 32);
+    pclose(f);
+    return ok;
+}
+
+// One session: remote interfaces md5 + applied VLAN state
+// applied[i]: ate_vlan_table[i] is on the switch with the same VLAN
+static bool ate_query_remote(char md5[33], bool applied[])
+{
+    char cmd[ATE_CMD_BUF_SIZE];
+    char ssh[ATE_TOOL_BUF_SIZE];
+    char tok[64];
+
+    md5[0] = '\0';
+    ate_cumulus_tool(ssh, sizeof(ssh), false);
+    snprintf(cmd, sizeof(cmd),
+             "%s " ATE_SSH_OPTS " %s %s@%s "
+             "\"md5sum %s 2>/dev/null; cat %s 2>/dev/null; echo ATE_QUERY_END\"",
+             ssh, ate_mux_opts, ATE_CUMULUS_USER, ATE_CUMULUS_HOST,
+             ATE_INTERFACES_REMOTE_PATH, ATE_CUMULUS_STATE_PATH);
+
+    FILE *f = popen(cmd, "r");
+    if (f == NULL)
+        return false;
+
+    bool end = false;
+    while (fscanf(f, "%63s", tok) == 1) {
+        char *eq = strchr(tok, '=');
+
+        if (strcmp(tok, "ATE_QUERY_END") == 0) {
+            end = true;
+        } else if (eq != NULL) {
+            *eq = '\0';
+            int vlan = atoi(eq + 1);
+            for (int i = 0; i < ATE_VLAN_PORTS; i++)
+                if (strcmp(ate_vlan_table[i].iface, tok) == 0 && ate_vlan_table[i].vlan_id == vlan)
+                    applied[i] = true;
+        } else if (md5[0] == '\0' && strlen(tok) == 32) {
+            snprintf(md5, 33, "%s", tok);
+        }
+    }
+
+    int ret = pclose(f);
+    return end && ret == 0;
+}
+
+// "iface=vlan iface=vlan ..." for the whole table
+static void ate_render_state(char *buf, size_t len)
+{
+    size_t off = 0;
+
+    buf[0] = '\0';
+    for (int i = 0; i < ATE_VLAN_PORTS && off < len; i++)
+        off += snprintf(buf + off, len - off, "%s%s=%d", i ? " " : "",
+                        ate_vlan_table[i].iface, ate_vlan_table[i].vlan_id);
+}
+
+// Transaction script: interfaces + ifreload (if changed), changed VLANs, new state
+static bool ate_render_txn(const char *interfaces_path, bool reload, const bool changed[])
+{
+    char state[ATE_STATE_BUF_SIZE];
+    char line[512];
+
+    FILE *out = fopen(ATE_CUMULUS_TXN_LOCAL_PATH, "w");
+    if (out == NULL) {
+        printf("%s ERROR: Cannot write %s\n", ATE_LOG_PREFIX, ATE_CUMULUS_TXN_LOCAL_PATH);
+        return false;
+    }
+
+    fprintf(out, "#!/bin/sh\n# ATE Cumulus provisioning transaction\nset -e\n");
+
+    if (reload) {
+        FILE *in = fopen(interfaces_path, "r");
+        if (in == NULL) {
+            fclose(out);
+            return false;
+        }
+        fprintf(out, "rm -f %s\n", ATE_CUMULUS_STATE_PATH);
+        fprintf(out, "cat > %s.ate_new <<'ATE_INTERFACES_EOF'\n", ATE_INTERFACES_REMOTE_PATH);
+        while (fgets(line, sizeof(line), in) != NULL)
+            fputs(line, out);
+        fclose(in);
+        fprintf(out, "ATE_INTERFACES_EOF\n");
+        fprintf(out, "mv %s.ate_new %s\n", ATE_INTERFACES_REMOTE_PATH, ATE_INTERFACES_REMOTE_PATH);
+        // ifreload may return non-zero but still apply changes
+        fprintf(out, "ifreload -a || echo 'ifreload -a returned non-zero'\n");
+        fprintf(out, "sleep %d\n", ATE_CUMULUS_SETTLE_S);
+    }
+
+    for (int i = 0; i < ATE_VLAN_PORTS; i++)
+        if (changed[i])
+            fprintf(out, "bridge vlan add dev %s vid %d untagged\n",
+                    ate_vlan_table[i].iface, ate_vlan_table[i].vlan_id);
+
+    ate_render_state(state, sizeof(state));
+    fprintf(out, "echo %s > %s\n", state, ATE_CUMULUS_STATE_PATH);
+    fprintf(out, "rm -f %s\n", ATE_CUMULUS_TXN_REMOTE_PATH);
+
+    return fclose(out) == 0;
+}
+
+// One session: upload the script on stdin and run it with sudo
+static bool ate_apply_txn(void)
+{
+    char cmd[ATE_CMD_BUF_SIZE];
+    char ssh[ATE_TOOL_BUF_SIZE];
+
+    ate_cumulus_tool(ssh, sizeof(ssh), false);
+    snprintf(cmd, sizeof(cmd),
+             "%s " ATE_SSH_OPTS " %s %s@%s "
+             "\"cat > %s && echo '%s' | sudo -S sh %s\" < %s",
+             ssh, ate_mux_opts, ATE_CUMULUS_USER, ATE_CUMULUS_HOST,
+             ATE_CUMULUS_TXN_REMOTE_PATH, ATE_CUMULUS_PASSWORD,
+             ATE_CUMULUS_TXN_REMOTE_PATH, ATE_CUMULUS_TXN_LOCAL_PATH);
+
+    int ret = system(cmd);
+    if (ret != 0) {
+        printf("%s Transaction failed (exit code: %d)\n", ATE_LOG_PREFIX, ret);
+        return false;
+    }
+    return true;
+}
+
+struct ate_group_job
+{
+    pthread_t thread;
+    int first;              // Table index range of the group
+    int last;
+    const bool *changed;
+    bool ok;
+};
+
+// Fallback: one session per port group, changed VLANs chained with &&
+static void *ate_group_worker(void *arg)
+{
+    struct ate_group_job *job = (struct ate_group_job *)arg;
+    char cmd[ATE_CMD_BUF_SIZE];
+    size_t off = 0;
+
+    off += snprintf(cmd + off, sizeof(cmd) - off, "sh -c '");
+    for (int i = job->first; i <= job->last && off < sizeof(cmd); i++) {
+        if (!job->changed[i])
+            continue;
+        off += snprintf(cmd + off, sizeof(cmd) - off, "%sbridge vlan add dev %s vid %d untagged",
+                        off > 7 ? " && " : "", ate_vlan_table[i].iface, ate_vlan_table[i].vlan_id);
+    }
+    if (off < sizeof(cmd))
+        snprintf(cmd + off, sizeof(cmd) - off, "'");
+
+    job->ok = ate_cumulus_ssh_execute(cmd, true);
+    return NULL;
+}
+
+static bool ate_apply_parallel(const char *interfaces_path, bool reload, const bool changed[])
+{
+    struct ate_group_job jobs[ATE_VLAN_PORTS];
+    char state[ATE_STATE_BUF_SIZE];
+    char cmd[ATE_CMD_BUF_SIZE];
+    int nb_jobs = 0;
+    bool ok = true;
+
+    if (reload) {
+        if (!ate_cumulus_scp_copy(interfaces_path, "/tmp/interfaces") ||
+            !ate_cumulus_ssh_execute("mv /tmp/interfaces " ATE_INTERFACES_REMOTE_PATH, true))
+            return false;
+        if (!ate_cumulus_ssh_execute("ifreload -a", true))
+            printf("%s Warning: ifreload -a returned non-zero (changes may still be applied)\n",
+                   ATE_LOG_PREFIX);
+        sleep(ATE_CUMULUS_SETTLE_S);
+    }
+
+    for (int i = 0; i < ATE_VLAN_PORTS; ) {
+        int last = i;
+        bool any = false;
+
+        while (last + 1 < ATE_VLAN_PORTS &&
+               strcmp(ate_vlan_table[last + 1].group, ate_vlan_table[i].group) == 0)
+            last++;
+        for (int k = i; k <= last; k++)
+            any |= changed[k];
+
+        if (any) {
+            struct ate_group_job *job = &jobs[nb_jobs];
+            job->first = i;
+            job->last = last;
+            job->changed = changed;
+            job->ok = false;
+            if (pthread_create(&job->thread, NULL, ate_group_worker, job) == 0) {
+                nb_jobs++;
+            } else {
+                ate_group_worker(job);
+                ok &= job->ok;
+            }
+        }
+        i = last + 1;
+    }
+
+    for (int j = 0; j < nb_jobs; j++) {
+        pthread_join(jobs[j].thread, NULL);
+        ok &= jobs[j].ok;
+    }
+    if (!ok)
+        return false;
+
+    ate_render_state(state, sizeof(state));
+    snprintf(cmd, sizeof(cmd), "sh -c 'echo %s > %s'", state, ATE_CUMULUS_STATE_PATH);
+    return ate_cumulus_ssh_execute(cmd, true);
+}
+
+void ate_cumulus_print_report(const struct ate_provision_report *report)
+{
+    printf("%s Provisioning: %d/%d ports, interfaces %s, %s%s\n", ATE_LOG_PREFIX,
+           report->ports_changed, report->ports_total,
+           report->interfaces_changed ? "reloaded" : "unchanged",
+           report->multiplexed ? "one multiplexed connection" : "separate sessions",
+           report->fallback ? " (parallel per-group fallback)" : "");
+    for (int p = 0; p < ATE_PHASE_COUNT; p++)
+        printf("%s   %-8s %9.1f ms\n", ATE_LOG_PREFIX, ate_phase_names[p], report->phase_ms[p]);
+    printf("%s   %-8s %9.1f ms\n", ATE_LOG_PREFIX, "total", report->total_ms);
+}
+
+int ate_cumulus_provision(const char *interfaces_path, bool force,
+                          struct ate_provision_report *report)
+{
+    struct ate_provision_report local;
+    bool applied[ATE_VLAN_PORTS];
+    bool changed[ATE_VLAN_PORTS];
+    char local_md5[33], remote_md5[33];
+    int ret = -1;
+
+    if (report == NULL)
+        report = &local;
+    memset(report, 0, sizeof(*report));
+    memset(applied, 0, sizeof(applied));
+    report->ports_total = ATE_VLAN_PORTS;
+
+    if (!ate_local_md5(interfaces_path, local_md5)) {
+        printf("%s ERROR: ATE interfaces file not found: %s\n", ATE_LOG_PREFIX, interfaces_path);
+        return -1;
+    }
+
+    double t_start = ate_now_ms();
+    double t = t_start;
+
+    // 1. One connection for everything below
+    report->multiplexed = ate_mux_open();
+    report->phase_ms[ATE_PHASE_CONNECT] = ate_now_ms() - t;
+    t = ate_now_ms();
+
+    // 2. What the switch already has
+    if (!ate_query_remote(remote_md5, applied)) {
+        printf("%s FAILED: Cannot connect to switch %s\n", ATE_LOG_PREFIX, ATE_CUMULUS_HOST);
+        goto out;
+    }
+    report->phase_ms[ATE_PHASE_QUERY] = ate_now_ms() - t;
+    t = ate_now_ms();
+
+    // 3. Diff + transaction
+    report->interfaces_changed = force || strcmp(local_md5, remote_md5) != 0;
+    for (int i = 0; i < ATE_VLAN_PORTS; i++) {
+        changed[i] = report->interfaces_changed || !applied[i];
+        report->ports_changed += changed[i];
+    }
+    printf("%s Interfaces %s, %d/%d port VLANs to apply\n", ATE_LOG_PREFIX,
+           report->interfaces_changed ? "changed" : "unchanged",
+           report->ports_changed, ATE_VLAN_PORTS);
+
+    if (!report->interfaces_changed && report->ports_changed == 0) {
+        report->phase_ms[ATE_PHASE_RENDER] = ate_now_ms() - t;
+        ret = 0;
+        goto out;
+    }
+
+    bool rendered = report->multiplexed &&
+                    ate_render_txn(interfaces_path, report->interfaces_changed, changed);
+    report->phase_ms[ATE_PHASE_RENDER] = ate_now_ms() - t;
+    t = ate_now_ms();
+
+    // 4. Apply: one session, parallel per-group sessions as fallback
+    if (rendered && ate_apply_txn()) {
+        ret = 0;
+    } else {
+        report->fallback = true;
+        printf("%s Applying in parallel per-group sessions\n", ATE_LOG_PREFIX);
+        ret = ate_apply_parallel(interfaces_path, report->interfaces_changed, changed) ? 0 : -1;
+    }
+    report->phase_ms[ATE_PHASE_APPLY] = ate_now_ms() - t;
+
+out:
+    t = ate_now_ms();
+    ate_mux_close();
+    remove(ATE_CUMULUS_TXN_LOCAL_PATH);
+    report->phase_ms[ATE_PHASE_CLOSE] = ate_now_ms() - t;
+    report->total_ms = ate_now_ms() - t_start;
+
+    ate_cumulus_print_report(report);
+    return ret;
+}
+
+// ============================================
+// MAIN ENTRY POINT
+// ============================================
+
+int ate_configure_cumulus(void)
+{
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════════╗\n");
+    printf("║         ATE CUMULUS SWITCH CONFIGURATION                        ║\n");
+    printf("║  1. Deploy ATE interfaces file (if changed)                     ║\n");
+    printf("║  2. Configure bridge VLAN settings (changed ports)              ║\n");
+    printf("╚══════════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    if (ate_cumulus_provision(ATE_INTERFACES_LOCAL_PATH, false, NULL) != 0) {
+        printf("%s FAILED: Could not provision ATE switch configuration\n", ATE_LOG_PREFIX);
+        return -1;
+    }
+
+    printf("\n========================================\n");
+    printf("%s ATE Cumulus Configuration Complete!\n", ATE_LOG_PREFIX);
+    printf("========================================\n\n");
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+/**
+ * Runtime capacity: ports, queues and lcores of the host
+ *
+ * Everything here runs on the main lcore during startup. The counts only
+ * feed the checks, the lcore assignment and the per-port allocations; the
+ * port_id indexed tables stay MAX_PORTS wide (compile-time ceiling).
+ */
+
+#include "capacity.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <rte_ethdev.h>
+#include <rte_lcore.h>
+#include <rte_malloc.h>
+
+#include "config.h"
+#include "packet.h"   // MAX_PRBS_CACHE_PORTS
+
+_Static_assert(MAX_PRBS_CACHE_PORTS >= MAX_PORTS, "PRBS cache table is indexed by port_id");
+_Static_assert(MAX_PORTS_CONFIG >= MAX_PORTS, "port VLAN / VL-ID configs are indexed by port_id");
+
+struct runtime_capacity runtime_cap;
+
+void capacity_discover(void)
+{
+    unsigned lcore_id;
+
+    memset(&runtime_cap, 0, sizeof(runtime_cap));
+    runtime_cap.nb_ports_avail = rte_eth_dev_count_avail();
+    runtime_cap.nb_lcores = (uint16_t)rte_lcore_count();
+
+    RTE_LCORE_FOREACH(lcore_id)
+    {
+        unsigned socket = rte_lcore_to_socket_id(lcore_id);
+        if (socket >= MAX_SOCKET)
+            continue;
+        if (runtime_cap.lcores_per_socket[socket]++ == 0)
+            runtime_cap.nb_sockets++;
+    }
+
+    printf("Capacity: %u DPDK ports available (table limit %d), %u lcores on %u sockets [",
+           runtime_cap.nb_ports_avail, MAX_PORTS, runtime_cap.nb_lcores, runtime_cap.nb_sockets);
+    bool first = true;
+    for (unsigned s = 0; s < MAX_SOCKET; s++)
+    {
+        if (runtime_cap.lcores_per_socket[s] == 0)
+            continue;
+        printf("%sS%u=%u", first ? "" : " ", s, runtime_cap.lcores_per_socket[s]);
+        first = false;
+    }
+    printf("]\n");
+
+    if (runtime_cap.nb_ports_avail > MAX_PORTS)
+        printf("Warning: %u ports available, only the first %d are used (MAX_PORTS is a build-time "
+               "ceiling: rebuild with -DMAX_PORTS=N and port configs for the extra ports)\n",
+               runtime_cap.nb_ports_avail, MAX_PORTS);
+}
+
+uint16_t capacity_port_tx_queues(uint16_t port_id)
+{
+    // Base: NUM_TX_CORES (0 to NUM_TX_CORES-1)
+    uint16_t num_tx_queues = NUM_TX_CORES;
+
+#if DPDK_EXT_TX_ENABLED
+    // External TX ports need an extra queue (queue 4) for external TX
+    // Port 2,3,4,5 → Port 12 | Port 0,6 → Port 13
+    bool is_ext_tx_port = (port_id == 0 || port_id == 2 || port_id == 3 ||
+                           port_id == 4 || port_id == 5 || port_id == 6);
+    if (is_ext_tx_port)
+        num_tx_queues = NUM_TX_CORES + 1;
+#else
+    (void)port_id;
+#endif
+
+#if PTP_ENABLED
+    // PTP needs queue 5 for TX on all ports (after external TX queue 4)
+    num_tx_queues = (num_tx_queues < 6) ? 6 : num_tx_queues;
+#endif
+    return num_tx_queues;
+}
+
+uint16_t capacity_port_rx_queues(uint16_t port_id)
+{
+    (void)port_id;
+    // Base: NUM_RX_CORES (0 to NUM_RX_CORES-1)
+    uint16_t num_rx_queues = NUM_RX_CORES;
+
+#if PTP_ENABLED
+    // PTP needs queue 5 for RX on all ports
+    num_rx_queues = (num_rx_queues < 6) ? 6 : num_rx_queues;
+#endif
+    return num_rx_queues;
+}
+
+int capacity_check(const struct ports_config *config)
+{
+    uint16_t socket_need[MAX_SOCKET] = {0};
+    uint32_t workers = 0;
+    int ret = 0;
+
+    printf("\n=== Capacity ===\n");
+
+    for (uint16_t i = 0; i < config->nb_ports; i++)
+    {
+        uint16_t port_id = config->ports[i].port_id;
+        uint16_t need_rx = capacity_port_rx_queues(port_id);
+        uint16_t need_tx = capacity_port_tx_queues(port_id);
+        struct rte_eth_dev_info dev_info;
+
+        if (port_id >= MAX_PORTS || rte_eth_dev_info_get(port_id, &dev_info) != 0)
+        {
+            printf("  Port %u: Cannot get device info\n", port_id);
+            continue;
+        }
+        runtime_cap.max_rx_queues[port_id] = dev_info.max_rx_queues;
+        runtime_cap.max_tx_queues[port_id] = dev_info.max_tx_queues;
+
+        bool fits = need_rx <= dev_info.max_rx_queues && need_tx <= dev_info.max_tx_queues;
+        printf("  Port %2u (socket %u): RX queues %u/%u, TX queues %u/%u%s\n",
+               port_id, config->ports[i].numa_node, need_rx, dev_info.max_rx_queues,
+               need_tx, dev_info.max_tx_queues, fits ? "" : "  ✗ exceeds device limit");
+        if (!fits)
+            ret = -1;
+
+        // RX + TX workers (+ external TX queue's own lcore)
+        uint16_t port_workers = NUM_RX_CORES + NUM_TX_CORES +
+                                (need_tx > NUM_TX_CORES && DPDK_EXT_TX_ENABLED ? 1 : 0);
+        workers += port_workers;
+        if (config->ports[i].numa_node < MAX_SOCKET)
+            socket_need[config->ports[i].numa_node] += port_workers;
+    }
+
+    printf("  Worker lcores: %u needed for %u ports, %u available (main lcore excluded)\n",
+           workers, config->nb_ports, runtime_cap.nb_lcores > 0 ? runtime_cap.nb_lcores - 1 : 0);
+    if (workers + 1 > runtime_cap.nb_lcores)
+        printf("  Warning: not enough lcores, some queues will have no worker\n");
+
+    for (unsigned s = 0; s < MAX_SOCKET; s++)
+    {
+        if (socket_need[s] > runtime_cap.lcores_per_socket[s])
+            printf("  Warning: socket %u ports need %u worker lcores, socket has %u (remote lcores used)\n",
+                   s, socket_need[s], runtime_cap.lcores_per_socket[s]);
+    }
+    return ret;
+}
+
+int capacity_port_socket(uint16_t port_id)
+{
+    int socket = rte_eth_dev_socket_id(port_id);
+    if (socket < 0 || socket >= MAX_SOCKET)
+        socket = (int)rte_lcore_to_socket_id(rte_get_main_lcore());
+    return socket;
+}
+
+void *capacity_port_zmalloc(const char *name, size_t size, uint16_t port_id)
+{
+    int socket = capacity_port_socket(port_id);
+    void *p = rte_zmalloc_socket(name, size, RTE_CACHE_LINE_SIZE, socket);
+
+    if (p == NULL)
+    {
+        p = rte_zmalloc_socket(name, size, RTE_CACHE_LINE_SIZE, SOCKET_ID_ANY);
+        if (p != NULL)
+            printf("Warning: %s for port %u not on socket %d (%zu KB on any socket)\n",
+                   name, port_id, socket, size >> 10);
+    }
+    if (p == NULL)
+        printf("Error: Cannot allocate %s for port %u (%zu KB)\n", name, port_id, size >> 10);
+    return p;
+}
@@ -0,0 +1,284 @@
+/**
+ * Trigger-on-error pcap capture
+ *
+ * RX cores fill their ring (capture_record_burst) and fire triggers
+ * (capture_trigger) from the validation path. This file owns the rings and
+ * the capture thread: every CAPTURE_POLL_MS it looks for FROZEN rings,
+ * writes the last CAPTURE_RING_SIZE packets oldest first as a nanosecond
+ * pcap (TSC converted with a CLOCK_REALTIME anchor taken at init) and
+ * re-arms the ring after CAPTURE_HOLDOFF_MS. After CAPTURE_MAX_FILES files
+ * rings stay DISARMED so a persistent fault cannot fill the disk.
+ */
+
+#include "config.h"
+
+#if CAPTURE_ENABLED
+
+#include <rte_malloc.h>
+#include <rte_lcore.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "capture_ring.h"
+
+#define CAPTURE_POLL_MS 10
+
+#define PCAP_MAGIC_NSEC     0xa1b23c4d
+#define PCAP_LINKTYPE_ETHER 1
+
+static const char *const capture_reason_names[] = {"crc", "prbs", "gap"};
+
+static struct capture_ring capture_rings[MAX_PORTS][NUM_RX_CORES];
+static bool capture_ring_used[MAX_PORTS][NUM_RX_CORES];
+
+static pthread_t capture_thread;
+static volatile bool capture_running;
+static uint32_t capture_files;
+static uint32_t capture_nb_rings;
+
+// TSC -> wall clock anchor
+static uint64_t anchor_tsc;
+static uint64_t anchor_ns;
+static uint64_t tsc_hz;
+
+struct pcap_file_hdr
+{
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t linktype;
+};
+
+struct pcap_rec_hdr
+{
+    uint32_t ts_sec;
+    uint32_t ts_nsec;
+    uint32_t incl_len;
+    uint32_t orig_len;
+};
+
+static uint64_t tsc_to_ns(uint64_t tsc)
+{
+    // Signed: slot TSCs can predate the anchor by a few cycles on other cores
+    int64_t delta = (int64_t)(tsc - anchor_tsc);
+    return anchor_ns + (int64_t)((__int128)delta * 1000000000 / (int64_t)tsc_hz);
+}
+
+static int write_pcap(struct capture_ring *r, const char *path, uint64_t *trigger_idx)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        printf("[CAPTURE] Cannot create %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+
+    struct pcap_file_hdr fh = {
+        .magic = PCAP_MAGIC_NSEC,
+        .version_major = 2,
+        .version_minor = 4,
+        .snaplen = CAPTURE_SNAP_LEN,
+        .linktype = PCAP_LINKTYPE_ETHER,
+    };
+    fwrite(&fh, sizeof(fh), 1, f);
+
+    uint64_t end = r->head;
+    uint64_t start = end > CAPTURE_RING_SIZE ? end - CAPTURE_RING_SIZE : 0;
+    *trigger_idx = r->trigger_pkt >= start ? r->trigger_pkt - start : 0;
+
+    for (uint64_t i = start; i < end; i++) {
+        const struct capture_slot *s = &r->slots[i & CAPTURE_RING_MASK];
+        uint64_t ns = tsc_to_ns(s->tsc);
+        struct pcap_rec_hdr rh = {
+            .ts_sec = (uint32_t)(ns / 1000000000ULL),
+            .ts_nsec = (uint32_t)(ns % 1000000000ULL),
+            .incl_len = s->cap_len,
+            .orig_len = s->orig_len,
+        };
+        fwrite(&rh, sizeof(rh), 1, f);
+        fwrite(s->data, s->cap_len, 1, f);
+    }
+
+    int ret = ferror(f) ? -1 : 0;
+    if (fclose(f) != 0)
+        ret = -1;
+    if (ret != 0)
+        printf("[CAPTURE] Write error on %s\n", path);
+    return ret;
+}
+
+static void dump_ring(struct capture_ring *r)
+{
+    char path[256];
+    uint64_t trigger_idx = 0;
+    uint64_t ns = tsc_to_ns(r->trigger_tsc);
+    time_t sec = (time_t)(ns / 1000000000ULL);
+    struct tm tm;
+    char stamp[32];
+
+    localtime_r(&sec, &tm);
+    strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", &tm);
+    snprintf(path, sizeof(path), "%s/capture_p%u_q%u_%s_%s_%09lu.pcap", CAPTURE_DIR,
+             r->port_id, r->queue_id, capture_reason_names[r->reason], stamp,
+             (unsigned long)(ns % 1000000000ULL));
+
+    if (write_pcap(r, path, &trigger_idx) == 0) {
+        capture_files++;
+        printf("[CAPTURE] Port %u Q%u %s trigger (VL-ID %u, seq %lu, %s %lu): %s, "
+               "trigger = packet #%lu\n",
+               r->port_id, r->queue_id, capture_reason_names[r->reason], r->vl_id, r->seq,
+               r->reason == CAPTURE_REASON_GAP ? "gap" : "bit errors", r->detail, path,
+               trigger_idx + 1);
+    }
+}
+
+static void *capture_thread_func(void *arg)
+{
+    (void)arg;
+    uint64_t last_dump[MAX_PORTS][NUM_RX_CORES] = {{0}};
+    const uint64_t holdoff = tsc_hz / 1000 * CAPTURE_HOLDOFF_MS;
+
+    while (capture_running) {
+        for (uint16_t p = 0; p < MAX_PORTS; p++) {
+            for (uint16_t q = 0; q < NUM_RX_CORES; q++) {
+                if (!capture_ring_used[p][q])
+                    continue;
+                struct capture_ring *r = &capture_rings[p][q];
+                uint64_t now = rte_get_tsc_cycles();
+
+                if (__atomic_load_n(&r->state, __ATOMIC_ACQUIRE) != CAPTURE_FROZEN)
+                    continue;
+
+                if (last_dump[p][q] == 0) {
+                    if (capture_files >= CAPTURE_MAX_FILES) {
+                        printf("[CAPTURE] %u files written, Port %u Q%u disarmed\n",
+                               capture_files, p, q);
+                        __atomic_store_n(&r->state, CAPTURE_DISARMED, __ATOMIC_RELEASE);
+                        continue;
+                    }
+                    dump_ring(r);
+                    last_dump[p][q] = now;
+                }
+
+                if (now - last_dump[p][q] >= holdoff) {
+                    last_dump[p][q] = 0;
+                    __atomic_store_n(&r->state, CAPTURE_ARMED, __ATOMIC_RELEASE);
+                }
+            }
+        }
+        usleep(CAPTURE_POLL_MS * 1000);
+    }
+    return NULL;
+}
+
+int capture_init(const struct ports_config *ports_config)
+{
+    struct timespec ts;
+    size_t ring_bytes = (size_t)CAPTURE_RING_SIZE * sizeof(struct capture_slot);
+
+    RTE_BUILD_BUG_ON((CAPTURE_RING_SIZE & CAPTURE_RING_MASK) != 0);
+
+    tsc_hz = rte_get_tsc_hz();
+    clock_gettime(CLOCK_REALTIME, &ts);
+    anchor_tsc = rte_get_tsc_cycles();
+    anchor_ns = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+
+    for (uint16_t i = 0; i < ports_config->nb_ports; i++) {
+        const struct port *port = &ports_config->ports[i];
+        if (port->port_id >= MAX_PORTS)
+            continue;
+
+        for (uint16_t q = 0; q < NUM_RX_CORES; q++) {
+            struct capture_ring *r = &capture_rings[port->port_id][q];
+            memset(r, 0, sizeof(*r));
+            r->slots = rte_zmalloc_socket("capture_ring", ring_bytes, RTE_CACHE_LINE_SIZE,
+                                          port->numa_node);
+            if (r->slots == NULL) {
+                printf("[CAPTURE] Cannot allocate %zu KB ring for port %u Q%u\n",
+                       ring_bytes / 1024, port->port_id, q);
+                capture_stop();
+                return -1;
+            }
+            r->port_id = port->port_id;
+            r->queue_id = q;
+            r->state = CAPTURE_ARMED;
+            capture_ring_used[port->port_id][q] = true;
+            capture_nb_rings++;
+        }
+    }
+
+    capture_running = true;
+    if (pthread_create(&capture_thread, NULL, capture_thread_func, NULL) != 0) {
+        printf("[CAPTURE] Failed to create thread: %s\n", strerror(errno));
+        capture_running = false;
+        capture_stop();
+        return -1;
+    }
+
+    printf("[CAPTURE] Armed: %u packets x %u B snap per RX core (%zu KB), "
+           "triggers: CRC, PRBS, gap > %u, post-trigger %u, dir %s\n",
+           CAPTURE_RING_SIZE, CAPTURE_SNAP_LEN, ring_bytes / 1024, CAPTURE_GAP_TRIGGER,
+           CAPTURE_POST_TRIGGER_PKTS, CAPTURE_DIR);
+    return 0;
+}
+
+struct capture_ring *capture_ring_get(uint16_t port_id, uint16_t queue_id)
+{
+    if (port_id >= MAX_PORTS || queue_id >= NUM_RX_CORES || !capture_ring_used[port_id][queue_id])
+        return NULL;
+    return &capture_rings[port_id][queue_id];
+}
+
+void capture_stop(void)
+{
+    if (capture_running) {
+        capture_running = false;
+        pthread_join(capture_thread, NULL);
+
+        // RX cores are stopped: a trigger still in POST_TRIGGER is written as is
+        for (uint16_t p = 0; p < MAX_PORTS; p++) {
+            for (uint16_t q = 0; q < NUM_RX_CORES; q++) {
+                struct capture_ring *r = &capture_rings[p][q];
+                if (capture_ring_used[p][q] && capture_files < CAPTURE_MAX_FILES &&
+                    (r->state == CAPTURE_POST_TRIGGER || r->state == CAPTURE_FROZEN))
+                    dump_ring(r);
+            }
+        }
+    }
+
+    for (uint16_t p = 0; p < MAX_PORTS; p++) {
+        for (uint16_t q = 0; q < NUM_RX_CORES; q++) {
+            if (capture_rings[p][q].slots != NULL) {
+                rte_free(capture_rings[p][q].slots);
+                capture_rings[p][q].slots = NULL;
+            }
+            capture_ring_used[p][q] = false;
+        }
+    }
+}
+
+void capture_print_stats(void)
+{
+    if (capture_nb_rings == 0)
+        return;
+
+    printf("\n=== Capture Ring ===\n");
+    printf("Files written: %u (max %u)\n", capture_files, CAPTURE_MAX_FILES);
+    for (uint16_t p = 0; p < MAX_PORTS; p++) {
+        for (uint16_t q = 0; q < NUM_RX_CORES; q++) {
+            const struct capture_ring *r = &capture_rings[p][q];
+            if (!capture_ring_used[p][q] || (r->triggers == 0 && r->suppressed == 0))
+                continue;
+            printf("  Port %u Q%u: %lu packets, %lu triggers, %lu suppressed\n",
+                   p, q, r->head, r->triggers, r->suppressed);
+        }
+    }
+}
+
+#endif /* CAPTURE_ENABLED */
@@ -19,6 +19,8 @@
 #include "dpdk_external_tx.h"
 #include "packet.h"
 #include "tx_rx_manager.h"
+#include "traffic_profile.h"  // IMIX profile sequence, pacer, per-size counters
+#include "adaptive_poll.h"    // TPAUSE in long pacing gaps
 
 #if DPDK_EXT_TX_ENABLED
 
@@ -32,8 +34,8 @@ struct dpdk_ext_tx_stats dpdk_ext_tx_stats_per_port[DPDK_EXT_TX_PORT_COUNT];
 // External TX ports
 struct dpdk_ext_tx_port dpdk_ext_tx_ports[DPDK_EXT_TX_PORT_COUNT];
 
-// Per-port per-VL-ID sequence numbers (separate from main system)
-static uint64_t ext_tx_sequences[DPDK_EXT_TX_PORT_COUNT][MAX_VL_ID + 1];
+// Per-VL-ID sequence numbers (separate from main system) live in the port's
+// single ext TX worker, one private slot per target VL-ID (no locks)
 
 // Worker parameters storage
 static struct dpdk_ext_tx_worker_params ext_worker_params[DPDK_EXT_TX_PORT_COUNT * DPDK_EXT_TX_QUEUES_PER_PORT];
@@ -97,30 +99,24 @@ static inline bool ext_consume_tokens(struct ext_rate_limiter *limiter, uint64_t
 // HELPER FUNCTIONS
 // ==========================================
 
-static inline uint64_t get_ext_tx_sequence(uint16_t port_idx, uint16_t vl_id)
+// Targets of one port must not share a VL-ID: the worker keeps one
+// sequence slot per target VL-ID, a shared one would repeat sequences
+static bool ext_tx_targets_overlap(const struct dpdk_ext_tx_port_config *config)
 {
-    if (port_idx >= DPDK_EXT_TX_PORT_COUNT || vl_id > MAX_VL_ID) {
-        return 0;
-    }
-    return ext_tx_sequences[port_idx][vl_id]++;
-}
-
-// Peek without incrementing — for send-then-commit pattern
-static inline uint64_t peek_ext_tx_sequence(uint16_t port_idx, uint16_t vl_id)
-{
-    if (port_idx >= DPDK_EXT_TX_PORT_COUNT || vl_id > MAX_VL_ID) {
-        return 0;
-    }
-    return ext_tx_sequences[port_idx][vl_id];
-}
-
-// Commit after successful send
-static inline void commit_ext_tx_sequence(uint16_t port_idx, uint16_t vl_id)
-{
-    if (port_idx >= DPDK_EXT_TX_PORT_COUNT || vl_id > MAX_VL_ID) {
-        return;
+    for (int a = 0; a < config->target_count; a++) {
+        const struct dpdk_ext_tx_target *ta = &config->targets[a];
+        for (int b = a + 1; b < config->target_count; b++) {
+            const struct dpdk_ext_tx_target *tb = &config->targets[b];
+            if (ta->vl_id_start < tb->vl_id_start + tb->vl_id_count &&
+                tb->vl_id_start < ta->vl_id_start + ta->vl_id_count) {
+                printf("  Port %u: Target %d VL-ID [%u..%u) overlaps target %d [%u..%u)\n",
+                       config->port_id, a, ta->vl_id_start, ta->vl_id_start + ta->vl_id_count,
+                       b, tb->vl_id_start, tb->vl_id_start + tb->vl_id_count);
+                return true;
+            }
+        }
     }
-    ext_tx_sequences[port_idx][vl_id]++;
+    return false;
 }
 
 int dpdk_ext_tx_get_source_port(uint16_t vl_id)
@@ -165,9 +161,6 @@ int dpdk_ext_tx_init(struct rte_mempool *mbuf_pools[])
         rte_atomic64_init(&dpdk_ext_tx_stats_per_port[i].tx_bytes);
     }
 
-    // Initialize sequence counters
-    memset(ext_tx_sequences, 0, sizeof(ext_tx_sequences));
-
     // Initialize port structures
     for (int i = 0; i < DPDK_EXT_TX_PORT_COUNT; i++) {
         struct dpdk_ext_tx_port *port = &dpdk_ext_tx_ports[i];
@@ -182,6 +175,12 @@ int dpdk_ext_tx_init(struct rte_mempool *mbuf_pools[])
             port->initialized = false;
             continue;
         }
+        if (ext_tx_targets_overlap(&port->config)) {
+            printf("  Port %u: Error: overlapping target VL-IDs, External TX DISABLED for this port.\n",
+                   port->port_id);
+            port->initialized = false;
+            continue;
+        }
         port->initialized = true;
 
         printf("  Port %u: %d targets, mbuf_pool=%p\n",
@@ -213,12 +212,6 @@ int dpdk_ext_tx_worker(void *arg)
     // VLAN header length
     const uint16_t l2_len = sizeof(struct rte_ether_hdr) + 4; // +4 for VLAN tag
 
-#if IMIX_ENABLED
-    // IMIX: Worker-specific offset for pattern rotation
-    const uint8_t imix_offset = (uint8_t)((params->port_id * 4 + params->queue_id) % IMIX_PATTERN_SIZE);
-    uint64_t imix_counter = 0;
-#endif
-
     // Find port index and config for multi-target handling
     int port_idx = -1;
     struct dpdk_ext_tx_port_config *port_config = NULL;
@@ -269,8 +262,22 @@ int dpdk_ext_tx_worker(void *arg)
         return -1;
     }
 
+    // Private per-VL sequences, targets back to back: slot = seq_base[target] + VL offset
+    uint16_t seq_base[DPDK_EXT_TX_QUEUES_PER_PORT];
+    uint32_t seq_slots = 0;
+    for (int t = 0; t < target_count; t++) {
+        seq_base[t] = (uint16_t)seq_slots;
+        seq_slots += port_config->targets[t].vl_id_count;
+    }
+    uint64_t *vl_seqs = calloc(seq_slots ? seq_slots : 1, sizeof(uint64_t));
+    if (!vl_seqs) {
+        printf("Error: Failed to allocate VL sequence array\n");
+        free(vl_offsets);
+        return -1;
+    }
+
 #if IMIX_ENABLED
-    const uint64_t avg_pkt_size = IMIX_AVG_PACKET_SIZE;
+    const double avg_pkt_size = (double)g_traffic_profile.cycle_bytes / g_traffic_profile.seq_len;
 #else
     const uint64_t avg_pkt_size = PACKET_SIZE_VLAN;
 #endif
@@ -290,10 +297,16 @@ int dpdk_ext_tx_worker(void *arg)
     uint64_t delay_cycles = (packets_per_sec > 0) ? (tsc_hz / packets_per_sec) : tsc_hz;
 #else
     // Hassas hesaplama: rate_mbps -> bytes/sec -> packets/sec -> cycles/packet
-    // IMIX: Ortalama paket boyutu kullan
+    // IMIX: Profil ortalaması ile paket hızı, her paket kendi byte maliyeti ile bekler
     uint64_t bytes_per_sec = (uint64_t)params->rate_mbps * 125000ULL;  // Mbit/s -> bytes/s
-    uint64_t packets_per_sec = bytes_per_sec / avg_pkt_size;
+    uint64_t packets_per_sec = (uint64_t)(bytes_per_sec / avg_pkt_size);
     uint64_t delay_cycles = (packets_per_sec > 0) ? (tsc_hz / packets_per_sec) : tsc_hz;
+#if IMIX_ENABLED
+    struct tp_pacer pacer;
+    tp_pacer_init(&pacer, tsc_hz, bytes_per_sec);
+    uint64_t pace_cycles = delay_cycles;  // Bir önceki paketin byte maliyeti
+    traffic_profile_add_target(params->port_id, bytes_per_sec);
+#endif
 #endif
 
     // Mikrosaniye cinsinden paket arası süre (debug için)
@@ -320,8 +333,8 @@ int dpdk_ext_tx_worker(void *arg)
     printf("  *** TOKEN BUCKET MODE - %u total VL-IDX, 1ms window ***\n", total_tb_vl_count);
 #elif IMIX_ENABLED
     printf("  *** IMIX MODE + SMOOTH PACING ***\n");
-    printf("  -> IMIX pattern: 100, 200, 400, 800, 1200x3, 1518x3 (avg=%lu bytes)\n", avg_pkt_size);
-    printf("  -> Worker offset: %u (hybrid shuffle)\n", imix_offset);
+    printf("  -> IMIX profile '%s': %u sizes (avg=%.1f bytes), exact byte-cost pacing\n",
+           g_traffic_profile.name, g_traffic_profile.nb_sizes, avg_pkt_size);
 #else
     printf("  *** SMOOTH PACING - 1 saniyeye yayılmış trafik ***\n");
 #endif
@@ -338,6 +351,12 @@ int dpdk_ext_tx_worker(void *arg)
     uint64_t local_tx_bytes = 0;
     const uint32_t STATS_FLUSH = 1024;
 
+#if ADAPTIVE_POLL_ENABLED
+    struct adaptive_poll *ap = adaptive_poll_register(ADAPTIVE_POLL_EXT_TX, params->port_id,
+                                                      params->queue_id,
+                                                      adaptive_poll_port_max_level(params->port_id));
+#endif
+
     while (!(*params->stop_flag))
     {
         // ==========================================
@@ -347,10 +366,14 @@ int dpdk_ext_tx_worker(void *arg)
         uint64_t now = rte_get_tsc_cycles();
 
         // Zamanı gelene kadar bekle (busy-wait for precision)
+#if ADAPTIVE_POLL_ENABLED
+        now = adaptive_poll_wait_until(ap, now, next_send_time);
+#else
         while (now < next_send_time) {
             rte_pause();
             now = rte_get_tsc_cycles();
         }
+#endif
 
 #if TOKEN_BUCKET_TX_ENABLED
         // ÖNEMLİ: Geride kalırsak PHASE-PRESERVING SKIP (burst önleme)
@@ -366,7 +389,11 @@ int dpdk_ext_tx_worker(void *arg)
             next_send_time = now;
         }
 #endif
+#if IMIX_ENABLED && !TOKEN_BUCKET_TX_ENABLED
+        next_send_time += pace_cycles;
+#else
         next_send_time += delay_cycles;
+#endif
 
         // Paket tahsisi - BAŞARISIZ OLURSA BİLE TIMING KORUNUR
         pkts[0] = rte_pktmbuf_alloc(params->mbuf_pool);
@@ -382,13 +409,14 @@ int dpdk_ext_tx_worker(void *arg)
 
         // Current VL-ID (round-robin within target's range)
         uint16_t curr_vl = target->vl_id_start + vl_offsets[current_target];
+        uint64_t *seq_slot = &vl_seqs[seq_base[current_target] + vl_offsets[current_target]];
         vl_offsets[current_target] = (vl_offsets[current_target] + 1) % target->vl_id_count;
 
         // Move to next target for next packet
         current_target = (current_target + 1) % target_count;
 
         // Peek sequence WITHOUT incrementing — only commit after successful send
-        uint64_t seq = peek_ext_tx_sequence(port_idx, curr_vl);
+        uint64_t seq = *seq_slot;
 
         // ==========================================
         // BUILD ETHERNET HEADER
@@ -419,11 +447,14 @@ int dpdk_ext_tx_worker(void *arg)
         *(uint16_t *)(vlan_tag + 2) = rte_cpu_to_be_16(0x0800); // IPv4
 
 #if IMIX_ENABLED
-        // IMIX: Paket boyutunu pattern'den al
-        uint16_t pkt_size = get_imix_packet_size(imix_counter, imix_offset);
+        // IMIX: Paket boyutu VL'in profil sırasından (VL, sequence) ile
+        const uint8_t imix_bucket = traffic_profile_bucket(curr_vl, seq);
+        uint16_t pkt_size = traffic_profile_size(imix_bucket);
         uint16_t prbs_len = calc_prbs_size(pkt_size);
         uint16_t payload_size = pkt_size - l2_len - sizeof(struct rte_ipv4_hdr) - sizeof(struct rte_udp_hdr);
-        imix_counter++;
+#if !TOKEN_BUCKET_TX_ENABLED
+        pace_cycles = tp_pacer_cycles(&pacer, pkt_size);
+#endif
 #else
         const uint16_t pkt_size = PACKET_SIZE_VLAN;
         const uint16_t prbs_len = NUM_PRBS_BYTES;
@@ -488,9 +519,12 @@ int dpdk_ext_tx_worker(void *arg)
 
         if (nb_tx > 0) {
             // Sequence'ı sadece başarılı gönderimden sonra artır
-            commit_ext_tx_sequence(port_idx, curr_vl);
+            (*seq_slot)++;
             local_tx_pkts++;
             local_tx_bytes += pkt_size;
+#if IMIX_ENABLED
+            traffic_profile_count_tx(params->port_id, TP_TX_SLOT_EXT, imix_bucket);
+#endif
         } else {
             // TX queue dolu — paketi at, sequence artırma (tekrar denenecek)
             rte_pktmbuf_free(pkts[0]);
@@ -511,6 +545,7 @@ int dpdk_ext_tx_worker(void *arg)
         rte_atomic64_add(&dpdk_ext_tx_stats_per_port[port_idx].tx_bytes, local_tx_bytes);
     }
 
+    free(vl_seqs);
     free(vl_offsets);
     printf("ExtTX Worker stopped: Port %u Q%u\n", params->port_id, params->queue_id);
     return 0;
@@ -86,7 +86,7 @@ void printSocketToLcoreList()
     for (uint16_t socket = 0; socket < MAX_SOCKET; socket++)
     {
         printf("  Socket %u -> [", socket);
-        for (uint16_t lcore_id = 0; lcore_id < MAX_LCORE; lcore_id++)
+        for (uint16_t lcore_id = 0; lcore_id < MAX_LCORE_PER_SOCKET; lcore_id++)
         {
             printf("%u ", socket_to_lcore[socket][lcore_id]);
         }
@@ -96,7 +96,7 @@ void printSocketToLcoreList()
     for (uint16_t socket = 0; socket < MAX_SOCKET; socket++)
     {
         printf(" Unused  Socket %u -> [", socket);
-        for (uint16_t lcore_id = 0; lcore_id < MAX_LCORE; lcore_id++)
+        for (uint16_t lcore_id = 0; lcore_id < MAX_LCORE_PER_SOCKET; lcore_id++)
         {
             printf("%u ", unused_socket_to_lcore[socket][lcore_id]);
         }
@@ -0,0 +1,468 @@
+#define _GNU_SOURCE
+#include "health_history.h"
+#include "health_monitor.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ==========================================
+// METRIC DESCRIPTORS
+// ==========================================
+
+// lo/hi: value (gauge) or rate (counter) limits, roc: |d value/dt| limit; 0 = off
+struct health_metric_desc {
+    const char *name;
+    health_metric_kind_t kind;
+    double lo;
+    double hi;
+    double roc;
+};
+
+static const struct health_metric_desc metric_desc[HM_METRIC_COUNT] = {
+    [HM_RESPONSES]        = {"responses",       HM_KIND_GAUGE,   0, 0, 0},
+    [HM_AST_TEMP_C]       = {"ast_temp_c",      HM_KIND_GAUGE,   0, HEALTH_ALARM_FPGA_TEMP_C, HEALTH_ALARM_TEMP_RISE_C_PER_S},
+    [HM_AST_VOLT_V]       = {"ast_volt_v",      HM_KIND_GAUGE,   0, 0, 0},
+    [HM_AST_TX_TOTAL]     = {"ast_tx_total",    HM_KIND_COUNTER, 0, 0, 0},
+    [HM_AST_RX_TOTAL]     = {"ast_rx_total",    HM_KIND_COUNTER, 0, 0, 0},
+    [HM_AST_TX_ERR]       = {"ast_tx_err",      HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_AST_RX_ERR]       = {"ast_rx_err",      HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_AST_CRC_ERR]      = {"ast_crc_err",     HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_AST_POLICY_DROP]  = {"ast_policy_drop", HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_AST_VLID_DROP]    = {"ast_vlid_drop",   HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_AST_QUEUE_OVF]    = {"ast_queue_ovf",   HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_MGR_TEMP_C]       = {"mgr_temp_c",      HM_KIND_GAUGE,   0, HEALTH_ALARM_FPGA_TEMP_C, HEALTH_ALARM_TEMP_RISE_C_PER_S},
+    [HM_MGR_VOLT_V]       = {"mgr_volt_v",      HM_KIND_GAUGE,   0, 0, 0},
+    [HM_MGR_TX_TOTAL]     = {"mgr_tx_total",    HM_KIND_COUNTER, 0, 0, 0},
+    [HM_MGR_RX_TOTAL]     = {"mgr_rx_total",    HM_KIND_COUNTER, 0, 0, 0},
+    [HM_MGR_TX_ERR]       = {"mgr_tx_err",      HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_MGR_RX_ERR]       = {"mgr_rx_err",      HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_MGR_CRC_ERR]      = {"mgr_crc_err",     HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_MGR_POLICY_DROP]  = {"mgr_policy_drop", HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_MGR_VLID_DROP]    = {"mgr_vlid_drop",   HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_MGR_QUEUE_OVF]    = {"mgr_queue_ovf",   HM_KIND_COUNTER, 0, HEALTH_ALARM_ERR_RATE_PER_S, 0},
+    [HM_MCU_BOARD_TEMP_C] = {"mcu_board_temp_c", HM_KIND_GAUGE,  0, HEALTH_ALARM_BOARD_TEMP_C, HEALTH_ALARM_TEMP_RISE_C_PER_S},
+    [HM_MCU_FO_TEMP_C]    = {"mcu_fo_temp_c",   HM_KIND_GAUGE,   0, 0, HEALTH_ALARM_TEMP_RISE_C_PER_S},
+    [HM_MCU_VOLT_12V]     = {"mcu_volt_12v",    HM_KIND_GAUGE,   HEALTH_ALARM_VOLT_12V_MIN, HEALTH_ALARM_VOLT_12V_MAX, 0},
+    [HM_MCU_CURR_12V]     = {"mcu_curr_12v",    HM_KIND_GAUGE,   0, 0, 0},
+};
+
+// ==========================================
+// GLOBAL STATE
+// ==========================================
+
+#define HEALTH_HISTORY_MASK (HEALTH_HISTORY_DEPTH - 1)
+
+// Ring (written by monitor thread, read by render thread)
+static struct health_history_sample g_ring[HEALTH_HISTORY_DEPTH];
+static uint64_t g_ring_count;   // Cycles recorded (release on publish)
+
+// Analysis state (render thread only)
+static struct {
+    uint64_t analyzed;                  // Cycles analyzed
+    struct health_history_sample prev;  // Last analyzed sample
+    bool     have_prev;
+    uint32_t missed_cycles;             // Consecutive incomplete cycles
+    bool     metric_alarm[HM_METRIC_COUNT];
+    bool     port_alarm[FPGA_TYPE_COUNT][HEALTH_MAX_PORTS];
+    bool     missed_alarm;
+    uint64_t alarm_count;
+} g_an;
+
+// Scratch for percentiles (render thread only)
+static double g_scratch[HEALTH_HISTORY_DEPTH];
+
+static const char *fpga_name[FPGA_TYPE_COUNT] = {"ASSISTANT", "MANAGER"};
+
+// ==========================================
+// RECORD (monitor thread)
+// ==========================================
+
+static void set_metric(struct health_history_sample *s, health_metric_t m, double v)
+{
+    s->value[m] = v;
+    s->valid_mask |= 1ULL << m;
+}
+
+static void record_fpga(struct health_history_sample *s, fpga_type_t type,
+                        const struct health_fpga_data *fpga, health_metric_t base)
+{
+    // Metric order per FPGA: TEMP, VOLT, TX_TOTAL, RX_TOTAL, TX_ERR, RX_ERR,
+    //                        CRC_ERR, POLICY_DROP, VLID_DROP, QUEUE_OVF
+    if (fpga->device_info_valid) {
+        const struct health_device_info *dev = &fpga->device;
+        set_metric(s, base + 0, convert_fpga_temperature(dev->fpga_temp));
+        set_metric(s, base + 1, convert_fpga_voltage(dev->fpga_voltage));
+        set_metric(s, base + 2, (double)dev->tx_total_count);
+        set_metric(s, base + 3, (double)dev->rx_total_count);
+        set_metric(s, base + 4, (double)dev->tx_err_total_count);
+        set_metric(s, base + 5, (double)dev->rx_err_total_count);
+    }
+
+    if (fpga->port_count_received == 0) {
+        return;
+    }
+
+    uint64_t crc = 0, policy = 0, vlid = 0, ovf = 0;
+    for (int p = 0; p < HEALTH_MAX_PORTS; p++) {
+        const struct health_port_info *port = &fpga->ports[p];
+        if (!port->valid) {
+            continue;
+        }
+
+        uint64_t q_ovf = port->hp_queue_overflow + port->lp_queue_overflow +
+                         port->be_queue_overflow;
+        crc    += port->crc_err_count;
+        policy += port->traffic_policy_drop;
+        vlid   += port->vlid_drop_count;
+        ovf    += q_ovf;
+
+        s->port_err[type][p] = port->crc_err_count + port->ali_err_count +
+                               port->vl_source_err + port->max_delay_err +
+                               port->queue_overflow + q_ovf;
+        s->port_valid[type] |= 1ULL << p;
+    }
+
+    set_metric(s, base + 6, (double)crc);
+    set_metric(s, base + 7, (double)policy);
+    set_metric(s, base + 8, (double)vlid);
+    set_metric(s, base + 9, (double)ovf);
+}
+
+void health_history_record(const struct health_cycle_data *cycle, uint64_t time_ms)
+{
+    uint64_t n = g_ring_count;
+    struct health_history_sample *s = &g_ring[n & HEALTH_HISTORY_MASK];
+
+    // Seqlock: invalidate slot while it is rewritten
+    __atomic_store_n(&s->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    s->time_ms = time_ms;
+    s->valid_mask = 0;
+    memset(s->port_valid, 0, sizeof(s->port_valid));
+
+    set_metric(s, HM_RESPONSES, (double)cycle->total_responses_received);
+    record_fpga(s, FPGA_TYPE_ASSISTANT, &cycle->assistant, HM_AST_TEMP_C);
+    record_fpga(s, FPGA_TYPE_MANAGER, &cycle->manager, HM_MGR_TEMP_C);
+
+    if (cycle->mcu.valid) {
+        const struct health_mcu_info *mcu = &cycle->mcu;
+        set_metric(s, HM_MCU_BOARD_TEMP_C, mcu->board_temp / 100.0);
+        set_metric(s, HM_MCU_FO_TEMP_C, mcu->fo_trans_temp / 100.0);
+        set_metric(s, HM_MCU_VOLT_12V, mcu->volt_12v / 1000.0);
+        set_metric(s, HM_MCU_CURR_12V, mcu->curr_12v / 1000.0);
+    }
+
+    __atomic_store_n(&s->seq, n + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&g_ring_count, n + 1, __ATOMIC_RELEASE);
+}
+
+// ==========================================
+// READ / ANALYSIS (render thread)
+// ==========================================
+
+/**
+ * Copy cycle n out of the ring; false if it was overwritten meanwhile
+ */
+static bool read_sample(uint64_t n, struct health_history_sample *out)
+{
+    const struct health_history_sample *s = &g_ring[n & HEALTH_HISTORY_MASK];
+
+    if (__atomic_load_n(&s->seq, __ATOMIC_ACQUIRE) != n + 1) {
+        return false;
+    }
+    memcpy(out, s, sizeof(*out));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&s->seq, __ATOMIC_RELAXED) == n + 1;
+}
+
+static inline bool metric_valid(const struct health_history_sample *s, int m)
+{
+    return (s->valid_mask >> m) & 1;
+}
+
+/**
+ * Per-second rate of a counter (or slope of a gauge) between two samples
+ */
+static bool metric_rate(const struct health_history_sample *prev,
+                        const struct health_history_sample *cur, int m, double *rate)
+{
+    if (!metric_valid(prev, m) || !metric_valid(cur, m) || cur->time_ms <= prev->time_ms) {
+        return false;
+    }
+
+    double delta = cur->value[m] - prev->value[m];
+    if (metric_desc[m].kind == HM_KIND_COUNTER && delta < 0) {
+        return false;  // Counter reset
+    }
+
+    *rate = delta * 1000.0 / (double)(cur->time_ms - prev->time_ms);
+    return true;
+}
+
+static void raise_alarm(bool *latch, bool active, const char *fmt_name,
+                        const char *what, double value, double limit)
+{
+    if (active && !*latch) {
+        printf("[HEALTH-ALARM] %s %s: %.3f (limit %.3f)\n", fmt_name, what, value, limit);
+        g_an.alarm_count++;
+    } else if (!active && *latch) {
+        printf("[HEALTH-ALARM] %s %s cleared: %.3f\n", fmt_name, what, value);
+    }
+    *latch = active;
+}
+
+static int analyze_sample(const struct health_history_sample *cur)
+{
+    uint64_t before = g_an.alarm_count;
+
+    // Missed responses
+    if (cur->value[HM_RESPONSES] < HEALTH_MONITOR_EXPECTED_RESPONSES) {
+        g_an.missed_cycles++;
+    } else {
+        g_an.missed_cycles = 0;
+    }
+    raise_alarm(&g_an.missed_alarm, g_an.missed_cycles >= HEALTH_ALARM_MISSED_CYCLES,
+                "responses", "incomplete cycles", (double)g_an.missed_cycles,
+                HEALTH_ALARM_MISSED_CYCLES);
+
+    for (int m = 0; m < HM_METRIC_COUNT; m++) {
+        const struct health_metric_desc *d = &metric_desc[m];
+        if (!metric_valid(cur, m) || (d->lo == 0 && d->hi == 0 && d->roc == 0)) {
+            continue;
+        }
+
+        double rate = 0;
+        bool have_rate = g_an.have_prev && metric_rate(&g_an.prev, cur, m, &rate);
+
+        if (d->kind == HM_KIND_COUNTER) {
+            // Error counters: rate threshold
+            if (have_rate && d->hi != 0) {
+                raise_alarm(&g_an.metric_alarm[m], rate > d->hi, d->name, "rate/s", rate, d->hi);
+            }
+            continue;
+        }
+
+        // Gauges: level, then rate of change (same latch, level wins)
+        double v = cur->value[m];
+        if (d->hi != 0 && v > d->hi) {
+            raise_alarm(&g_an.metric_alarm[m], true, d->name, "high", v, d->hi);
+        } else if (d->lo != 0 && v < d->lo) {
+            raise_alarm(&g_an.metric_alarm[m], true, d->name, "low", v, d->lo);
+        } else if (d->roc != 0 && have_rate && (rate > d->roc || rate < -d->roc)) {
+            raise_alarm(&g_an.metric_alarm[m], true, d->name, "change/s", rate, d->roc);
+        } else {
+            raise_alarm(&g_an.metric_alarm[m], false, d->name, "alarm", v, 0);
+        }
+    }
+
+    // Per-port error counter jumps
+    if (g_an.have_prev) {
+        for (int f = 0; f < FPGA_TYPE_COUNT; f++) {
+            uint64_t both = cur->port_valid[f] & g_an.prev.port_valid[f];
+            for (int p = 0; p < HEALTH_MAX_PORTS; p++) {
+                if (!((both >> p) & 1)) {
+                    continue;
+                }
+                uint64_t now = cur->port_err[f][p];
+                uint64_t old = g_an.prev.port_err[f][p];
+                uint64_t delta = (now > old) ? now - old : 0;
+                bool active = delta >= HEALTH_ALARM_PORT_ERR_DELTA;
+
+                if (active && !g_an.port_alarm[f][p]) {
+                    printf("[HEALTH-ALARM] %s port %d error counters +%lu in one cycle\n",
+                           fpga_name[f], p, (unsigned long)delta);
+                    g_an.alarm_count++;
+                }
+                g_an.port_alarm[f][p] = active;
+            }
+        }
+    }
+
+    return (int)(g_an.alarm_count - before);
+}
+
+void health_history_reset(void)
+{
+    memset(g_ring, 0, sizeof(g_ring));
+    __atomic_store_n(&g_ring_count, 0, __ATOMIC_RELEASE);
+    memset(&g_an, 0, sizeof(g_an));
+}
+
+int health_history_analyze(void)
+{
+    static struct health_history_sample cur;
+    uint64_t count = __atomic_load_n(&g_ring_count, __ATOMIC_ACQUIRE);
+    int alarms = 0;
+
+    // Fell behind by more than the ring: skip to the oldest kept cycle
+    if (count - g_an.analyzed > HEALTH_HISTORY_DEPTH) {
+        g_an.analyzed = count - HEALTH_HISTORY_DEPTH;
+        g_an.have_prev = false;
+    }
+
+    for (; g_an.analyzed < count; g_an.analyzed++) {
+        if (!read_sample(g_an.analyzed, &cur)) {
+            g_an.have_prev = false;
+            continue;
+        }
+        alarms += analyze_sample(&cur);
+        memcpy(&g_an.prev, &cur, sizeof(cur));
+        g_an.have_prev = true;
+    }
+
+    return alarms;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static double percentile(const double *sorted, uint32_t n, double p)
+{
+    uint32_t idx = (uint32_t)(p * (n - 1) + 0.5);
+    return sorted[idx < n ? idx : n - 1];
+}
+
+void health_history_summary(health_metric_t metric, struct health_metric_summary *out)
+{
+    static struct health_history_sample prev, cur;
+    uint64_t count = __atomic_load_n(&g_ring_count, __ATOMIC_ACQUIRE);
+    uint64_t first = (count > HEALTH_HISTORY_DEPTH) ? count - HEALTH_HISTORY_DEPTH : 0;
+    bool have_prev = false;
+    uint32_t n = 0;
+    double sum = 0;
+
+    memset(out, 0, sizeof(*out));
+
+    for (uint64_t i = first; i < count; i++) {
+        if (!read_sample(i, &cur)) {
+            have_prev = false;
+            continue;
+        }
+
+        double v;
+        bool ok;
+        if (metric_desc[metric].kind == HM_KIND_COUNTER) {
+            ok = have_prev && metric_rate(&prev, &cur, metric, &v);
+        } else {
+            ok = metric_valid(&cur, metric);
+            v = cur.value[metric];
+        }
+
+        if (ok) {
+            g_scratch[n++] = v;
+            sum += v;
+            out->last = v;
+        }
+
+        memcpy(&prev, &cur, sizeof(cur));
+        have_prev = true;
+    }
+
+    if (n == 0) {
+        return;
+    }
+
+    qsort(g_scratch, n, sizeof(double), cmp_double);
+    out->samples = n;
+    out->min = g_scratch[0];
+    out->max = g_scratch[n - 1];
+    out->mean = sum / n;
+    out->p50 = percentile(g_scratch, n, 0.50);
+    out->p95 = percentile(g_scratch, n, 0.95);
+    out->p99 = percentile(g_scratch, n, 0.99);
+}
+
+void health_history_print_summary(void)
+{
+    uint64_t count = __atomic_load_n(&g_ring_count, __ATOMIC_ACQUIRE);
+    struct health_metric_summary sm;
+
+    printf("[HEALTH] ---- History (last %lu cycles, counters as rate/s) ----\n",
+           (unsigned long)(count < HEALTH_HISTORY_DEPTH ? count : HEALTH_HISTORY_DEPTH));
+    printf("[HEALTH] %-17s | %5s | %12s | %12s | %12s | %12s | %12s | %12s | %12s |\n",
+           "Metric", "N", "Last", "Min", "Mean", "P50", "P95", "P99", "Max");
+
+    for (int m = 0; m < HM_METRIC_COUNT; m++) {
+        health_history_summary((health_metric_t)m, &sm);
+        if (sm.samples == 0) {
+            continue;
+        }
+        printf("[HEALTH] %-17s | %5u | %12.3f | %12.3f | %12.3f | %12.3f | %12.3f | %12.3f | %12.3f |\n",
+               metric_desc[m].name, sm.samples, sm.last, sm.min, sm.mean,
+               sm.p50, sm.p95, sm.p99, sm.max);
+    }
+    printf("[HEALTH] Alarms raised: %lu\n", (unsigned long)g_an.alarm_count);
+}
+
+int health_history_dump_csv(const char *path)
+{
+    static struct health_history_sample prev, cur;
+    uint64_t count = __atomic_load_n(&g_ring_count, __ATOMIC_ACQUIRE);
+    uint64_t first = (count > HEALTH_HISTORY_DEPTH) ? count - HEALTH_HISTORY_DEPTH : 0;
+    bool have_prev = false;
+    int rows = 0;
+
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        fprintf(stderr, "[HEALTH] Failed to open %s for CSV dump\n", path);
+        return -1;
+    }
+
+    // Header: values, then rates of counters
+    fprintf(fp, "cycle,time_ms");
+    for (int m = 0; m < HM_METRIC_COUNT; m++) {
+        fprintf(fp, ",%s", metric_desc[m].name);
+    }
+    for (int m = 0; m < HM_METRIC_COUNT; m++) {
+        if (metric_desc[m].kind == HM_KIND_COUNTER) {
+            fprintf(fp, ",%s_per_s", metric_desc[m].name);
+        }
+    }
+    fprintf(fp, "\n");
+
+    for (uint64_t i = first; i < count; i++) {
+        if (!read_sample(i, &cur)) {
+            have_prev = false;
+            continue;
+        }
+
+        fprintf(fp, "%lu,%lu", (unsigned long)i, (unsigned long)cur.time_ms);
+        for (int m = 0; m < HM_METRIC_COUNT; m++) {
+            if (metric_valid(&cur, m)) {
+                fprintf(fp, ",%.6g", cur.value[m]);
+            } else {
+                fprintf(fp, ",");
+            }
+        }
+        for (int m = 0; m < HM_METRIC_COUNT; m++) {
+            if (metric_desc[m].kind != HM_KIND_COUNTER) {
+                continue;
+            }
+            double rate;
+            if (have_prev && metric_rate(&prev, &cur, m, &rate)) {
+                fprintf(fp, ",%.3f", rate);
+            } else {
+                fprintf(fp, ",");
+            }
+        }
+        fprintf(fp, "\n");
+        rows++;
+
+        memcpy(&prev, &cur, sizeof(cur));
+        have_prev = true;
+    }
+
+    fclose(fp);
+    printf("[HEALTH] History dumped: %s (%d cycles)\n", path, rows);
+    return rows;
+}
+
+uint64_t health_history_alarm_count(void)
+{
+    return g_an.alarm_count;
+}
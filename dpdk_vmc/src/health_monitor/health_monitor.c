@@ -1,10 +1,12 @@
 #define _GNU_SOURCE
 #include "health_monitor.h"
+#include "health_history.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <errno.h>
+#include <signal.h>
 #include <time.h>
 #include <sys/socket.h>
 #include <sys/ioctl.h>
@@ -12,7 +14,10 @@
 #include <net/ethernet.h>
 #include <linux/if_packet.h>
 #include <arpa/inet.h>
-#include <poll.h>
+#include <linux/filter.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
 
 // ==========================================
 // GLOBAL STATE
@@ -20,6 +25,7 @@
 
 static struct health_monitor_state g_health_monitor;
 static volatile bool *g_stop_flag = NULL;
+static volatile sig_atomic_t g_csv_dump_requested = 0;  // Set by SIGUSR1
 
 // ==========================================
 // QUERY PACKET TEMPLATE (64 bytes, no VLAN)
@@ -63,6 +69,14 @@ static uint64_t get_time_ms(void)
     return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)ts.tv_nsec / 1000000ULL;
 }
 
+// CLOCK_REALTIME in ns (same clock as SO_TIMESTAMPNS RX timestamps)
+static uint64_t get_realtime_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
 // ==========================================
 // BYTE PARSING FUNCTIONS (Big-Endian)
 // ==========================================
@@ -258,8 +272,8 @@ static void health_parse_response(const uint8_t *packet, size_t len, struct heal
             cycle->mcu.valid = true;
             cycle->total_responses_received++;
         } else {
-            printf("[HEALTH] Unexpected small packet: %zu bytes (need >= %d for MCU)\n",
-                   len, (int)(HEALTH_UDP_PAYLOAD_OFFSET + MCU_OFF_FO_TRANS_TEMP + 2));
+            // Too small for MCU data (counted, reported by render thread)
+            cycle->unexpected_packets++;
         }
         return;
     }
@@ -283,8 +297,8 @@ static void health_parse_response(const uint8_t *packet, size_t len, struct heal
             target_fpga = &cycle->manager;
             cycle->last_fpga_type = STATUS_ENABLE_MANAGER;
         } else {
-            printf("[HEALTH] Unknown status_enable=0x%02X in %zu-byte packet, ignoring\n",
-                   status_enable, len);
+            // Unknown status_enable, ignore
+            cycle->unexpected_packets++;
             return;
         }
     } else {
@@ -294,7 +308,8 @@ static void health_parse_response(const uint8_t *packet, size_t len, struct heal
         } else if (cycle->last_fpga_type == STATUS_ENABLE_MANAGER) {
             target_fpga = &cycle->manager;
         } else {
-            printf("[HEALTH] Mini header packet (%zu bytes) received before any 1187-byte packet, ignoring\n", len);
+            // Mini header before any 1187-byte packet, ignore
+            cycle->unexpected_packets++;
             return;
         }
     }
@@ -330,23 +345,6 @@ static void health_parse_response(const uint8_t *packet, size_t len, struct heal
 // CONVERSION FUNCTIONS
 // ==========================================
 
-static double convert_fpga_voltage(uint16_t raw)
-{
-    uint16_t integer_part = (raw & 0x7FF8) >> 3;
-    uint16_t fractional_part = raw & 0x7;
-    double milli_volt = (double)integer_part + (double)fractional_part / 10.0;
-    return milli_volt / 1000.0;
-}
-
-static double convert_fpga_temperature(uint16_t raw)
-{
-    uint16_t integer_part = (raw & 0x7FF0) >> 4;
-    uint16_t fractional_part = raw & 0xF;
-    double divisor = (fractional_part >= 10) ? 100.0 : 10.0;
-    double kelvin = (double)integer_part + (double)fractional_part / divisor;
-    return kelvin - 273.15;
-}
-
 static const char *port_speed_str(uint64_t speed)
 {
     switch (speed) {
@@ -449,8 +447,11 @@ static void health_print_tables(const struct health_cycle_data *cycle)
         printf("[HEALTH] MCU: NOT RECEIVED\n");
     }
 
-    printf("[HEALTH] Total responses: %d/%d\n",
+    printf("[HEALTH] Total responses: %d/%d",
            cycle->total_responses_received, HEALTH_MONITOR_EXPECTED_RESPONSES);
+    if (cycle->unexpected_packets > 0)
+        printf(" | Unexpected: %d", cycle->unexpected_packets);
+    printf("\n");
     printf("[HEALTH] ================================================\n\n");
 }
 
@@ -476,12 +477,10 @@ static int get_interface_index(const char *ifname)
 // SOCKET FUNCTIONS
 // ==========================================
 
-static int create_raw_socket(const char *ifname, int if_index)
+static int create_raw_socket(int if_index, uint16_t protocol)
 {
-    (void)ifname;
-
-    // Create raw socket
-    int sock = socket(AF_PACKET, SOCK_RAW, htons(ETH_P_ALL));
+    // Create raw socket (protocol 0: TX only, nothing is queued for RX)
+    int sock = socket(AF_PACKET, SOCK_RAW, htons(protocol));
     if (sock < 0) {
         fprintf(stderr, "[HEALTH] Failed to create socket: %s\n", strerror(errno));
         return -1;
@@ -492,7 +491,7 @@ static int create_raw_socket(const char *ifname, int if_index)
     memset(&sll, 0, sizeof(sll));
     sll.sll_family = AF_PACKET;
     sll.sll_ifindex = if_index;
-    sll.sll_protocol = htons(ETH_P_ALL);
+    sll.sll_protocol = htons(protocol);
 
     if (bind(sock, (struct sockaddr *)&sll, sizeof(sll)) < 0) {
         fprintf(stderr, "[HEALTH] Failed to bind socket: %s\n", strerror(errno));
@@ -500,6 +499,10 @@ static int create_raw_socket(const char *ifname, int if_index)
         return -1;
     }
 
+    if (protocol == 0) {
+        return sock;
+    }
+
     // Set promiscuous mode for RX
     struct packet_mreq mreq;
     memset(&mreq, 0, sizeof(mreq));
@@ -514,11 +517,89 @@ static int create_raw_socket(const char *ifname, int if_index)
     return sock;
 }
 
+/**
+ * Attach classic BPF filter: accept only frames with VL_IDX 0x1184 at DST MAC[4:5]
+ * PRBS traffic on the same interface is dropped in the kernel and never
+ * reaches the RX queue of the socket.
+ */
+static int attach_health_filter(int sock)
+{
+    struct sock_filter code[] = {
+        BPF_STMT(BPF_LD  | BPF_H   | BPF_ABS, 4),                               // A = DST MAC[4:5]
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, HEALTH_MONITOR_RESPONSE_VL_IDX, 0, 1),
+        BPF_STMT(BPF_RET | BPF_K, 0xFFFF),                                      // Accept
+        BPF_STMT(BPF_RET | BPF_K, 0),                                           // Drop
+    };
+    struct sock_fprog prog = {
+        .len = sizeof(code) / sizeof(code[0]),
+        .filter = code,
+    };
+
+    if (setsockopt(sock, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof(prog)) < 0) {
+        fprintf(stderr, "[HEALTH] Warning: Failed to attach BPF filter: %s\n", strerror(errno));
+        return -1;
+    }
+
+    // Drop frames queued between bind() and filter attach
+    uint8_t buffer[HEALTH_MONITOR_RX_BUFFER_SIZE];
+    while (recv(sock, buffer, sizeof(buffer), MSG_DONTWAIT) > 0) {
+    }
+
+    return 0;
+}
+
+static int create_timer_fd(void)
+{
+    int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd < 0) {
+        fprintf(stderr, "[HEALTH] Failed to create timerfd: %s\n", strerror(errno));
+    }
+    return fd;
+}
+
+static void arm_timer(int fd, uint32_t first_ms, uint32_t period_ms)
+{
+    struct itimerspec its;
+    memset(&its, 0, sizeof(its));
+    its.it_value.tv_sec = first_ms / 1000;
+    its.it_value.tv_nsec = (long)(first_ms % 1000) * 1000000L;
+    its.it_interval.tv_sec = period_ms / 1000;
+    its.it_interval.tv_nsec = (long)(period_ms % 1000) * 1000000L;
+    timerfd_settime(fd, 0, &its, NULL);
+}
+
+static int epoll_add(int epfd, int fd)
+{
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    return epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev);
+}
+
+static void close_fd(int *fd)
+{
+    if (*fd >= 0) {
+        close(*fd);
+        *fd = -1;
+    }
+}
+
+static void close_health_fds(struct health_monitor_state *state)
+{
+    close_fd(&state->epoll_fd);
+    close_fd(&state->query_timer_fd);
+    close_fd(&state->deadline_timer_fd);
+    close_fd(&state->wake_fd);
+    close_fd(&state->tx_socket);
+    close_fd(&state->rx_socket);
+}
+
 // ==========================================
 // PACKET FUNCTIONS
 // ==========================================
 
-static int send_health_query(void)
+static int send_health_query(uint64_t *sent_ns)
 {
     struct health_monitor_state *state = &g_health_monitor;
 
@@ -534,6 +615,7 @@ static int send_health_query(void)
     memcpy(dest.sll_addr, state->query_packet, ETH_ALEN);  // DST MAC
 
     // Send packet
+    *sent_ns = get_realtime_ns();
     ssize_t sent = sendto(state->tx_socket, state->query_packet, HEALTH_MONITOR_QUERY_SIZE,
                           0, (struct sockaddr *)&dest, sizeof(dest));
 
@@ -542,7 +624,6 @@ static int send_health_query(void)
         return -1;
     }
 
-    printf("[HEALTH] Query sent (seq=0x%02X)\n", state->sequence);
     return 0;
 }
 
@@ -552,6 +633,7 @@ static bool is_health_response(const uint8_t *packet, size_t len)
     if (len < 14) return false;
 
     // Check VL_IDX at DST MAC offset 4-5 (all health packets including MCU)
+    // Already enforced by the BPF filter; kept in case the attach failed
     if (packet[4] == HEALTH_MONITOR_RESPONSE_VL_IDX_HIGH &&
         packet[5] == HEALTH_MONITOR_RESPONSE_VL_IDX_LOW) {
         return true;
@@ -560,121 +642,306 @@ static bool is_health_response(const uint8_t *packet, size_t len)
     return false;
 }
 
-static int receive_health_responses(int timeout_ms, struct health_cycle_data *cycle)
+// ==========================================
+// CYCLE HANDLING
+// ==========================================
+
+// Query/response cycle in flight (monitor thread only)
+struct health_pending_cycle {
+    struct health_cycle_data data;
+    bool     open;
+    uint64_t start_ms;        // CLOCK_MONOTONIC, cycle time
+    uint64_t sent_ns;         // CLOCK_REALTIME, latency reference
+    uint64_t first_resp_ns;
+    uint64_t last_resp_ns;
+};
+
+static void record_response_latency(struct health_pending_cycle *pc, uint64_t rx_ns)
 {
     struct health_monitor_state *state = &g_health_monitor;
-    uint8_t buffer[HEALTH_MONITOR_RX_BUFFER_SIZE];
-    uint64_t start_time = get_time_ms();
+    uint64_t lat_us = (rx_ns > pc->sent_ns) ? (rx_ns - pc->sent_ns) / 1000 : 0;
 
-    while (cycle->total_responses_received < HEALTH_MONITOR_EXPECTED_RESPONSES) {
-        // Calculate remaining timeout
-        uint64_t elapsed = get_time_ms() - start_time;
-        if (elapsed >= (uint64_t)timeout_ms) {
-            break;  // Timeout
-        }
-        int remaining = timeout_ms - (int)elapsed;
+    if (pc->first_resp_ns == 0) {
+        pc->first_resp_ns = rx_ns;
+    }
+    pc->last_resp_ns = rx_ns;
 
-        // Poll for incoming packets
-        struct pollfd pfd;
-        pfd.fd = state->rx_socket;
-        pfd.events = POLLIN;
+    pthread_spin_lock(&state->stats_lock);
+    if (state->stats.resp_latency_samples == 0 || lat_us < state->stats.resp_latency_min_us) {
+        state->stats.resp_latency_min_us = lat_us;
+    }
+    if (lat_us > state->stats.resp_latency_max_us) {
+        state->stats.resp_latency_max_us = lat_us;
+    }
+    state->stats.resp_latency_sum_us += lat_us;
+    state->stats.resp_latency_samples++;
+    pthread_spin_unlock(&state->stats_lock);
+}
 
-        int ret = poll(&pfd, 1, remaining);
-        if (ret < 0) {
-            if (errno == EINTR) continue;
-            fprintf(stderr, "[HEALTH] Poll error: %s\n", strerror(errno));
-            break;
-        }
+/**
+ * Close the current cycle: update stats, hand the data to the render thread
+ */
+static void finish_cycle(struct health_pending_cycle *pc)
+{
+    struct health_monitor_state *state = &g_health_monitor;
+
+    if (!pc->open) {
+        return;
+    }
+    pc->open = false;
+    arm_timer(state->deadline_timer_fd, 0, 0);  // Disarm
+
+    uint64_t end_ms = get_time_ms();
+    uint64_t cycle_time = end_ms - pc->start_ms;
+
+    // Compact sample into the history ring (analysis runs on render thread)
+    health_history_record(&pc->data, end_ms);
+
+    pthread_spin_lock(&state->stats_lock);
+    state->stats.responses_received += pc->data.total_responses_received;
+    state->stats.unexpected_packets += pc->data.unexpected_packets;
+    state->stats.last_cycle_time_ms = cycle_time;
+    state->stats.last_response_count = pc->data.total_responses_received;
+    if (pc->first_resp_ns != 0) {
+        state->stats.last_first_latency_us = (pc->first_resp_ns - pc->sent_ns) / 1000;
+        state->stats.last_latency_us = (pc->last_resp_ns - pc->sent_ns) / 1000;
+    }
+    if (pc->data.total_responses_received < HEALTH_MONITOR_EXPECTED_RESPONSES) {
+        state->stats.timeouts++;
+    }
+    pthread_spin_unlock(&state->stats_lock);
+
+    // Publish for the render thread (it prints at its own pace)
+    pthread_mutex_lock(&state->render_lock);
+    memcpy(&state->render_cycle, &pc->data, sizeof(pc->data));
+    state->render_seq++;
+    pthread_mutex_unlock(&state->render_lock);
+
+    // Increment sequence (255 -> 1, skip 0)
+    if (state->sequence >= 255) {
+        state->sequence = 1;
+    } else {
+        state->sequence++;
+    }
+}
+
+static void start_cycle(struct health_pending_cycle *pc)
+{
+    struct health_monitor_state *state = &g_health_monitor;
+
+    // Previous cycle still open: response window ran into the next query
+    finish_cycle(pc);
+
+    memset(&pc->data, 0, sizeof(pc->data));
+    pc->first_resp_ns = 0;
+    pc->last_resp_ns = 0;
+    pc->start_ms = get_time_ms();
+
+    if (send_health_query(&pc->sent_ns) < 0) {
+        return;  // Retried on next timer tick
+    }
+
+    pthread_spin_lock(&state->stats_lock);
+    state->stats.queries_sent++;
+    state->stats.current_sequence = state->sequence;
+    pthread_spin_unlock(&state->stats_lock);
+
+    pc->open = true;
+
+    uint32_t timeout_ms = HEALTH_MONITOR_RESPONSE_TIMEOUT_MS;
+    if (timeout_ms >= state->interval_ms) {
+        timeout_ms = 0;  // Closed by the next query tick
+    }
+    if (timeout_ms > 0) {
+        arm_timer(state->deadline_timer_fd, timeout_ms, 0);
+    }
+}
 
-        if (ret == 0) {
-            break;  // Timeout
+/**
+ * Read all pending responses in recvmmsg batches
+ */
+static void receive_health_batch(struct health_pending_cycle *pc)
+{
+    struct health_monitor_state *state = &g_health_monitor;
+    static uint8_t buffers[HEALTH_MONITOR_RX_BATCH][HEALTH_MONITOR_RX_BUFFER_SIZE];
+    static uint8_t cmsg_buf[HEALTH_MONITOR_RX_BATCH][CMSG_SPACE(sizeof(struct timespec))];
+    struct mmsghdr msgs[HEALTH_MONITOR_RX_BATCH];
+    struct iovec iovs[HEALTH_MONITOR_RX_BATCH];
+
+    for (;;) {
+        memset(msgs, 0, sizeof(msgs));
+        for (int i = 0; i < HEALTH_MONITOR_RX_BATCH; i++) {
+            iovs[i].iov_base = buffers[i];
+            iovs[i].iov_len = HEALTH_MONITOR_RX_BUFFER_SIZE;
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_control = cmsg_buf[i];
+            msgs[i].msg_hdr.msg_controllen = sizeof(cmsg_buf[i]);
         }
 
-        if (pfd.revents & POLLIN) {
-            ssize_t len = recv(state->rx_socket, buffer, sizeof(buffer), 0);
-            if (len < 0) {
-                if (errno == EINTR || errno == EAGAIN) continue;
+        int n = recvmmsg(state->rx_socket, msgs, HEALTH_MONITOR_RX_BATCH, MSG_DONTWAIT, NULL);
+        if (n <= 0) {
+            if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
                 fprintf(stderr, "[HEALTH] Recv error: %s\n", strerror(errno));
-                break;
             }
+            return;
+        }
+
+        uint64_t now_ns = get_realtime_ns();
 
-            // Check if this is a health response and parse it
-            if (is_health_response(buffer, len)) {
-                printf("[HEALTH-DBG] Accepted packet: %zd bytes\n", len);
-                health_parse_response(buffer, len, cycle);
+        for (int i = 0; i < n; i++) {
+            size_t len = msgs[i].msg_len;
+            if (!pc->open || !is_health_response(buffers[i], len)) {
+                continue;  // Late response or non-health packet
+            }
+
+            // Kernel RX timestamp (SO_TIMESTAMPNS), else time of recvmmsg
+            uint64_t rx_ns = now_ns;
+            for (struct cmsghdr *cm = CMSG_FIRSTHDR(&msgs[i].msg_hdr); cm;
+                 cm = CMSG_NXTHDR(&msgs[i].msg_hdr, cm)) {
+                if (cm->cmsg_level == SOL_SOCKET && cm->cmsg_type == SCM_TIMESTAMPNS) {
+                    struct timespec ts;
+                    memcpy(&ts, CMSG_DATA(cm), sizeof(ts));
+                    rx_ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+                }
+            }
+
+            uint8_t before = pc->data.total_responses_received;
+            health_parse_response(buffers[i], len, &pc->data);
+            if (pc->data.total_responses_received != before) {
+                record_response_latency(pc, rx_ns);
             }
-            // else: ignore non-health packets (PRBS traffic etc.)
         }
-    }
 
-    return 0;
+        if (pc->open && pc->data.total_responses_received >= HEALTH_MONITOR_EXPECTED_RESPONSES) {
+            finish_cycle(pc);
+        }
+
+        if (n < HEALTH_MONITOR_RX_BATCH) {
+            return;
+        }
+    }
 }
 
 // ==========================================
-// THREAD FUNCTION
+// THREAD FUNCTIONS
 // ==========================================
 
 static void *health_monitor_thread_func(void *arg)
 {
     (void)arg;
     struct health_monitor_state *state = &g_health_monitor;
-    struct health_cycle_data cycle;
+    static struct health_pending_cycle pc;
+    struct epoll_event events[4];
 
+    memset(&pc, 0, sizeof(pc));
     printf("[HEALTH] Thread started\n");
 
+    // First query immediately, then every interval_ms
+    arm_timer(state->query_timer_fd, 1, state->interval_ms);
+
     while (!(*g_stop_flag) && state->running) {
-        uint64_t cycle_start = get_time_ms();
+        // Bounded wait so the global stop flag is noticed
+        int n = epoll_wait(state->epoll_fd, events, 4, 100);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            fprintf(stderr, "[HEALTH] epoll_wait error: %s\n", strerror(errno));
+            break;
+        }
 
-        // 1. Reset cycle data
-        memset(&cycle, 0, sizeof(cycle));
+        for (int i = 0; i < n; i++) {
+            int fd = events[i].data.fd;
+            uint64_t ticks;
+
+            if (fd == state->rx_socket) {
+                receive_health_batch(&pc);
+            } else if (fd == state->query_timer_fd) {
+                if (read(fd, &ticks, sizeof(ticks)) == (ssize_t)sizeof(ticks)) {
+                    start_cycle(&pc);
+                }
+            } else if (fd == state->deadline_timer_fd) {
+                if (read(fd, &ticks, sizeof(ticks)) == (ssize_t)sizeof(ticks)) {
+                    finish_cycle(&pc);
+                }
+            } else if (fd == state->wake_fd) {
+                // Stop request, running flag is checked by the loop
+                ssize_t ret = read(fd, &ticks, sizeof(ticks));
+                (void)ret;
+            }
+        }
+    }
+
+    arm_timer(state->query_timer_fd, 0, 0);
+    finish_cycle(&pc);
 
-        // 2. Send query
-        if (send_health_query() < 0) {
-            // Error sending, wait and retry
-            usleep(100000);  // 100ms
-            continue;
+    printf("[HEALTH] Thread stopped\n");
+    return NULL;
+}
+
+static void health_csv_signal_handler(int sig)
+{
+    (void)sig;
+    g_csv_dump_requested = 1;
+}
+
+static void *health_render_thread_func(void *arg)
+{
+    (void)arg;
+    struct health_monitor_state *state = &g_health_monitor;
+    static struct health_cycle_data cycle;
+    uint64_t printed_seq = 0;
+    uint64_t last_summary_ms = get_time_ms();
+
+    pthread_mutex_lock(&state->render_lock);
+    while (state->running) {
+        struct timespec deadline;
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += HEALTH_MONITOR_RENDER_INTERVAL_MS / 1000;
+        deadline.tv_nsec += (long)(HEALTH_MONITOR_RENDER_INTERVAL_MS % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
         }
+        pthread_cond_timedwait(&state->render_cond, &state->render_lock, &deadline);
 
-        // Update stats
-        pthread_spin_lock(&state->stats_lock);
-        state->stats.queries_sent++;
-        state->stats.current_sequence = state->sequence;
-        pthread_spin_unlock(&state->stats_lock);
+        if (!state->running) {
+            break;
+        }
 
-        // 3. Receive and parse responses
-        receive_health_responses(HEALTH_MONITOR_RESPONSE_TIMEOUT_MS, &cycle);
+        bool have_new = (state->render_seq != printed_seq);
+        if (have_new) {
+            memcpy(&cycle, &state->render_cycle, sizeof(cycle));
+            printed_seq = state->render_seq;
+        }
 
-        uint64_t cycle_end = get_time_ms();
-        uint64_t cycle_time = cycle_end - cycle_start;
+        // Print without holding the lock (console may block)
+        pthread_mutex_unlock(&state->render_lock);
 
-        // 4. Print parsed data tables (Assistant + Manager)
-        health_print_tables(&cycle);
+        // Every cycle since last wake: deltas, rates, alarms
+        health_history_analyze();
 
-        // 5. Update statistics
-        pthread_spin_lock(&state->stats_lock);
-        state->stats.responses_received += cycle.total_responses_received;
-        state->stats.last_cycle_time_ms = cycle_time;
-        state->stats.last_response_count = cycle.total_responses_received;
-        if (cycle.total_responses_received < HEALTH_MONITOR_EXPECTED_RESPONSES) {
-            state->stats.timeouts++;
+        if (have_new) {
+            health_print_tables(&cycle);
         }
-        pthread_spin_unlock(&state->stats_lock);
 
-        // 6. Increment sequence (255 -> 1, skip 0)
-        if (state->sequence >= 255) {
-            state->sequence = 1;
-        } else {
-            state->sequence++;
+        uint64_t now_ms = get_time_ms();
+        if (now_ms - last_summary_ms >= HEALTH_HISTORY_SUMMARY_INTERVAL_MS) {
+            health_history_print_summary();
+            last_summary_ms = now_ms;
         }
 
-        // 7. Wait for remaining time to complete 1 second interval
-        uint64_t elapsed = get_time_ms() - cycle_start;
-        if (elapsed < HEALTH_MONITOR_QUERY_INTERVAL_MS) {
-            usleep((HEALTH_MONITOR_QUERY_INTERVAL_MS - elapsed) * 1000);
+        if (g_csv_dump_requested) {
+            g_csv_dump_requested = 0;
+            health_history_dump_csv(HEALTH_HISTORY_CSV_PATH);
         }
+
+        pthread_mutex_lock(&state->render_lock);
     }
+    pthread_mutex_unlock(&state->render_lock);
+
+    // Alarms of the last cycles
+    health_history_analyze();
 
-    printf("[HEALTH] Thread stopped\n");
     return NULL;
 }
 
@@ -688,7 +955,8 @@ int init_health_monitor(void)
 
     printf("\n=== Initializing Health Monitor ===\n");
     printf("  Interface: %s\n", HEALTH_MONITOR_INTERFACE);
-    printf("  Query interval: %d ms\n", HEALTH_MONITOR_QUERY_INTERVAL_MS);
+    printf("  Query interval: %d ms (min %d ms)\n",
+           HEALTH_MONITOR_QUERY_INTERVAL_MS, HEALTH_MONITOR_MIN_INTERVAL_MS);
     printf("  Response timeout: %d ms\n", HEALTH_MONITOR_RESPONSE_TIMEOUT_MS);
     printf("  Expected responses: %d (Assistant=%d + Manager=%d + MCU=%d)\n",
            HEALTH_MONITOR_EXPECTED_RESPONSES,
@@ -700,18 +968,38 @@ int init_health_monitor(void)
     memset(state, 0, sizeof(*state));
     state->tx_socket = -1;
     state->rx_socket = -1;
+    state->epoll_fd = -1;
+    state->query_timer_fd = -1;
+    state->deadline_timer_fd = -1;
+    state->wake_fd = -1;
     state->sequence = HEALTH_MONITOR_SEQ_INIT;
     state->running = false;
+    state->interval_ms = HEALTH_MONITOR_QUERY_INTERVAL_MS;
+    if (state->interval_ms < HEALTH_MONITOR_MIN_INTERVAL_MS) {
+        state->interval_ms = HEALTH_MONITOR_MIN_INTERVAL_MS;
+    }
 
     // Copy query template
     memcpy(state->query_packet, health_query_template, HEALTH_MONITOR_QUERY_SIZE);
 
+    // History ring; SIGUSR1 dumps it to HEALTH_HISTORY_CSV_PATH
+    health_history_reset();
+    signal(SIGUSR1, health_csv_signal_handler);
+
     // Initialize stats lock
     if (pthread_spin_init(&state->stats_lock, PTHREAD_PROCESS_PRIVATE) != 0) {
         fprintf(stderr, "[HEALTH] Failed to init stats lock\n");
         return -1;
     }
 
+    // Render hand-off (monotonic timed wait)
+    pthread_condattr_t cattr;
+    pthread_condattr_init(&cattr);
+    pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+    pthread_cond_init(&state->render_cond, &cattr);
+    pthread_condattr_destroy(&cattr);
+    pthread_mutex_init(&state->render_lock, NULL);
+
     // Get interface index
     state->if_index = get_interface_index(HEALTH_MONITOR_INTERFACE);
     if (state->if_index < 0) {
@@ -720,8 +1008,8 @@ int init_health_monitor(void)
     }
     printf("  Interface index: %d\n", state->if_index);
 
-    // Create TX socket
-    state->tx_socket = create_raw_socket(HEALTH_MONITOR_INTERFACE, state->if_index);
+    // Create TX socket (no RX queue)
+    state->tx_socket = create_raw_socket(state->if_index, 0);
     if (state->tx_socket < 0) {
         fprintf(stderr, "[HEALTH] Failed to create TX socket\n");
         return -1;
@@ -729,15 +1017,40 @@ int init_health_monitor(void)
     printf("  TX socket created: fd=%d\n", state->tx_socket);
 
     // Create RX socket (separate from TX for clean separation)
-    state->rx_socket = create_raw_socket(HEALTH_MONITOR_INTERFACE, state->if_index);
+    state->rx_socket = create_raw_socket(state->if_index, ETH_P_ALL);
     if (state->rx_socket < 0) {
         fprintf(stderr, "[HEALTH] Failed to create RX socket\n");
-        close(state->tx_socket);
-        state->tx_socket = -1;
+        close_health_fds(state);
         return -1;
     }
     printf("  RX socket created: fd=%d\n", state->rx_socket);
 
+    if (attach_health_filter(state->rx_socket) == 0) {
+        printf("  BPF filter attached: VL_IDX 0x%04X only\n", HEALTH_MONITOR_RESPONSE_VL_IDX);
+    }
+
+    int on = 1;
+    if (setsockopt(state->rx_socket, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) < 0) {
+        fprintf(stderr, "[HEALTH] Warning: SO_TIMESTAMPNS not available, latency uses user time\n");
+    }
+
+    // Event loop
+    state->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    state->query_timer_fd = create_timer_fd();
+    state->deadline_timer_fd = create_timer_fd();
+    state->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (state->epoll_fd < 0 || state->query_timer_fd < 0 ||
+        state->deadline_timer_fd < 0 || state->wake_fd < 0 ||
+        epoll_add(state->epoll_fd, state->rx_socket) < 0 ||
+        epoll_add(state->epoll_fd, state->query_timer_fd) < 0 ||
+        epoll_add(state->epoll_fd, state->deadline_timer_fd) < 0 ||
+        epoll_add(state->epoll_fd, state->wake_fd) < 0) {
+        fprintf(stderr, "[HEALTH] Failed to set up event loop: %s\n", strerror(errno));
+        close_health_fds(state);
+        return -1;
+    }
+
     printf("[HEALTH] Initialization complete\n");
     return 0;
 }
@@ -751,7 +1064,7 @@ int start_health_monitor(volatile bool *stop_flag)
         return -1;
     }
 
-    if (state->tx_socket < 0 || state->rx_socket < 0) {
+    if (state->tx_socket < 0 || state->rx_socket < 0 || state->epoll_fd < 0) {
         fprintf(stderr, "[HEALTH] Not initialized\n");
         return -1;
     }
@@ -766,7 +1079,13 @@ int start_health_monitor(volatile bool *stop_flag)
         return -1;
     }
 
-    printf("[HEALTH] Started\n");
+    if (pthread_create(&state->render_thread, NULL, health_render_thread_func, NULL) != 0) {
+        fprintf(stderr, "[HEALTH] Failed to create render thread: %s\n", strerror(errno));
+        stop_health_monitor();
+        return -1;
+    }
+
+    printf("[HEALTH] Started (interval %u ms)\n", state->interval_ms);
     return 0;
 }
 
@@ -781,9 +1100,26 @@ void stop_health_monitor(void)
     printf("[HEALTH] Stopping...\n");
     state->running = false;
 
+    // Wake event loop (epoll_wait timeout ends it otherwise)
+    uint64_t one = 1;
+    ssize_t ret = write(state->wake_fd, &one, sizeof(one));
+    (void)ret;
+
     // Wait for thread to finish
     pthread_join(state->thread, NULL);
 
+    // Wake and join render thread
+    pthread_mutex_lock(&state->render_lock);
+    pthread_cond_signal(&state->render_cond);
+    pthread_mutex_unlock(&state->render_lock);
+    if (state->render_thread) {
+        pthread_join(state->render_thread, NULL);
+        state->render_thread = 0;
+    }
+
+    // Final history summary (both threads joined)
+    health_history_print_summary();
+
     printf("[HEALTH] Stopped\n");
 }
 
@@ -796,23 +1132,36 @@ void cleanup_health_monitor(void)
         stop_health_monitor();
     }
 
-    // Close sockets
-    if (state->tx_socket >= 0) {
-        close(state->tx_socket);
-        state->tx_socket = -1;
-    }
-
-    if (state->rx_socket >= 0) {
-        close(state->rx_socket);
-        state->rx_socket = -1;
-    }
+    // Close event loop fds and sockets
+    close_health_fds(state);
 
-    // Destroy lock
+    // Destroy locks
     pthread_spin_destroy(&state->stats_lock);
+    pthread_mutex_destroy(&state->render_lock);
+    pthread_cond_destroy(&state->render_cond);
 
     printf("[HEALTH] Cleanup complete\n");
 }
 
+int set_health_monitor_interval(uint32_t interval_ms)
+{
+    struct health_monitor_state *state = &g_health_monitor;
+
+    if (interval_ms < HEALTH_MONITOR_MIN_INTERVAL_MS) {
+        fprintf(stderr, "[HEALTH] Interval %u ms below minimum %d ms\n",
+                interval_ms, HEALTH_MONITOR_MIN_INTERVAL_MS);
+        return -1;
+    }
+
+    state->interval_ms = interval_ms;
+    if (state->running && state->query_timer_fd >= 0) {
+        arm_timer(state->query_timer_fd, interval_ms, interval_ms);
+    }
+
+    printf("[HEALTH] Query interval set to %u ms\n", interval_ms);
+    return 0;
+}
+
 void get_health_monitor_stats(struct health_monitor_stats *stats)
 {
     struct health_monitor_state *state = &g_health_monitor;
@@ -838,6 +1187,22 @@ void print_health_monitor_stats(void)
            success_rate,
            (unsigned long)stats.timeouts,
            stats.current_sequence);
+
+    if (stats.resp_latency_samples > 0) {
+        printf("[HEALTH] Latency: first=%luus last=%luus | per-response min=%luus avg=%luus max=%luus\n",
+               (unsigned long)stats.last_first_latency_us,
+               (unsigned long)stats.last_latency_us,
+               (unsigned long)stats.resp_latency_min_us,
+               (unsigned long)(stats.resp_latency_sum_us / stats.resp_latency_samples),
+               (unsigned long)stats.resp_latency_max_us);
+    }
+    if (stats.unexpected_packets > 0) {
+        printf("[HEALTH] Unexpected packets: %lu\n", (unsigned long)stats.unexpected_packets);
+    }
+    if (health_history_alarm_count() > 0) {
+        printf("[HEALTH] Alarms: %lu (history: kill -USR1 -> %s)\n",
+               (unsigned long)health_history_alarm_count(), HEALTH_HISTORY_CSV_PATH);
+    }
 }
 
 bool is_health_monitor_running(void)
@@ -10,6 +10,10 @@
 #include "tx_rx_manager.h"  // rx_stats_per_port için
 #include "dpdk_external_tx.h" // External TX stats için
 #include "raw_socket_port.h"  // reset_raw_socket_stats için
+#include "traffic_profile.h"  // IMIX boyut bazlı sayaçlar
+#include "pcap_replay.h"      // Replay hız / zamanlama hatası
+#include "adaptive_poll.h"    // Idle seviyesi / kazanılan core zamanı
+#include "rx_flow_steer.h"    // Queue başına RX payı (rte_flow steering)
 
 // Daemon mode flag - when true, ANSI escape codes are disabled
 bool g_daemon_mode = false;
@@ -39,6 +43,17 @@ void helper_reset_stats(const struct ports_config *ports_config,
 
     // Raw socket ve global sequence tracking sıfırla
     reset_raw_socket_stats();
+
+#if IMIX_ENABLED
+    // IMIX boyut bazlı TX/RX sayaçları
+    traffic_profile_reset_stats();
+#endif
+#if PCAP_REPLAY_ENABLED
+    pcap_replay_reset_stats();
+#endif
+#if ADAPTIVE_POLL_ENABLED
+    adaptive_poll_reset_stats();
+#endif
 }
 
 void helper_print_stats(const struct ports_config *ports_config,
@@ -116,6 +131,23 @@ void helper_print_stats(const struct ports_config *ports_config,
 
     printf("└──────┴─────────────────────┴─────────────────────┴─────────────────────────┴─────────────────────┴─────────────────────┴─────────────────────────┴─────────────────────┴─────────────────────┴─────────────────────┴─────────────────────┴─────────────┘\n");
 
+#if IMIX_ENABLED
+    // Boyut bazlı TX/RX dağılımı + hedef hız kontrolü
+    traffic_profile_print_stats(ports_config);
+#endif
+#if PCAP_REPLAY_ENABLED
+    // Replay: gerçekleşen / beklenen hız + zamanlama hatası yüzdelikleri
+    pcap_replay_print_stats(ports_config);
+#endif
+#if ADAPTIVE_POLL_ENABLED
+    // Worker başına kazanılan core zamanı ve uyanma gecikmesi
+    adaptive_poll_print_stats();
+#endif
+#if RX_FLOW_STEERING
+    // VL-ID -> queue steering: kural sayısı ve queue dengesi
+    rx_flow_steer_print_stats(ports_config);
+#endif
+
     // Uyarılar
     bool has_warning = false;
     for (uint16_t i = 0; i < ports_config->nb_ports; i++) {
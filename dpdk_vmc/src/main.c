@@ -8,6 +8,7 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <string.h>
+#include <pthread.h>
 
 #include "helpers.h" // helper_reset_stats, helper_print_stats, signal_handler / force_quit
 #include "port_manager.h"
@@ -20,6 +21,15 @@
 #include "embedded_latency/embedded_latency.h"  // Embedded HW timestamp latency test
 #include "ptp_slave.h"        // PTP slave for IEEE 1588v2 synchronization
 #include "health_monitor.h"   // Health monitor for DTN status queries
+#include "sw_harness.h"        // NIC-free throughput harness (net_ring / net_null)
+#include "placement.h"         // NUMA / SMT aware lcore placement
+#include "traffic_profile.h"   // IMIX traffic profile engine
+#include "capture_ring.h"      // Trigger-on-error pcap capture
+#include "pcap_replay.h"       // Pcap replay TX
+#include "startup_trace.h"     // Per-step init time + time to first packet
+#include "capacity.h"          // Runtime port / queue / lcore capacity
+#include "stats_shm.h"         // Counters in memzones for the secondary stats reader
+#include "vmc_role.h"          // Verifier / forwarder role (--role)
 
 // Enable/disable raw socket ports
 #ifndef ENABLE_RAW_SOCKET_PORTS
@@ -31,18 +41,18 @@
 #define EMBEDDED_HW_LATENCY_TEST 0
 #endif
 
-// Check if --daemon flag is present and remove it from argv
-// Returns true if --daemon was found, also updates argc
-static bool check_and_remove_daemon_flag(int *argc, char const *argv[]) {
+// App options are taken out of argv before EAL init (EAL rejects unknown
+// options). Every occurrence is removed.
+
+// Remove flag `name` from argv, returns true if it was present
+static bool strip_flag(int *argc, char const *argv[], const char *name) {
     bool found = false;
     int new_argc = 0;
 
     for (int i = 0; i < *argc; i++) {
-        if (strcmp(argv[i], "--daemon") == 0 || strcmp(argv[i], "-d") == 0) {
+        if (strcmp(argv[i], name) == 0) {
             found = true;
-            // Skip this argument (don't copy to new position)
         } else {
-            // Keep this argument
             argv[new_argc] = argv[i];
             new_argc++;
         }
@@ -52,6 +62,58 @@ static bool check_and_remove_daemon_flag(int *argc, char const *argv[]) {
     return found;
 }
 
+// Remove `name <value>` / `name=<value>` from argv, returns the last value
+// (NULL if not given)
+static const char *strip_opt(int *argc, char const *argv[], const char *name) {
+    const char *value = NULL;
+    size_t len = strlen(name);
+    int new_argc = 0;
+
+    for (int i = 0; i < *argc; i++) {
+        if (strncmp(argv[i], name, len) == 0 && argv[i][len] == '=') {
+            value = argv[i] + len + 1;
+        } else if (strcmp(argv[i], name) == 0 && i + 1 < *argc) {
+            value = argv[++i];
+        } else {
+            argv[new_argc] = argv[i];
+            new_argc++;
+        }
+    }
+
+    *argc = new_argc;
+    return value;
+}
+
+#if ENABLE_RAW_SOCKET_PORTS
+// Parallel init: raw socket ports (AF_PACKET rings + their own PRBS caches,
+// no DPDK calls) are set up in a thread next to the DPDK port configuration
+static pthread_t raw_init_thread;
+static bool raw_init_running = false;
+static int raw_init_ret = -1;
+
+static void *raw_socket_init_thread(void *arg)
+{
+    (void)arg;
+    uint64_t start_ns = startup_trace_now_ns();
+    raw_init_ret = init_raw_socket_ports();
+    startup_trace_task("raw_socket", -1, start_ns, startup_trace_now_ns());
+    return NULL;
+}
+#endif
+
+// Parallel init: wait for the PRBS lcores and the raw socket thread
+// (before any worker starts, and before cleanup on an error path)
+static void parallel_init_join(void)
+{
+    prbs_cache_wait();
+#if ENABLE_RAW_SOCKET_PORTS
+    if (raw_init_running) {
+        pthread_join(raw_init_thread, NULL);
+        raw_init_running = false;
+    }
+#endif
+}
+
 // Global force_quit definition (declared as extern in common.h)
 volatile bool force_quit = false;
 
@@ -59,16 +121,38 @@ int main(int argc, char const *argv[])
 {
     // Check for --daemon flag BEFORE anything else, and remove it from argv
     // so it doesn't confuse DPDK EAL argument parser
-    bool daemon_mode = check_and_remove_daemon_flag(&argc, argv);
+    bool daemon_mode = strip_flag(&argc, argv, "--daemon") | strip_flag(&argc, argv, "-d");
+    // --placement-dry-run: print the lcore plan and exit
+    bool placement_dry_run = strip_flag(&argc, argv, "--placement-dry-run") || PLACEMENT_DRY_RUN;
+    // --imix-profile <spec>: NULL -> IMIX_PROFILE default
+    const char *imix_profile = strip_opt(&argc, argv, "--imix-profile");
+    // --replay <file.pcap>: NULL -> PCAP_REPLAY_FILE
+    const char *replay_file = strip_opt(&argc, argv, "--replay");
+    // --serial-init: old sequential init in a STARTUP_PARALLEL_INIT=1 binary (A/B)
+    bool serial_init = strip_flag(&argc, argv, "--serial-init");
+    bool parallel_init = STARTUP_PARALLEL_INIT && !serial_init;
+    // --role <verifier|forwarder>
+    const char *role_name = strip_opt(&argc, argv, "--role");
+
+    startup_trace_init(parallel_init);
+
+    // Role first: VLAN tables, pools, placement and workers all depend on it
+    enum vmc_role role = VMC_ROLE_DEFAULT;
+    if (role_name != NULL && vmc_role_parse(role_name, &role) != 0) {
+        printf("Error: Unknown --role '%s' (verifier or forwarder)\n", role_name);
+        return -1;
+    }
+    vmc_role_set(role);
+    port_vlans_load_config(false);
 
     // Set daemon mode flag for helper functions (disables ANSI escape codes in logs)
     helper_set_daemon_mode(daemon_mode);
 
-#if FORWARD_MODE
-    printf("=== DPDK VMC_2 Forward Mode (Loopback to VMC_1) ===\n");
-#else
-    printf("=== DPDK TX/RX Application with PRBS-31 & Sequence Validation ===\n");
-#endif
+    if (vmc_role_forwarder())
+        printf("=== DPDK VMC_2 Forward Mode (Loopback to VMC_1) ===\n");
+    else
+        printf("=== DPDK TX/RX Application with PRBS-31 & Sequence Validation ===\n");
+    printf("Role: %s (--role verifier|forwarder)\n", vmc_role_name(g_vmc_role));
     if (daemon_mode) {
         printf("Mode: DAEMON (will fork to background after latency tests)\n");
     } else {
@@ -84,7 +168,7 @@ int main(int argc, char const *argv[])
     );
     printf("PRBS Method: Sequence-based with ~268MB cache per port\n");
     printf("Payload format: [8-byte sequence][PRBS-31 data]\n");
-    printf("Mode: Forward (loopback) - no warm-up\n");
+    printf("Mode: %s\n", vmc_role_forwarder() ? "Forward (loopback) - no warm-up" : "No warm-up");
     printf("Sequence Validation: Enabled (Lost/Out-of-Order/Duplicate detection)\n");
 #if ENABLE_RAW_SOCKET_PORTS
     printf("Raw Socket Ports: Enabled (%d ports, multi-target)\n", MAX_RAW_SOCKET_PORTS);
@@ -103,6 +187,8 @@ int main(int argc, char const *argv[])
     // Full sequence: Loopback (switch) + Unit Test (device) + Combined Results
     // =========================================================================
 #if EMBEDDED_HW_LATENCY_TEST
+    startup_trace_phase("emb_latency");
+
     // Full interactive sequence:
     // 1. Loopback test (Mellanox switch latency) - or use default 14µs
     // 2. Unit test (device latency) - port pairs 0↔1, 2↔3, 4↔5, 6↔7
@@ -179,8 +265,19 @@ int main(int argc, char const *argv[])
     }
 
     // Initialize DPDK EAL
+    startup_trace_phase("eal_init");
     initialize_eal(argc, argv);
 
+#if SW_HARNESS_ENABLED
+    // NIC-free harness: vdevs must exist before initialize_ports scans them
+    if (sw_harness_create_ports() != 0)
+    {
+        printf("Error: Failed to create SW harness ports\n");
+        cleanup_eal();
+        return -1;
+    }
+#endif
+
     // Setup signal handlers
     signal(SIGINT, signal_handler);
     signal(SIGTERM, signal_handler);
@@ -188,7 +285,16 @@ int main(int argc, char const *argv[])
     // Print basic EAL info
     print_eal_info();
 
+    // Ports / lcores per socket actually present
+    capacity_discover();
+
+#if STATS_SHM_ENABLED
+    // Counter arrays into memzones before anything holds a pointer into them
+    stats_shm_init();
+#endif
+
     // Initialize ports
+    startup_trace_phase("port_discovery");
     int nb_ports = initialize_ports(&ports_config);
     if (nb_ports < 0)
     {
@@ -203,33 +309,102 @@ int main(int argc, char const *argv[])
     set_manual_pci_addresses(&ports_config);
     portNumaNodesMatch(&ports_config);
 
+    // Queue limits of every port, worker lcores vs EAL lcore set
+    if (capacity_check(&ports_config) != 0)
+    {
+        printf("Error: Port queue counts exceed device limits\n");
+        cleanup_ports(&ports_config);
+        cleanup_eal();
+        return -1;
+    }
+
     // Setup socket to lcore mapping
     socketToLcore();
 
     // Assign lcores to ports
+#if PLACEMENT_ENABLED
+    if (placement_assign(&ports_config) != 0 && !placement_dry_run)
+    {
+        printf("Error: Lcore placement failed\n");
+        cleanup_ports(&ports_config);
+        cleanup_eal();
+        return -1;
+    }
+#else
     lcorePortAssign(&ports_config);
+#endif
+
+    if (placement_dry_run)
+    {
+        printf("\n=== Placement dry run, exiting before allocation ===\n");
+        cleanup_ports(&ports_config);
+        cleanup_eal();
+        return 0;
+    }
 
     // Initialize VLAN configuration + print
+    startup_trace_phase("vlan_stats_imix");
     init_vlan_config();
     print_vlan_config();
 
     // Initialize RX verification stats (PRBS good/bad/bit_errors + sequence stats)
     init_rx_stats();
 
-#if FORWARD_MODE
-    printf("\n=== FORWARD MODE: Skipping PRBS-31 Cache (not needed for loopback) ===\n\n");
+#if IMIX_ENABLED
+    // IMIX profile: size sequence + exact mean, before any TX worker starts
+    if (traffic_profile_load(imix_profile) != 0)
+    {
+        printf("Error: Failed to load IMIX profile\n");
+        cleanup_ports(&ports_config);
+        cleanup_eal();
+        return -1;
+    }
 #else
+    if (imix_profile != NULL)
+        printf("Warning: --imix-profile ignored (IMIX_ENABLED=0)\n");
+#endif
+
     // *** PRBS-31 CACHE INITIALIZATION ***
-    printf("\n=== Initializing PRBS-31 Cache ===\n");
-    printf("This will take a few minutes as we generate ~%u MB per port...\n",
-           (unsigned)(PRBS_CACHE_SIZE / (1024 * 1024)));
+    if (vmc_role_forwarder())
+    {
+        printf("\n=== FORWARD MODE: Skipping PRBS-31 Cache (not needed for loopback) ===\n\n");
+        if (parallel_init)
+            startup_trace_phase("init_launch");
+    }
+    else if (parallel_init)
+    {
+        // Generated on the idle TX lcores while the ports are configured below
+        startup_trace_phase("init_launch");
+        prbs_cache_start_async((uint16_t)nb_ports, &ports_config);
+    }
+    else
+    {
+        startup_trace_phase("prbs_cache");
+        printf("\n=== Initializing PRBS-31 Cache ===\n");
+        printf("Generating ~%u MB per port...\n",
+               (unsigned)(PRBS_CACHE_SIZE / (1024 * 1024)));
 
-    init_prbs_cache_for_all_ports((uint16_t)nb_ports, &ports_config);
+        init_prbs_cache_for_all_ports((uint16_t)nb_ports, &ports_config);
+
+        printf("PRBS-31 cache initialization complete!\n\n");
+    }
 
-    printf("PRBS-31 cache initialization complete!\n\n");
+#if ENABLE_RAW_SOCKET_PORTS
+    if (parallel_init)
+    {
+        // Load ATE or normal config before initializing ports
+        raw_socket_ports_load_config(ate_mode_enabled());
+
+        printf("\n=== Initializing Raw Socket Ports (Non-DPDK, background thread) ===\n");
+        if (pthread_create(&raw_init_thread, NULL, raw_socket_init_thread, NULL) == 0)
+            raw_init_running = true;
+        else
+            raw_socket_init_thread(NULL);
+    }
 #endif
 
     // Configure TX/RX for each port
+    startup_trace_phase("port_config");
     printf("\n=== Configuring Ports ===\n");
     struct txrx_config txrx_configs[MAX_PORTS];
 
@@ -238,62 +413,47 @@ int main(int argc, char const *argv[])
         uint16_t port_id = ports_config.ports[i].port_id;
         uint16_t socket_id = ports_config.ports[i].numa_node;
 
-        // Create mbuf pool
-        struct rte_mempool *mbuf_pool = create_mbuf_pool(socket_id, port_id);
-        if (mbuf_pool == NULL)
-        {
-            printf("Failed to create mbuf pool for port %u\n", port_id);
-            cleanup_prbs_cache();
-            cleanup_ports(&ports_config);
-            cleanup_eal();
-            return -1;
-        }
-
         // Setup TX/RX configuration
         txrx_configs[i].port_id = port_id;
 
-        // Calculate number of TX queues needed
-        // Base: NUM_TX_CORES (0 to NUM_TX_CORES-1)
-        // External TX: +1 queue (queue 4)
-        // PTP: +1 queue (queue 5)
-        uint16_t num_tx_queues = NUM_TX_CORES;
-
-#if DPDK_EXT_TX_ENABLED
-        // External TX ports need an extra queue (queue 4) for external TX
-        // Port 2,3,4,5 → Port 12 | Port 0,6 → Port 13
-        bool is_ext_tx_port = (port_id == 0 || port_id == 2 || port_id == 3 ||
-                               port_id == 4 || port_id == 5 || port_id == 6);
-        if (is_ext_tx_port) {
-            num_tx_queues = NUM_TX_CORES + 1;  // Extra queue for external TX (queue 4)
-        }
-#endif
-
-#if PTP_ENABLED
-        // PTP needs queue 5 for TX on all ports
-        // Queue 5 comes after external TX queue 4
-        num_tx_queues = (num_tx_queues < 6) ? 6 : num_tx_queues;  // Ensure queue 5 exists
-#endif
+        // NUM_TX_CORES (+1 external TX queue 4, queue 5 with PTP) / NUM_RX_CORES (queue 5 with PTP)
+        uint16_t num_tx_queues = capacity_port_tx_queues(port_id);
+        uint16_t num_rx_queues = capacity_port_rx_queues(port_id);
 
         txrx_configs[i].nb_tx_queues = num_tx_queues;
+        txrx_configs[i].nb_rx_queues = num_rx_queues;
 
-        // Calculate number of RX queues needed
-        // Base: NUM_RX_CORES (0 to NUM_RX_CORES-1)
-        // PTP: +1 queue (queue 5)
-        uint16_t num_rx_queues = NUM_RX_CORES;
-
-#if PTP_ENABLED
-        // PTP needs queue 5 for RX on all ports
-        num_rx_queues = (num_rx_queues < 6) ? 6 : num_rx_queues;  // Ensure queue 5 exists
+        // Separate RX / TX mbuf pools on the port's socket, sized from the queue counts
+        struct rte_mempool *rx_pool = create_mbuf_pool(socket_id, port_id, MBUF_POOL_RX,
+                                                       num_rx_queues);
+        struct rte_mempool *tx_pool = rx_pool ? create_mbuf_pool(socket_id, port_id, MBUF_POOL_TX,
+                                                                 num_tx_queues) : NULL;
+#if PRBS_EXTBUF_TX_ENABLED
+        // Payload segments for zero-copy PRBS TX, one per TX mbuf in flight
+        if (tx_pool != NULL &&
+            create_mbuf_pool(socket_id, port_id, MBUF_POOL_TX_EXTBUF, num_tx_queues) == NULL)
+            tx_pool = NULL;
 #endif
+        if (rx_pool == NULL || tx_pool == NULL)
+        {
+            printf("Failed to create mbuf pools for port %u\n", port_id);
+            parallel_init_join();
+            cleanup_prbs_cache();
+            cleanup_ports(&ports_config);
+            cleanup_eal();
+            return -1;
+        }
 
-        txrx_configs[i].nb_rx_queues = num_rx_queues;
-        txrx_configs[i].mbuf_pool = mbuf_pool;
+        txrx_configs[i].rx_mbuf_pool = rx_pool;
+        txrx_configs[i].tx_mbuf_pool = tx_pool;
+        txrx_configs[i].socket_id = socket_id;
 
         // Initialize port TX/RX
         int ret = init_port_txrx(port_id, &txrx_configs[i]);
         if (ret < 0)
         {
             printf("Failed to initialize TX/RX for port %u\n", port_id);
+            parallel_init_join();
             cleanup_prbs_cache();
             cleanup_ports(&ports_config);
             cleanup_eal();
@@ -301,21 +461,35 @@ int main(int argc, char const *argv[])
         }
     }
 
+    print_mbuf_pool_report();
+
     print_ports_info(&ports_config);
 
     printf("All ports configured\n");
 
+    if (parallel_init)
+    {
+        startup_trace_phase("init_join");
+        parallel_init_join();
+    }
+
 #if ENABLE_RAW_SOCKET_PORTS
     // *** RAW SOCKET PORTS INITIALIZATION ***
-    // Load ATE or normal config before initializing ports
-    raw_socket_ports_load_config(ate_mode_enabled());
+    bool raw_ports_initialized = false;
+    int raw_ret = raw_init_ret;     // Parallel init: already done in the background
+    if (!parallel_init)
+    {
+        startup_trace_phase("raw_socket");
 
-    printf("\n=== Initializing Raw Socket Ports (Non-DPDK) ===\n");
-    printf("These ports use AF_PACKET with zero-copy (PACKET_MMAP)\n");
-    printf("VLAN header: Disabled for raw socket ports\n\n");
+        // Load ATE or normal config before initializing ports
+        raw_socket_ports_load_config(ate_mode_enabled());
 
-    bool raw_ports_initialized = false;
-    int raw_ret = init_raw_socket_ports();
+        printf("\n=== Initializing Raw Socket Ports (Non-DPDK) ===\n");
+        printf("These ports use AF_PACKET with zero-copy (PACKET_MMAP)\n");
+        printf("VLAN header: Disabled for raw socket ports\n\n");
+
+        raw_ret = init_raw_socket_ports();
+    }
     if (raw_ret < 0)
     {
         printf("Warning: Failed to initialize raw socket ports\n");
@@ -329,6 +503,7 @@ int main(int argc, char const *argv[])
 #endif
 
 #if DPDK_EXT_TX_ENABLED
+    startup_trace_phase("ext_tx_init");
     if (!ate_mode_enabled()) {
         // *** DPDK EXTERNAL TX INITIALIZATION (BEFORE start_txrx_workers!) ***
         // Must be called before start_txrx_workers so ext_tx_enabled can be set
@@ -341,8 +516,8 @@ int main(int argc, char const *argv[])
         for (int i = 0; i < DPDK_EXT_TX_PORT_COUNT; i++) {
             uint16_t port_id = ext_configs[i].port_id;
             if (port_id < nb_ports) {
-                ext_mbuf_pools[i] = txrx_configs[port_id].mbuf_pool;
-                printf("  Ext TX Port %u: mbuf_pool from txrx_configs[%u]\n", port_id, port_id);
+                ext_mbuf_pools[i] = txrx_configs[port_id].tx_mbuf_pool;
+                printf("  Ext TX Port %u: TX mbuf pool from txrx_configs[%u]\n", port_id, port_id);
             } else {
                 ext_mbuf_pools[i] = NULL;
                 printf("  Ext TX Port %u: mbuf_pool = NULL (port_id >= nb_ports)\n", port_id);
@@ -377,6 +552,7 @@ int main(int argc, char const *argv[])
 
 #if LATENCY_TEST_ENABLED
     // *** LATENCY TEST - RUNS BEFORE NORMAL MODE ***
+    startup_trace_phase("latency_test");
     printf("\n");
     printf("╔══════════════════════════════════════════════════════════════════╗\n");
     printf("║            LATENCY TEST MODE ENABLED                             ║\n");
@@ -402,20 +578,48 @@ int main(int argc, char const *argv[])
     printf("\n=== Latency test complete, starting normal TX/RX workers ===\n\n");
 #endif
 
-#if FORWARD_MODE
-    int start_ret = start_forward_workers(&ports_config, &force_quit);
-    if (start_ret < 0)
+    startup_trace_phase("worker_start");
+
+#if STATS_SHM_ENABLED
+    // Port list, VL-ID trackers, latency results -> secondary readers
+    stats_shm_publish(&ports_config);
+#endif
+
+#if SW_HARNESS_ENABLED
+    // Fabric lcores (switch / peer VMC stand-in) must run before traffic starts
+    if (sw_harness_start(&ports_config, &force_quit) != 0)
     {
-        printf("Failed to start forward workers\n");
+        printf("Failed to start SW harness\n");
+        cleanup_prbs_cache();
+        cleanup_ports(&ports_config);
+        cleanup_eal();
+        return -1;
+    }
+#endif
+
+    if (vmc_role_forwarder() && (replay_file != NULL || PCAP_REPLAY_ENABLED))
+        printf("Warning: PCAP replay not used in the forwarder role\n");
+
+#if PCAP_REPLAY_ENABLED
+    // Frame table + pre-converted mbufs before the TX lcores pick them up
+    if (!vmc_role_forwarder() && pcap_replay_load(replay_file, &ports_config) != 0)
+    {
+        printf("Failed to load pcap for replay\n");
+        cleanup_prbs_cache();
         cleanup_ports(&ports_config);
         cleanup_eal();
         return -1;
     }
 #else
-    int start_ret = start_txrx_workers(&ports_config, &force_quit);
-    if (start_ret < 0)
+    if (replay_file != NULL && !vmc_role_forwarder())
+        printf("Warning: --replay ignored (PCAP_REPLAY_ENABLED=0)\n");
+#endif
+
+#if CAPTURE_ENABLED
+    // RX capture rings must exist before the RX workers look them up
+    if (!vmc_role_forwarder() && capture_init(&ports_config) != 0)
     {
-        printf("Failed to start TX/RX workers\n");
+        printf("Failed to set up capture rings\n");
         cleanup_prbs_cache();
         cleanup_ports(&ports_config);
         cleanup_eal();
@@ -423,6 +627,19 @@ int main(int argc, char const *argv[])
     }
 #endif
 
+    // Role specific worker entry points, chosen once: the per-packet loops
+    // (tx_worker / rx_worker, forward_worker) never look at the role
+    int start_ret = vmc_role_forwarder() ? start_forward_workers(&ports_config, &force_quit)
+                                         : start_txrx_workers(&ports_config, &force_quit);
+    if (start_ret < 0)
+    {
+        printf("Failed to start %s workers\n", vmc_role_forwarder() ? "forward" : "TX/RX");
+        cleanup_prbs_cache();
+        cleanup_ports(&ports_config);
+        cleanup_eal();
+        return -1;
+    }
+
 #if ENABLE_RAW_SOCKET_PORTS
     // Start raw socket workers (only if initialization succeeded)
     if (raw_ports_initialized)
@@ -489,13 +706,28 @@ int main(int argc, char const *argv[])
         ptp_active = ate_mode_enabled() ? ATE_PTP_ENABLED : PTP_ENABLED;
         if (ptp_active) {
             printf("\n=== Initializing PTP Slave (IEEE 1588v2) ===\n");
-            printf("Mode: One-step | Transport: Layer 2 | Timestamps: Software (rte_rdtsc)\n");
+            printf("Mode: One-step | Transport: Layer 2 | Timestamps: NIC (rte_eth_timesync), software fallback\n");
             printf("Architecture: Split TX/RX Port Support\n\n");
 
             // Initialize PTP subsystem
             if (ptp_init() != 0) {
                 printf("Warning: PTP initialization failed\n");
             } else {
+#if PTP_SIM_MASTER_ENABLED
+                // NIC-free bench: net_ring slave/master pair instead of session table
+                uint16_t sim_cores[2];
+                if (get_unused_cores(2, sim_cores) != 2 ||
+                    ptp_sim_master_setup(sim_cores[0], sim_cores[1]) != 0) {
+                    printf("Warning: PTP simulated master setup failed\n");
+                } else if (ptp_start() != 0) {
+                    printf("Warning: Failed to start PTP workers\n");
+                } else if (ptp_sim_master_start() != 0) {
+                    printf("Warning: Failed to start PTP simulated master\n");
+                } else {
+                    printf("PTP workers started (simulated master, expected offset=-%d ns delay=%d ns)\n",
+                           PTP_SIM_MASTER_OFFSET_NS, PTP_SIM_PATH_DELAY_NS);
+                }
+#else
                 // Configure PTP sessions with split TX/RX port support
                 // Sessions are defined in config.h with separate RX and TX ports
                 static struct ptp_session_config ptp_sessions[] = PTP_SESSIONS_CONFIG_INIT;
@@ -527,6 +759,7 @@ int main(int argc, char const *argv[])
                                PTP_SESSION_COUNT);
                     }
                 }
+#endif
             }
         } else {
             printf("\n[ATE] PTP disabled (ATE_PTP_ENABLED=0)\n");
@@ -534,6 +767,8 @@ int main(int argc, char const *argv[])
     }
 #endif
 
+    startup_trace_report();
+
     printf("\n=== Running (Press Ctrl+C to stop) ===\n\n");
 
     // Previous TX/RX bytes for per-second rate calculation
@@ -548,6 +783,8 @@ int main(int argc, char const *argv[])
         sleep(1);
         loop_count++;
 
+        startup_trace_poll();
+
         // Büyük tablo + kuyruk dağılımları (includes DPDK External TX stats)
         helper_print_stats(&ports_config, prev_tx_bytes, prev_rx_bytes,
                            true, loop_count, loop_count);
@@ -566,6 +803,11 @@ int main(int argc, char const *argv[])
             ptp_print_stats();
 #endif
 
+#if SW_HARNESS_ENABLED
+        if (sw_harness_tick(loop_count))
+            force_quit = true;  // SW_HARNESS_DURATION_S reached
+#endif
+
         fflush(stdout);  // Ensure output is visible on remote/main computer
 
         // Bir SONRAKİ saniye için prev_* güncelle: (kümülatif HW byte sayaçları)
@@ -584,11 +826,18 @@ int main(int argc, char const *argv[])
 
     printf("\n=== Shutting down ===\n");
 
+#if SW_HARNESS_ENABLED
+    sw_harness_print_summary();
+#endif
+
 #if PTP_ENABLED
     if (ptp_active) {
         // Stop PTP workers first
         printf("Stopping PTP workers...\n");
         ptp_print_stats();  // Final stats
+#if PTP_SIM_MASTER_ENABLED
+        ptp_sim_master_stop();
+#endif
         ptp_stop();
     }
 #endif
@@ -618,6 +867,16 @@ int main(int argc, char const *argv[])
     // Wait for all DPDK workers to stop
     rte_eal_mp_wait_lcore();
 
+#if CAPTURE_ENABLED
+    // RX cores stopped: pending triggers are written, rings freed
+    capture_print_stats();
+    capture_stop();
+#endif
+
+#if SW_HARNESS_ENABLED
+    sw_harness_cleanup();
+#endif
+
     // Cleanup
 #if PTP_ENABLED
     if (ptp_active)
@@ -635,8 +894,12 @@ int main(int argc, char const *argv[])
         cleanup_raw_socket_ports();
     }
 #endif
-    cleanup_prbs_cache();
+    // Ports first: queued TX segments may still point into the PRBS cache (extbuf TX)
     cleanup_ports(&ports_config);
+#if PCAP_REPLAY_ENABLED
+    pcap_replay_cleanup();
+#endif
+    cleanup_prbs_cache();
     cleanup_eal();
 
     printf("Application exited cleanly\n");
@@ -1,11 +1,17 @@
 #include "packet.h"
 #include "port.h"
+#include "startup_trace.h"
 #include <string.h>
 #include <arpa/inet.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <inttypes.h>
+#include <rte_eal.h>
 #include <rte_malloc.h>
 #include <rte_memcpy.h>
+#include <rte_launch.h>
+#include <rte_lcore.h>
+#include <rte_errno.h>
 
 // Global PRBS cache for all ports
 struct prbs_cache port_prbs_cache[MAX_PRBS_CACHE_PORTS];
@@ -25,35 +31,195 @@ static inline uint32_t prbs31_next(uint32_t *state)
     return output;
 }
 
+// Byte with its bit order reversed (PRBS bit stream is MSB first).
+// Constant so that parallel fill lcores never see it half-built.
+static const uint8_t bit_reverse[256] = {
+    0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
+    0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8,
+    0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4, 0x34, 0xB4, 0x74, 0xF4,
+    0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC, 0x3C, 0xBC, 0x7C, 0xFC,
+    0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2, 0x32, 0xB2, 0x72, 0xF2,
+    0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA, 0x3A, 0xBA, 0x7A, 0xFA,
+    0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6, 0x36, 0xB6, 0x76, 0xF6,
+    0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE, 0x3E, 0xBE, 0x7E, 0xFE,
+    0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1, 0x31, 0xB1, 0x71, 0xF1,
+    0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9, 0x39, 0xB9, 0x79, 0xF9,
+    0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5, 0x35, 0xB5, 0x75, 0xF5,
+    0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD, 0x3D, 0xBD, 0x7D, 0xFD,
+    0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3, 0x33, 0xB3, 0x73, 0xF3,
+    0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB, 0x3B, 0xBB, 0x7B, 0xFB,
+    0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7,
+    0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF,
+};
+
 /**
  * Fill buffer with PRBS-31 sequence
- * 
+ *
+ * Same bit stream as prbs31_next (first bit = MSB of the first byte), 16
+ * bits per step: the next 16 feedback bits s[k+31..k+46] = s[k..k+15] ^
+ * s[k+3..k+18] are all in the current 31-bit state.
+ *
  * @param buffer Destination buffer
  * @param initial_state Initial PRBS-31 state (31-bit)
+ * @param progress Print progress every 32 MB (serial init only)
  */
-static void fill_buffer_with_prbs31(uint8_t *buffer, const uint32_t initial_state)
+static void fill_buffer_with_prbs31(uint8_t *buffer, const uint32_t initial_state, bool progress)
 {
     uint32_t state = initial_state;
-    
-    printf("Generating PRBS-31 sequence (this may take a minute)...\n");
-    
-    for (size_t i = 0; i < PRBS_CACHE_SIZE; i++) {
-        buffer[i] = 0;
-        // Generate 8 bits per byte
-        for (int j = 0; j < 8; j++) {
-            buffer[i] = (buffer[i] << 1) | prbs31_next(&state);
-        }
-        
-        // Progress indicator every 10MB
-        if ((i % (10 * 1024 * 1024)) == 0 && i > 0) {
-            printf("  Generated %zu MB / %u MB (%.1f%%)\n", 
-                   i / (1024 * 1024), 
+
+    if (progress)
+        printf("Generating PRBS-31 sequence...\n");
+
+    // PRBS_CACHE_SIZE is a power of 2: whole 16-bit steps
+    for (size_t i = 0; i < PRBS_CACHE_SIZE; i += 2) {
+        buffer[i] = bit_reverse[state & 0xFF];
+        buffer[i + 1] = bit_reverse[(state >> 8) & 0xFF];
+        state = (state >> 16) | (((state ^ (state >> 3)) & 0xFFFF) << 15);
+
+        if (progress && (i % (32 * 1024 * 1024)) == 0 && i > 0) {
+            printf("  Generated %zu MB / %u MB (%.1f%%)\n",
+                   i / (1024 * 1024),
                    (unsigned)(PRBS_CACHE_SIZE / (1024 * 1024)),
                    (100.0 * i) / PRBS_CACHE_SIZE);
         }
     }
-    
-    printf("PRBS-31 generation complete!\n");
+
+    if (progress)
+        printf("PRBS-31 generation complete!\n");
+}
+
+#if PRBS_EXTBUF_TX_ENABLED
+/**
+ * The NIC DMAs the payload straight from cache_ext, so it needs one IOVA
+ * base for the whole buffer: a RTE_MEMZONE_IOVA_CONTIG zone guarantees it,
+ * IOVA-as-VA is contiguous by definition. An rte_malloc fallback in PA mode
+ * is not checked page by page, it stays in copy mode.
+ */
+static void prbs_extbuf_check_port(uint16_t port)
+{
+    struct prbs_cache *pc = &port_prbs_cache[port];
+
+    pc->extbuf_ready = false;
+
+    if (pc->cache_ext_mz) {
+        pc->cache_ext_iova = pc->cache_ext_mz->iova;
+    } else if (rte_eal_iova_mode() == RTE_IOVA_VA) {
+        pc->cache_ext_iova = (rte_iova_t)(uintptr_t)pc->cache_ext;
+    } else {
+        printf("  Extbuf TX: PRBS cache not in an IOVA-contiguous zone, copy mode\n");
+        return;
+    }
+
+    pc->extbuf_ready = true;
+    printf("  Extbuf TX: PRBS cache attachable (IOVA 0x%" PRIx64 ")\n",
+           (uint64_t)pc->cache_ext_iova);
+}
+
+/**
+ * Extended cache as one IOVA-contiguous memzone on the port's socket
+ */
+static uint8_t *prbs_cache_ext_reserve(uint16_t port, size_t ext_size, int socket_id)
+{
+    char name[RTE_MEMZONE_NAMESIZE];
+
+    snprintf(name, sizeof(name), "prbs_ext_%u", port);
+    port_prbs_cache[port].cache_ext_mz = rte_memzone_reserve_aligned(
+        name, ext_size, socket_id, RTE_MEMZONE_IOVA_CONTIG, RTE_CACHE_LINE_SIZE);
+    if (!port_prbs_cache[port].cache_ext_mz) {
+        printf("  Extbuf TX: no IOVA-contiguous %zu MB zone for port %u (%s), rte_malloc\n",
+               ext_size >> 20, port, rte_strerror(rte_errno));
+        return NULL;
+    }
+    return port_prbs_cache[port].cache_ext_mz->addr;
+}
+#endif
+
+/**
+ * Free the extended cache, zone or rte_malloc
+ */
+static void prbs_cache_ext_free(uint16_t port)
+{
+#if PRBS_EXTBUF_TX_ENABLED
+    if (port_prbs_cache[port].cache_ext_mz) {
+        rte_memzone_free(port_prbs_cache[port].cache_ext_mz);
+        port_prbs_cache[port].cache_ext_mz = NULL;
+        port_prbs_cache[port].cache_ext = NULL;
+        return;
+    }
+#endif
+    rte_free(port_prbs_cache[port].cache_ext);
+    port_prbs_cache[port].cache_ext = NULL;
+}
+
+/**
+ * Allocate the main and extended cache of one port on its socket
+ */
+static int prbs_cache_alloc_port(uint16_t port, int socket_id)
+{
+    port_prbs_cache[port].socket_id = socket_id;
+
+    // Unique initial state for each port (0x0000000F + port_id)
+    port_prbs_cache[port].initial_state = 0x0000000F + port;
+
+    // Allocate main cache on correct NUMA node
+    port_prbs_cache[port].cache = (uint8_t *)rte_malloc_socket(
+        NULL,
+        PRBS_CACHE_SIZE,
+        0,
+        socket_id
+    );
+
+    if (!port_prbs_cache[port].cache) {
+        printf("Error: Failed to allocate PRBS cache for port %u\n", port);
+        port_prbs_cache[port].initialized = false;
+        return -1;
+    }
+
+    // Allocate extended cache (main + extra bytes for wraparound)
+    size_t ext_size = (size_t)PRBS_CACHE_SIZE + (size_t)NUM_PRBS_BYTES;
+#if PRBS_EXTBUF_TX_ENABLED
+    port_prbs_cache[port].cache_ext = prbs_cache_ext_reserve(port, ext_size, socket_id);
+#endif
+    if (!port_prbs_cache[port].cache_ext)
+        port_prbs_cache[port].cache_ext = (uint8_t *)rte_malloc_socket(
+            NULL,
+            ext_size,
+            0,
+            socket_id
+        );
+
+    if (!port_prbs_cache[port].cache_ext) {
+        printf("Error: Failed to allocate extended PRBS cache for port %u\n", port);
+        rte_free(port_prbs_cache[port].cache);
+        port_prbs_cache[port].cache = NULL;
+        port_prbs_cache[port].initialized = false;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Generate the sequence into an allocated cache and mark it ready
+ */
+static void prbs_cache_fill_port(uint16_t port, bool progress)
+{
+    // Generate PRBS-31 sequence
+    fill_buffer_with_prbs31(port_prbs_cache[port].cache,
+                            port_prbs_cache[port].initial_state, progress);
+
+    // Copy to extended cache (main + wraparound bytes)
+    rte_memcpy(port_prbs_cache[port].cache_ext,
+               port_prbs_cache[port].cache,
+               PRBS_CACHE_SIZE);
+    rte_memcpy(port_prbs_cache[port].cache_ext + PRBS_CACHE_SIZE,
+               port_prbs_cache[port].cache,
+               NUM_PRBS_BYTES);
+
+#if PRBS_EXTBUF_TX_ENABLED
+    prbs_extbuf_check_port(port);
+#endif
+
+    port_prbs_cache[port].initialized = true;
 }
 
 /**
@@ -64,68 +230,23 @@ void init_prbs_cache_for_all_ports(uint16_t nb_ports, const struct ports_config
     printf("\n=== Initializing PRBS-31 Cache ===\n");
     printf("Cache size per port: %u MB\n", (unsigned)(PRBS_CACHE_SIZE / (1024 * 1024)));
     printf("Extended cache: +%u bytes for wraparound\n", NUM_PRBS_BYTES);
-    
+
     for (uint16_t port = 0; port < nb_ports && port < MAX_PRBS_CACHE_PORTS; port++) {
         printf("\nPort %u:\n", port);
-        
+
         // Get NUMA socket for this port
         int socket_id = 0;
         if (ports) {
             socket_id = ports->ports[port].numa_node;
         }
-        
-        port_prbs_cache[port].socket_id = socket_id;
-        
-        // Unique initial state for each port (0x0000000F + port_id)
-        port_prbs_cache[port].initial_state = 0x0000000F + port;
-        
+
         printf("  NUMA socket: %d\n", socket_id);
-        printf("  Initial PRBS state: 0x%08X\n", port_prbs_cache[port].initial_state);
-        
-        // Allocate main cache on correct NUMA node
-        port_prbs_cache[port].cache = (uint8_t *)rte_malloc_socket(
-            NULL, 
-            PRBS_CACHE_SIZE, 
-            0, 
-            socket_id
-        );
-        
-        if (!port_prbs_cache[port].cache) {
-            printf("Error: Failed to allocate PRBS cache for port %u\n", port);
-            port_prbs_cache[port].initialized = false;
-            continue;
-        }
-        
-        // Allocate extended cache (main + extra bytes for wraparound)
-        size_t ext_size = (size_t)PRBS_CACHE_SIZE + (size_t)NUM_PRBS_BYTES;
-        port_prbs_cache[port].cache_ext = (uint8_t *)rte_malloc_socket(
-            NULL,
-            ext_size,
-            0,
-            socket_id
-        );
-        
-        if (!port_prbs_cache[port].cache_ext) {
-            printf("Error: Failed to allocate extended PRBS cache for port %u\n", port);
-            rte_free(port_prbs_cache[port].cache);
-            port_prbs_cache[port].cache = NULL;
-            port_prbs_cache[port].initialized = false;
+        printf("  Initial PRBS state: 0x%08X\n", 0x0000000F + port);
+
+        if (prbs_cache_alloc_port(port, socket_id) != 0)
             continue;
-        }
-        
-        // Generate PRBS-31 sequence
-        fill_buffer_with_prbs31(port_prbs_cache[port].cache, 
-                                port_prbs_cache[port].initial_state);
-        
-        // Copy to extended cache (main + wraparound bytes)
-        rte_memcpy(port_prbs_cache[port].cache_ext, 
-                   port_prbs_cache[port].cache, 
-                   PRBS_CACHE_SIZE);
-        rte_memcpy(port_prbs_cache[port].cache_ext + PRBS_CACHE_SIZE,
-                   port_prbs_cache[port].cache,
-                   NUM_PRBS_BYTES);
-        
-        port_prbs_cache[port].initialized = true;
+
+        prbs_cache_fill_port(port, true);
 
         printf("  Status: PRBS cache initialized successfully\n");
 
@@ -143,12 +264,87 @@ void init_prbs_cache_for_all_ports(uint16_t nb_ports, const struct ports_config
             }
         }
     }
-    
-    printf("\nTotal PRBS cache memory: %.2f GB\n", 
+
+    printf("\nTotal PRBS cache memory: %.2f GB\n",
            (nb_ports * PRBS_CACHE_SIZE) / (1024.0 * 1024.0 * 1024.0));
     printf("PRBS cache initialization complete\n\n");
 }
 
+// ==========================================
+// ASYNC PRBS CACHE INIT (parallel startup)
+// ==========================================
+// Caches are allocated by the main lcore, generated on each port's first TX
+// lcore (idle until start_txrx_workers, same socket as the port) while the
+// main lcore configures the ports. prbs_cache_wait joins them.
+
+static uint16_t prbs_async_lcore[MAX_PRBS_CACHE_PORTS];   // 0 = generated inline / none
+static uint64_t prbs_async_start_ns[MAX_PRBS_CACHE_PORTS];
+static uint64_t prbs_async_end_ns[MAX_PRBS_CACHE_PORTS];
+static uint16_t prbs_async_nb_ports;
+
+static int prbs_cache_fill_lcore(void *arg)
+{
+    uint16_t port = (uint16_t)(uintptr_t)arg;
+
+    prbs_async_start_ns[port] = startup_trace_now_ns();
+    prbs_cache_fill_port(port, false);
+    prbs_async_end_ns[port] = startup_trace_now_ns();
+    return 0;
+}
+
+int prbs_cache_start_async(uint16_t nb_ports, const struct ports_config *ports)
+{
+    printf("\n=== Initializing PRBS-31 Cache (async, one TX lcore per port) ===\n");
+
+    prbs_async_nb_ports = RTE_MIN(nb_ports, (uint16_t)MAX_PRBS_CACHE_PORTS);
+
+    for (uint16_t port = 0; port < prbs_async_nb_ports; port++) {
+        int socket_id = ports->ports[port].numa_node;
+        uint16_t lcore = ports->ports[port].used_tx_cores[0];
+
+        prbs_async_lcore[port] = 0;
+        prbs_async_start_ns[port] = prbs_async_end_ns[port] = 0;
+        if (prbs_cache_alloc_port(port, socket_id) != 0)
+            continue;
+
+        if (lcore != 0 && lcore < RTE_MAX_LCORE &&
+            rte_eal_get_lcore_state(lcore) == WAIT &&
+            rte_eal_remote_launch(prbs_cache_fill_lcore, (void *)(uintptr_t)port, lcore) == 0) {
+            prbs_async_lcore[port] = lcore;
+            printf("  Port %u: socket %d, generating on lcore %u\n", port, socket_id, lcore);
+        } else {
+            printf("  Port %u: socket %d, no idle TX lcore, generating inline\n", port, socket_id);
+            prbs_cache_fill_lcore((void *)(uintptr_t)port);
+        }
+    }
+    return 0;
+}
+
+void prbs_cache_wait(void)
+{
+    for (uint16_t port = 0; port < prbs_async_nb_ports; port++) {
+        int where = prbs_async_lcore[port];
+
+        if (prbs_async_lcore[port] != 0) {
+            rte_eal_wait_lcore(prbs_async_lcore[port]);
+            prbs_async_lcore[port] = 0;
+        }
+        if (!port_prbs_cache[port].initialized)
+            continue;
+
+        char name[STARTUP_TRACE_NAME_LEN];
+        snprintf(name, sizeof(name), "prbs_port%u", port);
+        startup_trace_task(name, where != 0 ? where : (int)rte_get_main_lcore(),
+                           prbs_async_start_ns[port], prbs_async_end_ns[port]);
+        printf("  Port %u: PRBS cache ready (%.2f s)\n", port,
+               (prbs_async_end_ns[port] - prbs_async_start_ns[port]) / 1e9);
+    }
+    if (prbs_async_nb_ports > 0)
+        printf("PRBS cache initialization complete (%.2f GB)\n\n",
+               (prbs_async_nb_ports * PRBS_CACHE_SIZE) / (1024.0 * 1024.0 * 1024.0));
+    prbs_async_nb_ports = 0;
+}
+
 uint8_t* get_prbs_cache_for_port(uint16_t port_id)
 {
     if (port_id >= MAX_PRBS_CACHE_PORTS) {
@@ -230,6 +426,52 @@ void fill_payload_with_prbs31_dynamic(struct rte_mbuf *mbuf, uint16_t port_id,
                prbs_len);
 }
 
+#if PRBS_EXTBUF_TX_ENABLED
+// cache_ext lives until cleanup_prbs_cache, after all ports are stopped
+static void prbs_extbuf_free_cb(void *addr, void *opaque)
+{
+    (void)addr;
+    (void)opaque;
+}
+
+void prbs_extbuf_shinfo_init(struct rte_mbuf_ext_shared_info *shinfo)
+{
+    shinfo->free_cb = prbs_extbuf_free_cb;
+    shinfo->fcb_opaque = NULL;
+    // Owner reference: attached segments never drop it to zero
+    rte_mbuf_ext_refcnt_set(shinfo, 1);
+}
+
+int attach_prbs_extbuf(struct rte_mbuf *pkt, struct rte_mempool *seg_pool,
+                       struct rte_mbuf_ext_shared_info *shinfo, uint16_t port_id,
+                       uint64_t sequence_number, uint16_t l2_len, uint16_t prbs_len)
+{
+    struct rte_mbuf *seg = rte_pktmbuf_alloc(seg_pool);
+    if (unlikely(seg == NULL))
+        return -1;
+
+    const struct prbs_cache *pc = &port_prbs_cache[port_id];
+    const uint16_t seq_offset = l2_len + sizeof(struct rte_ipv4_hdr) + sizeof(struct rte_udp_hdr);
+
+    // Header segment: headers (already built) + sequence number
+    *rte_pktmbuf_mtod_offset(pkt, uint64_t *, seq_offset) = sequence_number;
+    pkt->data_len = seq_offset + SEQ_BYTES;
+
+    // Payload segment: same offset rule as fill_payload_with_prbs31_dynamic
+    const uint64_t start_offset = (sequence_number * (uint64_t)MAX_PRBS_BYTES) % (uint64_t)PRBS_CACHE_SIZE;
+    rte_mbuf_ext_refcnt_update(shinfo, 1);
+    rte_pktmbuf_attach_extbuf(seg, pc->cache_ext + start_offset,
+                              pc->cache_ext_iova + start_offset, prbs_len, shinfo);
+    seg->data_len = prbs_len;
+    seg->pkt_len = prbs_len;
+
+    pkt->next = seg;
+    pkt->nb_segs = 2;
+    pkt->pkt_len = pkt->data_len + prbs_len;
+    return 0;
+}
+#endif
+
 void cleanup_prbs_cache(void)
 {
     printf("Cleaning up PRBS cache...\n");
@@ -241,10 +483,8 @@ void cleanup_prbs_cache(void)
                 port_prbs_cache[port].cache = NULL;
             }
             
-            if (port_prbs_cache[port].cache_ext) {
-                rte_free(port_prbs_cache[port].cache_ext);
-                port_prbs_cache[port].cache_ext = NULL;
-            }
+            if (port_prbs_cache[port].cache_ext)
+                prbs_cache_ext_free(port);
             
             port_prbs_cache[port].initialized = false;
         }
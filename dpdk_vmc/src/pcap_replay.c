@@ -0,0 +1,629 @@
+/**
+ * Pcap replay TX
+ *
+ * pcap_replay_load reads the file twice: pass 1 counts frames and the
+ * largest one, pass 2 fills the frame table (hugepage memory) and, in
+ * verbatim mode, copies every frame into its own mbuf on each port's socket.
+ * pcap_replay_tx_worker runs on the TX lcores in place of tx_worker and
+ * sends every NUM_TX_CORES-th frame of the file at its TSC deadline (see
+ * pcap_replay.h for the schedule).
+ */
+
+#include "config.h"
+
+#if PCAP_REPLAY_ENABLED
+
+#include <rte_malloc.h>
+#include <rte_mbuf.h>
+#include <rte_ethdev.h>
+#include <rte_cycles.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "pcap_replay.h"
+#include "tx_rx_manager.h"
+#include "vl_range.h"
+#include "packet.h"
+#include "startup_trace.h"
+
+#define PCAP_MAGIC_USEC         0xa1b2c3d4
+#define PCAP_MAGIC_NSEC         0xa1b23c4d
+#define PCAP_LINKTYPE_ETHER     1
+#define PCAP_MAX_RECORD         65535
+
+// All queues of a port start together, this long after the first one is up
+#define REPLAY_START_DELAY_MS   10
+
+// Span-less file (one frame / identical timestamps): frames spaced at 1 Gbps
+#define REPLAY_FALLBACK_NS_PER_BYTE 8
+
+// Rewrite mode: sizes the RX verifier accepts
+#if IMIX_ENABLED
+#define REPLAY_MIN_LEN IMIX_MIN_PACKET_SIZE
+#else
+#define REPLAY_MIN_LEN PACKET_SIZE
+#endif
+#define REPLAY_MAX_LEN PACKET_SIZE
+
+struct pcap_file_hdr
+{
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t linktype;
+};
+
+struct pcap_rec_hdr
+{
+    uint32_t ts_sec;
+    uint32_t ts_frac;       // usec or nsec (magic)
+    uint32_t incl_len;
+    uint32_t orig_len;
+};
+
+static struct replay_stats replay_stats_local[MAX_PORTS][NUM_TX_CORES];
+struct replay_stats (*replay_stats)[NUM_TX_CORES] = replay_stats_local;  // Memzone after stats_shm_init
+
+static struct replay_frame *replay_frames;
+static uint32_t replay_nb_frames;
+static uint64_t replay_loop_cycles;         // One pass over the file, original timing
+static uint64_t replay_total_bytes;         // Bytes sent per pass
+static double replay_file_gbps;             // Mean rate of one pass, original timing
+static char replay_path[256];
+
+#if !PCAP_REPLAY_REWRITE
+static struct rte_mempool *replay_pools[MAX_PORTS];
+static struct rte_mbuf **replay_mbufs[MAX_PORTS];   // [frame], refcnt held by us
+#else
+// Per-VL sequence (each VL belongs to one queue, so one writer per entry)
+static uint64_t replay_vl_seq[MAX_PORTS][MAX_VL_ID + 1];
+#endif
+
+static uint64_t replay_start_tsc[MAX_PORTS];
+static double replay_expected_gbps[MAX_PORTS];
+
+// print_stats snapshot
+static uint64_t replay_base_frames[MAX_PORTS];
+static uint64_t replay_prev_bytes[MAX_PORTS];
+static uint64_t replay_prev_tsc;
+
+static inline uint32_t rd32(uint32_t v, bool swap)
+{
+    return swap ? __builtin_bswap32(v) : v;
+}
+
+/**
+ * Pass 1: validate the header, count frames and find the largest
+ */
+static int replay_scan(FILE *f, bool *swap, bool *nsec, uint32_t *nb_frames,
+                       uint32_t *max_len)
+{
+    struct pcap_file_hdr fh;
+    if (fread(&fh, sizeof(fh), 1, f) != 1) {
+        printf("[REPLAY] %s: not a pcap file (short header)\n", replay_path);
+        return -1;
+    }
+
+    if (fh.magic == PCAP_MAGIC_USEC || fh.magic == PCAP_MAGIC_NSEC) {
+        *swap = false;
+    } else if (__builtin_bswap32(fh.magic) == PCAP_MAGIC_USEC ||
+               __builtin_bswap32(fh.magic) == PCAP_MAGIC_NSEC) {
+        *swap = true;
+    } else {
+        printf("[REPLAY] %s: bad magic 0x%08x (pcapng is not supported)\n",
+               replay_path, fh.magic);
+        return -1;
+    }
+    *nsec = rd32(fh.magic, *swap) == PCAP_MAGIC_NSEC;
+
+    if (rd32(fh.linktype, *swap) != PCAP_LINKTYPE_ETHER) {
+        printf("[REPLAY] %s: link type %u, only Ethernet (1) is supported\n",
+               replay_path, rd32(fh.linktype, *swap));
+        return -1;
+    }
+
+    struct pcap_rec_hdr rh;
+    *nb_frames = 0;
+    *max_len = 0;
+    while (*nb_frames < PCAP_REPLAY_MAX_FRAMES && fread(&rh, sizeof(rh), 1, f) == 1) {
+        uint32_t incl = rd32(rh.incl_len, *swap);
+        if (incl > PCAP_MAX_RECORD || fseek(f, incl, SEEK_CUR) != 0) {
+            printf("[REPLAY] %s: corrupt record %u\n", replay_path, *nb_frames);
+            return -1;
+        }
+        if (incl > 0 && incl <= MBUF_MAX_FRAME_SIZE) {
+            (*nb_frames)++;
+            if (incl > *max_len)
+                *max_len = incl;
+        }
+    }
+
+    if (*nb_frames == 0) {
+        printf("[REPLAY] %s: no frames up to %u bytes\n", replay_path, MBUF_MAX_FRAME_SIZE);
+        return -1;
+    }
+    return 0;
+}
+
+#if !PCAP_REPLAY_REWRITE
+static int replay_create_pools(const struct ports_config *ports_config, uint32_t nb_frames,
+                               uint32_t max_len)
+{
+    uint16_t data_room = RTE_ALIGN_CEIL(RTE_PKTMBUF_HEADROOM + max_len, RTE_CACHE_LINE_SIZE);
+
+    for (uint16_t i = 0; i < ports_config->nb_ports; i++) {
+        const struct port *port = &ports_config->ports[i];
+        uint16_t port_id = port->port_id;
+        char name[RTE_MEMPOOL_NAMESIZE];
+
+        if (port_id >= MAX_PORTS)
+            continue;
+
+        snprintf(name, sizeof(name), "replay_p%u", port_id);
+        replay_pools[port_id] = rte_pktmbuf_pool_create(name, nb_frames, 0, 0, data_room,
+                                                        port->numa_node);
+        replay_mbufs[port_id] = rte_zmalloc_socket("replay_mbufs",
+                                                   (size_t)nb_frames * sizeof(struct rte_mbuf *),
+                                                   RTE_CACHE_LINE_SIZE, port->numa_node);
+        if (replay_pools[port_id] == NULL || replay_mbufs[port_id] == NULL) {
+            printf("[REPLAY] Cannot allocate %u x %u B frames for port %u\n",
+                   nb_frames, data_room, port_id);
+            return -1;
+        }
+    }
+    return 0;
+}
+#endif
+
+/**
+ * Pass 2: frame table (+ pre-converted mbufs)
+ */
+static int replay_fill(FILE *f, bool swap, bool nsec, uint32_t nb_frames,
+                       const struct ports_config *ports_config)
+{
+    static uint8_t buf[PCAP_MAX_RECORD];
+    const uint64_t tsc_hz = rte_get_tsc_hz();
+    struct pcap_rec_hdr rh;
+    uint64_t first_ns = 0, last_ns = 0;
+    uint32_t n = 0, truncated = 0, clamped = 0;
+
+#if PCAP_REPLAY_REWRITE
+    (void)ports_config;
+#endif
+
+    fseek(f, sizeof(struct pcap_file_hdr), SEEK_SET);
+    replay_total_bytes = 0;
+
+    while (n < nb_frames && fread(&rh, sizeof(rh), 1, f) == 1) {
+        uint32_t incl = rd32(rh.incl_len, swap);
+        uint32_t orig = rd32(rh.orig_len, swap);
+        if (fread(buf, 1, incl, f) != incl)
+            break;
+        if (incl == 0 || incl > MBUF_MAX_FRAME_SIZE)
+            continue;
+
+        uint64_t ns = (uint64_t)rd32(rh.ts_sec, swap) * 1000000000ULL +
+                      (uint64_t)rd32(rh.ts_frac, swap) * (nsec ? 1 : 1000);
+        if (n == 0)
+            first_ns = last_ns = ns;
+        if (ns < last_ns)
+            ns = last_ns;               // Keep the schedule monotonic
+        last_ns = ns;
+
+        struct replay_frame *fr = &replay_frames[n];
+        fr->off_cycles = (uint64_t)((__uint128_t)(ns - first_ns) * tsc_hz / 1000000000ULL);
+        fr->orig_len = (uint16_t)(orig < UINT16_MAX ? orig : UINT16_MAX);
+
+#if PCAP_REPLAY_REWRITE
+        // Wire length from the file (also right for snapped captures)
+        uint32_t len = orig;
+        if (len < REPLAY_MIN_LEN || len > REPLAY_MAX_LEN) {
+            len = len < REPLAY_MIN_LEN ? REPLAY_MIN_LEN : REPLAY_MAX_LEN;
+            clamped++;
+        }
+        fr->len = (uint16_t)len;
+#else
+        fr->len = (uint16_t)incl;
+        if (incl < orig)
+            truncated++;
+
+        for (uint16_t i = 0; i < ports_config->nb_ports; i++) {
+            uint16_t port_id = ports_config->ports[i].port_id;
+            if (port_id >= MAX_PORTS)
+                continue;
+            struct rte_mbuf *m = rte_pktmbuf_alloc(replay_pools[port_id]);
+            if (m == NULL) {
+                printf("[REPLAY] Port %u mbuf pool exhausted at frame %u\n", port_id, n);
+                return -1;
+            }
+            rte_memcpy(rte_pktmbuf_append(m, fr->len), buf, fr->len);
+            replay_mbufs[port_id][n] = m;
+        }
+#endif
+        replay_total_bytes += fr->len;
+        n++;
+    }
+
+    if (n != nb_frames) {
+        printf("[REPLAY] %s: file changed or truncated while loading (%u of %u frames)\n",
+               replay_path, n, nb_frames);
+        return -1;
+    }
+
+    if (replay_frames[n - 1].off_cycles == 0) {
+        // No time span: space frames by their bytes at 1 Gbps
+        uint64_t cum = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            replay_frames[i].off_cycles = cum * REPLAY_FALLBACK_NS_PER_BYTE * tsc_hz / 1000000000ULL;
+            cum += replay_frames[i].len;
+        }
+        replay_loop_cycles = cum * REPLAY_FALLBACK_NS_PER_BYTE * tsc_hz / 1000000000ULL;
+        printf("[REPLAY] No timestamp span in file, frames spaced at 1 Gbps\n");
+    } else {
+        // Next pass starts one mean inter-frame gap after the last frame
+        uint64_t last = replay_frames[n - 1].off_cycles;
+        replay_loop_cycles = last + last / (n - 1);
+    }
+    replay_file_gbps = replay_total_bytes * 8.0 * tsc_hz / replay_loop_cycles / 1e9;
+
+    if (truncated > 0)
+        printf("[REPLAY] Warning: %u frames captured with snaplen, sent truncated\n", truncated);
+    if (clamped > 0)
+        printf("[REPLAY] %u frames outside %u..%u B, clamped for RX verification\n",
+               clamped, REPLAY_MIN_LEN, REPLAY_MAX_LEN);
+    return 0;
+}
+
+int pcap_replay_load(const char *path, const struct ports_config *ports_config)
+{
+    bool swap = false, nsec = false;
+    uint32_t nb_frames = 0, max_len = 0;
+
+    snprintf(replay_path, sizeof(replay_path), "%s", path ? path : PCAP_REPLAY_FILE);
+
+    FILE *f = fopen(replay_path, "rb");
+    if (!f) {
+        printf("[REPLAY] Cannot open %s: %s\n", replay_path, strerror(errno));
+        return -1;
+    }
+
+    if (replay_scan(f, &swap, &nsec, &nb_frames, &max_len) != 0)
+        goto fail;
+
+    replay_frames = rte_zmalloc("replay_frames", (size_t)nb_frames * sizeof(struct replay_frame),
+                                RTE_CACHE_LINE_SIZE);
+    if (replay_frames == NULL) {
+        printf("[REPLAY] Cannot allocate frame table (%u frames)\n", nb_frames);
+        goto fail;
+    }
+    replay_nb_frames = nb_frames;
+
+#if !PCAP_REPLAY_REWRITE
+    if (replay_create_pools(ports_config, nb_frames, max_len) != 0)
+        goto fail;
+#endif
+
+    if (replay_fill(f, swap, nsec, nb_frames, ports_config) != 0)
+        goto fail;
+    fclose(f);
+
+    memset(replay_start_tsc, 0, sizeof(replay_start_tsc));
+    pcap_replay_reset_stats();
+
+    printf("\n=== PCAP Replay ===\n");
+    printf("File: %s (%s timestamps%s)\n", replay_path, nsec ? "nsec" : "usec",
+           swap ? ", swapped" : "");
+    printf("Frames: %u, %lu bytes per pass, largest %u B\n", nb_frames,
+           replay_total_bytes, max_len);
+    printf("Pass: %.3f ms at original timing, mean %.3f Gbps\n",
+           replay_loop_cycles * 1000.0 / rte_get_tsc_hz(), replay_file_gbps);
+#if PCAP_REPLAY_TIMING
+    printf("Timing: original x %.2f speed\n", (double)PCAP_REPLAY_SPEEDUP);
+#else
+    printf("Timing: scaled to port target rate (burst pattern kept)\n");
+#endif
+    printf("Content: %s, %s\n",
+           PCAP_REPLAY_REWRITE ? "rewritten (VL-ID / VLAN / sequence / PRBS)"
+                               : "verbatim (pre-converted mbufs, zero-copy)",
+           PCAP_REPLAY_LOOP ? "looped" : "sent once");
+    printf("Queues: frame i -> TX queue i %% %d on every port\n", NUM_TX_CORES);
+    return 0;
+
+fail:
+    fclose(f);
+    pcap_replay_cleanup();
+    return -1;
+}
+
+int pcap_replay_tx_worker(void *arg)
+{
+    struct tx_worker_params *params = (struct tx_worker_params *)arg;
+    const uint16_t port_id = params->port_id;
+    const uint16_t queue_id = params->queue_id;
+    const uint64_t tsc_hz = rte_get_tsc_hz();
+
+    if (port_id >= MAX_PORTS || queue_id >= NUM_TX_CORES || replay_frames == NULL)
+        return -1;
+    if (queue_id >= replay_nb_frames) {
+        printf("Replay TX Port %u Q%u: idle (file has %u frames)\n",
+               port_id, queue_id, replay_nb_frames);
+        return 0;
+    }
+
+    struct replay_stats *st = &replay_stats[port_id][queue_id];
+
+    // Schedule scale (32.32): cycles at original timing -> cycles now
+#if PCAP_REPLAY_TIMING
+    double scale = 1.0 / PCAP_REPLAY_SPEEDUP;
+#else
+    double port_bytes_per_sec = (double)params->limiter.tokens_per_sec * NUM_TX_CORES;
+    double scale = (double)replay_total_bytes * tsc_hz / port_bytes_per_sec /
+                   replay_loop_cycles;
+#endif
+    const uint64_t scale_q32 = (uint64_t)(scale * 4294967296.0);
+    uint64_t loop_cycles = (uint64_t)(((__uint128_t)replay_loop_cycles * scale_q32) >> 32);
+    if (loop_cycles == 0)
+        loop_cycles = 1;
+    const uint64_t ns_per_cycle_q32 = (1000000000ULL << 32) / tsc_hz;
+    replay_expected_gbps[port_id] = replay_file_gbps / scale;
+
+#if PCAP_REPLAY_REWRITE
+#if VLAN_ENABLED
+    const uint16_t l2_len = sizeof(struct rte_ether_hdr) + sizeof(struct vlan_hdr);
+#else
+    const uint16_t l2_len = sizeof(struct rte_ether_hdr);
+#endif
+    if (!port_prbs_cache[port_id].initialized) {
+        printf("Error: PRBS cache not initialized for port %u\n", port_id);
+        return -1;
+    }
+
+    // Same VL walk as tx_worker (range 1 then range 2)
+    const uint16_t vl_r1_start = get_tx_vl_id_range_start(port_id, queue_id);
+    const uint16_t vl_r1_size = get_tx_vl_range1_size(port_id, queue_id);
+    const uint16_t vl_r2_start = (port_id < MAX_PORTS_CONFIG)
+        ? port_vlans[port_id].tx_vl_ids2[queue_id] : 0;
+    const uint16_t vl_range_size = get_tx_vl_total_count(port_id, queue_id);
+    uint16_t vl_offset = 0;
+    uint16_t burst_vl[BURST_SIZE];
+#endif
+
+    // Shared start for all queues of the port (first one up sets it)
+    uint64_t start = 0;
+    uint64_t want = rte_get_tsc_cycles() + tsc_hz / 1000 * REPLAY_START_DELAY_MS;
+    if (__atomic_compare_exchange_n(&replay_start_tsc[port_id], &start, want, false,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        start = want;
+
+    printf("Replay TX started: Port %u, Queue %u, Lcore %u, %u frames/pass, "
+           "scale %.4f, expected %.3f Gbps/port\n",
+           port_id, queue_id, params->lcore_id,
+           (replay_nb_frames - queue_id + NUM_TX_CORES - 1) / NUM_TX_CORES,
+           scale, replay_expected_gbps[port_id]);
+
+    struct rte_mbuf *burst[BURST_SIZE];
+    uint64_t burst_sched[BURST_SIZE];
+    uint16_t burst_len[BURST_SIZE];
+
+    uint32_t idx = queue_id;
+    uint64_t loop_base = start;
+    uint64_t next_tsc = loop_base +
+        (uint64_t)(((__uint128_t)replay_frames[idx].off_cycles * scale_q32) >> 32);
+    bool done = false;
+    bool first_sent = false;
+
+    while (!(*params->stop_flag) && !done)
+    {
+        uint64_t now = rte_get_tsc_cycles();
+        if (now < next_tsc) {
+            rte_pause();
+            continue;
+        }
+
+        // Everything due now leaves in one burst
+        uint16_t nb = 0;
+        while (nb < BURST_SIZE && next_tsc <= now)
+        {
+            const struct replay_frame *fr = &replay_frames[idx];
+#if PCAP_REPLAY_REWRITE
+            struct rte_mbuf *m = rte_pktmbuf_alloc(params->mbuf_pool);
+            if (likely(m != NULL))
+            {
+                uint16_t vl = (vl_offset < vl_r1_size)
+                    ? (vl_r1_start + vl_offset)
+                    : (vl_r2_start + (vl_offset - vl_r1_size));
+                if (++vl_offset >= vl_range_size)
+                    vl_offset = 0;
+
+                struct packet_config cfg = params->pkt_config;
+                cfg.vl_id = vl;
+                cfg.dst_mac.addr_bytes[0] = 0x03;
+                cfg.dst_mac.addr_bytes[1] = 0x00;
+                cfg.dst_mac.addr_bytes[2] = 0x00;
+                cfg.dst_mac.addr_bytes[3] = 0x00;
+                cfg.dst_mac.addr_bytes[4] = (uint8_t)((vl >> 8) & 0xFF);
+                cfg.dst_mac.addr_bytes[5] = (uint8_t)(vl & 0xFF);
+                cfg.dst_ip = (uint32_t)((224U << 24) | (224U << 16) |
+                                        ((uint32_t)((vl >> 8) & 0xFF) << 8) |
+                                        (uint32_t)(vl & 0xFF));
+
+                uint64_t seq = replay_vl_seq[port_id][vl]++;
+                build_packet_dynamic(m, &cfg, fr->len);
+                fill_payload_with_prbs31_dynamic(m, port_id, seq, l2_len,
+                                                 calc_prbs_size(fr->len));
+                burst_vl[nb] = vl;
+            }
+#else
+            struct rte_mbuf *m = replay_mbufs[port_id][idx];
+            rte_mbuf_refcnt_update(m, 1);   // Driver frees one reference, ours stays
+#endif
+            if (likely(m != NULL))
+            {
+                burst[nb] = m;
+                burst_sched[nb] = next_tsc;
+                burst_len[nb] = fr->len;
+                nb++;
+            }
+            else
+            {
+                st->drops++;
+            }
+
+            idx += NUM_TX_CORES;
+            if (idx >= replay_nb_frames)
+            {
+                idx = queue_id;
+                loop_base += loop_cycles;
+                st->loops++;
+                if (!PCAP_REPLAY_LOOP)
+                {
+                    done = true;
+                    break;
+                }
+            }
+            next_tsc = loop_base +
+                (uint64_t)(((__uint128_t)replay_frames[idx].off_cycles * scale_q32) >> 32);
+        }
+
+        if (nb == 0)
+            continue;
+
+        uint64_t tx_tsc = rte_get_tsc_cycles();
+        uint16_t sent = rte_eth_tx_burst(port_id, queue_id, burst, nb);
+
+        for (uint16_t i = 0; i < sent; i++)
+        {
+            uint64_t err_ns = (uint64_t)(((__uint128_t)(tx_tsc - burst_sched[i]) *
+                                          ns_per_cycle_q32) >> 32);
+            st->hist[replay_hist_bucket(err_ns)]++;
+            if (err_ns > st->err_max_ns)
+                st->err_max_ns = err_ns;
+            st->bytes += burst_len[i];
+        }
+        st->frames += sent;
+        if (unlikely(!first_sent && sent > 0))
+        {
+            startup_trace_first_packet();
+            first_sent = true;
+        }
+
+        // TX queue full: the slots are lost (timing kept), sequences given back
+        for (uint16_t i = nb; i > sent; i--)
+        {
+#if PCAP_REPLAY_REWRITE
+            replay_vl_seq[port_id][burst_vl[i - 1]]--;
+#endif
+            rte_pktmbuf_free(burst[i - 1]);
+        }
+        st->drops += nb - sent;
+    }
+
+    printf("Replay TX stopped: Port %u, Queue %u (%lu frames, %lu passes%s)\n",
+           port_id, queue_id, st->frames, st->loops, done ? ", file sent once" : "");
+    return 0;
+}
+
+// Bucket upper bound, capped at the exact maximum
+static uint64_t hist_percentile(const uint64_t *hist, uint64_t total, double p, uint64_t max)
+{
+    uint64_t rank = (uint64_t)(p * (total - 1));
+    uint64_t cum = 0;
+    for (uint32_t b = 0; b < REPLAY_HIST_BUCKETS; b++) {
+        cum += hist[b];
+        if (cum > rank)
+            return RTE_MIN(replay_hist_bucket_max(b), max);
+    }
+    return max;
+}
+
+void pcap_replay_print_stats(const struct ports_config *ports_config)
+{
+    static uint64_t hist[REPLAY_HIST_BUCKETS];
+    uint64_t now = rte_get_tsc_cycles();
+    double dt = replay_prev_tsc ? (double)(now - replay_prev_tsc) / rte_get_tsc_hz() : 0.0;
+    replay_prev_tsc = now;
+
+    printf("\n  PCAP replay %s (%u frames, %.3f Gbps original):\n",
+           replay_path, replay_nb_frames, replay_file_gbps);
+    printf("  ┌──────┬─────────────────────┬──────────┬────────────────────────┬──────────┬─────────────────────────────────────────────────┐\n");
+    printf("  │ Port │       Frames        │  Passes  │ Achieved/Expected Gbps │  Drops   │ Timing error (ns) p50 / p90 / p99 / p99.9 / max │\n");
+    printf("  ├──────┼─────────────────────┼──────────┼────────────────────────┼──────────┼─────────────────────────────────────────────────┤\n");
+
+    for (uint16_t i = 0; i < ports_config->nb_ports; i++) {
+        uint16_t port_id = ports_config->ports[i].port_id;
+        if (port_id >= MAX_PORTS)
+            continue;
+
+        uint64_t frames = 0, bytes = 0, drops = 0, err_max = 0;
+        memset(hist, 0, sizeof(hist));
+        for (uint16_t q = 0; q < NUM_TX_CORES; q++) {
+            const struct replay_stats *st = &replay_stats[port_id][q];
+            frames += st->frames;
+            bytes += st->bytes;
+            drops += st->drops;
+            if (st->err_max_ns > err_max)
+                err_max = st->err_max_ns;
+            for (uint32_t b = 0; b < REPLAY_HIST_BUCKETS; b++)
+                hist[b] += st->hist[b];
+        }
+
+        uint64_t counted = 0;
+        for (uint32_t b = 0; b < REPLAY_HIST_BUCKETS; b++)
+            counted += hist[b];
+
+        double gbps = dt > 0.0 ? (bytes - replay_prev_bytes[port_id]) * 8.0 / dt / 1e9 : 0.0;
+        replay_prev_bytes[port_id] = bytes;
+
+        printf("  │  %2u  │ %19lu │ %8lu │ %10.3f / %9.3f │ %8lu │ %7lu / %7lu / %7lu / %7lu / %7lu │\n",
+               port_id, frames - replay_base_frames[port_id], replay_stats[port_id][0].loops,
+               gbps, replay_expected_gbps[port_id], drops,
+               counted ? hist_percentile(hist, counted, 0.50, err_max) : 0,
+               counted ? hist_percentile(hist, counted, 0.90, err_max) : 0,
+               counted ? hist_percentile(hist, counted, 0.99, err_max) : 0,
+               counted ? hist_percentile(hist, counted, 0.999, err_max) : 0,
+               err_max);
+    }
+    printf("  └──────┴─────────────────────┴──────────┴────────────────────────┴──────────┴─────────────────────────────────────────────────┘\n");
+}
+
+void pcap_replay_reset_stats(void)
+{
+    // Frame count as a base; histograms are zeroed (racy, like the other resets)
+    for (uint16_t p = 0; p < MAX_PORTS; p++) {
+        uint64_t frames = 0;
+        for (uint16_t q = 0; q < NUM_TX_CORES; q++) {
+            struct replay_stats *st = &replay_stats[p][q];
+            frames += st->frames;
+            memset(st->hist, 0, sizeof(st->hist));
+            st->err_max_ns = 0;
+        }
+        replay_base_frames[p] = frames;
+    }
+}
+
+void pcap_replay_cleanup(void)
+{
+#if !PCAP_REPLAY_REWRITE
+    for (uint16_t p = 0; p < MAX_PORTS; p++) {
+        if (replay_mbufs[p] != NULL) {
+            for (uint32_t i = 0; i < replay_nb_frames; i++)
+                rte_pktmbuf_free(replay_mbufs[p][i]);
+            rte_free(replay_mbufs[p]);
+            replay_mbufs[p] = NULL;
+        }
+        if (replay_pools[p] != NULL) {
+            rte_mempool_free(replay_pools[p]);
+            replay_pools[p] = NULL;
+        }
+    }
+#endif
+    rte_free(replay_frames);
+    replay_frames = NULL;
+    replay_nb_frames = 0;
+}
+
+#endif /* PCAP_REPLAY_ENABLED */
@@ -0,0 +1,335 @@
+/**
+ * NUMA / SMT aware lcore placement
+ *
+ * Roles per port: TX queues, RX queues (forward workers in the forwarder role),
+ * external TX, PTP. Hot roles are placed first, port by port, each lcore
+ * chosen by the first matching pass:
+ *
+ *   1. port socket, physical core fully idle
+ *   2. port socket, SMT sibling only busy with a non-hot role (main, PTP)
+ *   3. port socket, SMT sibling busy with a hot role      -> SMT penalty
+ *   4-6. same on a remote socket                         -> cross-socket penalty
+ *
+ * Within a pass the highest lcore wins (same order as lcorePortAssign), so
+ * low lcores stay free for get_unused_cores users (raw socket, health, ...).
+ * Topology comes from rte_lcore_to_socket_id and sysfs core_id /
+ * physical_package_id of the lcore's CPU.
+ */
+
+#include "config.h"
+
+#if PLACEMENT_ENABLED
+
+#include <rte_eal.h>
+#include <rte_ethdev.h>
+#include <rte_lcore.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "placement.h"
+#include "common.h"   // socket_to_lcore, unused_socket_to_lcore
+#include "vmc_role.h"
+
+enum placement_role {
+    PL_ROLE_FREE = 0,
+    PL_ROLE_MAIN,
+    PL_ROLE_TX,
+    PL_ROLE_RX,
+    PL_ROLE_EXT_TX,
+    PL_ROLE_PTP,
+};
+
+static const char *pl_role_names[] = {"-", "MAIN", "TX", "RX", "EXT_TX", "PTP"};
+
+// Forwarder role: TX queues are driven by the forward workers, TX lcores stay idle
+static bool pl_tx_hot = true;
+
+#define PL_PENALTY_CROSS_SOCKET 0x1
+#define PL_PENALTY_SMT          0x2
+
+struct pl_lcore {
+    uint16_t lcore_id;
+    uint16_t socket;
+    int cpu;             // OS CPU (-1 = lcore spans several CPUs)
+    int phys_core;       // package << 16 | core_id, unique per lcore if unknown
+    uint8_t role;
+};
+
+struct pl_entry {
+    uint16_t port_id;
+    uint16_t port_socket;
+    uint8_t role;
+    uint16_t index;      // Queue index
+    uint16_t lcore_id;   // 0 = not placed
+    uint8_t penalty;
+    uint16_t sibling;    // Busy hot SMT sibling (PL_PENALTY_SMT)
+};
+
+#define PL_MAX_ENTRIES (MAX_PORTS * (NUM_TX_CORES + NUM_RX_CORES + 2))
+
+static struct pl_lcore pl_lcores[RTE_MAX_LCORE];
+static uint16_t pl_nb_lcores;
+static struct pl_entry pl_entries[PL_MAX_ENTRIES];
+static uint16_t pl_nb_entries;
+
+static inline bool pl_is_hot(uint8_t role)
+{
+    return (role == PL_ROLE_TX && pl_tx_hot) || role == PL_ROLE_RX || role == PL_ROLE_EXT_TX;
+}
+
+static int read_cpu_topology(int cpu, const char *leaf)
+{
+    char path[128];
+    int value = -1;
+
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/%s", cpu, leaf);
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return -1;
+    if (fscanf(f, "%d", &value) != 1)
+        value = -1;
+    fclose(f);
+    return value;
+}
+
+static void scan_lcores(void)
+{
+    unsigned lcore_id;
+    unsigned main_lcore = rte_get_main_lcore();
+    bool topo_known = true;
+
+    pl_nb_lcores = 0;
+    RTE_LCORE_FOREACH(lcore_id)
+    {
+        struct pl_lcore *l = &pl_lcores[pl_nb_lcores++];
+        l->lcore_id = lcore_id;
+        l->socket = rte_lcore_to_socket_id(lcore_id);
+        l->cpu = rte_lcore_to_cpu_id(lcore_id);
+        l->role = (lcore_id == main_lcore) ? PL_ROLE_MAIN : PL_ROLE_FREE;
+
+        int pkg = l->cpu >= 0 ? read_cpu_topology(l->cpu, "physical_package_id") : -1;
+        int core = l->cpu >= 0 ? read_cpu_topology(l->cpu, "core_id") : -1;
+        if (pkg >= 0 && core >= 0) {
+            l->phys_core = (pkg << 16) | core;
+        } else {
+            l->phys_core = (1 << 30) | lcore_id;   // No sibling information
+            topo_known = false;
+        }
+    }
+
+    if (!topo_known)
+        printf("Placement: CPU topology not available for some lcores, SMT siblings unknown\n");
+}
+
+static struct pl_lcore *find_lcore(uint16_t lcore_id)
+{
+    for (uint16_t i = 0; i < pl_nb_lcores; i++) {
+        if (pl_lcores[i].lcore_id == lcore_id)
+            return &pl_lcores[i];
+    }
+    return NULL;
+}
+
+// Busy lcore on the same physical core (SMT sibling), NULL if none
+static const struct pl_lcore *busy_sibling(const struct pl_lcore *l, bool hot_only)
+{
+    for (uint16_t i = 0; i < pl_nb_lcores; i++) {
+        const struct pl_lcore *o = &pl_lcores[i];
+        if (o == l || o->role == PL_ROLE_FREE || o->phys_core != l->phys_core)
+            continue;
+        if (!hot_only || pl_is_hot(o->role))
+            return o;
+    }
+    return NULL;
+}
+
+static struct pl_lcore *pick_lcore(uint16_t socket, struct pl_entry *e)
+{
+    for (int remote = 0; remote < 2; remote++) {
+        for (int level = 0; level < 3; level++) {
+#if !PLACEMENT_AVOID_SMT
+            if (level != 2)
+                continue;   // SMT ignored: first free lcore on the socket
+#endif
+            for (int i = pl_nb_lcores - 1; i >= 0; i--) {
+                struct pl_lcore *l = &pl_lcores[i];
+                if (l->role != PL_ROLE_FREE || (l->socket != socket) != (remote == 1))
+                    continue;
+
+                const struct pl_lcore *hot = busy_sibling(l, true);
+                if (level == 0 && busy_sibling(l, false))
+                    continue;
+                if (level == 1 && hot)
+                    continue;
+
+                e->penalty = remote ? PL_PENALTY_CROSS_SOCKET : 0;
+                if (hot) {
+                    e->penalty |= PL_PENALTY_SMT;
+                    e->sibling = hot->lcore_id;
+                }
+                return l;
+            }
+        }
+    }
+    return NULL;
+}
+
+// Keep unused_socket_to_lcore in sync for get_unused_cores
+static void mark_used(const struct pl_lcore *l)
+{
+    if (l->socket >= MAX_SOCKET)
+        return;
+    for (int idx = 0; idx < MAX_LCORE_PER_SOCKET; idx++) {
+        if (socket_to_lcore[l->socket][idx] == l->lcore_id)
+            unused_socket_to_lcore[l->socket][idx] = 0;
+    }
+}
+
+static uint16_t place(const struct port *port, uint8_t role, uint16_t index)
+{
+    if (pl_nb_entries >= PL_MAX_ENTRIES)
+        return 0;
+
+    struct pl_entry *e = &pl_entries[pl_nb_entries++];
+    memset(e, 0, sizeof(*e));
+    e->port_id = port->port_id;
+    e->port_socket = port->numa_node;
+    e->role = role;
+    e->index = index;
+
+    struct pl_lcore *l = pick_lcore(port->numa_node, e);
+    if (!l)
+        return 0;
+
+    l->role = role;
+    e->lcore_id = l->lcore_id;
+    mark_used(l);
+    return l->lcore_id;
+}
+
+int placement_assign(struct ports_config *config)
+{
+    int unplaced = 0;
+
+    pl_tx_hot = !vmc_role_forwarder();
+    pl_role_names[PL_ROLE_RX] = pl_tx_hot ? "RX" : "FWD";
+
+    scan_lcores();
+    pl_nb_entries = 0;
+
+    // Hot roles first, port by port
+    for (uint16_t i = 0; i < config->nb_ports; i++) {
+        struct port *port = &config->ports[i];
+
+        for (uint16_t q = 0; q < NUM_RX_CORES; q++) {
+            port->used_rx_cores[q] = place(port, PL_ROLE_RX, q);
+            unplaced += (port->used_rx_cores[q] == 0);
+        }
+
+        if (pl_tx_hot) {
+            for (uint16_t q = 0; q < NUM_TX_CORES; q++) {
+                port->used_tx_cores[q] = place(port, PL_ROLE_TX, q);
+                unplaced += (port->used_tx_cores[q] == 0);
+            }
+        }
+
+#if DPDK_EXT_TX_ENABLED
+        // Port 2,3,4,5 → Port 12 | Port 0,6 → Port 13
+        port->used_ext_tx_core = 0;
+        bool is_ext_tx_port = (i == 0 || i == 2 || i == 3 ||
+                               i == 4 || i == 5 || i == 6);
+        if (is_ext_tx_port)
+            port->used_ext_tx_core = place(port, PL_ROLE_EXT_TX, 0);
+#endif
+    }
+
+    // Non-hot roles take what is left (idle physical cores still preferred)
+    for (uint16_t i = 0; i < config->nb_ports; i++) {
+        struct port *port = &config->ports[i];
+
+        if (!pl_tx_hot) {
+            for (uint16_t q = 0; q < NUM_TX_CORES; q++)
+                port->used_tx_cores[q] = place(port, PL_ROLE_TX, q);
+        }
+
+#if PTP_ENABLED
+        port->used_ptp_core = place(port, PL_ROLE_PTP, 0);
+#endif
+        (void)port;
+    }
+
+    placement_print(config);
+
+    if (unplaced > 0) {
+        printf("Error: %d hot lcore role(s) could not be placed, extend the -l lcore list\n",
+               unplaced);
+        return -1;
+    }
+    return 0;
+}
+
+void placement_print(const struct ports_config *config)
+{
+    int cross = 0, smt = 0, missing = 0;
+
+    printf("\n=== Lcore Placement (NUMA%s) ===\n", PLACEMENT_AVOID_SMT ? " + SMT" : "");
+    printf("Port  Socket | Role    Q | Lcore  CPU  Socket  Core     | Note\n");
+
+    for (uint16_t i = 0; i < pl_nb_entries; i++) {
+        const struct pl_entry *e = &pl_entries[i];
+        const struct pl_lcore *l = e->lcore_id ? find_lcore(e->lcore_id) : NULL;
+
+        if (!l) {
+            printf("  %2u    %2u   | %-6s %2u |   -                             | NOT PLACED\n",
+                   e->port_id, e->port_socket, pl_role_names[e->role], e->index);
+            missing++;
+            continue;
+        }
+
+        char note[64] = "";
+        if (e->penalty & PL_PENALTY_CROSS_SOCKET) {
+            snprintf(note, sizeof(note), "cross-socket");
+            cross++;
+        }
+        if (e->penalty & PL_PENALTY_SMT) {
+            size_t len = strlen(note);
+            snprintf(note + len, sizeof(note) - len, "%sSMT with lcore %u",
+                     len ? ", " : "", e->sibling);
+            smt++;
+        }
+
+        if (l->phys_core & (1 << 30))
+            printf("  %2u    %2u   | %-6s %2u | %5u %4d  %4u      ?:?     | %s\n",
+                   e->port_id, e->port_socket, pl_role_names[e->role], e->index,
+                   l->lcore_id, l->cpu, l->socket, note);
+        else
+            printf("  %2u    %2u   | %-6s %2u | %5u %4d  %4u   %4d:%-4d | %s\n",
+                   e->port_id, e->port_socket, pl_role_names[e->role], e->index,
+                   l->lcore_id, l->cpu, l->socket, l->phys_core >> 16,
+                   l->phys_core & 0xFFFF, note);
+    }
+
+    printf("Memory: ");
+    for (uint16_t i = 0; i < config->nb_ports; i++)
+        printf("%sport %u -> socket %u", i ? ", " : "",
+               config->ports[i].port_id, config->ports[i].numa_node);
+    printf(" (mbuf pool, queue rings, PRBS cache)\n");
+
+    printf("Free lcores left:");
+    for (unsigned s = 0; s < MAX_SOCKET; s++) {
+        int n = 0, total = 0;
+        for (uint16_t i = 0; i < pl_nb_lcores; i++) {
+            if (pl_lcores[i].socket != s)
+                continue;
+            total++;
+            n += (pl_lcores[i].role == PL_ROLE_FREE);
+        }
+        if (total > 0)
+            printf(" socket %u: %d/%d", s, n, total);
+    }
+    printf("\n");
+
+    printf("Penalties: %d cross-socket, %d SMT-shared, %d not placed\n", cross, smt, missing);
+}
+
+#endif /* PLACEMENT_ENABLED */
@@ -3,6 +3,7 @@
 #include <string.h>
 #include "port.h"
 #include "config.h"
+#include "capacity.h"
 
 int initialize_ports(struct ports_config *config)
 {
@@ -25,7 +26,8 @@ int initialize_ports(struct ports_config *config)
     {
         if (port_count >= MAX_PORTS)
         {
-            printf("Warning: Maximum ports limit (%d) reached\n", MAX_PORTS);
+            printf("Warning: Maximum ports limit (%d) reached, %u ports available\n",
+                   MAX_PORTS, rte_eth_dev_count_avail());
             break;
         }
 
@@ -245,7 +247,16 @@ void portNumaNodesMatch(struct ports_config *config)
 {
     for (uint16_t port = 0; port < config->nb_ports; port++)
     {
-        config->ports[port].numa_node = rte_eth_dev_socket_id(port);
+        int socket = rte_eth_dev_socket_id(config->ports[port].port_id);
+
+        // SOCKET_ID_ANY (-1): vdev / unknown NUMA, use the main lcore's socket
+        if (socket < 0 || socket >= MAX_SOCKET)
+        {
+            socket = rte_lcore_to_socket_id(rte_get_main_lcore());
+            printf("Port %u: NUMA socket unknown, using socket %d\n",
+                   config->ports[port].port_id, socket);
+        }
+        config->ports[port].numa_node = (uint16_t)socket;
     }
 }
 
@@ -253,7 +264,9 @@ void lcorePortAssign(struct ports_config *config)
 {
     for (uint16_t port = 0; port < config->nb_ports; port++)
     {
-        uint16_t cores = MAX_LCORE - 1;
+        // Highest lcore of the port's socket in the EAL lcore set
+        uint16_t socket_lcores = runtime_cap.lcores_per_socket[config->ports[port].numa_node];
+        uint16_t cores = socket_lcores > 0 ? socket_lcores - 1 : 0;
         uint16_t *lcore_list = socket_to_lcore[config->ports[port].numa_node];
         uint16_t *unused_lcore_list = unused_socket_to_lcore[config->ports[port].numa_node];
         
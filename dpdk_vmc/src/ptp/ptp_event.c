@@ -0,0 +1,338 @@
+/**
+ * PTP Event Ring
+ *
+ * Debug output of the PTP workers without printf in the polling loop.
+ *
+ * Each PTP port owns a single-producer/single-consumer ring of fixed-size
+ * events. The producer is the port's worker (RX path, state machine, servo),
+ * the consumer is a non-realtime pthread that drains all rings every
+ * PTP_EVENT_DRAIN_INTERVAL_US and formats the output. A full ring drops the
+ * event (counted), it never blocks the worker.
+ */
+
+#include <rte_malloc.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ptp_types.h"
+#include "ptp_slave.h"
+#include "config.h"
+
+#define PTP_EVENT_RING_MASK (PTP_EVENT_RING_SIZE - 1)
+
+static pthread_t drain_thread;
+static volatile bool drain_running = false;
+
+/**
+ * Allocate event ring for a port
+ */
+int ptp_event_ring_create(ptp_port_t *port, int socket_id)
+{
+    if (port->events)
+        return 0;
+
+    port->events = rte_zmalloc_socket("ptp_events", sizeof(ptp_event_ring_t),
+                                      RTE_CACHE_LINE_SIZE, socket_id);
+    if (!port->events) {
+        fprintf(stderr, "PTP: Failed to allocate event ring for port %u\n", port->port_id);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Free event ring of a port
+ */
+void ptp_event_ring_free(ptp_port_t *port)
+{
+    rte_free(port->events);
+    port->events = NULL;
+}
+
+/**
+ * Reserve next event slot (worker side)
+ */
+ptp_event_t *ptp_event_alloc(uint16_t port_id, ptp_event_type_t type)
+{
+    if (port_id >= PTP_MAX_PORTS)
+        return NULL;
+
+    ptp_event_ring_t *ring = ptp_get_context()->ports[port_id].events;
+    if (!ring)
+        return NULL;
+
+    uint32_t head = ring->head;
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    if (head - tail >= PTP_EVENT_RING_SIZE) {
+        ring->dropped++;
+        return NULL;
+    }
+
+    ptp_event_t *ev = &ring->ev[head & PTP_EVENT_RING_MASK];
+    memset(ev, 0, offsetof(ptp_event_t, data));
+    ev->type = type;
+    ev->port_id = port_id;
+    return ev;
+}
+
+/**
+ * Publish the slot reserved by ptp_event_alloc (worker side)
+ */
+void ptp_event_post(uint16_t port_id)
+{
+    ptp_event_ring_t *ring = ptp_get_context()->ports[port_id].events;
+    __atomic_store_n(&ring->head, ring->head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Hex/ASCII dump of event payload
+ */
+static void print_hex_dump(const uint8_t *pkt, size_t len)
+{
+    for (size_t i = 0; i < len; i += 16) {
+        printf("  %04zx: ", i);
+        // Hex bytes
+        for (size_t j = 0; j < 16; j++) {
+            if (i + j < len)
+                printf("%02x ", pkt[i + j]);
+            else
+                printf("   ");
+        }
+        // ASCII representation
+        printf(" |");
+        for (size_t j = 0; j < 16 && (i + j) < len; j++) {
+            uint8_t c = pkt[i + j];
+            printf("%c", (c >= 32 && c < 127) ? c : '.');
+        }
+        printf("|\n");
+    }
+}
+
+/**
+ * Format one event
+ */
+static void print_event(const ptp_event_t *ev)
+{
+    switch (ev->type) {
+    case PTP_EVT_RAW_RX: {
+        const uint8_t *pkt = ev->data;
+        printf("PTP RAW Q5 Port%u: len=%lu DST=%02X:%02X:%02X:%02X:%02X:%02X "
+               "SRC=%02X:%02X:%02X:%02X:%02X:%02X Type=0x%02X%02X",
+               ev->port_id, ev->v[0],
+               pkt[0], pkt[1], pkt[2], pkt[3], pkt[4], pkt[5],
+               pkt[6], pkt[7], pkt[8], pkt[9], pkt[10], pkt[11],
+               pkt[12], pkt[13]);
+        // If VLAN tagged (0x8100), print VLAN info
+        if (pkt[12] == 0x81 && pkt[13] == 0x00 && ev->data_len >= 18) {
+            uint16_t vlan_tci = (pkt[14] << 8) | pkt[15];
+            uint16_t inner_type = (pkt[16] << 8) | pkt[17];
+            printf(" VLAN=%u Inner=0x%04X", vlan_tci & 0x0FFF, inner_type);
+        }
+        printf("\n");
+        break;
+    }
+
+    case PTP_EVT_SYNC_RX:
+        printf("PTP RX Sync [VLAN=%u]: SeqID=%u\n", ev->vlan_id, ev->seq_id);
+        printf("  T1 (from DTN) = %lu.%09lu sec = %lu ns\n",
+               ev->v[0] / 1000000000UL, ev->v[0] % 1000000000UL, ev->v[0]);
+        printf("  T2 (our TSC)  = %lu cycles\n", ev->v[1]);
+        if (ev->v[2] != 0)
+            printf("  T2 (NIC)      = %lu ns\n", ev->v[2]);
+        break;
+
+    case PTP_EVT_DELAY_RESP_RX: {
+        printf("PTP RX Delay_Resp [VLAN=%u]: SeqID=%u\n", ev->vlan_id, ev->seq_id);
+        printf("  T4 (from DTN) = %lu.%09lu sec = %lu ns%s\n",
+               ev->v[0] / 1000000000UL, ev->v[0] % 1000000000UL, ev->v[0],
+               ev->v[0] == 0 ? " (EMPTY!)" : "");
+        if (ev->flags) {
+            const ptp_port_identity_t *id = (const ptp_port_identity_t *)ev->data;
+            printf("PTP Delay_Resp [VLAN=%u]: requesting_port_id=%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X port=%u%s\n",
+                   ev->vlan_id,
+                   id->clock_identity[0], id->clock_identity[1],
+                   id->clock_identity[2], id->clock_identity[3],
+                   id->clock_identity[4], id->clock_identity[5],
+                   id->clock_identity[6], id->clock_identity[7],
+                   rte_be_to_cpu_16(id->port_number),
+                   " (DTN non-standard, check skipped)");
+        }
+        break;
+    }
+
+    case PTP_EVT_DELAY_REQ_TX:
+        printf("PTP TX Delay_Req [TXPort%lu VLAN%u] (RXPort%u): SeqID=%u VL-IDX=%lu T3=%lu cycles T3(NIC)=%lu ns\n",
+               ev->v[0], ev->vlan_id, ev->port_id, ev->seq_id, ev->v[1], ev->v[2], ev->v[3]);
+        printf("  Raw packet (%u bytes):\n", ev->data_len);
+        print_hex_dump(ev->data, ev->data_len);
+        break;
+
+    case PTP_EVT_CALC: {
+        uint64_t t1 = ev->v[0], t2 = ev->v[1], t3 = ev->v[2], t4 = ev->v[3];
+        int64_t tsc_diff = (int64_t)ev->v[4];
+
+        printf("PTP Calc [Port%u VLAN%u]:\n", ev->port_id, ev->vlan_id);
+        printf("  T1 (Master Sync TX)     = %lu ns (PTP epoch)\n", t1);
+        printf("  T2 (Slave Sync RX)      = %lu ns (realtime)\n", t2);
+        printf("  T3 (Slave DelayReq TX)  = %lu ns (realtime)\n", t3);
+        printf("  T4 (Master DelayReq RX) = %lu ns (PTP epoch)%s\n", t4, t4 == 0 ? " (EMPTY!)" : "");
+        printf("  T3-T2 (our processing)  = %ld ns (%.2f us)\n",
+               (int64_t)(t3 - t2), (int64_t)(t3 - t2) / 1000.0);
+        printf("  T3-T2 (TSC based)       = %ld ns (%.2f us)\n", tsc_diff, tsc_diff / 1000.0);
+
+        if (t4 == 0) {
+            printf("  >>> T4 is EMPTY - cannot calculate offset/delay\n");
+            break;
+        }
+
+        int64_t t2_minus_t1 = (int64_t)t2 - (int64_t)t1;
+        int64_t t4_minus_t3 = (int64_t)t4 - (int64_t)t3;
+        int64_t offset = (t2_minus_t1 - t4_minus_t3) / 2;
+        int64_t delay = (t2_minus_t1 + t4_minus_t3) / 2;
+        printf("  T2-T1 (Sync path)       = %ld ns (%.2f ms)\n",
+               t2_minus_t1, t2_minus_t1 / 1000000.0);
+        printf("  T4-T3 (DelayReq path)   = %ld ns (%.2f ms)\n",
+               t4_minus_t3, t4_minus_t3 / 1000000.0);
+        printf("  >>> Offset = (T2-T1 - T4+T3) / 2 = %ld ns (%.3f ms)\n",
+               offset, offset / 1000000.0);
+        printf("  >>> Delay  = (T2-T1 + T4-T3) / 2 = %ld ns (%.2f us)\n",
+               delay, delay / 1000.0);
+
+        if (ev->flags) {
+            int64_t hw_t2_minus_t1 = (int64_t)ev->v[5] - (int64_t)t1;
+            int64_t hw_t4_minus_t3 = (int64_t)t4 - (int64_t)ev->v[6];
+            printf("  >>> %s: T2-T1 = %ld ns, T4-T3 = %ld ns (T2=%lu T3=%lu)\n",
+                   ptp_ts_mode_to_str((ptp_ts_mode_t)ev->v[7]),
+                   hw_t2_minus_t1, hw_t4_minus_t3, ev->v[5], ev->v[6]);
+            printf("  >>> %s Offset = %ld ns, Delay = %ld ns (used)\n",
+                   ptp_ts_mode_to_str((ptp_ts_mode_t)ev->v[7]),
+                   (hw_t2_minus_t1 - hw_t4_minus_t3) / 2,
+                   (hw_t2_minus_t1 + hw_t4_minus_t3) / 2);
+        }
+        break;
+    }
+
+    case PTP_EVT_NO_SESSION:
+        printf("PTP: No session for Port%u VLAN=%u\n", ev->port_id, ev->vlan_id);
+        break;
+
+    case PTP_EVT_COUNTERS:
+        printf("PTP Debug Port %u Q5: total=%lu ptp=%lu non_ptp=%lu "
+               "[Sync=%lu DelReq=%lu DelResp=%lu]\n",
+               ev->port_id, ev->v[0], ev->v[1], ev->v[2], ev->v[3], ev->v[4], ev->v[5]);
+        break;
+
+    case PTP_EVT_SERVO_STEP:
+        printf("PTP Servo [Port%u VLAN%u]: Clock stepped (step #%lu)\n",
+               ev->port_id, ev->vlan_id, ev->v[0]);
+        break;
+
+    case PTP_EVT_SERVO_LOCKED:
+        printf("PTP Servo [Port%u VLAN%u]: LOCKED after %lu ms (freq %.1f ppb)\n",
+               ev->port_id, ev->vlan_id, ev->v[0], ev->d);
+        break;
+
+    case PTP_EVT_SERVO_PATH_CHANGE:
+        printf("PTP Servo [Port%u VLAN%u]: Path delay changed, window restarted\n",
+               ev->port_id, ev->vlan_id);
+        break;
+
+    default:
+        printf("PTP: Unknown event %u on port %u\n", ev->type, ev->port_id);
+        break;
+    }
+}
+
+/**
+ * Drain all event rings (consumer side)
+ */
+unsigned ptp_event_drain(void)
+{
+    ptp_context_t *ctx = ptp_get_context();
+    unsigned drained = 0;
+
+    for (int p = 0; p < PTP_MAX_PORTS; p++) {
+        ptp_event_ring_t *ring = ctx->ports[p].events;
+        if (!ring)
+            continue;
+
+        uint32_t tail = ring->tail;
+        uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+        while (tail != head) {
+            print_event(&ring->ev[tail & PTP_EVENT_RING_MASK]);
+            tail++;
+            drained++;
+        }
+
+        __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+    }
+
+    if (drained > 0)
+        fflush(stdout);
+
+    return drained;
+}
+
+/**
+ * Drain thread main loop
+ */
+static void *drain_thread_func(void *arg)
+{
+    (void)arg;
+
+    while (drain_running) {
+        ptp_event_drain();
+        usleep(PTP_EVENT_DRAIN_INTERVAL_US);
+    }
+
+    // Final drain after workers stopped
+    ptp_event_drain();
+    return NULL;
+}
+
+/**
+ * Start drain thread
+ */
+int ptp_event_thread_start(void)
+{
+    if (drain_running)
+        return 0;
+
+    drain_running = true;
+    if (pthread_create(&drain_thread, NULL, drain_thread_func, NULL) != 0) {
+        fprintf(stderr, "PTP: Failed to create event drain thread\n");
+        drain_running = false;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Stop drain thread (call after workers stopped)
+ */
+void ptp_event_thread_stop(void)
+{
+    if (!drain_running)
+        return;
+
+    drain_running = false;
+    pthread_join(drain_thread, NULL);
+}
+
+/**
+ * Total events dropped because a ring was full
+ */
+uint64_t ptp_event_dropped(void)
+{
+    ptp_context_t *ctx = ptp_get_context();
+    uint64_t dropped = 0;
+
+    for (int p = 0; p < PTP_MAX_PORTS; p++) {
+        if (ctx->ports[p].events)
+            dropped += ctx->ports[p].events->dropped;
+    }
+    return dropped;
+}
@@ -144,7 +144,7 @@ static ptp_header_t *get_ptp_header(struct rte_mbuf *mbuf)
  */
 int ptp_packet_process(ptp_session_t *session,
                        struct rte_mbuf *mbuf,
-                       uint64_t rx_tsc)
+                       const ptp_rx_stamp_t *rx)
 {
     if (!session || !mbuf)
         return -1;
@@ -172,19 +172,22 @@ int ptp_packet_process(ptp_session_t *session,
         // Sync message: extract t1 (origin timestamp)
         ptp_sync_msg_t *sync = (ptp_sync_msg_t *)hdr;
 
-        // Debug: Print received Sync packet details (first 10 only)
+        // Debug: Post received Sync packet details (first 10 only)
         static uint64_t sync_print_count = 0;
         if (sync_print_count < 10) {
-            uint64_t t1_seconds = rte_be_to_cpu_32(sync->origin_timestamp.seconds_lsb);
-            uint32_t t1_nanos = rte_be_to_cpu_32(sync->origin_timestamp.nanoseconds);
-            uint64_t t1_ns = t1_seconds * 1000000000ULL + t1_nanos;
-            printf("PTP RX Sync [VLAN=%u]: SeqID=%u\n", vlan_id, rte_be_to_cpu_16(hdr->sequence_id));
-            printf("  T1 (from DTN) = %lu.%09u sec = %lu ns\n", t1_seconds, t1_nanos, t1_ns);
-            printf("  T2 (our TSC)  = %lu cycles\n", rx_tsc);
+            ptp_event_t *ev = ptp_event_alloc(session->port_id, PTP_EVT_SYNC_RX);
+            if (ev) {
+                ev->vlan_id = vlan_id;
+                ev->seq_id = rte_be_to_cpu_16(hdr->sequence_id);
+                ev->v[0] = ptp_timestamp_to_ns(&sync->origin_timestamp);
+                ev->v[1] = rx->tsc;
+                ev->v[2] = rx->hw_ns;
+                ptp_event_post(session->port_id);
+            }
             sync_print_count++;
         }
 
-        ptp_handle_sync(session, hdr, &sync->origin_timestamp, rx_tsc);
+        ptp_handle_sync(session, hdr, &sync->origin_timestamp, rx);
         session->sync_rx_count++;
         break;
     }
@@ -193,38 +196,23 @@ int ptp_packet_process(ptp_session_t *session,
         // Delay_Resp message: extract t4 (receive timestamp)
         ptp_delay_resp_msg_t *resp = (ptp_delay_resp_msg_t *)hdr;
 
-        // Debug: Print received Delay_Resp packet details (first 10 only)
-        static uint64_t resp_print_count = 0;
-        if (resp_print_count < 10) {
-            uint64_t t4_seconds = rte_be_to_cpu_32(resp->receive_timestamp.seconds_lsb);
-            uint32_t t4_nanos = rte_be_to_cpu_32(resp->receive_timestamp.nanoseconds);
-            uint64_t t4_ns = t4_seconds * 1000000000ULL + t4_nanos;
-            printf("PTP RX Delay_Resp [VLAN=%u]: SeqID=%u\n", vlan_id, rte_be_to_cpu_16(hdr->sequence_id));
-            printf("  T4 (from DTN) = %lu.%09u sec = %lu ns%s\n",
-                   t4_seconds, t4_nanos, t4_ns,
-                   (t4_seconds == 0 && t4_nanos == 0) ? " (EMPTY!)" : "");
-            resp_print_count++;
-        }
-
         // NOTE: DTN is non-standard and sends requesting_port_id as all zeros
         // We rely on VLAN matching (done above) and SeqID matching (done in ptp_handle_delay_resp)
         // for correct session identification. Port identity check is skipped.
-        // Debug: Print requesting port identity (first 5 only)
-        static uint64_t port_id_print_count = 0;
-        if (port_id_print_count < 5) {
-            printf("PTP Delay_Resp [VLAN=%u]: requesting_port_id=%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X port=%u%s\n",
-                   vlan_id,
-                   resp->requesting_port_id.clock_identity[0],
-                   resp->requesting_port_id.clock_identity[1],
-                   resp->requesting_port_id.clock_identity[2],
-                   resp->requesting_port_id.clock_identity[3],
-                   resp->requesting_port_id.clock_identity[4],
-                   resp->requesting_port_id.clock_identity[5],
-                   resp->requesting_port_id.clock_identity[6],
-                   resp->requesting_port_id.clock_identity[7],
-                   rte_be_to_cpu_16(resp->requesting_port_id.port_number),
-                   " (DTN non-standard, check skipped)");
-            port_id_print_count++;
+        // Debug: Post received Delay_Resp details (first 10 only, port identity first 5 only)
+        static uint64_t resp_print_count = 0;
+        if (resp_print_count < 10) {
+            ptp_event_t *ev = ptp_event_alloc(session->port_id, PTP_EVT_DELAY_RESP_RX);
+            if (ev) {
+                ev->vlan_id = vlan_id;
+                ev->seq_id = rte_be_to_cpu_16(hdr->sequence_id);
+                ev->v[0] = ptp_timestamp_to_ns(&resp->receive_timestamp);
+                ev->flags = (resp_print_count < 5);
+                ev->data_len = sizeof(ptp_port_identity_t);
+                memcpy(ev->data, &resp->requesting_port_id, sizeof(ptp_port_identity_t));
+                ptp_event_post(session->port_id);
+            }
+            resp_print_count++;
         }
 
         ptp_handle_delay_resp(session, hdr, &resp->receive_timestamp,
@@ -336,6 +324,25 @@ int ptp_send_delay_req(ptp_session_t *session,
     mbuf->ol_flags = RTE_MBUF_F_TX_VLAN;
     mbuf->vlan_tci = session->tx_vlan_id;
 
+    // Debug: Stage Delay_Req dump before TX (mbuf belongs to the PMD afterwards),
+    // posted after TX and printed by the drain thread (first 10 only)
+    static uint64_t delay_req_print_count = 0;
+    ptp_event_t *ev = NULL;
+    if (delay_req_print_count < 10) {
+        ev = ptp_event_alloc(session->port_id, PTP_EVT_DELAY_REQ_TX);
+        if (ev) {
+            ev->vlan_id = session->tx_vlan_id;
+            ev->seq_id = session->delay_req_seq_id;
+            ev->v[0] = tx_port_id;
+            ev->v[1] = session->tx_vl_idx;
+            ev->data_len = RTE_MIN(pkt_size, (size_t)PTP_EVENT_DATA_LEN);
+            memcpy(ev->data, data, ev->data_len);
+        }
+    }
+
+    // Request NIC TX timestamp (no-op in SW mode)
+    ptp_ts_prepare_tx(tx_port_id, mbuf);
+
     // Record TX timestamp (TSC) just before sending
     uint64_t tsc_before = rte_rdtsc();
 
@@ -356,38 +363,20 @@ int ptp_send_delay_req(ptp_session_t *session,
     // Update session
     session->t3_tsc = *tx_tsc;
     session->t3_realtime_ns = get_realtime_ns();  // Realtime for offset calculation
+
+    // NIC TX timestamp (taken after the software one, polling must not skew it)
+    uint64_t tx_hw_ns = 0;
+    ptp_ts_read_tx(tx_port_id, &tx_hw_ns);
+    session->t3_hw_ns = tx_hw_ns;
     session->last_delay_req_seq_id = session->delay_req_seq_id;  // Store before incrementing
     session->delay_req_seq_id++;
     session->delay_req_tx_count++;
     session->last_delay_req_tsc = *tx_tsc;
 
-    // Debug: Print sent Delay_Req packet in raw hex dump format
-    static uint64_t delay_req_print_count = 0;
-    if (delay_req_print_count < 10) {
-        printf("PTP TX Delay_Req [TXPort%u VLAN%u] (RXPort%u): SeqID=%u VL-IDX=%u T3=%lu cycles\n",
-               tx_port_id, session->tx_vlan_id, session->port_id,
-               rte_be_to_cpu_16(delay_req->header.sequence_id),
-               session->tx_vl_idx, *tx_tsc);
-        printf("  Raw packet (%zu bytes):\n", pkt_size);
-        uint8_t *pkt = (uint8_t *)data;
-        for (size_t i = 0; i < pkt_size; i += 16) {
-            printf("  %04zx: ", i);
-            // Hex bytes
-            for (size_t j = 0; j < 16 && (i + j) < pkt_size; j++) {
-                printf("%02x ", pkt[i + j]);
-            }
-            // Padding for incomplete lines
-            for (size_t j = pkt_size - i; j < 16 && (i + j) >= pkt_size; j++) {
-                printf("   ");
-            }
-            // ASCII representation
-            printf(" |");
-            for (size_t j = 0; j < 16 && (i + j) < pkt_size; j++) {
-                uint8_t c = pkt[i + j];
-                printf("%c", (c >= 32 && c < 127) ? c : '.');
-            }
-            printf("|\n");
-        }
+    if (ev) {
+        ev->v[2] = *tx_tsc;
+        ev->v[3] = tx_hw_ns;
+        ptp_event_post(session->port_id);
         delay_req_print_count++;
     }
 
@@ -0,0 +1,332 @@
+/**
+ * PTP Servo
+ *
+ * Filters the raw two-step exchanges of a session and disciplines a software
+ * clock (TSC -> master time) with a PI controller.
+ *
+ * Per exchange (after ptp_calculate_offset_delay):
+ *   1. Outlier rejection: delay > window median + PTP_SERVO_OUTLIER_NS is
+ *      dropped (a delayed Delay_Resp/Sync must not skew the offset). After
+ *      PTP_SERVO_WINDOW consecutive rejects the window is restarted, so a
+ *      real path change is followed.
+ *   2. Path delay: median (PTP_SERVO_DELAY_MEDIAN=1) or mean of the window.
+ *   3. Lucky packet: offset of the minimum-delay exchange in the window is
+ *      reported as filtered offset; only exchanges within
+ *      PTP_SERVO_LUCKY_MARGIN_NS of that minimum drive the PI.
+ *   4. PI: error = disciplined_clock(t2_tsc) - (t1 + path_delay).
+ *      |error| > PTP_SERVO_STEP_THRESHOLD_NS steps the clock, otherwise the
+ *      frequency is corrected: ppb = -(KP * e + KI * sum(e)), e in ns/s.
+ *
+ * Disciplined clock:
+ *   master_ns = base_master_ns + (tsc - base_tsc) * ns_per_tsc
+ * It is rebased at every PI update (continuous, no phase jumps) and published
+ * with a sequence counter so latency code on other lcores can read it.
+ */
+
+#include <rte_cycles.h>
+#include <rte_pause.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ptp_types.h"
+#include "ptp_slave.h"
+#include "config.h"
+
+// Session used by ptp_clock_tsc_to_master_ns (first LOCKED session found)
+static const ptp_session_t *time_base_session = NULL;
+
+/**
+ * Publish a new TSC -> master mapping
+ */
+static void clock_set(ptp_disc_clock_t *clk, uint64_t base_tsc,
+                      uint64_t base_master_ns, double ns_per_tsc)
+{
+    uint32_t seq = clk->seq;
+
+    __atomic_store_n(&clk->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    clk->base_tsc = base_tsc;
+    clk->base_master_ns = base_master_ns;
+    clk->ns_per_tsc = ns_per_tsc;
+    clk->valid = true;
+
+    __atomic_store_n(&clk->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+/**
+ * Read disciplined clock at a TSC value
+ */
+bool ptp_servo_clock_read(const ptp_disc_clock_t *clk, uint64_t tsc, uint64_t *master_ns)
+{
+    uint64_t base_tsc;
+    uint64_t base_master_ns;
+    double ns_per_tsc;
+    bool valid;
+
+    for (;;) {
+        uint32_t seq = __atomic_load_n(&clk->seq, __ATOMIC_ACQUIRE);
+        if (seq & 1) {
+            rte_pause();
+            continue;
+        }
+
+        valid = clk->valid;
+        base_tsc = clk->base_tsc;
+        base_master_ns = clk->base_master_ns;
+        ns_per_tsc = clk->ns_per_tsc;
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&clk->seq, __ATOMIC_RELAXED) == seq)
+            break;
+    }
+
+    if (!valid)
+        return false;
+
+    int64_t dt = (int64_t)(tsc - base_tsc);
+    *master_ns = base_master_ns + (int64_t)((double)dt * ns_per_tsc);
+    return true;
+}
+
+/**
+ * Path delay estimate over the window (median or mean)
+ */
+static int64_t window_path_delay(const ptp_servo_t *servo)
+{
+    uint8_t n = servo->win_count;
+
+#if PTP_SERVO_DELAY_MEDIAN
+    int64_t sorted[PTP_SERVO_WINDOW];
+    for (uint8_t i = 0; i < n; i++) {
+        int64_t d = servo->window[i].delay_ns;
+        int j = i - 1;
+        while (j >= 0 && sorted[j] > d) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = d;
+    }
+    return (n & 1) ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+#else
+    int64_t sum = 0;
+    for (uint8_t i = 0; i < n; i++)
+        sum += servo->window[i].delay_ns;
+    return sum / n;
+#endif
+}
+
+/**
+ * Minimum-delay (lucky) exchange in the window
+ */
+static const ptp_servo_sample_t *window_lucky(const ptp_servo_t *servo)
+{
+    const ptp_servo_sample_t *best = &servo->window[0];
+    for (uint8_t i = 1; i < servo->win_count; i++) {
+        if (servo->window[i].delay_ns < best->delay_ns)
+            best = &servo->window[i];
+    }
+    return best;
+}
+
+/**
+ * Step the disciplined clock onto a sample
+ */
+static void servo_step(ptp_session_t *session, uint64_t t2_tsc, uint64_t master_ns,
+                       double ns_per_tsc)
+{
+    ptp_servo_t *servo = &session->servo;
+
+    clock_set(&servo->clock, t2_tsc, master_ns, ns_per_tsc);
+
+    servo->state = PTP_SERVO_LOCKING;
+    servo->first_sample_tsc = t2_tsc;
+    servo->last_update_tsc = t2_tsc;
+    servo->lock_count = 0;
+    servo->converge_ms = 0;
+    servo->integral_ppb = 0.0;
+    servo->steps++;
+
+    ptp_event_t *ev = ptp_event_alloc(session->port_id, PTP_EVT_SERVO_STEP);
+    if (ev) {
+        ev->vlan_id = session->rx_vlan_id;
+        ev->v[0] = servo->steps;
+        ptp_event_post(session->port_id);
+    }
+}
+
+/**
+ * PI update with one lucky exchange
+ */
+static void servo_pi(ptp_session_t *session, const ptp_servo_sample_t *sample)
+{
+    ptp_servo_t *servo = &session->servo;
+    double nominal = 1e9 / (double)session->tsc_hz;
+    uint64_t master_at_t2 = sample->t1_ns + servo->path_delay_ns;
+
+    if (servo->state == PTP_SERVO_UNLOCKED || !servo->clock.valid) {
+        servo->freq_ppb = 0.0;
+        servo_step(session, sample->t2_tsc, master_at_t2, nominal);
+        return;
+    }
+
+    uint64_t local_ns;
+    ptp_servo_clock_read(&servo->clock, sample->t2_tsc, &local_ns);
+    int64_t err = (int64_t)(local_ns - master_at_t2);
+    servo->clock_offset_ns = err;
+
+    if (llabs(err) > PTP_SERVO_STEP_THRESHOLD_NS) {
+        servo_step(session, sample->t2_tsc, master_at_t2, servo->clock.ns_per_tsc);
+        return;
+    }
+
+    if (sample->t2_tsc <= servo->last_update_tsc)
+        return;
+
+    double dt_s = (double)(sample->t2_tsc - servo->last_update_tsc) / (double)session->tsc_hz;
+    double err_rate = (double)err / dt_s;   // ns/s == ppb
+
+    servo->integral_ppb += PTP_SERVO_KI * err_rate;
+    if (servo->integral_ppb > PTP_SERVO_MAX_FREQ_PPB)
+        servo->integral_ppb = PTP_SERVO_MAX_FREQ_PPB;
+    else if (servo->integral_ppb < -PTP_SERVO_MAX_FREQ_PPB)
+        servo->integral_ppb = -PTP_SERVO_MAX_FREQ_PPB;
+
+    // Positive error: our clock is ahead, slow it down
+    double ppb = -(PTP_SERVO_KP * err_rate + servo->integral_ppb);
+    if (ppb > PTP_SERVO_MAX_FREQ_PPB)
+        ppb = PTP_SERVO_MAX_FREQ_PPB;
+    else if (ppb < -PTP_SERVO_MAX_FREQ_PPB)
+        ppb = -PTP_SERVO_MAX_FREQ_PPB;
+    servo->freq_ppb = ppb;
+
+    // Rebase at t2 (continuous) with the new frequency
+    clock_set(&servo->clock, sample->t2_tsc, local_ns, nominal * (1.0 + ppb * 1e-9));
+    servo->last_update_tsc = sample->t2_tsc;
+
+    // Convergence tracking
+    if (llabs(err) < PTP_SERVO_LOCK_THRESHOLD_NS) {
+        servo->lock_count++;
+        if (servo->state == PTP_SERVO_LOCKING && servo->lock_count >= PTP_SERVO_LOCK_COUNT) {
+            servo->state = PTP_SERVO_LOCKED;
+            servo->converge_ms = ((sample->t2_tsc - servo->first_sample_tsc) * 1000) /
+                                 session->tsc_hz;
+            ptp_event_t *ev = ptp_event_alloc(session->port_id, PTP_EVT_SERVO_LOCKED);
+            if (ev) {
+                ev->vlan_id = session->rx_vlan_id;
+                ev->v[0] = servo->converge_ms;
+                ev->d = ppb;
+                ptp_event_post(session->port_id);
+            }
+        }
+    } else {
+        servo->lock_count = 0;
+    }
+
+    if (servo->state == PTP_SERVO_LOCKED)
+        ptp_jitter_add(&servo->steady, err, servo->path_delay_ns);
+}
+
+/**
+ * Feed a completed exchange to the servo
+ */
+void ptp_servo_update(ptp_session_t *session)
+{
+    ptp_servo_t *servo = &session->servo;
+    ptp_servo_sample_t cur = {
+        .t1_ns = session->t1_ns,
+        .t2_tsc = session->t2_tsc,
+        .offset_ns = session->offset_ns,
+        .delay_ns = session->delay_ns,
+    };
+
+    servo->samples++;
+
+    // Outlier rejection against the current window
+    if (servo->win_count >= 3 &&
+        cur.delay_ns > window_path_delay(servo) + PTP_SERVO_OUTLIER_NS) {
+        servo->outliers++;
+        if (++servo->consecutive_outliers < PTP_SERVO_WINDOW)
+            return;
+
+        // Persistent: path changed, restart window from this exchange
+        ptp_event_t *ev = ptp_event_alloc(session->port_id, PTP_EVT_SERVO_PATH_CHANGE);
+        if (ev) {
+            ev->vlan_id = session->rx_vlan_id;
+            ptp_event_post(session->port_id);
+        }
+        servo->win_count = 0;
+        servo->win_head = 0;
+    }
+    servo->consecutive_outliers = 0;
+
+    servo->window[servo->win_head] = cur;
+    servo->win_head = (servo->win_head + 1) % PTP_SERVO_WINDOW;
+    if (servo->win_count < PTP_SERVO_WINDOW)
+        servo->win_count++;
+
+    servo->path_delay_ns = window_path_delay(servo);
+
+    const ptp_servo_sample_t *lucky = window_lucky(servo);
+    servo->filtered_offset_ns = lucky->offset_ns;
+
+    // Only near-minimum-delay exchanges drive the clock
+    if (cur.delay_ns > lucky->delay_ns + PTP_SERVO_LUCKY_MARGIN_NS)
+        return;
+
+    servo_pi(session, &cur);
+}
+
+/**
+ * Reset servo counters and steady-state statistics (clock is kept)
+ */
+void ptp_servo_reset_stats(ptp_servo_t *servo)
+{
+    servo->samples = 0;
+    servo->outliers = 0;
+    servo->steps = 0;
+    memset(&servo->steady, 0, sizeof(servo->steady));
+}
+
+/**
+ * Read disciplined clock of a session
+ */
+bool ptp_session_clock_read(const ptp_session_t *session, uint64_t tsc, uint64_t *master_ns)
+{
+    if (!session || session->servo.state == PTP_SERVO_UNLOCKED)
+        return false;
+
+    return ptp_servo_clock_read(&session->servo.clock, tsc, master_ns);
+}
+
+/**
+ * Convert TSC to master time using the first LOCKED session
+ */
+bool ptp_clock_tsc_to_master_ns(uint64_t tsc, uint64_t *master_ns)
+{
+    const ptp_session_t *sess = time_base_session;
+
+    if (!sess || sess->servo.state != PTP_SERVO_LOCKED) {
+        ptp_context_t *ctx = ptp_get_context();
+        sess = NULL;
+
+        for (int p = 0; p < PTP_MAX_PORTS && !sess; p++) {
+            ptp_port_t *port = &ctx->ports[p];
+            if (!port->enabled)
+                continue;
+
+            for (int s = 0; s < port->session_count; s++) {
+                if (port->sessions[s].servo.state == PTP_SERVO_LOCKED) {
+                    sess = &port->sessions[s];
+                    break;
+                }
+            }
+        }
+
+        time_base_session = sess;
+        if (!sess)
+            return false;
+    }
+
+    return ptp_servo_clock_read(&sess->servo.clock, tsc, master_ns);
+}
@@ -0,0 +1,324 @@
+#define _GNU_SOURCE  // For clock_gettime and CLOCK_REALTIME
+
+/**
+ * PTP Simulated Master
+ *
+ * NIC-free test bench for the PTP slave: a net_ring port pair where one side
+ * is served by the normal PTP slave worker and the other by a minimal master.
+ *
+ *   slave port  --TX q5--> s2m ring --RX q5--> master port
+ *   master port --TX q5--> m2s ring --RX q5--> slave port
+ *
+ * The master clock is CLOCK_REALTIME + PTP_SIM_MASTER_OFFSET_NS and every
+ * frame is "on the wire" for PTP_SIM_PATH_DELAY_NS. The slave port uses the
+ * emulated NIC latch (PTP_TS_MODE_SIM) so the HW path can be exercised end to
+ * end; with exact latches the slave reports:
+ *   offset = -PTP_SIM_MASTER_OFFSET_NS, delay = PTP_SIM_PATH_DELAY_NS
+ *
+ * Run with --no-pci so the ring ports get low port IDs (< PTP_MAX_PORTS).
+ */
+
+#include "config.h"
+
+#if PTP_SIM_MASTER_ENABLED
+
+#include <rte_cycles.h>
+#include <rte_ethdev.h>
+#include <rte_eth_ring.h>
+#include <rte_lcore.h>
+#include <rte_mbuf.h>
+#include <rte_ring.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ptp_types.h"
+#include "ptp_slave.h"
+
+#define PTP_SIM_RING_SIZE       1024
+#define PTP_SIM_NUM_QUEUES      (PTP_RX_QUEUE_ID + 1)
+#define PTP_SIM_POOL_SIZE       1023
+#define PTP_SIM_BURST           8
+
+// VLAN header (same layout as ptp_packet.c)
+struct sim_vlan_hdr {
+    uint16_t vlan_tci;
+    uint16_t eth_proto;
+} __attribute__((packed));
+
+static struct rte_ring *s2m_rings[PTP_SIM_NUM_QUEUES];
+static struct rte_ring *m2s_rings[PTP_SIM_NUM_QUEUES];
+static struct rte_mempool *sim_pool;
+
+static uint16_t sim_slave_port;
+static uint16_t sim_master_port;
+static uint16_t sim_master_lcore;
+static bool sim_configured = false;
+static volatile bool sim_running = false;
+
+// Master clock identity (02:00:00:ff:fe:00:00:01)
+static const uint8_t sim_master_clock_id[8] = {0x02, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01};
+static const uint8_t sim_master_mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+// Counters
+static uint64_t sim_sync_tx;
+static uint64_t sim_delay_req_rx;
+static uint64_t sim_delay_resp_tx;
+
+static inline uint64_t sim_realtime_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Allocate a VLAN-tagged PTP frame and return pointer to the PTP header
+ */
+static ptp_header_t *sim_build_frame(struct rte_mbuf **out, uint16_t vlan, uint16_t ptp_len)
+{
+    struct rte_mbuf *m = rte_pktmbuf_alloc(sim_pool);
+    if (!m)
+        return NULL;
+
+    uint16_t pkt_size = sizeof(struct rte_ether_hdr) + sizeof(struct sim_vlan_hdr) + ptp_len;
+    char *data = rte_pktmbuf_append(m, pkt_size);
+    if (!data) {
+        rte_pktmbuf_free(m);
+        return NULL;
+    }
+    memset(data, 0, pkt_size);
+
+    struct rte_ether_hdr *eth = (struct rte_ether_hdr *)data;
+    eth->dst_addr.addr_bytes[0] = 0x03;
+    eth->dst_addr.addr_bytes[4] = (vlan >> 8) & 0xFF;
+    eth->dst_addr.addr_bytes[5] = vlan & 0xFF;
+    memcpy(eth->src_addr.addr_bytes, sim_master_mac, 6);
+    eth->ether_type = rte_cpu_to_be_16(RTE_ETHER_TYPE_VLAN);
+
+    struct sim_vlan_hdr *vh = (struct sim_vlan_hdr *)(eth + 1);
+    vh->vlan_tci = rte_cpu_to_be_16(vlan & 0x0FFF);
+    vh->eth_proto = rte_cpu_to_be_16(PTP_ETHERTYPE);
+
+    ptp_header_t *hdr = (ptp_header_t *)(vh + 1);
+    hdr->transport = 0;
+    hdr->version = PTP_VERSION;
+    hdr->msg_length = rte_cpu_to_be_16(ptp_len);
+    hdr->domain_number = PTP_DEFAULT_DOMAIN;
+    memcpy(hdr->source_port_id.clock_identity, sim_master_clock_id, 8);
+    hdr->source_port_id.port_number = rte_cpu_to_be_16(1);
+
+    *out = m;
+    return hdr;
+}
+
+/**
+ * Send a Sync (t1 = master clock at TX)
+ */
+static void sim_send_sync(uint16_t seq_id)
+{
+    struct rte_mbuf *m;
+    ptp_header_t *hdr = sim_build_frame(&m, PTP_SIM_RX_VLAN, sizeof(ptp_sync_msg_t));
+    if (!hdr)
+        return;
+
+    ptp_sync_msg_t *sync = (ptp_sync_msg_t *)hdr;
+    hdr->msg_type = PTP_MSG_SYNC;
+    hdr->control = PTP_CTRL_SYNC;
+    hdr->sequence_id = rte_cpu_to_be_16(seq_id);
+    hdr->log_msg_interval = PTP_LOG_MSG_INTERVAL;
+
+    uint64_t now = sim_realtime_ns();
+    ns_to_ptp_timestamp(now + PTP_SIM_MASTER_OFFSET_NS, &sync->origin_timestamp);
+
+    // Slave NIC latches the frame one path delay later (slave clock)
+    ptp_ts_sim_latch_rx(sim_slave_port, now + PTP_SIM_PATH_DELAY_NS);
+
+    if (rte_eth_tx_burst(sim_master_port, PTP_TX_QUEUE_ID, &m, 1) == 0) {
+        rte_pktmbuf_free(m);
+        return;
+    }
+    sim_sync_tx++;
+}
+
+/**
+ * Answer a Delay_Req (t4 = master clock at RX)
+ */
+static void sim_handle_delay_req(struct rte_mbuf *req)
+{
+    uint64_t now = sim_realtime_ns();
+
+    // Slave NIC TX latch: the frame left the slave "now" (slave clock)
+    ptp_ts_sim_latch_tx(sim_slave_port, now);
+    sim_delay_req_rx++;
+
+    const ptp_header_t *req_hdr = rte_pktmbuf_mtod_offset(req, const ptp_header_t *,
+        sizeof(struct rte_ether_hdr) + sizeof(struct sim_vlan_hdr));
+
+    struct rte_mbuf *m;
+    ptp_header_t *hdr = sim_build_frame(&m, PTP_SIM_RX_VLAN, sizeof(ptp_delay_resp_msg_t));
+    if (!hdr)
+        return;
+
+    ptp_delay_resp_msg_t *resp = (ptp_delay_resp_msg_t *)hdr;
+    hdr->msg_type = PTP_MSG_DELAY_RESP;
+    hdr->control = PTP_CTRL_DELAY_RESP;
+    hdr->sequence_id = req_hdr->sequence_id;
+    hdr->log_msg_interval = PTP_LOG_DELAY_REQ_INT;
+
+    ns_to_ptp_timestamp(now + PTP_SIM_PATH_DELAY_NS + PTP_SIM_MASTER_OFFSET_NS,
+                        &resp->receive_timestamp);
+    memcpy(&resp->requesting_port_id, &req_hdr->source_port_id, sizeof(ptp_port_identity_t));
+
+    if (rte_eth_tx_burst(sim_master_port, PTP_TX_QUEUE_ID, &m, 1) == 0) {
+        rte_pktmbuf_free(m);
+        return;
+    }
+    sim_delay_resp_tx++;
+}
+
+/**
+ * Simulated master main loop
+ */
+static int sim_master_main(void *arg)
+{
+    (void)arg;
+
+    uint64_t hz = rte_get_tsc_hz();
+    uint64_t sync_interval = (hz * PTP_SIM_SYNC_INTERVAL_MS) / 1000;
+    uint64_t next_sync = rte_rdtsc();
+    uint16_t seq_id = 0;
+    struct rte_mbuf *pkts[PTP_SIM_BURST];
+
+    printf("PTP SIM: Master running on lcore %u (Sync every %u ms)\n",
+           rte_lcore_id(), PTP_SIM_SYNC_INTERVAL_MS);
+
+    while (sim_running) {
+        uint64_t now = rte_rdtsc();
+        if (now >= next_sync) {
+            sim_send_sync(seq_id++);
+            next_sync = now + sync_interval;
+        }
+
+        uint16_t nb_rx = rte_eth_rx_burst(sim_master_port, PTP_RX_QUEUE_ID, pkts, PTP_SIM_BURST);
+        for (uint16_t i = 0; i < nb_rx; i++) {
+            if (ptp_is_ptp_packet(pkts[i]) && ptp_get_msg_type(pkts[i]) == PTP_MSG_DELAY_REQ)
+                sim_handle_delay_req(pkts[i]);
+            rte_pktmbuf_free(pkts[i]);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Create net_ring slave/master port pair and configure one slave session
+ */
+int ptp_sim_master_setup(uint16_t slave_lcore_id, uint16_t master_lcore_id)
+{
+    char name[RTE_RING_NAMESIZE];
+    int socket = rte_socket_id();
+
+    for (int q = 0; q < PTP_SIM_NUM_QUEUES; q++) {
+        snprintf(name, sizeof(name), "ptp_sim_s2m_%d", q);
+        s2m_rings[q] = rte_ring_create(name, PTP_SIM_RING_SIZE, socket,
+                                       RING_F_SP_ENQ | RING_F_SC_DEQ);
+        snprintf(name, sizeof(name), "ptp_sim_m2s_%d", q);
+        m2s_rings[q] = rte_ring_create(name, PTP_SIM_RING_SIZE, socket,
+                                       RING_F_SP_ENQ | RING_F_SC_DEQ);
+        if (!s2m_rings[q] || !m2s_rings[q]) {
+            fprintf(stderr, "PTP SIM: Failed to create rings\n");
+            return -1;
+        }
+    }
+
+    int slave = rte_eth_from_rings("ptp_sim_slave", m2s_rings, PTP_SIM_NUM_QUEUES,
+                                   s2m_rings, PTP_SIM_NUM_QUEUES, socket);
+    int master = rte_eth_from_rings("ptp_sim_master", s2m_rings, PTP_SIM_NUM_QUEUES,
+                                    m2s_rings, PTP_SIM_NUM_QUEUES, socket);
+    if (slave < 0 || master < 0) {
+        fprintf(stderr, "PTP SIM: rte_eth_from_rings failed\n");
+        return -1;
+    }
+    if (slave >= PTP_MAX_PORTS) {
+        fprintf(stderr, "PTP SIM: Slave port %d >= PTP_MAX_PORTS (run with --no-pci)\n", slave);
+        return -1;
+    }
+
+    sim_slave_port = (uint16_t)slave;
+    sim_master_port = (uint16_t)master;
+    sim_master_lcore = master_lcore_id;
+
+    sim_pool = rte_pktmbuf_pool_create("ptp_sim_pool", PTP_SIM_POOL_SIZE, 32, 0,
+                                       RTE_MBUF_DEFAULT_BUF_SIZE, socket);
+    if (!sim_pool) {
+        fprintf(stderr, "PTP SIM: Failed to create mbuf pool\n");
+        return -1;
+    }
+
+    if (rte_eth_dev_start(sim_slave_port) != 0 || rte_eth_dev_start(sim_master_port) != 0) {
+        fprintf(stderr, "PTP SIM: Failed to start ring ports\n");
+        return -1;
+    }
+
+    // Slave port uses the emulated NIC latch
+    ptp_ts_sim_attach(sim_slave_port);
+
+    struct ptp_session_config cfg = {
+        .rx_port_id = sim_slave_port,
+        .rx_vlan = PTP_SIM_RX_VLAN,
+        .tx_port_id = sim_slave_port,
+        .tx_vlan = PTP_SIM_TX_VLAN,
+        .tx_vl_idx = PTP_SIM_TX_VL_IDX,
+    };
+    if (ptp_configure_split_sessions(&cfg, 1) != 0) {
+        fprintf(stderr, "PTP SIM: Failed to configure slave session\n");
+        return -1;
+    }
+    if (ptp_assign_lcore(sim_slave_port, slave_lcore_id) != 0) {
+        fprintf(stderr, "PTP SIM: Failed to assign slave lcore %u\n", slave_lcore_id);
+        return -1;
+    }
+
+    sim_configured = true;
+    printf("PTP SIM: Slave port %u (lcore %u) <-> master port %u (lcore %u)\n",
+           sim_slave_port, slave_lcore_id, sim_master_port, master_lcore_id);
+    printf("PTP SIM: Master offset %d ns, path delay %d ns\n",
+           PTP_SIM_MASTER_OFFSET_NS, PTP_SIM_PATH_DELAY_NS);
+    return 0;
+}
+
+/**
+ * Launch simulated master
+ */
+int ptp_sim_master_start(void)
+{
+    if (!sim_configured)
+        return -1;
+
+    sim_running = true;
+    int ret = rte_eal_remote_launch(sim_master_main, NULL, sim_master_lcore);
+    if (ret != 0) {
+        fprintf(stderr, "PTP SIM: Failed to launch master on lcore %u\n", sim_master_lcore);
+        sim_running = false;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Stop simulated master
+ */
+void ptp_sim_master_stop(void)
+{
+    if (!sim_running)
+        return;
+
+    sim_running = false;
+    rte_eal_wait_lcore(sim_master_lcore);
+
+    printf("PTP SIM: Sync TX=%lu Delay_Req RX=%lu Delay_Resp TX=%lu\n",
+           sim_sync_tx, sim_delay_req_rx, sim_delay_resp_tx);
+}
+
+#endif /* PTP_SIM_MASTER_ENABLED */
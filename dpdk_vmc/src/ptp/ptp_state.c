@@ -12,13 +12,15 @@
  *
  * Timing:
  *   - t1: Master's TX time (from Sync packet origin_timestamp)
- *   - t2: Our RX time (software timestamp via rte_rdtsc)
- *   - t3: Our TX time (software timestamp via rte_rdtsc)
+ *   - t2: Our RX time (NIC timestamp, or rte_rdtsc/CLOCK_REALTIME once per RX burst)
+ *   - t3: Our TX time (NIC timestamp, or rte_rdtsc/CLOCK_REALTIME around TX)
  *   - t4: Master's RX time (from Delay_Resp receive_timestamp)
  *
  * Calculations:
  *   - Offset = ((t2 - t1) - (t4 - t3)) / 2
  *   - Delay  = ((t2 - t1) + (t4 - t3)) / 2
+ *
+ * Raw results are then filtered by the servo (ptp_servo.c).
  */
 
 #include <rte_cycles.h>
@@ -31,14 +33,6 @@
 #include "ptp_slave.h"
 #include "config.h"
 
-// Helper: Get current time in nanoseconds (CLOCK_REALTIME - same epoch as PTP)
-static inline uint64_t get_realtime_ns(void)
-{
-    struct timespec ts;
-    clock_gettime(CLOCK_REALTIME, &ts);
-    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
-}
-
 // Timeout values in TSC cycles (calculated at init)
 static uint64_t sync_timeout_cycles;
 static uint64_t delay_resp_timeout_cycles;
@@ -67,7 +61,7 @@ static void init_timeouts(void)
 void ptp_handle_sync(ptp_session_t *session,
                      const ptp_header_t *header,
                      const ptp_timestamp_t *timestamp,
-                     uint64_t rx_tsc)
+                     const ptp_rx_stamp_t *rx)
 {
     init_timeouts();
 
@@ -80,7 +74,7 @@ void ptp_handle_sync(ptp_session_t *session,
     session->sync_seq_id = rte_be_to_cpu_16(header->sequence_id);
 
     // Update timing (always track last sync for timeout detection)
-    session->last_sync_tsc = rx_tsc;
+    session->last_sync_tsc = rx->tsc;
 
     // Only store T1/T2 and transition if we're ready for a new sync cycle
     // Don't overwrite T1/T2 if we're waiting for Delay_Resp (DELAY_REQ_SENT)
@@ -93,12 +87,16 @@ void ptp_handle_sync(ptp_session_t *session,
         // t1: Master's TX time (from Sync origin_timestamp) - PTP epoch
         session->t1_ns = ptp_timestamp_to_ns(timestamp);
 
-        // t2: Our RX time (software timestamps)
-        session->t2_tsc = rx_tsc;                    // TSC for delay calculation
-        session->t2_realtime_ns = get_realtime_ns(); // Realtime for offset calculation
+        // t2: Our RX time (software timestamps, taken once per RX burst)
+        session->t2_tsc = rx->tsc;                   // TSC for delay calculation
+        session->t2_realtime_ns = rx->realtime_ns;   // Realtime for offset calculation
+
+        // t2: NIC RX time (0 = not available, SW only)
+        session->t2_hw_ns = rx->hw_ns;
+        session->t3_hw_ns = 0;
 
         session->state = PTP_STATE_SYNC_RECEIVED;
-        session->last_state_change = rx_tsc;
+        session->last_state_change = rx->tsc;
     }
 }
 
@@ -129,6 +127,10 @@ void ptp_handle_delay_resp(ptp_session_t *session,
         // Calculate offset and delay
         ptp_calculate_offset_delay(session);
 
+        // Filter and discipline the session clock (needs t4 from DTN)
+        if (session->t4_ns != 0)
+            ptp_servo_update(session);
+
         // Mark as synced
         session->state = PTP_STATE_SYNCED;
         session->is_synced = true;
@@ -152,6 +154,10 @@ void ptp_handle_delay_resp(ptp_session_t *session,
  *   - T2: Our Sync RX time (clock_gettime CLOCK_REALTIME)
  *   - T3: Our Delay_Req TX time (clock_gettime CLOCK_REALTIME)
  *   - T4: Master's Delay_Req RX time (from Delay_Resp packet)
+ *
+ * When the NIC latched both T2 and T3 (t2_hw_ns/t3_hw_ns), offset/delay are
+ * taken from the NIC timestamps; the software result is still scored in the
+ * SW jitter bucket so both sources can be compared.
  */
 void ptp_calculate_offset_delay(ptp_session_t *session)
 {
@@ -162,34 +168,13 @@ void ptp_calculate_offset_delay(ptp_session_t *session)
     uint64_t t2_ns = session->t2_realtime_ns;     // Our Sync RX (clock_gettime)
     uint64_t t3_ns = session->t3_realtime_ns;     // Our Delay_Req TX (clock_gettime)
     uint64_t t4_ns = session->t4_ns;              // Master Delay_Req RX (from packet)
-
-    // Also get TSC-based values for comparison
-    uint64_t t2_tsc_ns = tsc_to_ns(session->t2_tsc, tsc_hz);
-    uint64_t t3_tsc_ns = tsc_to_ns(session->t3_tsc, tsc_hz);
-
-    // Debug: Print all timestamps (first 10 calculations)
-    static uint64_t calc_print_count = 0;
-    if (calc_print_count < 10) {
-        printf("PTP Calc [Port%u VLAN%u]:\n", session->port_id, session->rx_vlan_id);
-        printf("  T1 (Master Sync TX)     = %lu ns (PTP epoch)\n", t1_ns);
-        printf("  T2 (Slave Sync RX)      = %lu ns (realtime)\n", t2_ns);
-        printf("  T3 (Slave DelayReq TX)  = %lu ns (realtime)\n", t3_ns);
-        printf("  T4 (Master DelayReq RX) = %lu ns (PTP epoch)%s\n", t4_ns, t4_ns == 0 ? " (EMPTY!)" : "");
-        printf("  T3-T2 (our processing)  = %ld ns (%.2f us)\n",
-               (int64_t)(t3_ns - t2_ns), (t3_ns - t2_ns) / 1000.0);
-        printf("  T3-T2 (TSC based)       = %ld ns (%.2f us)\n",
-               (int64_t)(t3_tsc_ns - t2_tsc_ns), (t3_tsc_ns - t2_tsc_ns) / 1000.0);
-    }
+    bool have_hw = (session->t2_hw_ns != 0 && session->t3_hw_ns != 0);
 
     // Check if T4 is valid (DTN may not fill it in)
     if (t4_ns == 0) {
         // T4 not provided by DTN, cannot calculate
         session->delay_ns = 0;
         session->offset_ns = 0;
-        if (calc_print_count < 10) {
-            printf("  >>> T4 is EMPTY - cannot calculate offset/delay\n");
-            calc_print_count++;
-        }
     } else {
         // Calculate using PTP formulas
         // T2 - T1: Time from Master TX to Slave RX = delay + offset
@@ -204,18 +189,38 @@ void ptp_calculate_offset_delay(ptp_session_t *session)
         // Delay = ((T2-T1) + (T4-T3)) / 2
         // One-way network propagation delay
         session->delay_ns = (t2_minus_t1 + t4_minus_t3) / 2;
+        session->ts_mode = PTP_TS_MODE_SW;
+        ptp_jitter_add(&session->jitter[PTP_JITTER_SW], session->offset_ns, session->delay_ns);
+
+        // NIC timestamps available for both T2 and T3: prefer them
+        if (have_hw) {
+            int64_t hw_t2_minus_t1 = (int64_t)session->t2_hw_ns - (int64_t)t1_ns;
+            int64_t hw_t4_minus_t3 = (int64_t)t4_ns - (int64_t)session->t3_hw_ns;
+            session->offset_ns = (hw_t2_minus_t1 - hw_t4_minus_t3) / 2;
+            session->delay_ns = (hw_t2_minus_t1 + hw_t4_minus_t3) / 2;
+            session->ts_mode = ptp_ts_port_mode(session->port_id);
+            ptp_jitter_add(&session->jitter[PTP_JITTER_HW], session->offset_ns, session->delay_ns);
+        }
+    }
 
-        if (calc_print_count < 10) {
-            printf("  T2-T1 (Sync path)       = %ld ns (%.2f ms)\n",
-                   t2_minus_t1, t2_minus_t1 / 1000000.0);
-            printf("  T4-T3 (DelayReq path)   = %ld ns (%.2f ms)\n",
-                   t4_minus_t3, t4_minus_t3 / 1000000.0);
-            printf("  >>> Offset = (T2-T1 - T4+T3) / 2 = %ld ns (%.3f ms)\n",
-                   session->offset_ns, session->offset_ns / 1000000.0);
-            printf("  >>> Delay  = (T2-T1 + T4-T3) / 2 = %ld ns (%.2f us)\n",
-                   session->delay_ns, session->delay_ns / 1000.0);
-            calc_print_count++;
+    // Debug: Post all timestamps (first 10 calculations), printed by the drain thread
+    static uint64_t calc_print_count = 0;
+    if (calc_print_count < 10) {
+        ptp_event_t *ev = ptp_event_alloc(session->port_id, PTP_EVT_CALC);
+        if (ev) {
+            ev->vlan_id = session->rx_vlan_id;
+            ev->flags = have_hw;
+            ev->v[0] = t1_ns;
+            ev->v[1] = t2_ns;
+            ev->v[2] = t3_ns;
+            ev->v[3] = t4_ns;
+            ev->v[4] = tsc_to_ns(session->t3_tsc, tsc_hz) - tsc_to_ns(session->t2_tsc, tsc_hz);
+            ev->v[5] = session->t2_hw_ns;
+            ev->v[6] = session->t3_hw_ns;
+            ev->v[7] = session->ts_mode;
+            ptp_event_post(session->port_id);
         }
+        calc_print_count++;
     }
 
     session->tsc_hz = tsc_hz;
@@ -309,7 +314,7 @@ void ptp_state_machine_tick(ptp_session_t *session,
 void ptp_session_init(ptp_session_t *session,
                       uint16_t rx_port_id,
                       uint16_t tx_port_id,
-                      uint8_t session_idx,
+                      uint16_t session_idx,
                       uint16_t rx_vlan_id,
                       uint16_t tx_vlan_id,
                       uint16_t tx_vl_idx)
@@ -349,6 +354,8 @@ void ptp_session_reset_stats(ptp_session_t *session)
     session->sync_timeout_count = 0;
     session->sync_errors = 0;
     session->sync_count = 0;
+    memset(session->jitter, 0, sizeof(session->jitter));
+    ptp_servo_reset_stats(&session->servo);
 }
 
 /**
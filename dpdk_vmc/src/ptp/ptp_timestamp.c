@@ -0,0 +1,235 @@
+#define _GNU_SOURCE  // For clock_gettime and CLOCK_REALTIME
+
+/**
+ * PTP Timestamping
+ *
+ * Timestamp source for t2 (Sync RX) and t3 (Delay_Req TX), selected per port.
+ *
+ * Modes:
+ *   HW  - rte_eth_timesync_enable() succeeded on the port.
+ *         RX: mbufs flagged RTE_MBUF_F_RX_IEEE1588_TMST are read with
+ *             rte_eth_timesync_read_rx_timestamp() (mbuf->timesync = latch index)
+ *         TX: Delay_Req is sent with RTE_MBUF_F_TX_IEEE1588_TMST and the latched
+ *             timestamp is polled with rte_eth_timesync_read_tx_timestamp()
+ *         The NIC clock is loaded from CLOCK_REALTIME at enable time so offsets
+ *         stay in the same epoch as the software path.
+ *   SIM - Emulated NIC latch, filled by the net_ring simulated master.
+ *   SW  - PMD has no timesync support; callers keep rte_rdtsc/clock_gettime.
+ *
+ * Software timestamps are always taken as well, so both modes can be
+ * compared on the same exchanges (see ptp_print_stats jitter table).
+ */
+
+#include <rte_cycles.h>
+#include <rte_ethdev.h>
+#include <rte_mbuf.h>
+#include <rte_pause.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "ptp_types.h"
+#include "ptp_slave.h"
+#include "config.h"
+
+// Per-port timestamp mode
+static ptp_ts_mode_t port_ts_mode[RTE_MAX_ETHPORTS];
+static bool port_ts_enabled[RTE_MAX_ETHPORTS];
+
+// Emulated NIC latch for SIM mode (0 = empty)
+static uint64_t sim_rx_latch[RTE_MAX_ETHPORTS];
+static uint64_t sim_tx_latch[RTE_MAX_ETHPORTS];
+
+static inline uint64_t timespec_to_ns(const struct timespec *ts)
+{
+    return (uint64_t)ts->tv_sec * 1000000000ULL + (uint64_t)ts->tv_nsec;
+}
+
+/**
+ * Enable timestamping on a port
+ */
+int ptp_ts_port_enable(uint16_t port_id)
+{
+    if (port_id >= RTE_MAX_ETHPORTS)
+        return -1;
+
+    if (port_ts_enabled[port_id])
+        return 0;
+
+    port_ts_enabled[port_id] = true;
+
+    if (port_ts_mode[port_id] == PTP_TS_MODE_SIM) {
+        printf("PTP: Port %u timestamps: SIM (emulated NIC latch)\n", port_id);
+        return 0;
+    }
+
+#if PTP_HW_TIMESTAMP_ENABLED
+    int ret = rte_eth_timesync_enable(port_id);
+    if (ret == 0) {
+        // Align NIC clock with CLOCK_REALTIME (same epoch as software t2/t3)
+        struct timespec now;
+        clock_gettime(CLOCK_REALTIME, &now);
+        if (rte_eth_timesync_write_time(port_id, &now) != 0) {
+            printf("PTP: Port %u: Warning - cannot set NIC clock, offsets are relative to NIC epoch\n",
+                   port_id);
+        }
+
+        // Drain stale latches so the first exchange is not mismatched
+        struct timespec stale;
+        rte_eth_timesync_read_rx_timestamp(port_id, &stale, 0);
+        rte_eth_timesync_read_tx_timestamp(port_id, &stale);
+
+        port_ts_mode[port_id] = PTP_TS_MODE_HW;
+        printf("PTP: Port %u timestamps: HW (rte_eth_timesync)\n", port_id);
+        return 0;
+    }
+
+    printf("PTP: Port %u timestamps: SW (timesync not supported by PMD: %d)\n",
+           port_id, ret);
+#else
+    printf("PTP: Port %u timestamps: SW (PTP_HW_TIMESTAMP_ENABLED=0)\n", port_id);
+#endif
+
+    port_ts_mode[port_id] = PTP_TS_MODE_SW;
+    return 0;
+}
+
+/**
+ * Disable timestamping on all ports enabled by ptp_ts_port_enable
+ */
+void ptp_ts_disable_all(void)
+{
+    for (uint16_t p = 0; p < RTE_MAX_ETHPORTS; p++) {
+        if (!port_ts_enabled[p])
+            continue;
+
+        if (port_ts_mode[p] == PTP_TS_MODE_HW)
+            rte_eth_timesync_disable(p);
+
+        port_ts_enabled[p] = false;
+    }
+}
+
+/**
+ * Get timestamp mode of a port
+ */
+ptp_ts_mode_t ptp_ts_port_mode(uint16_t port_id)
+{
+    if (port_id >= RTE_MAX_ETHPORTS)
+        return PTP_TS_MODE_SW;
+
+    return port_ts_mode[port_id];
+}
+
+/**
+ * Read Sync RX timestamp for a received mbuf
+ */
+bool ptp_ts_read_rx(uint16_t port_id, struct rte_mbuf *mbuf, uint64_t *rx_ns)
+{
+    if (port_id >= RTE_MAX_ETHPORTS)
+        return false;
+
+    switch (port_ts_mode[port_id]) {
+    case PTP_TS_MODE_HW: {
+        if (!(mbuf->ol_flags & RTE_MBUF_F_RX_IEEE1588_TMST))
+            return false;
+
+        struct timespec ts;
+        if (rte_eth_timesync_read_rx_timestamp(port_id, &ts, mbuf->timesync) != 0)
+            return false;
+
+        *rx_ns = timespec_to_ns(&ts);
+        return true;
+    }
+
+    case PTP_TS_MODE_SIM: {
+        uint64_t ns = __atomic_exchange_n(&sim_rx_latch[port_id], 0, __ATOMIC_ACQ_REL);
+        if (ns == 0)
+            return false;
+
+        *rx_ns = ns;
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+/**
+ * Request TX timestamp for an mbuf about to be sent
+ */
+void ptp_ts_prepare_tx(uint16_t port_id, struct rte_mbuf *mbuf)
+{
+    if (port_id >= RTE_MAX_ETHPORTS)
+        return;
+
+    if (port_ts_mode[port_id] == PTP_TS_MODE_HW)
+        mbuf->ol_flags |= RTE_MBUF_F_TX_IEEE1588_TMST;
+    else if (port_ts_mode[port_id] == PTP_TS_MODE_SIM)
+        __atomic_store_n(&sim_tx_latch[port_id], 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * Poll latched TX timestamp (up to PTP_HW_TX_TS_POLL_US)
+ */
+bool ptp_ts_read_tx(uint16_t port_id, uint64_t *tx_ns)
+{
+    if (port_id >= RTE_MAX_ETHPORTS)
+        return false;
+
+    ptp_ts_mode_t mode = port_ts_mode[port_id];
+    if (mode == PTP_TS_MODE_SW)
+        return false;
+
+    uint64_t deadline = rte_rdtsc() + (rte_get_tsc_hz() * PTP_HW_TX_TS_POLL_US) / 1000000;
+
+    do {
+        if (mode == PTP_TS_MODE_HW) {
+            struct timespec ts;
+            if (rte_eth_timesync_read_tx_timestamp(port_id, &ts) == 0) {
+                *tx_ns = timespec_to_ns(&ts);
+                return true;
+            }
+        } else {
+            uint64_t ns = __atomic_exchange_n(&sim_tx_latch[port_id], 0, __ATOMIC_ACQ_REL);
+            if (ns != 0) {
+                *tx_ns = ns;
+                return true;
+            }
+        }
+        rte_pause();
+    } while (rte_rdtsc() < deadline);
+
+    return false;
+}
+
+/**
+ * Switch a port to the emulated NIC latch (simulated master)
+ */
+void ptp_ts_sim_attach(uint16_t port_id)
+{
+    if (port_id >= RTE_MAX_ETHPORTS)
+        return;
+
+    port_ts_mode[port_id] = PTP_TS_MODE_SIM;
+    __atomic_store_n(&sim_rx_latch[port_id], 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&sim_tx_latch[port_id], 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * Latch emulated Sync RX timestamp
+ */
+void ptp_ts_sim_latch_rx(uint16_t port_id, uint64_t rx_ns)
+{
+    if (port_id < RTE_MAX_ETHPORTS)
+        __atomic_store_n(&sim_rx_latch[port_id], rx_ns, __ATOMIC_RELEASE);
+}
+
+/**
+ * Latch emulated Delay_Req TX timestamp
+ */
+void ptp_ts_sim_latch_tx(uint16_t port_id, uint64_t tx_ns)
+{
+    if (port_id < RTE_MAX_ETHPORTS)
+        __atomic_store_n(&sim_tx_latch[port_id], tx_ns, __ATOMIC_RELEASE);
+}
@@ -2,13 +2,18 @@
  * PTP Worker
  *
  * Main worker loop for PTP slave operation.
- * One worker runs per port, handling all 4 VLAN sessions.
+ * One worker runs per port, handling all VLAN sessions of that port
+ * (session count is sized at configure time).
  *
  * Worker responsibilities:
  *   1. Poll PTP RX queue for incoming Sync and Delay_Resp packets
  *   2. Process received packets and update session state
- *   3. Run state machine tick for each session
+ *      (session lookup is O(1) through the port's VLAN map)
+ *   3. Run state machine tick, PTP_TICK_BUDGET sessions per loop (round-robin)
  *   4. Send Delay_Req packets when required
+ *
+ * The worker never calls printf: debug output goes through the port's event
+ * ring (ptp_event.c) and loop time is kept as a histogram for ptp_print_stats.
  */
 
 #include <rte_cycles.h>
@@ -16,13 +21,19 @@
 #include <rte_mbuf.h>
 #include <rte_lcore.h>
 #include <rte_log.h>
+#include <rte_malloc.h>
+#include <rte_prefetch.h>
+#include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "ptp_types.h"
 #include "ptp_slave.h"
 #include "config.h"
+#include "adaptive_poll.h"
 
 // Maximum packets to process per poll
 #define PTP_RX_BURST_SIZE 32
@@ -65,27 +76,69 @@ ptp_session_t *ptp_get_session(uint16_t port_id, uint16_t vlan_id)
     if (!port)
         return NULL;
 
+    uint16_t idx = port->vlan_map[vlan_id & (PTP_VLAN_MAP_SIZE - 1)];
+    if (idx != PTP_SESSION_NONE)
+        return &port->sessions[idx];
+
+    // TX VLANs are not mapped (not on the hot path)
     for (int i = 0; i < port->session_count; i++) {
-        if (port->sessions[i].rx_vlan_id == vlan_id ||
-            port->sessions[i].tx_vlan_id == vlan_id) {
+        if (port->sessions[i].tx_vlan_id == vlan_id)
             return &port->sessions[i];
-        }
     }
 
     return NULL;
 }
 
 /**
- * Find session by VLAN ID within a port
+ * Find session by RX VLAN ID within a port (O(1))
  */
-static ptp_session_t *find_session_by_vlan(ptp_port_t *port, uint16_t vlan_id)
+static inline ptp_session_t *find_session_by_vlan(ptp_port_t *port, uint16_t vlan_id)
 {
-    for (int i = 0; i < port->session_count; i++) {
-        if (port->sessions[i].rx_vlan_id == vlan_id) {
-            return &port->sessions[i];
-        }
-    }
-    return NULL;
+    uint16_t idx = port->vlan_map[vlan_id & (PTP_VLAN_MAP_SIZE - 1)];
+    return (idx != PTP_SESSION_NONE) ? &port->sessions[idx] : NULL;
+}
+
+/**
+ * Get current time in nanoseconds (CLOCK_REALTIME)
+ */
+static inline uint64_t get_realtime_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * Add one loop duration to the port histogram
+ * Bucket 0: < 256 ns, bucket i: [128 << i, 256 << i) ns, last bucket open.
+ */
+static inline void loop_hist_add(ptp_port_t *port, uint64_t ns)
+{
+    uint64_t v = ns >> PTP_LOOP_HIST_BASE_SHIFT;
+    unsigned b = v ? (64 - __builtin_clzll(v)) : 0;
+    if (b >= PTP_LOOP_HIST_BUCKETS)
+        b = PTP_LOOP_HIST_BUCKETS - 1;
+
+    port->loop_hist[b]++;
+    port->loop_count++;
+    if (ns > port->loop_max_ns)
+        port->loop_max_ns = ns;
+}
+
+/**
+ * Post a raw Q5 packet event (first bytes of the frame)
+ */
+static void post_raw_rx_event(uint16_t port_id, struct rte_mbuf *mbuf)
+{
+    ptp_event_t *ev = ptp_event_alloc(port_id, PTP_EVT_RAW_RX);
+    if (!ev)
+        return;
+
+    uint16_t len = rte_pktmbuf_data_len(mbuf);
+    ev->v[0] = len;
+    ev->data_len = RTE_MIN(len, (uint16_t)PTP_EVENT_DATA_LEN);
+    memcpy(ev->data, rte_pktmbuf_mtod(mbuf, uint8_t *), ev->data_len);
+    ptp_event_post(port_id);
 }
 
 /**
@@ -110,8 +163,19 @@ int ptp_worker_main(void *arg)
     uint64_t ptp_rx = 0;
     uint64_t non_ptp_rx = 0;
     uint64_t msg_type_count[16] = {0};  // Count per PTP message type
+    uint64_t raw_event_count = 0;
+    uint64_t no_session_count = 0;
+    uint64_t tsc_hz = rte_get_tsc_hz();
     uint64_t last_debug_tsc = rte_rdtsc();
-    uint64_t debug_interval_tsc = rte_get_tsc_hz() * 5; // 5 seconds
+    uint64_t debug_interval_tsc = tsc_hz * 5; // 5 seconds
+    uint16_t tick_budget = RTE_MIN(port->session_count, (uint16_t)PTP_TICK_BUDGET);
+
+#if ADAPTIVE_POLL_ENABLED
+    // Bounded sleeps only: the state machine has to tick every loop
+    struct adaptive_poll *ap = adaptive_poll_register(
+        ADAPTIVE_POLL_PTP, port_id, PTP_RX_QUEUE_ID,
+        RTE_MIN(adaptive_poll_port_max_level(port_id), (uint8_t)ADAPTIVE_POLL_MAX_LEVEL_PTP));
+#endif
 
     while (ptp_workers_running) {
         uint64_t current_tsc = rte_rdtsc();
@@ -122,32 +186,24 @@ int ptp_worker_main(void *arg)
 
         total_rx += nb_rx;
 
+        // Software RX stamp, taken once per burst
+        ptp_rx_stamp_t burst_stamp = {0};
+        if (nb_rx > 0) {
+            burst_stamp.tsc = rte_rdtsc();
+            burst_stamp.realtime_ns = get_realtime_ns();
+        }
+
         // Process received packets
         for (uint16_t i = 0; i < nb_rx; i++) {
             struct rte_mbuf *mbuf = rx_mbufs[i];
-            uint64_t rx_tsc = rte_rdtsc(); // Software RX timestamp
-
-            // Debug: Print raw packet header for any packet on Q5
-            static uint64_t raw_pkt_print_count = 0;
-            if (raw_pkt_print_count < 20) {
-                uint8_t *pkt = rte_pktmbuf_mtod(mbuf, uint8_t *);
-                uint16_t len = rte_pktmbuf_data_len(mbuf);
-                printf("PTP Q5 Raw [Port%u len=%u]: "
-                       "Dst=%02X:%02X:%02X:%02X:%02X:%02X "
-                       "Src=%02X:%02X:%02X:%02X:%02X:%02X "
-                       "Type=0x%02X%02X",
-                       port_id, len,
-                       pkt[0], pkt[1], pkt[2], pkt[3], pkt[4], pkt[5],
-                       pkt[6], pkt[7], pkt[8], pkt[9], pkt[10], pkt[11],
-                       pkt[12], pkt[13]);
-                // If VLAN tagged (0x8100), print VLAN info
-                if (pkt[12] == 0x81 && pkt[13] == 0x00 && len >= 18) {
-                    uint16_t vlan_tci = (pkt[14] << 8) | pkt[15];
-                    uint16_t inner_type = (pkt[16] << 8) | pkt[17];
-                    printf(" VLAN=%u Inner=0x%04X", vlan_tci & 0x0FFF, inner_type);
-                }
-                printf("\n");
-                raw_pkt_print_count++;
+
+            if (i + 1 < nb_rx)
+                rte_prefetch0(rte_pktmbuf_mtod(rx_mbufs[i + 1], void *));
+
+            // Debug: raw packet header for the first packets on Q5
+            if (raw_event_count < 20) {
+                post_raw_rx_event(port_id, mbuf);
+                raw_event_count++;
             }
 
             // Check if it's a PTP packet
@@ -159,6 +215,10 @@ int ptp_worker_main(void *arg)
 
             ptp_rx++;
 
+            // NIC RX timestamp (must be read for every PTP packet to free the latch)
+            ptp_rx_stamp_t rx = burst_stamp;
+            ptp_ts_read_rx(port_id, mbuf, &rx.hw_ns);
+
             // Count message types
             int msg_type = ptp_get_msg_type(mbuf);
             if (msg_type >= 0 && msg_type < 16) {
@@ -171,39 +231,54 @@ int ptp_worker_main(void *arg)
 
             if (session) {
                 // Process the PTP packet
-                ptp_packet_process(session, mbuf, rx_tsc);
-            } else {
+                ptp_packet_process(session, mbuf, &rx);
+            } else if (no_session_count < 10) {
                 // Debug: No session for this VLAN
-                static uint64_t no_session_count = 0;
-                if (no_session_count < 10) {
-                    printf("PTP: No session for Port%u VLAN=%u\n", port_id, vlan_id);
-                    no_session_count++;
+                ptp_event_t *ev = ptp_event_alloc(port_id, PTP_EVT_NO_SESSION);
+                if (ev) {
+                    ev->vlan_id = vlan_id;
+                    ptp_event_post(port_id);
                 }
+                no_session_count++;
             }
 
             rte_pktmbuf_free(mbuf);
         }
 
-        // Run state machine for each session
-        for (int i = 0; i < port->session_count; i++) {
-            ptp_session_t *session = &port->sessions[i];
-            ptp_state_machine_tick(session, port, current_tsc);
+        // Run state machine, PTP_TICK_BUDGET sessions per loop (round-robin)
+        for (uint16_t n = 0; n < tick_budget; n++) {
+            ptp_state_machine_tick(&port->sessions[port->tick_next], port, current_tsc);
+            if (++port->tick_next >= port->session_count)
+                port->tick_next = 0;
         }
 
-        // Debug output every 5 seconds (always print, even if total=0)
+        // Debug counters every 5 seconds (always posted, even if total=0)
         if (current_tsc - last_debug_tsc > debug_interval_tsc) {
-            printf("PTP Debug Port %u Q5: total=%lu ptp=%lu non_ptp=%lu "
-                   "[Sync=%lu DelReq=%lu DelResp=%lu]\n",
-                   port_id, total_rx, ptp_rx, non_ptp_rx,
-                   msg_type_count[PTP_MSG_SYNC],
-                   msg_type_count[PTP_MSG_DELAY_REQ],
-                   msg_type_count[PTP_MSG_DELAY_RESP]);
+            ptp_event_t *ev = ptp_event_alloc(port_id, PTP_EVT_COUNTERS);
+            if (ev) {
+                ev->v[0] = total_rx;
+                ev->v[1] = ptp_rx;
+                ev->v[2] = non_ptp_rx;
+                ev->v[3] = msg_type_count[PTP_MSG_SYNC];
+                ev->v[4] = msg_type_count[PTP_MSG_DELAY_REQ];
+                ev->v[5] = msg_type_count[PTP_MSG_DELAY_RESP];
+                ptp_event_post(port_id);
+            }
             last_debug_tsc = current_tsc;
         }
 
+        loop_hist_add(port, ((rte_rdtsc() - current_tsc) * 1000000000ULL) / tsc_hz);
+
+#if ADAPTIVE_POLL_ENABLED
+        adaptive_poll_update(ap, nb_rx);
+#endif
         rte_pause();
     }
 
+#if ADAPTIVE_POLL_ENABLED
+    adaptive_poll_release(ap);
+#endif
+
     printf("PTP Worker: Stopping on lcore %u for port %u\n",
            rte_lcore_id(), port_id);
 
@@ -233,6 +308,46 @@ static struct rte_mempool *create_ptp_mbuf_pool(uint16_t port_id)
     return pool;
 }
 
+/**
+ * Size a port's session array (NUMA local) and create its VLAN map / event ring
+ * Existing sessions are kept when the array grows.
+ */
+static int ptp_port_alloc_sessions(ptp_port_t *port, uint16_t port_id, uint16_t capacity)
+{
+    if (capacity == 0 || capacity > PTP_MAX_SESSIONS_PER_PORT) {
+        fprintf(stderr, "PTP: Port %u session count %u out of range (max %d)\n",
+                port_id, capacity, PTP_MAX_SESSIONS_PER_PORT);
+        return -1;
+    }
+
+    int socket_id = rte_eth_dev_socket_id(port_id);
+    if (socket_id < 0)
+        socket_id = rte_socket_id();
+
+    if (!port->sessions) {
+        port->port_id = port_id;
+        memset(port->vlan_map, 0xFF, sizeof(port->vlan_map));
+    }
+
+    if (capacity > port->session_capacity) {
+        ptp_session_t *arr = rte_zmalloc_socket("ptp_sessions", capacity * sizeof(ptp_session_t),
+                                                RTE_CACHE_LINE_SIZE, socket_id);
+        if (!arr) {
+            fprintf(stderr, "PTP: Failed to allocate %u sessions for port %u\n",
+                    capacity, port_id);
+            return -1;
+        }
+        if (port->sessions) {
+            memcpy(arr, port->sessions, port->session_count * sizeof(ptp_session_t));
+            rte_free(port->sessions);
+        }
+        port->sessions = arr;
+        port->session_capacity = capacity;
+    }
+
+    return ptp_event_ring_create(port, socket_id);
+}
+
 /**
  * Initialize PTP subsystem
  */
@@ -274,6 +389,8 @@ int ptp_configure_split_sessions(const struct ptp_session_config *sessions,
 
     printf("PTP: Configuring %u sessions with split TX/RX port support\n", session_count);
 
+    // First pass: validate and count sessions per RX port
+    uint16_t per_port[PTP_MAX_PORTS] = {0};
     for (int i = 0; i < session_count; i++) {
         const struct ptp_session_config *cfg = &sessions[i];
 
@@ -284,6 +401,22 @@ int ptp_configure_split_sessions(const struct ptp_session_config *sessions,
             return -1;
         }
 
+        per_port[cfg->rx_port_id]++;
+    }
+
+    // Allocate session arrays (NUMA local to the RX port)
+    for (uint16_t p = 0; p < PTP_MAX_PORTS; p++) {
+        if (per_port[p] == 0)
+            continue;
+
+        ptp_port_t *rx_port = &g_ptp_ctx.ports[p];
+        if (ptp_port_alloc_sessions(rx_port, p, rx_port->session_count + per_port[p]) < 0)
+            return -1;
+    }
+
+    for (int i = 0; i < session_count; i++) {
+        const struct ptp_session_config *cfg = &sessions[i];
+
         // Get or initialize RX port
         ptp_port_t *rx_port = &g_ptp_ctx.ports[cfg->rx_port_id];
 
@@ -295,20 +428,19 @@ int ptp_configure_split_sessions(const struct ptp_session_config *sessions,
                         cfg->rx_port_id);
                 return -1;
             }
-            rx_port->port_id = cfg->rx_port_id;
             rx_port->enabled = true;
             g_ptp_ctx.port_count++;
         }
 
-        // Check if we have room for another session
-        if (rx_port->session_count >= PTP_SESSIONS_PER_PORT) {
-            fprintf(stderr, "PTP: RX port %u already has max sessions (%d)\n",
-                    cfg->rx_port_id, PTP_SESSIONS_PER_PORT);
+        // RX VLAN must be unique within the port (VLAN map key)
+        if (rx_port->vlan_map[cfg->rx_vlan & (PTP_VLAN_MAP_SIZE - 1)] != PTP_SESSION_NONE) {
+            fprintf(stderr, "PTP: RX port %u already has a session on VLAN %u\n",
+                    cfg->rx_port_id, cfg->rx_vlan);
             return -1;
         }
 
         // Initialize session with split TX/RX ports
-        uint8_t session_idx = rx_port->session_count;
+        uint16_t session_idx = rx_port->session_count;
         ptp_session_init(&rx_port->sessions[session_idx],
                         cfg->rx_port_id,   // RX port (session owner)
                         cfg->tx_port_id,   // TX port for Delay_Req
@@ -317,6 +449,7 @@ int ptp_configure_split_sessions(const struct ptp_session_config *sessions,
                         cfg->tx_vlan,
                         cfg->tx_vl_idx);
 
+        rx_port->vlan_map[cfg->rx_vlan & (PTP_VLAN_MAP_SIZE - 1)] = session_idx;
         rx_port->session_count++;
 
         printf("PTP: Session %d configured - RX Port %u (VLAN %u) / TX Port %u (VLAN %u, VL-IDX %u)\n",
@@ -345,21 +478,17 @@ int ptp_port_configure_sessions(uint16_t port_id,
         return -1;
     }
 
-    if (session_count > PTP_SESSIONS_PER_PORT) {
-        fprintf(stderr, "PTP: Too many sessions %u (max %d)\n",
-                session_count, PTP_SESSIONS_PER_PORT);
-        return -1;
-    }
-
     ptp_port_t *port = &g_ptp_ctx.ports[port_id];
 
+    if (ptp_port_alloc_sessions(port, port_id, session_count) < 0)
+        return -1;
+
     // Create mbuf pool for TX
     port->tx_mbuf_pool = create_ptp_mbuf_pool(port_id);
     if (!port->tx_mbuf_pool) {
         return -1;
     }
 
-    port->port_id = port_id;
     port->session_count = session_count;
 
     // Initialize sessions (legacy: same TX/RX port)
@@ -372,6 +501,7 @@ int ptp_port_configure_sessions(uint16_t port_id,
                         rx_port, tx_port, i,
                         sessions[i].rx_vlan, sessions[i].tx_vlan,
                         sessions[i].tx_vl_idx);
+        port->vlan_map[sessions[i].rx_vlan & (PTP_VLAN_MAP_SIZE - 1)] = i;
     }
 
     port->enabled = true;
@@ -390,16 +520,28 @@ int ptp_port_configure(uint16_t port_id,
                        const uint16_t *tx_vlans,
                        uint16_t vlan_count)
 {
+    if (vlan_count == 0 || vlan_count > PTP_MAX_SESSIONS_PER_PORT) {
+        fprintf(stderr, "PTP: Invalid VLAN count %u (max %d)\n",
+                vlan_count, PTP_MAX_SESSIONS_PER_PORT);
+        return -1;
+    }
+
     // Convert to session config format (same TX/RX port for legacy)
-    struct ptp_session_config sessions[PTP_SESSIONS_PER_PORT];
-    for (int i = 0; i < vlan_count && i < PTP_SESSIONS_PER_PORT; i++) {
+    struct ptp_session_config *sessions = calloc(vlan_count, sizeof(*sessions));
+    if (!sessions)
+        return -1;
+
+    for (int i = 0; i < vlan_count; i++) {
         sessions[i].rx_port_id = port_id;  // Same port for legacy
         sessions[i].tx_port_id = port_id;  // Same port for legacy
         sessions[i].rx_vlan = rx_vlans[i];
         sessions[i].tx_vlan = tx_vlans[i];
         sessions[i].tx_vl_idx = 0;  // Default: not used
     }
-    return ptp_port_configure_sessions(port_id, sessions, vlan_count);
+
+    int ret = ptp_port_configure_sessions(port_id, sessions, vlan_count);
+    free(sessions);
+    return ret;
 }
 
 /**
@@ -437,6 +579,21 @@ int ptp_start(void)
     printf("PTP: Installing flow rules...\n");
     ptp_flow_rules_install_all();
 
+    // Enable timestamping (HW if the PMD supports timesync, else SW)
+    for (int i = 0; i < PTP_MAX_PORTS; i++) {
+        ptp_port_t *port = &g_ptp_ctx.ports[i];
+        if (!port->enabled)
+            continue;
+
+        ptp_ts_port_enable(port->port_id);
+        for (int s = 0; s < port->session_count; s++) {
+            ptp_ts_port_enable(port->sessions[s].tx_port_id);
+        }
+    }
+
+    // Debug output of the workers (non-realtime thread)
+    ptp_event_thread_start();
+
     // Start workers
     ptp_workers_running = true;
 
@@ -480,9 +637,14 @@ void ptp_stop(void)
         }
     }
 
+    // Print what the workers left in their event rings
+    ptp_event_thread_stop();
+
     // Remove flow rules
     ptp_flow_rules_remove_all();
 
+    ptp_ts_disable_all();
+
     g_ptp_ctx.running = false;
     printf("PTP: Stopped\n");
 }
@@ -501,6 +663,13 @@ void ptp_cleanup(void)
             rte_mempool_free(port->tx_mbuf_pool);
             port->tx_mbuf_pool = NULL;
         }
+
+        // Free session arrays and event rings
+        rte_free(port->sessions);
+        port->sessions = NULL;
+        port->session_count = 0;
+        port->session_capacity = 0;
+        ptp_event_ring_free(port);
     }
 
     g_ptp_ctx.initialized = false;
@@ -510,9 +679,9 @@ void ptp_cleanup(void)
 /**
  * Get statistics for all PTP sessions
  */
-void ptp_get_stats(ptp_session_stats_t *stats, uint8_t *count)
+void ptp_get_stats(ptp_session_stats_t *stats, uint16_t max_stats, uint16_t *count)
 {
-    uint8_t idx = 0;
+    uint16_t idx = 0;
 
     for (int p = 0; p < PTP_MAX_PORTS; p++) {
         ptp_port_t *port = &g_ptp_ctx.ports[p];
@@ -520,7 +689,7 @@ void ptp_get_stats(ptp_session_stats_t *stats, uint8_t *count)
             continue;
 
         for (int s = 0; s < port->session_count; s++) {
-            if (idx < PTP_MAX_SESSIONS) {
+            if (idx < max_stats) {
                 ptp_session_get_stats(&port->sessions[s], &stats[idx]);
                 idx++;
             }
@@ -535,7 +704,8 @@ void ptp_get_stats(ptp_session_stats_t *stats, uint8_t *count)
  */
 void ptp_get_port_stats(uint16_t port_id,
                         ptp_session_stats_t *stats,
-                        uint8_t *count)
+                        uint16_t max_stats,
+                        uint16_t *count)
 {
     ptp_port_t *port = ptp_get_port(port_id);
     if (!port) {
@@ -543,11 +713,12 @@ void ptp_get_port_stats(uint16_t port_id,
         return;
     }
 
-    for (int i = 0; i < port->session_count; i++) {
+    uint16_t n = RTE_MIN(port->session_count, max_stats);
+    for (uint16_t i = 0; i < n; i++) {
         ptp_session_get_stats(&port->sessions[i], &stats[i]);
     }
 
-    *count = port->session_count;
+    *count = n;
 }
 
 /**
@@ -558,10 +729,10 @@ void ptp_get_port_stats(uint16_t port_id,
 void ptp_print_stats(void)
 {
     printf("\n--- PTP Statistics ---\n");
-    printf("%-6s %-6s %-12s %12s %12s %8s %8s %8s %6s\n",
+    printf("%-6s %-6s %-12s %12s %12s %8s %8s %8s %6s %4s\n",
            "Port", "VLAN", "State", "Offset(ns)", "Delay(ns)",
-           "Sync RX", "Req TX", "Resp RX", "Synced");
-    printf("----------------------------------------------------------------------\n");
+           "Sync RX", "Req TX", "Resp RX", "Synced", "TS");
+    printf("---------------------------------------------------------------------------\n");
 
     for (int p = 0; p < PTP_MAX_PORTS; p++) {
         ptp_port_t *port = &g_ptp_ctx.ports[p];
@@ -570,7 +741,7 @@ void ptp_print_stats(void)
 
         for (int s = 0; s < port->session_count; s++) {
             ptp_session_t *sess = &port->sessions[s];
-            printf("%-6u %-6u %-12s %12ld %12ld %8lu %8lu %8lu %6s\n",
+            printf("%-6u %-6u %-12s %12ld %12ld %8lu %8lu %8lu %6s %4s\n",
                    sess->port_id,
                    sess->rx_vlan_id,
                    ptp_state_to_str(sess->state),
@@ -579,10 +750,100 @@ void ptp_print_stats(void)
                    sess->sync_rx_count,
                    sess->delay_req_tx_count,
                    sess->delay_resp_rx_count,
-                   sess->is_synced ? "YES" : "NO");
+                   sess->is_synced ? "YES" : "NO",
+                   ptp_ts_mode_to_str(sess->ts_mode));
+        }
+    }
+    printf("---------------------------------------------------------------------------\n");
+
+    // Offset/delay jitter per timestamp source
+    printf("--- PTP Timestamp Jitter ---\n");
+    printf("%-6s %-6s %-4s %8s %10s %8s %10s %10s %10s %8s %10s %10s\n",
+           "Port", "VLAN", "Mode", "Samples",
+           "OffMean", "OffStd", "OffMin", "OffMax",
+           "DlyMean", "DlyStd", "DlyMin", "DlyMax");
+
+    for (int p = 0; p < PTP_MAX_PORTS; p++) {
+        ptp_port_t *port = &g_ptp_ctx.ports[p];
+        if (!port->enabled)
+            continue;
+
+        for (int s = 0; s < port->session_count; s++) {
+            ptp_session_t *sess = &port->sessions[s];
+            for (int b = 0; b < PTP_JITTER_BUCKETS; b++) {
+                const ptp_jitter_stats_t *js = &sess->jitter[b];
+                if (js->samples == 0)
+                    continue;
+
+                double off_std = js->samples > 1 ? sqrt(js->offset_m2 / (js->samples - 1)) : 0.0;
+                double dly_std = js->samples > 1 ? sqrt(js->delay_m2 / (js->samples - 1)) : 0.0;
+                const char *mode = (b == PTP_JITTER_SW) ? "SW" :
+                                   ptp_ts_mode_to_str(ptp_ts_port_mode(sess->port_id));
+
+                printf("%-6u %-6u %-4s %8lu %10.0f %8.0f %10ld %10ld %10.0f %8.0f %10ld %10ld\n",
+                       sess->port_id, sess->rx_vlan_id, mode, js->samples,
+                       js->offset_mean, off_std, js->offset_min, js->offset_max,
+                       js->delay_mean, dly_std, js->delay_min, js->delay_max);
+            }
+        }
+    }
+    printf("---------------------------------------------------------------------------\n");
+
+    // Servo: filtered offset, convergence and steady-state offset vs raw history
+    printf("--- PTP Servo ---\n");
+    printf("%-6s %-6s %-9s %10s %10s %10s %8s %6s %9s %8s %8s %8s %8s %8s\n",
+           "Port", "VLAN", "Servo", "FiltOff", "PathDly", "Freq(ppb)",
+           "Outlier", "Steps", "Conv(ms)", "SSMean", "SSStd", "SSMin", "SSMax", "RawStd");
+
+    for (int p = 0; p < PTP_MAX_PORTS; p++) {
+        ptp_port_t *port = &g_ptp_ctx.ports[p];
+        if (!port->enabled)
+            continue;
+
+        for (int s = 0; s < port->session_count; s++) {
+            ptp_session_t *sess = &port->sessions[s];
+            const ptp_servo_t *sv = &sess->servo;
+            if (sv->samples == 0)
+                continue;
+
+            const ptp_jitter_stats_t *ss = &sv->steady;
+            const ptp_jitter_stats_t *raw = sess->jitter[PTP_JITTER_HW].samples > 0 ?
+                                            &sess->jitter[PTP_JITTER_HW] : &sess->jitter[PTP_JITTER_SW];
+            double ss_std = ss->samples > 1 ? sqrt(ss->offset_m2 / (ss->samples - 1)) : 0.0;
+            double raw_std = raw->samples > 1 ? sqrt(raw->offset_m2 / (raw->samples - 1)) : 0.0;
+
+            printf("%-6u %-6u %-9s %10ld %10ld %10.1f %8lu %6lu %9lu %8.0f %8.0f %8ld %8ld %8.0f\n",
+                   sess->port_id, sess->rx_vlan_id,
+                   ptp_servo_state_to_str(sv->state),
+                   sv->filtered_offset_ns, sv->path_delay_ns, sv->freq_ppb,
+                   sv->outliers, sv->steps, sv->converge_ms,
+                   ss->offset_mean, ss_std, ss->offset_min, ss->offset_max, raw_std);
         }
     }
-    printf("----------------------------------------------------------------------\n");
+    printf("---------------------------------------------------------------------------\n");
+
+    // Worker loop time histogram per port (bucket upper bounds in ns)
+    printf("--- PTP Worker Loop ---\n");
+    for (int p = 0; p < PTP_MAX_PORTS; p++) {
+        ptp_port_t *port = &g_ptp_ctx.ports[p];
+        if (!port->enabled || port->loop_count == 0)
+            continue;
+
+        printf("Port %-2u loops=%lu max=%luns:", port->port_id,
+               port->loop_count, port->loop_max_ns);
+        for (int b = 0; b < PTP_LOOP_HIST_BUCKETS; b++) {
+            if (port->loop_hist[b] == 0)
+                continue;
+            if (b == PTP_LOOP_HIST_BUCKETS - 1)
+                printf(" >=%u:%lu", 128u << b, port->loop_hist[b]);
+            else
+                printf(" <%u:%lu", 256u << b, port->loop_hist[b]);
+        }
+        printf("\n");
+    }
+    if (ptp_event_dropped() > 0)
+        printf("PTP events dropped: %lu\n", ptp_event_dropped());
+    printf("---------------------------------------------------------------------------\n");
 
     // Print Queue 5 hardware stats per port
     printf("Q5 HW Stats: ");
@@ -612,5 +873,9 @@ void ptp_reset_stats(void)
         for (int s = 0; s < port->session_count; s++) {
             ptp_session_reset_stats(&port->sessions[s]);
         }
+
+        memset(port->loop_hist, 0, sizeof(port->loop_hist));
+        port->loop_count = 0;
+        port->loop_max_ns = 0;
     }
 }
@@ -3,6 +3,8 @@
 #include "packet.h"
 #include "dpdk_external_tx.h"
 #include "socket.h"  // for get_unused_cores()
+#include "vl_seq_tracker.h"
+#include "raw_tx_template.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -21,13 +23,13 @@
 #include <poll.h>
 #include <sched.h>
 #include <x86intrin.h>  // for _mm_pause()
-#include <stdatomic.h>  // for atomic operations
 
 // ==========================================
 // GLOBAL VARIABLES
 // ==========================================
 
-struct raw_socket_port raw_ports[MAX_RAW_SOCKET_PORTS];
+static struct raw_socket_port raw_ports_local[MAX_RAW_SOCKET_PORTS];
+struct raw_socket_port *raw_ports = raw_ports_local;  // Memzone after stats_shm_init
 struct raw_socket_port_config raw_port_configs[MAX_RAW_SOCKET_PORTS] = RAW_SOCKET_PORTS_CONFIG_INIT;
 int active_raw_port_count = NORMAL_RAW_SOCKET_PORT_COUNT;
 
@@ -49,133 +51,59 @@ void raw_socket_ports_load_config(bool ate_mode)
 }
 
 // ==========================================
-// GLOBAL SEQUENCE TRACKING (shared across all RX queues)
+// SEQUENCE TRACKING (vl_seq_tracker, all raw ports)
 // ==========================================
-// Bu yapı tüm multi-queue RX thread'leri tarafından paylaşılır.
 // PACKET_FANOUT_HASH aynı VL-ID'yi farklı queue'lara dağıtabildiği için
-// global tracking gerekli.
+// kayıp per-queue sıradan değil, queue shard'larının birleşiminden
+// hesaplanır. Her raw port için izlenen VL-ID'ler: kendisine gelen DPDK
+// external TX aralıkları + raw RX kaynakları.
 
-// Port 12: VL-ID 4291-4418 (from Port 2,3,4,5)
-#define GLOBAL_SEQ_VL_ID_START_P12 4291
-#define GLOBAL_SEQ_VL_ID_COUNT_P12 128
-
-// Port 13: VL-ID 4099-4130 (from Port 0,6)
-#define GLOBAL_SEQ_VL_ID_START_P13 4099
-#define GLOBAL_SEQ_VL_ID_COUNT_P13 32
-
-// Legacy defines for backward compatibility
-#define GLOBAL_SEQ_VL_ID_START GLOBAL_SEQ_VL_ID_START_P12
-#define GLOBAL_SEQ_VL_ID_COUNT GLOBAL_SEQ_VL_ID_COUNT_P12
-
-struct global_vl_seq_state {
-    _Atomic uint64_t min_seq;      // İlk görülen sequence
-    _Atomic uint64_t max_seq;      // En yüksek sequence
-    _Atomic uint64_t rx_count;     // Alınan paket sayısı
-    _Atomic bool initialized;      // İlk paket alındı mı?
-};
-
-static struct global_vl_seq_state g_vl_seq_p12[GLOBAL_SEQ_VL_ID_COUNT_P12];
-static struct global_vl_seq_state g_vl_seq_p13[GLOBAL_SEQ_VL_ID_COUNT_P13];
-// Legacy alias
-#define g_vl_seq g_vl_seq_p12
-static _Atomic bool g_seq_tracking_reset = false;
-
-// Reset global sequence tracking (call before starting a new test)
-void reset_global_sequence_tracking(void)
-{
-    // Reset Port 12 tracking
-    for (int i = 0; i < GLOBAL_SEQ_VL_ID_COUNT_P12; i++) {
-        atomic_store(&g_vl_seq_p12[i].min_seq, UINT64_MAX);
-        atomic_store(&g_vl_seq_p12[i].max_seq, 0);
-        atomic_store(&g_vl_seq_p12[i].rx_count, 0);
-        atomic_store(&g_vl_seq_p12[i].initialized, false);
-    }
-    // Reset Port 13 tracking
-    for (int i = 0; i < GLOBAL_SEQ_VL_ID_COUNT_P13; i++) {
-        atomic_store(&g_vl_seq_p13[i].min_seq, UINT64_MAX);
-        atomic_store(&g_vl_seq_p13[i].max_seq, 0);
-        atomic_store(&g_vl_seq_p13[i].rx_count, 0);
-        atomic_store(&g_vl_seq_p13[i].initialized, false);
-    }
-    atomic_store(&g_seq_tracking_reset, false);
-}
-
-// Get global sequence tracking lost count for Port 12
-uint64_t get_global_sequence_lost(void)
-{
-    uint64_t total_lost = 0;
-    for (int i = 0; i < GLOBAL_SEQ_VL_ID_COUNT_P12; i++) {
-        if (atomic_load(&g_vl_seq_p12[i].initialized)) {
-            uint64_t min_s = atomic_load(&g_vl_seq_p12[i].min_seq);
-            uint64_t max_s = atomic_load(&g_vl_seq_p12[i].max_seq);
-            uint64_t rx_cnt = atomic_load(&g_vl_seq_p12[i].rx_count);
-            uint64_t expected = max_s - min_s + 1;
-            if (expected > rx_cnt) {
-                total_lost += (expected - rx_cnt);
-            }
-        }
-    }
-    return total_lost;
-}
+#if DPDK_EXT_TX_ENABLED
+static const struct dpdk_ext_tx_port_config ext_seq_configs[] = DPDK_EXT_TX_PORTS_CONFIG_INIT;
+#define EXT_SEQ_CONFIG_COUNT (int)(sizeof(ext_seq_configs) / sizeof(ext_seq_configs[0]))
 
-// Get global sequence tracking lost count for Port 13
-uint64_t get_global_sequence_lost_p13(void)
+// DPDK external TX packets only (raw sources excluded), merged over queues
+static void dpdk_ext_seq_read(int raw_index, uint16_t port_id, struct vl_seq_totals *out)
 {
-    uint64_t total_lost = 0;
-    for (int i = 0; i < GLOBAL_SEQ_VL_ID_COUNT_P13; i++) {
-        if (atomic_load(&g_vl_seq_p13[i].initialized)) {
-            uint64_t min_s = atomic_load(&g_vl_seq_p13[i].min_seq);
-            uint64_t max_s = atomic_load(&g_vl_seq_p13[i].max_seq);
-            uint64_t rx_cnt = atomic_load(&g_vl_seq_p13[i].rx_count);
-            uint64_t expected = max_s - min_s + 1;
-            if (expected > rx_cnt) {
-                total_lost += (expected - rx_cnt);
-            }
+    memset(out, 0, sizeof(*out));
+    for (int c = 0; c < EXT_SEQ_CONFIG_COUNT; c++) {
+        if (ext_seq_configs[c].dest_port != port_id)
+            continue;
+        for (int t = 0; t < ext_seq_configs[c].target_count; t++) {
+            struct vl_seq_totals part;
+            vl_seq_read(raw_index, ext_seq_configs[c].targets[t].vl_id_start,
+                        ext_seq_configs[c].targets[t].vl_id_count, &part);
+            out->rx += part.rx;
+            out->lost += part.lost;
+            out->reordered += part.reordered;
+            out->duplicates += part.duplicates;
+            out->active_vls += part.active_vls;
         }
     }
-    return total_lost;
 }
+#endif
 
-// Debug: Print per-VL-ID sequence statistics
-void print_global_sequence_debug(void)
+// Register every RX VL-ID range of the active raw ports (before workers start)
+static void setup_sequence_tracking(void)
 {
-    printf("  Global Sequence Debug (first 5 active VL-IDs):\n");
-    int printed = 0;
-    int total_with_loss = 0;
-    uint64_t max_loss_vlid = 0;
-    int64_t max_loss = 0;
-
-    for (int i = 0; i < GLOBAL_SEQ_VL_ID_COUNT; i++) {
-        if (atomic_load(&g_vl_seq[i].initialized)) {
-            uint64_t min_s = atomic_load(&g_vl_seq[i].min_seq);
-            uint64_t max_s = atomic_load(&g_vl_seq[i].max_seq);
-            uint64_t rx_cnt = atomic_load(&g_vl_seq[i].rx_count);
-            uint64_t expected = max_s - min_s + 1;
-            int64_t lost = (expected > rx_cnt) ? (expected - rx_cnt) : 0;
-
-            if (printed < 5) {
-                printf("    VL-ID %u: min=%lu max=%lu rx=%lu expected=%lu lost=%ld\n",
-                       GLOBAL_SEQ_VL_ID_START + i, min_s, max_s, rx_cnt, expected, lost);
-                printed++;
-            }
+    vl_seq_clear();
 
-            if (lost > 0) {
-                total_with_loss++;
-                if (lost > max_loss) {
-                    max_loss = lost;
-                    max_loss_vlid = GLOBAL_SEQ_VL_ID_START + i;
-                }
-            }
-        }
-    }
+    for (int i = 0; i < active_raw_port_count; i++) {
+        const struct raw_socket_port_config *cfg = &raw_port_configs[i];
 
-    if (printed == 0) {
-        printf("    (no VL-IDs initialized yet)\n");
-    }
+        for (int s = 0; s < cfg->rx_source_count; s++)
+            vl_seq_add_range(i, cfg->rx_sources[s].vl_id_start, cfg->rx_sources[s].vl_id_count);
 
-    if (total_with_loss > 0) {
-        printf("    ⚠️  %d VL-IDs have loss, worst: VL-ID %lu with %ld lost\n",
-               total_with_loss, max_loss_vlid, max_loss);
+#if DPDK_EXT_TX_ENABLED
+        for (int c = 0; c < EXT_SEQ_CONFIG_COUNT; c++) {
+            if (ext_seq_configs[c].dest_port != cfg->port_id)
+                continue;
+            for (int t = 0; t < ext_seq_configs[c].target_count; t++)
+                vl_seq_add_range(i, ext_seq_configs[c].targets[t].vl_id_start,
+                                 ext_seq_configs[c].targets[t].vl_id_count);
+        }
+#endif
+        printf("[Port %u] Sequence tracking: %u VL-IDs\n", cfg->port_id, vl_seq_ports[i].nb_slots);
     }
 }
 
@@ -190,22 +118,6 @@ uint64_t get_time_ns(void)
     return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
 }
 
-static uint16_t calculate_ip_checksum_raw(const void *ip_header)
-{
-    const uint16_t *ptr = (const uint16_t *)ip_header;
-    uint32_t sum = 0;
-
-    for (int i = 0; i < 10; i++) {
-        sum += ntohs(ptr[i]);
-    }
-
-    while (sum >> 16) {
-        sum = (sum & 0xFFFF) + (sum >> 16);
-    }
-
-    return htons(~sum & 0xFFFF);
-}
-
 // ==========================================
 // RATE LIMITER FUNCTIONS
 // ==========================================
@@ -347,16 +259,9 @@ bool raw_consume_tokens(struct raw_rate_limiter *limiter, uint64_t bytes)
 // PRBS-31 CACHE INITIALIZATION
 // ==========================================
 
-#define PRBS31_TAP1 31
-#define PRBS31_TAP2 28
+// x^31 + x^28 + 1, shift left, new bit = state[30] ^ state[27] is the output
 #define RAW_PRBS_CACHE_SIZE (268435456)
 
-static uint32_t prbs31_next(uint32_t state)
-{
-    uint32_t bit = ((state >> (PRBS31_TAP1 - 1)) ^ (state >> (PRBS31_TAP2 - 1))) & 1;
-    return ((state << 1) | bit) & 0x7FFFFFFF;
-}
-
 int init_raw_prbs_cache(struct raw_socket_port *port)
 {
     if (port->prbs_initialized) return 0;
@@ -379,13 +284,13 @@ int init_raw_prbs_cache(struct raw_socket_port *port)
 
     uint32_t state = 0x0000000F + port->port_id + 100;
 
-    for (size_t i = 0; i < RAW_PRBS_CACHE_SIZE; i++) {
-        uint8_t byte_val = 0;
-        for (int b = 0; b < 8; b++) {
-            state = prbs31_next(state);
-            byte_val = (byte_val << 1) | (state & 1);
-        }
-        port->prbs_cache[i] = byte_val;
+    // 16 output bits per step: they are (state ^ state >> 3) bits 27..12,
+    // MSB first, all computable from the current state
+    for (size_t i = 0; i < RAW_PRBS_CACHE_SIZE; i += 2) {
+        uint32_t fb = state ^ (state >> 3);
+        port->prbs_cache[i] = (uint8_t)(fb >> 20);
+        port->prbs_cache[i + 1] = (uint8_t)(fb >> 12);
+        state = ((state << 16) | ((fb >> 12) & 0xFFFF)) & 0x7FFFFFFF;
     }
 
     memcpy(port->prbs_cache_ext, port->prbs_cache, RAW_PRBS_CACHE_SIZE);
@@ -400,158 +305,54 @@ int init_raw_prbs_cache(struct raw_socket_port *port)
 // ==========================================
 // PACKET BUILDING
 // ==========================================
-
-// Legacy build_raw_packet (sabit boyut için geriye uyumluluk)
-int build_raw_packet(uint8_t *buffer, const uint8_t *src_mac,
-                     uint16_t vl_id, uint64_t sequence, const uint8_t *prbs_data)
-{
-    static const uint8_t fixed_src_mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x20};
-    (void)src_mac;
-
-    // Ethernet Header
-    buffer[0] = 0x03;
-    buffer[1] = 0x00;
-    buffer[2] = 0x00;
-    buffer[3] = 0x00;
-    buffer[4] = (vl_id >> 8) & 0xFF;
-    buffer[5] = vl_id & 0xFF;
-    memcpy(buffer + 6, fixed_src_mac, 6);
-    buffer[12] = 0x08;
-    buffer[13] = 0x00;
-
-    // IPv4 Header
-    uint8_t *ip = buffer + RAW_PKT_ETH_HDR_SIZE;
-    ip[0] = 0x45;
-    ip[1] = 0x00;
-    uint16_t ip_total_len = RAW_PKT_IP_HDR_SIZE + RAW_PKT_UDP_HDR_SIZE + RAW_PKT_PAYLOAD_SIZE;
-    ip[2] = (ip_total_len >> 8) & 0xFF;
-    ip[3] = ip_total_len & 0xFF;
-    ip[4] = 0x00;
-    ip[5] = 0x00;
-    ip[6] = 0x40;
-    ip[7] = 0x00;
-    ip[8] = 0x01;
-    ip[9] = 0x11;
-    ip[10] = 0x00;
-    ip[11] = 0x00;
-    ip[12] = 10;
-    ip[13] = 0;
-    ip[14] = 0;
-    ip[15] = 0;
-    ip[16] = 224;
-    ip[17] = 224;
-    ip[18] = (vl_id >> 8) & 0xFF;
-    ip[19] = vl_id & 0xFF;
-
-    uint16_t ip_checksum = calculate_ip_checksum_raw(ip);
-    ip[10] = (ip_checksum >> 8) & 0xFF;
-    ip[11] = ip_checksum & 0xFF;
-
-    // UDP Header
-    uint8_t *udp = ip + RAW_PKT_IP_HDR_SIZE;
-    udp[0] = 0x00;
-    udp[1] = 0x64;
-    udp[2] = 0x00;
-    udp[3] = 0x64;
-    uint16_t udp_len = RAW_PKT_UDP_HDR_SIZE + RAW_PKT_PAYLOAD_SIZE;
-    udp[4] = (udp_len >> 8) & 0xFF;
-    udp[5] = udp_len & 0xFF;
-    udp[6] = 0x00;
-    udp[7] = 0x00;
-
-    // Payload
-    uint8_t *payload = udp + RAW_PKT_UDP_HDR_SIZE;
-    memcpy(payload, &sequence, RAW_PKT_SEQ_BYTES);
-    memcpy(payload + RAW_PKT_SEQ_BYTES, prbs_data, RAW_PKT_PRBS_BYTES);
-
-    return RAW_PKT_TOTAL_SIZE;
-}
+// build_raw_packet / build_raw_packet_dynamic: raw_tx_template.h
 
 #if IMIX_ENABLED
-// IMIX: Dinamik boyutlu paket oluştur
-int build_raw_packet_dynamic(uint8_t *buffer, const uint8_t *src_mac,
-                              uint16_t vl_id, uint64_t sequence,
-                              const uint8_t *prbs_data, uint16_t prbs_len,
-                              uint16_t pkt_size)
-{
-    static const uint8_t fixed_src_mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x20};
-    (void)src_mac;
-
-    // Ethernet Header
-    buffer[0] = 0x03;
-    buffer[1] = 0x00;
-    buffer[2] = 0x00;
-    buffer[3] = 0x00;
-    buffer[4] = (vl_id >> 8) & 0xFF;
-    buffer[5] = vl_id & 0xFF;
-    memcpy(buffer + 6, fixed_src_mac, 6);
-    buffer[12] = 0x08;
-    buffer[13] = 0x00;
-
-    // IPv4 Header (dinamik total_length)
-    uint8_t *ip = buffer + RAW_PKT_ETH_HDR_SIZE;
-    uint16_t payload_size = pkt_size - RAW_PKT_ETH_HDR_SIZE - RAW_PKT_IP_HDR_SIZE - RAW_PKT_UDP_HDR_SIZE;
-    uint16_t ip_total_len = RAW_PKT_IP_HDR_SIZE + RAW_PKT_UDP_HDR_SIZE + payload_size;
-
-    ip[0] = 0x45;
-    ip[1] = 0x00;
-    ip[2] = (ip_total_len >> 8) & 0xFF;
-    ip[3] = ip_total_len & 0xFF;
-    ip[4] = 0x00;
-    ip[5] = 0x00;
-    ip[6] = 0x40;
-    ip[7] = 0x00;
-    ip[8] = 0x01;
-    ip[9] = 0x11;
-    ip[10] = 0x00;
-    ip[11] = 0x00;
-    ip[12] = 0x0A;
-    ip[13] = 0x00;
-    ip[14] = 0x00;
-    ip[15] = 0x00;
-    ip[16] = 0xE0;
-    ip[17] = 0xE0;
-    ip[18] = (vl_id >> 8) & 0xFF;
-    ip[19] = vl_id & 0xFF;
-
-    // IP Checksum
-    uint16_t ip_checksum = calculate_ip_checksum_raw(ip);
-    ip[10] = (ip_checksum >> 8) & 0xFF;
-    ip[11] = ip_checksum & 0xFF;
-
-    // UDP Header (dinamik dgram_len)
-    uint8_t *udp = ip + RAW_PKT_IP_HDR_SIZE;
-    udp[0] = 0x00;
-    udp[1] = 0x64;
-    udp[2] = 0x00;
-    udp[3] = 0x64;
-    uint16_t udp_len = RAW_PKT_UDP_HDR_SIZE + payload_size;
-    udp[4] = (udp_len >> 8) & 0xFF;
-    udp[5] = udp_len & 0xFF;
-    udp[6] = 0x00;
-    udp[7] = 0x00;
-
-    // Payload (dinamik PRBS boyutu)
-    uint8_t *payload = udp + RAW_PKT_UDP_HDR_SIZE;
-    memcpy(payload, &sequence, RAW_PKT_SEQ_BYTES);
-    memcpy(payload + RAW_PKT_SEQ_BYTES, prbs_data, prbs_len);
-
-    return pkt_size;
-}
-
 // IMIX paket boyutu al (raw socket için - VLAN'sız)
 static inline uint16_t get_raw_imix_packet_size(uint64_t pkt_counter, uint8_t worker_offset)
 {
     static const uint16_t raw_imix_pattern[IMIX_PATTERN_SIZE] = RAW_IMIX_PATTERN_INIT;
     return raw_imix_pattern[(pkt_counter + worker_offset) % IMIX_PATTERN_SIZE];
 }
+#endif /* IMIX_ENABLED */
 
-// Raw IMIX PRBS boyutu hesapla
-static inline uint16_t calc_raw_prbs_size(uint16_t pkt_size)
+/**
+ * Header templates of raw_tx_worker, one per IMIX pattern slot (one for
+ * the fixed size), taken from the builders with VL-ID 0. Checked against
+ * the builders for a spread of VL-IDs and sequences.
+ * @return 0 on success, -1 when a template frame differs (builders used)
+ */
+static int raw_tx_templates_init(struct raw_tx_template *tpl)
 {
-    return pkt_size - RAW_PKT_ETH_HDR_SIZE - RAW_PKT_IP_HDR_SIZE - RAW_PKT_UDP_HDR_SIZE - RAW_PKT_SEQ_BYTES;
+    static const uint16_t check_vls[] = {0x0001, 0x00FF, 0x1000, 0x17C3, 0x7FFF, 0xFFFF};
+    uint8_t ref[RAW_PKT_TOTAL_SIZE], out[RAW_PKT_TOTAL_SIZE];
+    uint8_t prbs[RAW_PKT_PRBS_BYTES];
+
+    for (int i = 0; i < RAW_PKT_PRBS_BYTES; i++)
+        prbs[i] = (uint8_t)(i * 7 + 1);
+
+    for (uint32_t slot = 0; slot < RAW_TX_TPL_COUNT; slot++) {
+#if IMIX_ENABLED
+        uint16_t pkt_size = get_raw_imix_packet_size(slot, 0);
+#else
+        uint16_t pkt_size = RAW_PKT_TOTAL_SIZE;
+#endif
+        raw_tx_template_build(&tpl[slot], pkt_size);
+
+        for (size_t v = 0; v < sizeof(check_vls) / sizeof(check_vls[0]); v++) {
+            uint64_t seq = 0x0123456789ABCDEFULL * (v + 1);
+#if IMIX_ENABLED
+            build_raw_packet_dynamic(ref, NULL, check_vls[v], seq, prbs, tpl[slot].prbs_len, pkt_size);
+#else
+            build_raw_packet(ref, NULL, check_vls[v], seq, prbs);
+#endif
+            if (raw_tx_template_fill(out, &tpl[slot], check_vls[v], seq, prbs) != pkt_size ||
+                memcmp(out, ref, pkt_size) != 0)
+                return -1;
+        }
+    }
+    return 0;
 }
-#endif /* IMIX_ENABLED */
 
 // ==========================================
 // SOCKET INITIALIZATION
@@ -959,7 +760,6 @@ int init_raw_socket_port(int raw_index, const struct raw_socket_port_config *con
 
         for (uint16_t i = 0; i < target->config.vl_id_count; i++) {
             pthread_spin_init(&target->vl_sequences[i].tx_lock, PTHREAD_PROCESS_PRIVATE);
-            pthread_spin_init(&target->vl_sequences[i].rx_lock, PTHREAD_PROCESS_PRIVATE);
         }
 
         pthread_spin_init(&target->stats.lock, PTHREAD_PROCESS_PRIVATE);
@@ -981,7 +781,6 @@ int init_raw_socket_port(int raw_index, const struct raw_socket_port_config *con
 
         for (uint16_t i = 0; i < source->config.vl_id_count; i++) {
             pthread_spin_init(&source->vl_sequences[i].tx_lock, PTHREAD_PROCESS_PRIVATE);
-            pthread_spin_init(&source->vl_sequences[i].rx_lock, PTHREAD_PROCESS_PRIVATE);
         }
 
         pthread_spin_init(&source->stats.lock, PTHREAD_PROCESS_PRIVATE);
@@ -1044,8 +843,8 @@ int init_raw_socket_ports(void)
 {
     printf("\n=== Initializing Raw Socket Ports (Multi-Target) ===\n");
 
-    // Initialize global sequence tracking (sets min_seq to UINT64_MAX)
-    reset_global_sequence_tracking();
+    // Per-(port, VL-ID) sequence tracking for every active raw port
+    setup_sequence_tracking();
 
     for (int i = 0; i < active_raw_port_count; i++) {
         if (init_raw_socket_port(i, &raw_port_configs[i]) < 0) {
@@ -1069,6 +868,14 @@ void *raw_tx_worker(void *arg)
     uint8_t packet_buffer[RAW_PKT_TOTAL_SIZE];  // Max boyut
     bool first_tx[MAX_RAW_TARGETS] = {false};
 
+    // Header templates: frames written straight into the TX ring
+    // (RAW_TX_TEMPLATE=0 or template check failed: build + copy per packet)
+    struct raw_tx_template tx_tpl[RAW_TX_TPL_COUNT];
+    bool use_tpl = RAW_TX_TEMPLATE && raw_tx_templates_init(tx_tpl) == 0;
+    if (RAW_TX_TEMPLATE && !use_tpl)
+        printf("[Port %u TX] Warning: header template differs from builder, per-packet build\n",
+               port->port_id);
+
 #if IMIX_ENABLED
     // IMIX: Worker offset (her target için farklı pattern başlangıcı)
     uint8_t imix_offset = (uint8_t)(port->port_id % IMIX_PATTERN_SIZE);
@@ -1200,6 +1007,7 @@ void *raw_tx_worker(void *arg)
 
 #if IMIX_ENABLED
                 // IMIX: Paket boyutunu pattern'den al
+                uint32_t tpl_slot = (uint32_t)((imix_counter + imix_offset) % IMIX_PATTERN_SIZE);
                 uint16_t pkt_size = get_raw_imix_packet_size(imix_counter, imix_offset);
                 uint16_t prbs_len = calc_raw_prbs_size(pkt_size);
                 imix_counter++;
@@ -1208,16 +1016,20 @@ void *raw_tx_worker(void *arg)
                 uint64_t prbs_offset = (seq * (uint64_t)RAW_MAX_PRBS_BYTES) % RAW_PRBS_CACHE_SIZE;
                 uint8_t *prbs_data = port->prbs_cache_ext + prbs_offset;
 
-                // Build packet (dinamik boyut)
-                build_raw_packet_dynamic(packet_buffer, port->mac_addr, vl_id, seq,
-                                          prbs_data, prbs_len, pkt_size);
+                // Build packet (dinamik boyut), templates: built in the ring frame below
+                if (!use_tpl)
+                    build_raw_packet_dynamic(packet_buffer, port->mac_addr, vl_id, seq,
+                                              prbs_data, prbs_len, pkt_size);
 #else
+                uint32_t tpl_slot = 0;
+
                 // Get PRBS data
                 uint64_t prbs_offset = (seq * (uint64_t)RAW_PKT_PRBS_BYTES) % RAW_PRBS_CACHE_SIZE;
                 uint8_t *prbs_data = port->prbs_cache_ext + prbs_offset;
 
-                // Build packet
-                build_raw_packet(packet_buffer, port->mac_addr, vl_id, seq, prbs_data);
+                // Build packet, templates: built in the ring frame below
+                if (!use_tpl)
+                    build_raw_packet(packet_buffer, port->mac_addr, vl_id, seq, prbs_data);
                 uint16_t pkt_size = RAW_PKT_TOTAL_SIZE;
 #endif
 
@@ -1244,9 +1056,12 @@ void *raw_tx_worker(void *arg)
                     }
                 }
 
-                // Copy packet to ring buffer (dinamik boyut)
+                // Template straight into the ring frame, else copy packet (dinamik boyut)
                 uint8_t *frame_data = (uint8_t *)hdr + TPACKET2_HDRLEN - sizeof(struct sockaddr_ll);
-                memcpy(frame_data, packet_buffer, pkt_size);
+                if (use_tpl)
+                    raw_tx_template_fill(frame_data, &tx_tpl[tpl_slot], vl_id, seq, prbs_data);
+                else
+                    memcpy(frame_data, packet_buffer, pkt_size);
                 hdr->tp_len = pkt_size;
                 hdr->tp_status = TP_STATUS_SEND_REQUEST;
 
@@ -1381,27 +1196,6 @@ void *raw_rx_worker(void *arg)
         get_prbs_cache_ext_for_port(0),
         get_prbs_cache_ext_for_port(6)
     };
-
-    // Sequence tracking - separate for Port 12 and Port 13
-    // Port 12: VL-ID 4291-4418 (128 entries)
-    // Port 13: VL-ID 4099-4130 (32 entries)
-    #define DPDK_EXT_VL_ID_START_P12 4291
-    #define DPDK_EXT_VL_ID_COUNT_P12 128
-    #define DPDK_EXT_VL_ID_START_P13 4099
-    #define DPDK_EXT_VL_ID_COUNT_P13 32
-    static uint64_t dpdk_ext_expected_seq_p12[DPDK_EXT_VL_ID_COUNT_P12];
-    static bool dpdk_ext_seq_initialized_p12[DPDK_EXT_VL_ID_COUNT_P12];
-    static uint64_t dpdk_ext_expected_seq_p13[DPDK_EXT_VL_ID_COUNT_P13];
-    static bool dpdk_ext_seq_initialized_p13[DPDK_EXT_VL_ID_COUNT_P13];
-    static bool dpdk_ext_seq_arrays_cleared = false;
-
-    if (!dpdk_ext_seq_arrays_cleared) {
-        memset(dpdk_ext_expected_seq_p12, 0, sizeof(dpdk_ext_expected_seq_p12));
-        memset(dpdk_ext_seq_initialized_p12, 0, sizeof(dpdk_ext_seq_initialized_p12));
-        memset(dpdk_ext_expected_seq_p13, 0, sizeof(dpdk_ext_expected_seq_p13));
-        memset(dpdk_ext_seq_initialized_p13, 0, sizeof(dpdk_ext_seq_initialized_p13));
-        dpdk_ext_seq_arrays_cleared = true;
-    }
 #endif
 
     // Local counters for batch stats update (reduces spinlock overhead)
@@ -1410,7 +1204,6 @@ void *raw_rx_worker(void *arg)
     uint64_t local_dpdk_good = 0;
     uint64_t local_dpdk_bad = 0;
     uint64_t local_dpdk_bit_errors = 0;
-    uint64_t local_dpdk_lost = 0;
     const uint32_t STATS_FLUSH_INTERVAL = 1024;  // Flush every 1024 packets
     uint32_t empty_polls = 0;
     const uint32_t BUSY_POLL_COUNT = 64;  // Spin this many times before blocking poll
@@ -1435,14 +1228,12 @@ void *raw_rx_worker(void *arg)
                 port->dpdk_ext_rx_stats.good_pkts += local_dpdk_good;
                 port->dpdk_ext_rx_stats.bad_pkts += local_dpdk_bad;
                 port->dpdk_ext_rx_stats.bit_errors += local_dpdk_bit_errors;
-                port->dpdk_ext_rx_stats.lost_pkts += local_dpdk_lost;
                 pthread_spin_unlock(&port->dpdk_ext_rx_stats.lock);
                 local_dpdk_rx_pkts = 0;
                 local_dpdk_rx_bytes = 0;
                 local_dpdk_good = 0;
                 local_dpdk_bad = 0;
                 local_dpdk_bit_errors = 0;
-                local_dpdk_lost = 0;
             }
             struct pollfd pfd = {port->rx_socket, POLLIN, 0};
             poll(&pfd, 1, 1);  // 1ms blocking poll
@@ -1501,57 +1292,8 @@ void *raw_rx_worker(void *arg)
             local_dpdk_rx_pkts++;
             local_dpdk_rx_bytes += pkt_len;
 
-            // Sequence tracking for lost packet detection (port-specific)
-            if (port->port_id == 12) {
-                // Port 12 receives from Port 2,3,4,5
-                uint16_t vl_idx = vl_id - DPDK_EXT_VL_ID_START_P12;
-                if (vl_idx < DPDK_EXT_VL_ID_COUNT_P12) {
-                    if (!dpdk_ext_seq_initialized_p12[vl_idx]) {
-                        dpdk_ext_expected_seq_p12[vl_idx] = seq + 1;
-                        dpdk_ext_seq_initialized_p12[vl_idx] = true;
-                    } else {
-#if TOKEN_BUCKET_TX_ENABLED
-                        // Multi-queue NOT: Port 12 RX has 4 queues (Q0-Q3).
-                        // NIC RSS distributes same VL-ID across queues → OOO.
-                        // Gap detection burada false positive verir.
-                        // Kayıp tespiti watermark-based (g_vl_seq) ile yapılır.
-                        if (seq >= dpdk_ext_expected_seq_p12[vl_idx]) {
-                            dpdk_ext_expected_seq_p12[vl_idx] = seq + 1;
-                        }
-#else
-                        uint64_t expected = dpdk_ext_expected_seq_p12[vl_idx];
-                        if (seq > expected) {
-                            local_dpdk_lost += (seq - expected);
-                        }
-                        dpdk_ext_expected_seq_p12[vl_idx] = seq + 1;
-#endif
-                    }
-                }
-            } else if (port->port_id == 13) {
-                // Port 13 receives from Port 0,6
-                uint16_t vl_idx = vl_id - DPDK_EXT_VL_ID_START_P13;
-                if (vl_idx < DPDK_EXT_VL_ID_COUNT_P13) {
-                    if (!dpdk_ext_seq_initialized_p13[vl_idx]) {
-                        dpdk_ext_expected_seq_p13[vl_idx] = seq + 1;
-                        dpdk_ext_seq_initialized_p13[vl_idx] = true;
-                    } else {
-#if TOKEN_BUCKET_TX_ENABLED
-                        // Multi-queue NOT: Port 13 RX has 2 queues.
-                        // Gap detection multi-queue OOO'da false positive verir.
-                        // Kayıp tespiti watermark-based (g_vl_seq) ile yapılır.
-                        if (seq >= dpdk_ext_expected_seq_p13[vl_idx]) {
-                            dpdk_ext_expected_seq_p13[vl_idx] = seq + 1;
-                        }
-#else
-                        uint64_t expected = dpdk_ext_expected_seq_p13[vl_idx];
-                        if (seq > expected) {
-                            local_dpdk_lost += (seq - expected);
-                        }
-                        dpdk_ext_expected_seq_p13[vl_idx] = seq + 1;
-#endif
-                    }
-                }
-            }
+            // Sequence tracking (single RX thread: shard 0)
+            vl_seq_update(port->raw_index, 0, vl_id, seq);
 
             // PRBS verification using pre-cached DPDK port's cache
             // Port 12: dpdk_src_port 2,3,4,5 → index 0,1,2,3
@@ -1617,14 +1359,12 @@ void *raw_rx_worker(void *arg)
                 port->dpdk_ext_rx_stats.good_pkts += local_dpdk_good;
                 port->dpdk_ext_rx_stats.bad_pkts += local_dpdk_bad;
                 port->dpdk_ext_rx_stats.bit_errors += local_dpdk_bit_errors;
-                port->dpdk_ext_rx_stats.lost_pkts += local_dpdk_lost;
                 pthread_spin_unlock(&port->dpdk_ext_rx_stats.lock);
                 local_dpdk_rx_pkts = 0;
                 local_dpdk_rx_bytes = 0;
                 local_dpdk_good = 0;
                 local_dpdk_bad = 0;
                 local_dpdk_bit_errors = 0;
-                local_dpdk_lost = 0;
             }
 
             hdr->tp_status = TP_STATUS_KERNEL;
@@ -1655,7 +1395,6 @@ void *raw_rx_worker(void *arg)
         }
 
         struct raw_rx_source_state *source = &port->rx_sources[source_idx];
-        uint16_t vl_index = vl_id - source->config.vl_id_start;
 
         // Get sequence number from payload
         uint8_t *payload = pkt_data + RAW_PKT_ETH_HDR_SIZE + RAW_PKT_IP_HDR_SIZE + RAW_PKT_UDP_HDR_SIZE;
@@ -1673,36 +1412,8 @@ void *raw_rx_worker(void *arg)
             first_rx[source_idx] = true;
         }
 
-        // Sequence validation
-        pthread_spin_lock(&source->vl_sequences[vl_index].rx_lock);
-
-        if (!source->vl_sequences[vl_index].rx_initialized) {
-            source->vl_sequences[vl_index].rx_expected_seq = seq + 1;
-            source->vl_sequences[vl_index].rx_initialized = true;
-        } else {
-            uint64_t expected = source->vl_sequences[vl_index].rx_expected_seq;
-
-            if (seq != expected) {
-                if (seq > expected) {
-                    uint64_t gap = seq - expected;
-                    pthread_spin_lock(&source->stats.lock);
-                    source->stats.lost_pkts += gap;
-                    pthread_spin_unlock(&source->stats.lock);
-                } else {
-                    pthread_spin_lock(&source->stats.lock);
-                    if (seq == expected - 1) {
-                        source->stats.duplicate_pkts++;
-                    } else {
-                        source->stats.out_of_order_pkts++;
-                    }
-                    pthread_spin_unlock(&source->stats.lock);
-                }
-            }
-
-            source->vl_sequences[vl_index].rx_expected_seq = seq + 1;
-        }
-
-        pthread_spin_unlock(&source->vl_sequences[vl_index].rx_lock);
+        // Sequence tracking (single RX thread: shard 0)
+        vl_seq_update(port->raw_index, 0, vl_id, seq);
 
         // PRBS verification
         if (partner && partner->prbs_initialized) {
@@ -1811,7 +1522,7 @@ void *multi_queue_rx_worker(void *arg)
         get_prbs_cache_ext_for_port(0),
         get_prbs_cache_ext_for_port(6)
     };
-    // Note: Using global sequence tracking (g_vl_seq) instead of per-queue
+    // Note: Sequence tracking is per queue shard (vl_seq_tracker), not per-queue gaps
 #endif
 
     // Local counters for batch stats update
@@ -1828,7 +1539,7 @@ void *multi_queue_rx_worker(void *arg)
     // VL-ID tracking (local, thread-safe)
     uint16_t local_vl_min = 0xFFFF;
     uint16_t local_vl_max = 0;
-    uint8_t vl_id_seen[GLOBAL_SEQ_VL_ID_COUNT / 8 + 1];  // Bitmap
+    uint8_t vl_id_seen[VL_SEQ_MAX_VLS / 8];  // Bitmap over tracker slots
     memset(vl_id_seen, 0, sizeof(vl_id_seen));
     queue->vl_id_min = 0xFFFF;
     queue->vl_id_max = 0;
@@ -1934,58 +1645,16 @@ void *multi_queue_rx_worker(void *arg)
             if (vl_id < local_vl_min) local_vl_min = vl_id;
             if (vl_id > local_vl_max) local_vl_max = vl_id;
 
-            // Global sequence tracking (shared across all queues, port-specific)
-            struct global_vl_seq_state *vs = NULL;
-            uint16_t vl_idx = 0;
-
-            if (port->port_id == 12) {
-                vl_idx = vl_id - GLOBAL_SEQ_VL_ID_START_P12;
-                if (vl_idx < GLOBAL_SEQ_VL_ID_COUNT_P12) {
-                    vs = &g_vl_seq_p12[vl_idx];
-                }
-            } else if (port->port_id == 13) {
-                vl_idx = vl_id - GLOBAL_SEQ_VL_ID_START_P13;
-                if (vl_idx < GLOBAL_SEQ_VL_ID_COUNT_P13) {
-                    vs = &g_vl_seq_p13[vl_idx];
-                }
-            }
-
-            if (vs != NULL) {
+            // Sequence tracking: this queue's shard, merged on read
+            uint16_t vl_slot = vl_seq_update(port->raw_index, queue->queue_id, vl_id, seq);
+            if (vl_slot != 0) {
                 // Track unique VL-IDs (per-queue, for debugging)
-                uint8_t byte_idx = vl_idx / 8;
-                uint8_t bit_mask = 1 << (vl_idx % 8);
+                uint16_t byte_idx = (vl_slot - 1) / 8;
+                uint8_t bit_mask = 1 << ((vl_slot - 1) % 8);
                 if (!(vl_id_seen[byte_idx] & bit_mask)) {
                     vl_id_seen[byte_idx] |= bit_mask;
                     queue->unique_vl_ids++;
                 }
-
-                // Increment RX count
-                atomic_fetch_add(&vs->rx_count, 1);
-
-                // Update min_seq (first seen sequence)
-                if (!atomic_load(&vs->initialized)) {
-                    // First packet for this VL-ID - set min_seq
-                    uint64_t expected = UINT64_MAX;
-                    if (atomic_compare_exchange_strong(&vs->min_seq, &expected, seq)) {
-                        atomic_store(&vs->initialized, true);
-                    }
-                }
-
-                // Update max_seq if this sequence is higher
-                uint64_t old_max = atomic_load(&vs->max_seq);
-                while (seq > old_max) {
-                    if (atomic_compare_exchange_weak(&vs->max_seq, &old_max, seq)) {
-                        break;
-                    }
-                }
-
-                // Also update min if this is smaller (for late arrivals)
-                uint64_t old_min = atomic_load(&vs->min_seq);
-                while (seq < old_min) {
-                    if (atomic_compare_exchange_weak(&vs->min_seq, &old_min, seq)) {
-                        break;
-                    }
-                }
             }
 
             // PRBS verification (port-specific cache selection)
@@ -2070,7 +1739,6 @@ void *multi_queue_rx_worker(void *arg)
 
         if (source_idx >= 0) {
             struct raw_rx_source_state *source = &port->rx_sources[source_idx];
-            uint16_t vl_index = vl_id - source->config.vl_id_start;
 
             // Get sequence number from payload
             uint8_t *payload = pkt_data + RAW_PKT_ETH_HDR_SIZE + RAW_PKT_IP_HDR_SIZE + RAW_PKT_UDP_HDR_SIZE;
@@ -2082,24 +1750,8 @@ void *multi_queue_rx_worker(void *arg)
             source->stats.rx_bytes += pkt_len;
             pthread_spin_unlock(&source->stats.lock);
 
-            // Sequence validation
-            pthread_spin_lock(&source->vl_sequences[vl_index].rx_lock);
-
-            if (!source->vl_sequences[vl_index].rx_initialized) {
-                source->vl_sequences[vl_index].rx_expected_seq = seq + 1;
-                source->vl_sequences[vl_index].rx_initialized = true;
-            } else {
-                uint64_t expected = source->vl_sequences[vl_index].rx_expected_seq;
-                if (seq > expected) {
-                    uint64_t gap = seq - expected;
-                    pthread_spin_lock(&source->stats.lock);
-                    source->stats.lost_pkts += gap;
-                    pthread_spin_unlock(&source->stats.lock);
-                }
-                source->vl_sequences[vl_index].rx_expected_seq = seq + 1;
-            }
-
-            pthread_spin_unlock(&source->vl_sequences[vl_index].rx_lock);
+            // Sequence tracking (lost / reordered computed on read)
+            vl_seq_update(port->raw_index, queue->queue_id, vl_id, seq);
 
             // PRBS verification - find partner port
             struct raw_socket_port *partner = NULL;
@@ -2323,8 +1975,7 @@ void stop_raw_socket_workers(void)
 
 static uint64_t prev_tx_bytes[MAX_RAW_SOCKET_PORTS][MAX_RAW_TARGETS] = {{0}};
 static uint64_t prev_rx_bytes[MAX_RAW_SOCKET_PORTS][MAX_RAW_TARGETS] = {{0}};
-static uint64_t prev_dpdk_ext_rx_bytes_p12 = 0;  // Port 12 DPDK RX tracking
-static uint64_t prev_dpdk_ext_rx_bytes_p13 = 0;  // Port 13 DPDK RX tracking
+static uint64_t prev_dpdk_ext_rx_bytes[MAX_RAW_SOCKET_PORTS] = {0};  // DPDK external RX per raw port
 static uint64_t last_stats_time_ns = 0;
 
 void print_raw_socket_stats(void)
@@ -2371,9 +2022,13 @@ void print_raw_socket_stats(void)
                             rx_pkts = src->stats.rx_packets;
                             good = src->stats.good_pkts;
                             bad = src->stats.bad_pkts;
-                            lost = src->stats.lost_pkts;
                             bit_err = src->stats.bit_errors;
                             pthread_spin_unlock(&src->stats.lock);
+
+                            // Lost: merged over the destination's RX queue shards
+                            struct vl_seq_totals seq_tot;
+                            vl_seq_read(dp, src->config.vl_id_start, src->config.vl_id_count, &seq_tot);
+                            lost = seq_tot.lost;
                             break;
                         }
                     }
@@ -2402,23 +2057,37 @@ void print_raw_socket_stats(void)
     // Show DPDK External RX stats (only in normal mode, not ATE mode)
 #if DPDK_EXT_TX_ENABLED
   if (active_raw_port_count <= NORMAL_RAW_SOCKET_PORT_COUNT) {
-    struct raw_socket_port *port12 = &raw_ports[0]; // Port 12 is index 0
-    if (port12->port_id == 12) {
-        pthread_spin_lock(&port12->dpdk_ext_rx_stats.lock);
-        uint64_t dpdk_rx = port12->dpdk_ext_rx_stats.rx_packets;
-        uint64_t dpdk_rx_bytes = port12->dpdk_ext_rx_stats.rx_bytes;
-        uint64_t dpdk_good = port12->dpdk_ext_rx_stats.good_pkts;
-        uint64_t dpdk_bad = port12->dpdk_ext_rx_stats.bad_pkts;
-        uint64_t dpdk_bit_err = port12->dpdk_ext_rx_stats.bit_errors;
-        pthread_spin_unlock(&port12->dpdk_ext_rx_stats.lock);
-
-        // Get lost count from global sequence tracking
-        uint64_t dpdk_lost = get_global_sequence_lost();
+    for (int p = 0; p < active_raw_port_count; p++) {
+        struct raw_socket_port *port = &raw_ports[p];
+
+        // Source DPDK ports sending to this raw port
+        char sources[64] = "";
+        int src_len = 0;
+        for (int c = 0; c < EXT_SEQ_CONFIG_COUNT && src_len < (int)sizeof(sources); c++) {
+            if (ext_seq_configs[c].dest_port == port->port_id)
+                src_len += snprintf(sources + src_len, sizeof(sources) - src_len, "%s%u",
+                                    src_len ? "," : "", ext_seq_configs[c].port_id);
+        }
+        if (src_len == 0)
+            continue;
+
+        pthread_spin_lock(&port->dpdk_ext_rx_stats.lock);
+        uint64_t dpdk_rx = port->dpdk_ext_rx_stats.rx_packets;
+        uint64_t dpdk_rx_bytes = port->dpdk_ext_rx_stats.rx_bytes;
+        uint64_t dpdk_good = port->dpdk_ext_rx_stats.good_pkts;
+        uint64_t dpdk_bad = port->dpdk_ext_rx_stats.bad_pkts;
+        uint64_t dpdk_bit_err = port->dpdk_ext_rx_stats.bit_errors;
+        pthread_spin_unlock(&port->dpdk_ext_rx_stats.lock);
+
+        // Lost / reordered from the sequence tracker (merged over RX queues)
+        struct vl_seq_totals seq_tot;
+        dpdk_ext_seq_read(p, port->port_id, &seq_tot);
+        uint64_t dpdk_lost = seq_tot.lost;
 
         // Calculate RX rate in Mbps
-        uint64_t rx_bytes_delta = dpdk_rx_bytes - prev_dpdk_ext_rx_bytes_p12;
+        uint64_t rx_bytes_delta = dpdk_rx_bytes - prev_dpdk_ext_rx_bytes[p];
         double rx_mbps = (rx_bytes_delta * 8.0) / (elapsed_sec * 1000000.0);
-        prev_dpdk_ext_rx_bytes_p12 = dpdk_rx_bytes;
+        prev_dpdk_ext_rx_bytes[p] = dpdk_rx_bytes;
 
         // Calculate BER (Bit Error Rate) - bit_errors / total_bits_received
         double ber = 0.0;
@@ -2426,20 +2095,26 @@ void print_raw_socket_stats(void)
             ber = (double)dpdk_bit_err / (dpdk_rx_bytes * 8.0);
         }
 
+        char title[128];
+        snprintf(title, sizeof(title), "Port %u RX: DPDK External TX Packets (from Port %s)",
+                 port->port_id, sources);
+
         printf("\n┌══════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════┐\n");
-        printf("│  Port 12 RX: DPDK External TX Packets (from Port 2,3,4,5)                                                                                                                                                              │\n");
+        printf("│  %-214s│\n", title);
         printf("├═════════════════════════════════════╦══════════════════════════╦═════════════════════════════════════╦═════════════════════════════════════╦═════════════════════════════════════╦═════════════════════════════════════╦═════════════════════════╣\n");
         printf("│              RX Pkts                ║         RX Mbps          ║               Good                  ║               Bad                   ║            Bit Errors               ║               Lost                  ║           BER           ║\n");
         printf("├═════════════════════════════════════╬══════════════════════════╬═════════════════════════════════════╬═════════════════════════════════════╬═════════════════════════════════════╬═════════════════════════════════════╬═════════════════════════╣\n");
         printf("│ %35lu ║ %24.2f ║ %35lu ║ %35lu ║ %35lu ║ %35lu ║ %23.2e ║\n",
                dpdk_rx, rx_mbps, dpdk_good, dpdk_bad, dpdk_bit_err, dpdk_lost, ber);
         printf("└═════════════════════════════════════╩══════════════════════════╩═════════════════════════════════════╩═════════════════════════════════════╩═════════════════════════════════════╩═════════════════════════════════════╩═════════════════════════┘\n");
+        printf("  Sequence: lost=%lu reordered=%lu duplicates=%lu (%u VL-IDs active)\n",
+               seq_tot.lost, seq_tot.reordered, seq_tot.duplicates, seq_tot.active_vls);
 
         // Show per-queue statistics if multi-queue is enabled
-        if (port12->use_multi_queue_rx && port12->rx_queue_count > 0) {
-            printf("  Multi-Queue RX Stats (Lost is tracked globally across all queues):\n");
-            for (int q = 0; q < port12->rx_queue_count; q++) {
-                struct raw_rx_queue *rq = &port12->rx_queues[q];
+        if (port->use_multi_queue_rx && port->rx_queue_count > 0) {
+            printf("  Multi-Queue RX Stats (Lost is merged over all queue shards):\n");
+            for (int q = 0; q < port->rx_queue_count; q++) {
+                struct raw_rx_queue *rq = &port->rx_queues[q];
                 printf("    Q%d (CPU %2u): RX=%9lu Good=%9lu KDrop=%8lu VL-ID=[%u-%u] (%u unique)\n",
                        q, rq->cpu_core, rq->rx_packets, rq->good_pkts, rq->kernel_drops,
                        rq->vl_id_min == 0xFFFF ? 0 : rq->vl_id_min,
@@ -2447,54 +2122,7 @@ void print_raw_socket_stats(void)
                        rq->unique_vl_ids);
             }
             // Debug: show per-VL-ID sequence stats
-            print_global_sequence_debug();
-        }
-    }
-
-    // Port 13 DPDK External RX Stats (from Port 0,6)
-    struct raw_socket_port *port13 = &raw_ports[1]; // Port 13 is index 1
-    if (port13->port_id == 13) {
-        pthread_spin_lock(&port13->dpdk_ext_rx_stats.lock);
-        uint64_t dpdk_rx_p13 = port13->dpdk_ext_rx_stats.rx_packets;
-        uint64_t dpdk_rx_bytes_p13 = port13->dpdk_ext_rx_stats.rx_bytes;
-        uint64_t dpdk_good_p13 = port13->dpdk_ext_rx_stats.good_pkts;
-        uint64_t dpdk_bad_p13 = port13->dpdk_ext_rx_stats.bad_pkts;
-        uint64_t dpdk_bit_err_p13 = port13->dpdk_ext_rx_stats.bit_errors;
-        pthread_spin_unlock(&port13->dpdk_ext_rx_stats.lock);
-        // Get lost from global sequence tracking (not from stats struct)
-        uint64_t dpdk_lost_p13 = get_global_sequence_lost_p13();
-
-        // Calculate RX rate in Mbps for Port 13
-        uint64_t rx_bytes_delta_p13 = dpdk_rx_bytes_p13 - prev_dpdk_ext_rx_bytes_p13;
-        double rx_mbps_p13 = (rx_bytes_delta_p13 * 8.0) / (elapsed_sec * 1000000.0);
-        prev_dpdk_ext_rx_bytes_p13 = dpdk_rx_bytes_p13;
-
-        // Calculate BER for Port 13
-        double ber_p13 = 0.0;
-        if (dpdk_rx_bytes_p13 > 0) {
-            ber_p13 = (double)dpdk_bit_err_p13 / (dpdk_rx_bytes_p13 * 8.0);
-        }
-
-        printf("\n┌══════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════┐\n");
-        printf("│  Port 13 RX: DPDK External TX Packets (from Port 0,6)                                                                                                                                                                  │\n");
-        printf("├═════════════════════════════════════╦══════════════════════════╦═════════════════════════════════════╦═════════════════════════════════════╦═════════════════════════════════════╦═════════════════════════════════════╦═════════════════════════╣\n");
-        printf("│              RX Pkts                ║         RX Mbps          ║               Good                  ║               Bad                   ║            Bit Errors               ║               Lost                  ║           BER           ║\n");
-        printf("├═════════════════════════════════════╬══════════════════════════╬═════════════════════════════════════╬═════════════════════════════════════╬═════════════════════════════════════╬═════════════════════════════════════╬═════════════════════════╣\n");
-        printf("│ %35lu ║ %24.2f ║ %35lu ║ %35lu ║ %35lu ║ %35lu ║ %23.2e ║\n",
-               dpdk_rx_p13, rx_mbps_p13, dpdk_good_p13, dpdk_bad_p13, dpdk_bit_err_p13, dpdk_lost_p13, ber_p13);
-        printf("└═════════════════════════════════════╩══════════════════════════╩═════════════════════════════════════╩═════════════════════════════════════╩═════════════════════════════════════╩═════════════════════════════════════╩═════════════════════════┘\n");
-
-        // Show per-queue statistics if multi-queue is enabled for Port 13
-        if (port13->use_multi_queue_rx && port13->rx_queue_count > 0) {
-            printf("  Multi-Queue RX Stats:\n");
-            for (int q = 0; q < port13->rx_queue_count; q++) {
-                struct raw_rx_queue *rq = &port13->rx_queues[q];
-                printf("    Q%d (CPU %2u): RX=%9lu Good=%9lu KDrop=%8lu VL-ID=[%u-%u] (%u unique)\n",
-                       q, rq->cpu_core, rq->rx_packets, rq->good_pkts, rq->kernel_drops,
-                       rq->vl_id_min == 0xFFFF ? 0 : rq->vl_id_min,
-                       rq->vl_id_max,
-                       rq->unique_vl_ids);
-            }
+            vl_seq_print_debug(p, port->port_id);
         }
     }
   } // end if (normal mode)
@@ -2528,12 +2156,11 @@ void reset_raw_socket_stats(void)
         pthread_spin_init(&port->dpdk_ext_rx_stats.lock, PTHREAD_PROCESS_PRIVATE);
         pthread_spin_unlock(&port->dpdk_ext_rx_stats.lock);
     }
-    prev_dpdk_ext_rx_bytes_p12 = 0;
-    prev_dpdk_ext_rx_bytes_p13 = 0;
+    memset(prev_dpdk_ext_rx_bytes, 0, sizeof(prev_dpdk_ext_rx_bytes));
     last_stats_time_ns = 0;
 
-    // Reset global sequence tracking
-    reset_global_sequence_tracking();
+    // Drop sequence tracking counts (workers clear their shards lazily)
+    vl_seq_reset();
     printf("Raw socket statistics reset\n");
 }
 
@@ -2584,7 +2211,6 @@ void cleanup_raw_socket_ports(void)
             if (port->tx_targets[t].vl_sequences) {
                 for (uint16_t v = 0; v < port->tx_targets[t].config.vl_id_count; v++) {
                     pthread_spin_destroy(&port->tx_targets[t].vl_sequences[v].tx_lock);
-                    pthread_spin_destroy(&port->tx_targets[t].vl_sequences[v].rx_lock);
                 }
                 free(port->tx_targets[t].vl_sequences);
             }
@@ -2595,7 +2221,6 @@ void cleanup_raw_socket_ports(void)
             if (port->rx_sources[s].vl_sequences) {
                 for (uint16_t v = 0; v < port->rx_sources[s].config.vl_id_count; v++) {
                     pthread_spin_destroy(&port->rx_sources[s].vl_sequences[v].tx_lock);
-                    pthread_spin_destroy(&port->rx_sources[s].vl_sequences[v].rx_lock);
                 }
                 free(port->rx_sources[s].vl_sequences);
             }
@@ -0,0 +1,384 @@
+/**
+ * RX flow steering: VL-ID ranges -> RX queues with rte_flow
+ *
+ * Runs on the main lcore in start_txrx_workers, after the latency test
+ * (which moves the RETA to queue 0) and before the RX workers start. The
+ * VL-ID -> queue map is built first, then every run of VL-IDs of one queue
+ * is cut into prefix blocks; one rule per block. All-or-nothing per
+ * attempt: a port is either fully steered or left on RSS.
+ */
+
+#include "config.h"
+
+#if RX_FLOW_STEERING
+
+#include <rte_flow.h>
+#include <rte_ethdev.h>
+#include <rte_cycles.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "rx_flow_steer.h"
+#include "tx_rx_manager.h"  // port_vlans
+#include "vl_range.h"
+
+#define STEER_NO_QUEUE 0xFF
+
+struct steer_port
+{
+    struct rte_flow *flows[RX_FLOW_STEER_MAX_RULES];
+    uint16_t nb_flows;
+    enum rx_flow_steer_mode mode;
+    uint16_t queue_vls[NUM_RX_CORES];     // VL-IDs steered to each queue
+    uint16_t queue_rules[NUM_RX_CORES];
+    uint8_t queue_of_vl[MAX_VL_ID + 1];   // Exclusive modes: steer_queue_of_vl of the port
+    uint64_t install_us;
+};
+
+static struct steer_port steer_ports[MAX_PORTS];
+
+// VL-ID -> queue of the port being installed (main lcore only)
+static uint8_t steer_queue_of_vl[65536];
+
+static const char *const steer_mode_names[] = {"RSS", "MAC", "MAC+VLAN", "VLAN"};
+
+static void steer_map_range(uint16_t start, uint16_t count, uint16_t queue)
+{
+    for (uint32_t vl = start; vl < (uint32_t)start + count && vl < 65536; vl++) {
+        if (steer_queue_of_vl[vl] == STEER_NO_QUEUE)
+            steer_queue_of_vl[vl] = (uint8_t)queue;
+    }
+}
+
+/*
+ * Source port TX ranges first (what the peer sends back), then our RX
+ * ranges (VL-IDs remapped by the peer). Queue q of either side -> RX
+ * queue q % NUM_RX_CORES.
+ */
+static void steer_map_build(uint16_t port_id, uint16_t src_port_id)
+{
+    memset(steer_queue_of_vl, STEER_NO_QUEUE, sizeof(steer_queue_of_vl));
+
+    if (src_port_id < MAX_PORTS_CONFIG) {
+        for (uint16_t q = 0; q < port_vlans[src_port_id].tx_vlan_count; q++) {
+            steer_map_range(port_vlans[src_port_id].tx_vl_ids[q],
+                            get_tx_vl_range1_size(src_port_id, q), q % NUM_RX_CORES);
+            if (port_vlans[src_port_id].tx_vl_ids2[q] > 0)
+                steer_map_range(port_vlans[src_port_id].tx_vl_ids2[q],
+                                port_vlans[src_port_id].tx_vl_range2_size[q], q % NUM_RX_CORES);
+        }
+    }
+
+    if (port_id < MAX_PORTS_CONFIG) {
+        for (uint16_t q = 0; q < port_vlans[port_id].rx_vlan_count; q++) {
+            steer_map_range(port_vlans[port_id].rx_vl_ids[q],
+                            get_rx_vl_range1_size(port_id, q), q % NUM_RX_CORES);
+            if (port_vlans[port_id].rx_vl_ids2[q] > 0)
+                steer_map_range(port_vlans[port_id].rx_vl_ids2[q],
+                                port_vlans[port_id].rx_vl_range2_size[q], q % NUM_RX_CORES);
+        }
+    }
+}
+
+// Largest aligned power-of-two block starting at vl inside [vl, end)
+static uint32_t steer_block_size(uint32_t vl, uint32_t end)
+{
+    uint32_t size = vl ? (vl & -vl) : 65536;
+    while (vl + size > end)
+        size >>= 1;
+    return size;
+}
+
+// Rules needed by the prefix-block modes (runs of one queue, cut in blocks)
+static uint32_t steer_count_blocks(void)
+{
+    uint32_t blocks = 0;
+    uint32_t vl = 0;
+
+    while (vl < 65536) {
+        uint8_t q = steer_queue_of_vl[vl];
+        uint32_t end = vl + 1;
+        while (end < 65536 && steer_queue_of_vl[end] == q)
+            end++;
+        if (q != STEER_NO_QUEUE) {
+            for (uint32_t b = vl; b < end; b += steer_block_size(b, end))
+                blocks++;
+        }
+        vl = end;
+    }
+    return blocks;
+}
+
+static void steer_rollback(uint16_t port_id)
+{
+    struct steer_port *sp = &steer_ports[port_id];
+    struct rte_flow_error error;
+
+    for (uint16_t i = 0; i < sp->nb_flows; i++) {
+        if (rte_flow_destroy(port_id, sp->flows[i], &error) != 0)
+            printf("RX steer Port %u: flow destroy failed: %s\n",
+                   port_id, error.message ? error.message : "unknown");
+    }
+    sp->nb_flows = 0;
+    memset(sp->queue_of_vl, STEER_NO_QUEUE, sizeof(sp->queue_of_vl));
+    memset(sp->queue_vls, 0, sizeof(sp->queue_vls));
+    memset(sp->queue_rules, 0, sizeof(sp->queue_rules));
+}
+
+static int steer_create(uint16_t port_id, const struct rte_flow_item *pattern, uint16_t queue)
+{
+    struct steer_port *sp = &steer_ports[port_id];
+    struct rte_flow_error error;
+    struct rte_flow_attr attr;
+    struct rte_flow_action action[2];
+    struct rte_flow_action_queue queue_action;
+
+    memset(&attr, 0, sizeof(attr));
+    memset(action, 0, sizeof(action));
+    attr.ingress = 1;
+    attr.priority = 1;      // Below the PTP rule (priority 0)
+
+    queue_action.index = queue;
+    action[0].type = RTE_FLOW_ACTION_TYPE_QUEUE;
+    action[0].conf = &queue_action;
+    action[1].type = RTE_FLOW_ACTION_TYPE_END;
+
+    // Pattern support is checked once per attempt, on its first rule
+    if (sp->nb_flows == 0 && rte_flow_validate(port_id, &attr, pattern, action, &error) != 0) {
+        printf("RX steer Port %u: validate failed: %s\n",
+               port_id, error.message ? error.message : "unknown");
+        return -1;
+    }
+
+    struct rte_flow *flow = rte_flow_create(port_id, &attr, pattern, action, &error);
+    if (!flow) {
+        printf("RX steer Port %u: create failed after %u rules: %s\n",
+               port_id, sp->nb_flows, error.message ? error.message : "unknown");
+        return -1;
+    }
+    sp->flows[sp->nb_flows++] = flow;
+    sp->queue_rules[queue]++;
+    return 0;
+}
+
+/*
+ * Attempts 1 / 2: one rule per (VL-ID prefix block, queue). with_vlan adds
+ * ETH type 0x8100 and a VLAN item (any TCI) for PMDs that want the full
+ * L2 stack in the pattern.
+ */
+static int steer_install_mac(uint16_t port_id, bool with_vlan)
+{
+    struct steer_port *sp = &steer_ports[port_id];
+    struct rte_flow_item pattern[3];
+    struct rte_flow_item_eth eth_spec, eth_mask;
+    struct rte_flow_item_vlan vlan_spec, vlan_mask;
+
+    memset(pattern, 0, sizeof(pattern));
+    memset(&vlan_spec, 0, sizeof(vlan_spec));
+    memset(&vlan_mask, 0, sizeof(vlan_mask));
+
+    pattern[0].type = RTE_FLOW_ITEM_TYPE_ETH;
+    pattern[0].spec = &eth_spec;
+    pattern[0].mask = &eth_mask;
+    if (with_vlan) {
+        pattern[1].type = RTE_FLOW_ITEM_TYPE_VLAN;
+        pattern[1].spec = &vlan_spec;
+        pattern[1].mask = &vlan_mask;   // tci = 0: any VLAN
+        pattern[2].type = RTE_FLOW_ITEM_TYPE_END;
+    } else {
+        pattern[1].type = RTE_FLOW_ITEM_TYPE_END;
+    }
+
+    uint32_t vl = 0;
+    while (vl < 65536) {
+        uint8_t q = steer_queue_of_vl[vl];
+        uint32_t end = vl + 1;
+        while (end < 65536 && steer_queue_of_vl[end] == q)
+            end++;
+
+        if (q != STEER_NO_QUEUE) {
+            sp->queue_vls[q] += (uint16_t)(end - vl);
+            for (uint32_t b = vl; b < end; ) {
+                uint32_t size = steer_block_size(b, end);
+                uint16_t mask = (uint16_t)~(size - 1);
+
+                memset(&eth_spec, 0, sizeof(eth_spec));
+                memset(&eth_mask, 0, sizeof(eth_mask));
+                // VL-ID = DST MAC bytes 4-5
+                eth_spec.dst.addr_bytes[4] = (uint8_t)(b >> 8);
+                eth_spec.dst.addr_bytes[5] = (uint8_t)b;
+                eth_mask.dst.addr_bytes[4] = (uint8_t)(mask >> 8);
+                eth_mask.dst.addr_bytes[5] = (uint8_t)mask;
+                if (with_vlan) {
+                    eth_spec.type = rte_cpu_to_be_16(RTE_ETHER_TYPE_VLAN);
+                    eth_mask.type = 0xFFFF;
+                }
+
+                if (steer_create(port_id, pattern, q) != 0)
+                    return -1;
+                b += size;
+            }
+        }
+        vl = end;
+    }
+    return 0;
+}
+
+// Attempt 3: VLAN TCI of each RX queue (rx_vlans[q]) -> queue q
+static int steer_install_vlan(uint16_t port_id)
+{
+    struct steer_port *sp = &steer_ports[port_id];
+    struct rte_flow_item pattern[3];
+    struct rte_flow_item_vlan vlan_spec, vlan_mask;
+
+    if (port_id >= MAX_PORTS_CONFIG || port_vlans[port_id].rx_vlan_count == 0)
+        return -1;
+
+    memset(pattern, 0, sizeof(pattern));
+    pattern[0].type = RTE_FLOW_ITEM_TYPE_ETH;
+    pattern[1].type = RTE_FLOW_ITEM_TYPE_VLAN;
+    pattern[1].spec = &vlan_spec;
+    pattern[1].mask = &vlan_mask;
+    pattern[2].type = RTE_FLOW_ITEM_TYPE_END;
+
+    for (uint16_t q = 0; q < port_vlans[port_id].rx_vlan_count; q++) {
+        memset(&vlan_spec, 0, sizeof(vlan_spec));
+        memset(&vlan_mask, 0, sizeof(vlan_mask));
+        vlan_spec.tci = rte_cpu_to_be_16(port_vlans[port_id].rx_vlans[q] & 0x0FFF);
+        vlan_mask.tci = rte_cpu_to_be_16(0x0FFF);
+
+        uint16_t queue = q % NUM_RX_CORES;
+        if (steer_create(port_id, pattern, queue) != 0)
+            return -1;
+        sp->queue_vls[queue] += get_rx_vl_range1_size(port_id, q);
+    }
+    return 0;
+}
+
+enum rx_flow_steer_mode rx_flow_steer_install(uint16_t port_id, uint16_t src_port_id)
+{
+    if (port_id >= MAX_PORTS) {
+        printf("RX steer: Invalid port_id %u\n", port_id);
+        return RX_FLOW_STEER_RSS;
+    }
+
+    struct steer_port *sp = &steer_ports[port_id];
+    uint64_t t0 = rte_get_tsc_cycles();
+
+    // Remove existing rules if any
+    rx_flow_steer_remove(port_id);
+
+    steer_map_build(port_id, src_port_id);
+    uint32_t blocks = steer_count_blocks();
+
+    for (int mode = RX_FLOW_STEER_MAC; mode <= RX_FLOW_STEER_VLAN; mode++) {
+        int ret;
+        if (mode == RX_FLOW_STEER_VLAN) {
+            ret = steer_install_vlan(port_id);
+        } else if (blocks == 0 || blocks > RX_FLOW_STEER_MAX_RULES) {
+            printf("RX steer Port %u: %s needs %u rules (budget %u), skipped\n",
+                   port_id, steer_mode_names[mode], blocks, RX_FLOW_STEER_MAX_RULES);
+            continue;
+        } else {
+            ret = steer_install_mac(port_id, mode == RX_FLOW_STEER_MAC_VLAN);
+        }
+
+        if (ret == 0) {
+            sp->mode = (enum rx_flow_steer_mode)mode;
+            if (mode != RX_FLOW_STEER_VLAN)
+                memcpy(sp->queue_of_vl, steer_queue_of_vl, sizeof(sp->queue_of_vl));
+            break;
+        }
+        steer_rollback(port_id);
+    }
+
+    sp->install_us = (rte_get_tsc_cycles() - t0) * 1000000ULL / rte_get_tsc_hz();
+
+    if (sp->mode == RX_FLOW_STEER_RSS) {
+        printf("RX steer: ✗ Port %u: no steering rule accepted, RSS RETA stays (%lu us)\n",
+               port_id, sp->install_us);
+        return RX_FLOW_STEER_RSS;
+    }
+
+    printf("RX steer: ✓ Port %u: %s, %u rules in %lu us (%.1f us/rule), source port %u\n",
+           port_id, steer_mode_names[sp->mode], sp->nb_flows, sp->install_us,
+           (double)sp->install_us / sp->nb_flows, src_port_id);
+    printf("  VL-IDs / rules per queue:");
+    for (uint16_t q = 0; q < NUM_RX_CORES; q++)
+        printf(" Q%u=%u/%u", q, sp->queue_vls[q], sp->queue_rules[q]);
+    printf("\n");
+    return sp->mode;
+}
+
+void rx_flow_steer_remove(uint16_t port_id)
+{
+    if (port_id >= MAX_PORTS)
+        return;
+
+    struct steer_port *sp = &steer_ports[port_id];
+    if (sp->nb_flows > 0) {
+        uint16_t nb = sp->nb_flows;
+        steer_rollback(port_id);
+        printf("RX steer: Removed %u rules from port %u\n", nb, port_id);
+    }
+    sp->mode = RX_FLOW_STEER_RSS;
+}
+
+bool rx_flow_steer_exclusive_map(uint16_t port_id, uint16_t queue_id, uint8_t *map)
+{
+    bool any = false;
+
+    memset(map, 0, 65536 / 8);
+    if (port_id >= MAX_PORTS)
+        return false;
+
+    const struct steer_port *sp = &steer_ports[port_id];
+    if (sp->mode != RX_FLOW_STEER_MAC && sp->mode != RX_FLOW_STEER_MAC_VLAN)
+        return false;
+
+    for (uint32_t vl = 0; vl <= MAX_VL_ID; vl++) {
+        if (sp->queue_of_vl[vl] == queue_id) {
+            map[vl >> 3] |= (uint8_t)(1u << (vl & 7));
+            any = true;
+        }
+    }
+    return any;
+}
+
+void rx_flow_steer_print_stats(const struct ports_config *ports_config)
+{
+    bool header = false;
+
+    for (uint16_t i = 0; i < ports_config->nb_ports; i++) {
+        uint16_t port_id = ports_config->ports[i].port_id;
+        if (port_id >= MAX_PORTS || steer_ports[port_id].mode == RX_FLOW_STEER_RSS)
+            continue;
+
+        struct rte_eth_stats st;
+        if (rte_eth_stats_get(port_id, &st) != 0)
+            continue;
+
+        if (!header) {
+            printf("\n=== RX Flow Steering (per-queue RX share) ===\n");
+            header = true;
+        }
+
+        uint64_t total = 0, q_min = UINT64_MAX, q_max = 0;
+        for (uint16_t q = 0; q < NUM_RX_CORES && q < RTE_ETHDEV_QUEUE_STAT_CNTRS; q++) {
+            total += st.q_ipackets[q];
+            if (st.q_ipackets[q] < q_min) q_min = st.q_ipackets[q];
+            if (st.q_ipackets[q] > q_max) q_max = st.q_ipackets[q];
+        }
+
+        printf("Port %2u %-8s %3u rules:", port_id, steer_mode_names[steer_ports[port_id].mode],
+               steer_ports[port_id].nb_flows);
+        for (uint16_t q = 0; q < NUM_RX_CORES && q < RTE_ETHDEV_QUEUE_STAT_CNTRS; q++)
+            printf("  Q%u %5.1f%%", q, total ? 100.0 * (double)st.q_ipackets[q] / (double)total : 0.0);
+        if (q_min > 0 && total > 0)
+            printf("  max/min %.2f\n", (double)q_max / (double)q_min);
+        else
+            printf("  max/min -\n");
+    }
+}
+
+#endif /* RX_FLOW_STEERING */
@@ -4,12 +4,13 @@
 void socketToLcore()
 {
     unsigned lcore_id;
-    for (unsigned socket = 0; socket <= MAX_SOCKET; socket++)
+    for (unsigned socket = 0; socket < MAX_SOCKET; socket++)
     {
         uint16_t lcore_index = 0;
         RTE_LCORE_FOREACH(lcore_id)
         {
-            if (rte_lcore_to_socket_id(lcore_id) == socket)
+            if (rte_lcore_to_socket_id(lcore_id) == socket &&
+                lcore_index < MAX_LCORE_PER_SOCKET)
             {
                 socket_to_lcore[socket][lcore_index++] = lcore_id;
             }
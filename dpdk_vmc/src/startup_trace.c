@@ -0,0 +1,158 @@
+/**
+ * Startup trace
+ *
+ * Steps are kept in a small fixed table in start order. Phases are written
+ * by the main thread only; tasks come from the threads / lcores that ran
+ * them and take the lock. The first packet time is a single CAS from the
+ * TX workers' existing first-burst branch, read by the main loop.
+ */
+
+#include "startup_trace.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+struct startup_step
+{
+    char name[STARTUP_TRACE_NAME_LEN];
+    int lcore;                  // -2 = main thread phase, -1 = non-EAL thread
+    uint64_t start_ns;
+    uint64_t end_ns;
+};
+
+#define STARTUP_MAIN (-2)
+
+static struct startup_step steps[STARTUP_TRACE_MAX_STEPS];
+static int nb_steps;
+static int open_phase = -1;
+static pthread_mutex_t steps_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t t0_ns;
+static uint64_t ready_ns;
+static uint64_t first_pkt_ns;   // Set once by the first TX worker burst (CAS)
+static bool parallel_mode;
+static bool result_printed;
+
+uint64_t startup_trace_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static double rel_ms(uint64_t ns)
+{
+    return ns > t0_ns ? (ns - t0_ns) / 1e6 : 0.0;
+}
+
+static int add_step(const char *name, int lcore, uint64_t start_ns, uint64_t end_ns)
+{
+    int idx = -1;
+
+    pthread_mutex_lock(&steps_lock);
+    if (nb_steps < STARTUP_TRACE_MAX_STEPS) {
+        idx = nb_steps++;
+        snprintf(steps[idx].name, sizeof(steps[idx].name), "%s", name);
+        steps[idx].lcore = lcore;
+        steps[idx].start_ns = start_ns;
+        steps[idx].end_ns = end_ns;
+    }
+    pthread_mutex_unlock(&steps_lock);
+    return idx;
+}
+
+void startup_trace_init(bool parallel)
+{
+    t0_ns = startup_trace_now_ns();
+    parallel_mode = parallel;
+    nb_steps = 0;
+    open_phase = -1;
+    ready_ns = 0;
+    first_pkt_ns = 0;
+    result_printed = false;
+}
+
+void startup_trace_phase(const char *name)
+{
+    uint64_t now = startup_trace_now_ns();
+
+    if (open_phase >= 0)
+        steps[open_phase].end_ns = now;
+    open_phase = name ? add_step(name, STARTUP_MAIN, now, 0) : -1;
+}
+
+void startup_trace_task(const char *name, int lcore, uint64_t start_ns, uint64_t end_ns)
+{
+    add_step(name, lcore, start_ns, end_ns);
+}
+
+void startup_trace_first_packet(void)
+{
+    uint64_t expected = 0;
+    __atomic_compare_exchange_n(&first_pkt_ns, &expected, startup_trace_now_ns(),
+                                false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+}
+
+void startup_trace_report(void)
+{
+    startup_trace_phase(NULL);
+    ready_ns = startup_trace_now_ns();
+
+    double ready_ms = rel_ms(ready_ns);
+    double main_ms = 0.0, bg_ms = 0.0;
+
+    printf("\n=== Startup Trace (%s init) ===\n", parallel_mode ? "parallel" : "serial");
+    printf("  %-24s %-9s %10s %10s %10s %7s\n", "Step", "Where", "Start ms", "End ms", "Dur ms", "Share");
+
+    pthread_mutex_lock(&steps_lock);
+    for (int i = 0; i < nb_steps; i++) {
+        const struct startup_step *s = &steps[i];
+        char where[24];
+        double dur = (s->end_ns - s->start_ns) / 1e6;
+
+        if (s->lcore == STARTUP_MAIN) {
+            snprintf(where, sizeof(where), "main");
+            main_ms += dur;
+        } else {
+            if (s->lcore < 0)
+                snprintf(where, sizeof(where), "thread");
+            else
+                snprintf(where, sizeof(where), "lcore %d", s->lcore);
+            bg_ms += dur;
+        }
+        printf("  %-24s %-9s %10.1f %10.1f %10.1f %6.1f%%\n", s->name, where,
+               rel_ms(s->start_ns), rel_ms(s->end_ns), dur,
+               ready_ms > 0 ? 100.0 * dur / ready_ms : 0.0);
+    }
+    pthread_mutex_unlock(&steps_lock);
+
+    printf("  Ready (workers started): %.1f ms  (main thread %.1f ms, overlapped %.1f ms)\n",
+           ready_ms, main_ms, bg_ms);
+    printf("  Time to first packet: waiting for first TX burst...\n\n");
+}
+
+void startup_trace_poll(void)
+{
+    if (result_printed || ready_ns == 0)
+        return;
+
+    uint64_t first = __atomic_load_n(&first_pkt_ns, __ATOMIC_ACQUIRE);
+    if (first == 0)
+        return;
+    result_printed = true;
+
+    printf("\n=== Startup: first packet %.1f ms after start (%.1f ms after ready) ===\n",
+           rel_ms(first), first > ready_ns ? (first - ready_ns) / 1e6 : 0.0);
+
+    // One key per step for bench/startup_ab.sh
+    printf("STARTUP-RESULT mode=%s ready_ms=%.1f first_pkt_ms=%.1f",
+           parallel_mode ? "parallel" : "serial", rel_ms(ready_ns), rel_ms(first));
+    pthread_mutex_lock(&steps_lock);
+    for (int i = 0; i < nb_steps; i++)
+        printf(" %s_ms=%.1f", steps[i].name, (steps[i].end_ns - steps[i].start_ns) / 1e6);
+    pthread_mutex_unlock(&steps_lock);
+    printf("\n");
+    fflush(stdout);
+}
@@ -0,0 +1,137 @@
+/**
+ * Shared stats memzones for the secondary process reader
+ *
+ * Primary side only: the counter arrays are moved once, before any worker
+ * or raw socket thread holds a pointer into them; the hot paths keep
+ * indexing the same global names.
+ */
+
+#include "stats_shm.h"
+
+#if STATS_SHM_ENABLED
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <rte_eal.h>
+#include <rte_errno.h>
+#include <rte_memzone.h>
+#include <rte_cycles.h>
+
+static struct stats_shm_dir *shm_dir;
+static unsigned shm_zones;
+
+static void *shm_reserve(const char *name, size_t size)
+{
+    const struct rte_memzone *mz = rte_memzone_reserve_aligned(name, size, SOCKET_ID_ANY, 0,
+                                                               RTE_CACHE_LINE_SIZE);
+    if (mz == NULL)
+    {
+        printf("Warning: Cannot reserve memzone %s (%zu KB): %s, not visible to secondary processes\n",
+               name, size >> 10, rte_strerror(rte_errno));
+        return NULL;
+    }
+    memset(mz->addr, 0, size);
+    shm_zones++;
+    return mz->addr;
+}
+
+// .bss array -> memzone, keeping what was already written
+static void *shm_move(const char *name, void *cur, size_t size)
+{
+    void *p = shm_reserve(name, size);
+    if (p == NULL)
+        return cur;
+    memcpy(p, cur, size);
+    return p;
+}
+
+static void shm_copy_latency(void)
+{
+    shm_dir->latency_seq++;
+    rte_smp_wmb();
+#if LATENCY_TEST_ENABLED
+    memcpy(&shm_dir->latency_test, &g_latency_test, sizeof(g_latency_test));
+#endif
+    memcpy(&shm_dir->emb_latency, &g_emb_latency, sizeof(g_emb_latency));
+    rte_smp_wmb();
+    shm_dir->latency_seq++;
+}
+
+void stats_shm_init(void)
+{
+    if (rte_eal_process_type() != RTE_PROC_PRIMARY)
+        return;
+
+    shm_dir = shm_reserve(STATS_SHM_DIR_NAME, sizeof(*shm_dir));
+    if (shm_dir == NULL)
+        return;
+
+    rx_stats_per_port = shm_move("vmc_rx_stats", rx_stats_per_port,
+                                 sizeof(struct rx_stats) * MAX_PORTS);
+    raw_ports = shm_move("vmc_raw_ports", raw_ports,
+                         sizeof(struct raw_socket_port) * MAX_RAW_SOCKET_PORTS);
+#if PCAP_REPLAY_ENABLED
+    replay_stats = shm_move("vmc_replay_stats", replay_stats,
+                            sizeof(struct replay_stats) * MAX_PORTS * NUM_TX_CORES);
+#endif
+
+    shm_dir->layout = (struct stats_shm_layout){
+        .max_ports = MAX_PORTS,
+        .max_vl_id = MAX_VL_ID,
+        .num_tx_cores = NUM_TX_CORES,
+        .num_rx_cores = NUM_RX_CORES,
+        .max_raw_ports = MAX_RAW_SOCKET_PORTS,
+        .max_raw_targets = MAX_RAW_TARGETS,
+        .dir_size = sizeof(struct stats_shm_dir),
+        .rx_stats_size = sizeof(struct rx_stats),
+        .vl_tracker_size = sizeof(struct port_vl_tracker),
+        .raw_port_size = sizeof(struct raw_socket_port),
+#if PCAP_REPLAY_ENABLED
+        .replay_stats_size = sizeof(struct replay_stats),
+#endif
+    };
+    shm_dir->tsc_hz = rte_get_tsc_hz();
+    shm_dir->start_tsc = rte_rdtsc();
+    shm_dir->primary_pid = (int32_t)getpid();
+    shm_dir->rx_stats = rx_stats_per_port;
+    shm_dir->raw_ports = raw_ports;
+#if PCAP_REPLAY_ENABLED
+    shm_dir->replay_stats = replay_stats;
+#endif
+
+    // Embedded latency ran before EAL init
+    shm_copy_latency();
+
+    shm_dir->version = STATS_SHM_VERSION;
+    rte_smp_wmb();
+    shm_dir->magic = STATS_SHM_MAGIC;
+
+    printf("Shared stats: %u memzones (%s), reader: make stats-reader\n",
+           shm_zones, STATS_SHM_DIR_NAME);
+}
+
+void stats_shm_publish(const struct ports_config *ports_config)
+{
+    if (shm_dir == NULL)
+        return;
+
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < ports_config->nb_ports && n < MAX_PORTS; i++)
+    {
+        uint16_t port_id = ports_config->ports[i].port_id;
+        if (port_id >= MAX_PORTS)
+            continue;
+        shm_dir->port_ids[n++] = port_id;
+        shm_dir->vl_trackers[port_id] = port_vl_trackers[port_id];
+    }
+    shm_dir->nb_ports = n;
+    shm_dir->raw_port_count = active_raw_port_count;
+
+    shm_copy_latency();
+
+    rte_smp_wmb();
+    shm_dir->ready = 1;
+}
+
+#endif /* STATS_SHM_ENABLED */
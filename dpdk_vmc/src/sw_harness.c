@@ -0,0 +1,760 @@
+/**
+ * Software Throughput Harness
+ *
+ * NIC-free end-to-end baseline: ports 0..3 are net_ring vdevs (net_null for
+ * TX-only) and one or more fabric lcores stand in for the Cumulus switch and
+ * the peer VMC. The application workers run unmodified on top.
+ *
+ *   loopback: tx_worker --TX q--> tx ring --fabric--> rx ring --RX q%NUM_RX_CORES--> rx_worker
+ *             fabric: TX VL-ID/VLAN -> RX VL-ID/VLAN (positional, from port_vlans)
+ *                     + splitmix64_transform (what VMC_2 does to the payload)
+ *   source:   fabric gen --> rx ring --> forward_worker --> tx ring --> fabric sink
+ *   null:     tx_worker --> net_null (no-rx=1)
+ *
+ * loopback / source follow the role (verifier / forwarder); each has its own
+ * fabric lcore entry point, picked when the fabric is launched.
+ *
+ * TX/RX rates come from the ethdev counters of the vdevs (packets the
+ * workers actually got through rte_eth_tx_burst / rte_eth_rx_burst); fabric
+ * rates from the fabric's own counters. Gbps are L2 frame bytes.
+ *
+ * Run with --no-pci so the vdevs get port IDs 0..3.
+ */
+
+#include "config.h"
+
+#if SW_HARNESS_ENABLED
+
+#include <rte_bus_vdev.h>
+#include <rte_cycles.h>
+#include <rte_ethdev.h>
+#include <rte_eth_ring.h>
+#include <rte_lcore.h>
+#include <rte_mbuf.h>
+#include <rte_memcpy.h>
+#include <rte_ring.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "sw_harness.h"
+#include "packet.h"
+#include "payload_transform.h"
+#include "socket.h"          // get_unused_cores
+#include "tx_rx_manager.h"   // port_vlans, MAX_VL_ID, mbuf_pool_total_bytes
+#include "vl_range.h"
+#include "vmc_role.h"
+
+#if NUM_TX_CORES > SW_HARNESS_QUEUES || NUM_RX_CORES > SW_HARNESS_QUEUES
+#error "SW_HARNESS_QUEUES must cover NUM_TX_CORES and NUM_RX_CORES"
+#endif
+
+#if SW_HARNESS_PORTS > MAX_PORTS
+#error "SW_HARNESS_PORTS exceeds MAX_PORTS"
+#endif
+
+
+#define HARNESS_HDR_LEN     (L2_HEADER_SIZE + IP_HDR_SIZE + UDP_HDR_SIZE)
+#define HARNESS_VL_IP_OFF   (L2_HEADER_SIZE + 18)   // Last 2 bytes of dst IP
+#define HARNESS_MAX_GEN_VLS 1024
+
+// Fabric counters (single writer: the fabric lcore owning the port)
+struct harness_counters {
+    uint64_t from_tx_pkts;   // Drained from app TX rings
+    uint64_t from_tx_bytes;
+    uint64_t to_rx_pkts;     // Enqueued into app RX rings
+    uint64_t to_rx_bytes;
+    uint64_t drops;          // RX ring full
+    uint64_t ctl_pkts;       // Non-data TX queues (ext TX, PTP), freed
+} __rte_cache_aligned;
+
+struct harness_port {
+    uint16_t port_id;
+    struct rte_ring *tx_rings[SW_HARNESS_QUEUES];   // ethdev TX -> fabric
+    struct rte_ring *rx_rings[SW_HARNESS_QUEUES];   // fabric -> ethdev RX
+};
+
+struct fabric_ctx {
+    uint16_t idx;
+    uint16_t lcore_id;
+    uint16_t nb_ports;
+    uint16_t ports[SW_HARNESS_PORTS];
+    volatile bool *stop_flag;
+};
+
+// Per-second sample (cumulative values)
+struct harness_snapshot {
+    uint64_t tsc;
+    uint64_t app_tx_pkts[SW_HARNESS_PORTS];
+    uint64_t app_tx_bytes[SW_HARNESS_PORTS];
+    uint64_t app_tx_err[SW_HARNESS_PORTS];
+    uint64_t app_rx_pkts[SW_HARNESS_PORTS];
+    uint64_t app_rx_bytes[SW_HARNESS_PORTS];
+    struct harness_counters fab[SW_HARNESS_PORTS];
+};
+
+// Totals after warmup
+struct harness_totals {
+    double seconds;
+    uint64_t app_tx_pkts;
+    double app_tx_bytes;
+    uint64_t app_rx_pkts;
+    double app_rx_bytes;
+    uint64_t fab_in_pkts;
+    uint64_t fab_out_pkts;
+    uint64_t drops;
+};
+
+static struct harness_port hports[SW_HARNESS_PORTS];
+static struct harness_counters fabric_stats[SW_HARNESS_PORTS];
+static uint16_t nb_fabric;
+static uint16_t nb_harness_ports;
+static bool harness_created = false;
+static bool harness_source = false;     // Forwarder role: generate into the RX rings
+static const char *harness_mode_name = SW_HARNESS_NULL ? "null" : "loopback";
+
+static struct harness_snapshot prev_snap;
+static struct harness_totals totals;
+
+#if !SW_HARNESS_NULL
+static struct fabric_ctx fabric_ctxs[SW_HARNESS_FABRIC_CORES];
+#endif
+
+#if !SW_HARNESS_NULL
+// Source mode generator state, per (port, RX queue)
+struct harness_gen {
+    uint8_t hdr[HARNESS_HDR_LEN];   // Eth/VLAN/IP/UDP template
+    uint16_t vl_pos;
+    uint64_t seq;
+};
+
+static struct harness_gen gens[SW_HARNESS_PORTS][NUM_RX_CORES];
+static uint16_t gen_vl_ids[SW_HARNESS_PORTS][HARNESS_MAX_GEN_VLS];
+static uint16_t gen_vl_count[SW_HARNESS_PORTS];
+static struct rte_mempool *gen_pools[SW_HARNESS_PORTS];
+
+// Loopback remap tables (0 = keep), built once from port_vlans
+static uint16_t vl_remap[SW_HARNESS_PORTS][MAX_VL_ID + 1];
+static uint16_t vlan_remap[SW_HARNESS_PORTS][SW_HARNESS_QUEUES];
+#endif
+
+static inline void stat_add(uint64_t *counter, uint64_t v)
+{
+    __atomic_store_n(counter, *counter + v, __ATOMIC_RELAXED);
+}
+
+static inline uint64_t burst_bytes(struct rte_mbuf **pkts, unsigned n)
+{
+    uint64_t bytes = 0;
+    for (unsigned i = 0; i < n; i++)
+        bytes += pkts[i]->pkt_len;
+    return bytes;
+}
+
+// ==========================================
+// PORT CREATION
+// ==========================================
+
+int sw_harness_create_ports(void)
+{
+    char name[RTE_RING_NAMESIZE];
+
+    if (rte_eth_dev_count_avail() != 0) {
+        fprintf(stderr, "SW HARNESS: %u ethdev(s) already probed, run with --no-pci\n",
+                rte_eth_dev_count_avail());
+        return -1;
+    }
+
+    printf("\n=== SW Harness: creating %d %s ports ===\n", SW_HARNESS_PORTS,
+           SW_HARNESS_NULL ? "net_null" : "net_ring");
+
+    for (uint16_t p = 0; p < SW_HARNESS_PORTS; p++) {
+        int port_id;
+
+#if SW_HARNESS_NULL
+        uint16_t pid;
+        snprintf(name, sizeof(name), "net_null%u", p);
+        if (rte_vdev_init(name, "no-rx=1") != 0 ||
+            rte_eth_dev_get_port_by_name(name, &pid) != 0) {
+            fprintf(stderr, "SW HARNESS: Failed to create %s\n", name);
+            return -1;
+        }
+        port_id = pid;
+#else
+        struct harness_port *hp = &hports[p];
+        int socket = rte_socket_id();
+        for (uint16_t q = 0; q < SW_HARNESS_QUEUES; q++) {
+            snprintf(name, sizeof(name), "swh_tx_%u_%u", p, q);
+            hp->tx_rings[q] = rte_ring_create(name, SW_HARNESS_RING_SIZE, socket,
+                                              RING_F_SP_ENQ | RING_F_SC_DEQ);
+            snprintf(name, sizeof(name), "swh_rx_%u_%u", p, q);
+            hp->rx_rings[q] = rte_ring_create(name, SW_HARNESS_RING_SIZE, socket,
+                                              RING_F_SP_ENQ | RING_F_SC_DEQ);
+            if (!hp->tx_rings[q] || !hp->rx_rings[q]) {
+                fprintf(stderr, "SW HARNESS: Failed to create rings for port %u\n", p);
+                return -1;
+            }
+        }
+
+        snprintf(name, sizeof(name), "swh_port%u", p);
+        port_id = rte_eth_from_rings(name, hp->rx_rings, SW_HARNESS_QUEUES,
+                                     hp->tx_rings, SW_HARNESS_QUEUES, socket);
+        if (port_id < 0) {
+            fprintf(stderr, "SW HARNESS: rte_eth_from_rings failed for port %u\n", p);
+            return -1;
+        }
+#endif
+
+        if (port_id != p) {
+            fprintf(stderr, "SW HARNESS: vdev got port ID %d, expected %u (run with --no-pci)\n",
+                    port_id, p);
+            return -1;
+        }
+        hports[p].port_id = (uint16_t)port_id;
+        printf("  Port %u: %s (%d queues)\n", p, name, SW_HARNESS_QUEUES);
+    }
+
+    harness_created = true;
+    return 0;
+}
+
+#if !SW_HARNESS_NULL
+
+// ==========================================
+// LOOPBACK FABRIC (switch + VMC_2 stand-in)
+// ==========================================
+
+// Map [tx_start, tx_start + size) onto [rx_start, rx_start + size)
+static void map_vl_range(uint16_t p, uint16_t tx_start, uint16_t tx_size,
+                         uint16_t rx_start, uint16_t rx_size)
+{
+    if (tx_start == 0 || rx_start == 0)
+        return;
+    if (tx_size != rx_size) {
+        printf("  Port %u: TX VL %u+%u / RX VL %u+%u size mismatch, VL-ID kept\n",
+               p, tx_start, tx_size, rx_start, rx_size);
+        return;
+    }
+    for (uint16_t k = 0; k < tx_size; k++) {
+        if (tx_start + k <= MAX_VL_ID)
+            vl_remap[p][tx_start + k] = rx_start + k;
+    }
+}
+
+/**
+ * Build per-port remap tables: TX queue q ranges -> RX queue q ranges,
+ * TX queue q VLAN -> rx_vlans[q]
+ */
+static void build_remap_tables(void)
+{
+    memset(vl_remap, 0, sizeof(vl_remap));
+    memset(vlan_remap, 0, sizeof(vlan_remap));
+
+#if SW_HARNESS_REMAP
+    for (uint16_t p = 0; p < nb_harness_ports; p++) {
+        const struct port_vlan_config *cfg = &port_vlans[p];
+        uint16_t n = cfg->tx_vlan_count < cfg->rx_vlan_count ? cfg->tx_vlan_count
+                                                            : cfg->rx_vlan_count;
+        for (uint16_t q = 0; q < n && q < NUM_TX_CORES; q++) {
+            map_vl_range(p, cfg->tx_vl_ids[q], get_tx_vl_range1_size(p, q),
+                         cfg->rx_vl_ids[q], get_rx_vl_range1_size(p, q));
+            map_vl_range(p, cfg->tx_vl_ids2[q], cfg->tx_vl_range2_size[q],
+                         cfg->rx_vl_ids2[q], cfg->rx_vl_range2_size[q]);
+            vlan_remap[p][q] = cfg->rx_vlans[q];
+        }
+    }
+#endif
+}
+
+static inline void fabric_remap(uint16_t p, uint16_t q, struct rte_mbuf *m)
+{
+    uint8_t *pkt = rte_pktmbuf_mtod(m, uint8_t *);
+    uint16_t vl_id = ((uint16_t)pkt[4] << 8) | pkt[5];
+    uint16_t new_vl = (vl_id <= MAX_VL_ID) ? vl_remap[p][vl_id] : 0;
+
+    if (new_vl != 0) {
+        pkt[4] = (uint8_t)(new_vl >> 8);
+        pkt[5] = (uint8_t)(new_vl & 0xFF);
+        pkt[HARNESS_VL_IP_OFF] = (uint8_t)(new_vl >> 8);
+        pkt[HARNESS_VL_IP_OFF + 1] = (uint8_t)(new_vl & 0xFF);
+    }
+
+#if VLAN_ENABLED
+    uint16_t vlan = vlan_remap[p][q];
+    if (vlan != 0) {
+        uint16_t tci = ((uint16_t)pkt[14] << 8) | pkt[15];
+        tci = (tci & 0xF000) | (vlan & 0x0FFF);
+        pkt[14] = (uint8_t)(tci >> 8);
+        pkt[15] = (uint8_t)(tci & 0xFF);
+    }
+#else
+    (void)q;
+#endif
+}
+
+static inline void fabric_loopback_queue(uint16_t p, uint16_t q, struct rte_mbuf **pkts)
+{
+    struct harness_port *hp = &hports[p];
+    struct harness_counters *st = &fabric_stats[p];
+
+    unsigned n = rte_ring_dequeue_burst(hp->tx_rings[q], (void **)pkts, SW_HARNESS_BURST, NULL);
+    if (n == 0)
+        return;
+
+    stat_add(&st->from_tx_pkts, n);
+    stat_add(&st->from_tx_bytes, burst_bytes(pkts, n));
+
+    // Ext TX / PTP queues have no peer in the harness
+    if (q >= NUM_TX_CORES) {
+        rte_pktmbuf_free_bulk(pkts, n);
+        stat_add(&st->ctl_pkts, n);
+        return;
+    }
+
+    // The wire hands the peer one contiguous frame; extbuf TX chains the
+    // payload from the read-only PRBS cache, so copy it before rewriting
+    unsigned kept = 0;
+    for (unsigned i = 0; i < n; i++) {
+        if (unlikely(pkts[i]->nb_segs > 1) && rte_pktmbuf_linearize(pkts[i]) != 0) {
+            rte_pktmbuf_free(pkts[i]);
+            stat_add(&st->drops, 1);
+            continue;
+        }
+        pkts[kept++] = pkts[i];
+    }
+    n = kept;
+
+    for (unsigned i = 0; i < n; i++) {
+        fabric_remap(p, q, pkts[i]);
+        splitmix64_transform(pkts[i]);
+    }
+
+    unsigned sent = rte_ring_enqueue_burst(hp->rx_rings[q % NUM_RX_CORES],
+                                           (void * const *)pkts, n, NULL);
+    stat_add(&st->to_rx_pkts, sent);
+    stat_add(&st->to_rx_bytes, burst_bytes(pkts, sent));
+    if (unlikely(sent < n)) {
+        rte_pktmbuf_free_bulk(pkts + sent, n - sent);
+        stat_add(&st->drops, n - sent);
+    }
+}
+
+/**
+ * Loopback fabric lcore (verifier role): owns ports p where p % nb_fabric == idx
+ */
+static int fabric_loopback_main(void *arg)
+{
+    struct fabric_ctx *ctx = (struct fabric_ctx *)arg;
+    struct rte_mbuf *pkts[SW_HARNESS_BURST];
+
+    printf("SW HARNESS: Fabric %u running on lcore %u (%u ports, loopback)\n",
+           ctx->idx, rte_lcore_id(), ctx->nb_ports);
+
+    while (!*ctx->stop_flag) {
+        for (uint16_t i = 0; i < ctx->nb_ports; i++) {
+            uint16_t p = ctx->ports[i];
+            for (uint16_t q = 0; q < SW_HARNESS_QUEUES; q++)
+                fabric_loopback_queue(p, q, pkts);
+        }
+    }
+
+    printf("SW HARNESS: Fabric %u stopped\n", ctx->idx);
+    return 0;
+}
+
+// ==========================================
+// SOURCE FABRIC (VMC_1 + switch stand-in for forward_worker)
+// ==========================================
+
+static void add_gen_range(uint16_t p, uint16_t start, uint16_t size)
+{
+    if (start == 0)
+        return;
+    for (uint16_t k = 0; k < size && gen_vl_count[p] < HARNESS_MAX_GEN_VLS; k++)
+        gen_vl_ids[p][gen_vl_count[p]++] = start + k;
+}
+
+/**
+ * Generator templates: VL-IDs from every TX range of the port (what
+ * forward_worker looks up), VLAN = rx_vlans[q] (what VMC_2 receives)
+ */
+static int build_generators(void)
+{
+    char name[RTE_MEMPOOL_NAMESIZE];
+
+    for (uint16_t p = 0; p < nb_harness_ports; p++) {
+        const struct port_vlan_config *cfg = &port_vlans[p];
+
+        gen_vl_count[p] = 0;
+        for (uint16_t q = 0; q < cfg->tx_vlan_count; q++) {
+            add_gen_range(p, cfg->tx_vl_ids[q], get_tx_vl_range1_size(p, q));
+            add_gen_range(p, cfg->tx_vl_ids2[q], cfg->tx_vl_range2_size[q]);
+        }
+        if (gen_vl_count[p] == 0) {
+            printf("  Port %u: no TX VL-ID ranges, generating VL-ID 3\n", p);
+            gen_vl_ids[p][gen_vl_count[p]++] = 3;
+        }
+
+        snprintf(name, sizeof(name), "swh_gen_pool_%u", p);
+        gen_pools[p] = rte_pktmbuf_pool_create(name, SW_HARNESS_POOL_SIZE, MBUF_CACHE_SIZE, 0,
+                                               RTE_MBUF_DEFAULT_BUF_SIZE,
+                                               rte_eth_dev_socket_id(p));
+        if (!gen_pools[p]) {
+            fprintf(stderr, "SW HARNESS: Failed to create generator pool for port %u\n", p);
+            return -1;
+        }
+
+        for (uint16_t q = 0; q < NUM_RX_CORES; q++) {
+            struct harness_gen *g = &gens[p][q];
+            struct packet_template tmpl;
+            struct packet_config pcfg;
+
+            init_packet_config(&pcfg);
+            pcfg.dst_ip = (224U << 24) | (224U << 16);
+#if VLAN_ENABLED
+            pcfg.vlan_id = cfg->rx_vlan_count ? cfg->rx_vlans[q % cfg->rx_vlan_count] : 0;
+#endif
+            build_packet(&tmpl, &pcfg);
+
+            memcpy(g->hdr, &tmpl, HARNESS_HDR_LEN);
+            g->vl_pos = (uint16_t)((gen_vl_count[p] * q) / NUM_RX_CORES);
+            g->seq = 0;
+        }
+
+        printf("  Port %u: generating %u VL-IDs on %d RX queues\n",
+               p, gen_vl_count[p], NUM_RX_CORES);
+    }
+    return 0;
+}
+
+static inline void fabric_gen_queue(uint16_t p, uint16_t q, struct rte_mbuf **pkts)
+{
+    struct rte_ring *ring = hports[p].rx_rings[q];
+    struct harness_counters *st = &fabric_stats[p];
+    struct harness_gen *g = &gens[p][q];
+
+    if (rte_ring_free_count(ring) < SW_HARNESS_BURST)
+        return;
+    // Pool empty: forward side is still holding the mbufs
+    if (rte_pktmbuf_alloc_bulk(gen_pools[p], pkts, SW_HARNESS_BURST) != 0)
+        return;
+
+    for (unsigned i = 0; i < SW_HARNESS_BURST; i++) {
+        struct rte_mbuf *m = pkts[i];
+        uint8_t *pkt = rte_pktmbuf_mtod(m, uint8_t *);
+        uint16_t vl_id = gen_vl_ids[p][g->vl_pos];
+
+        if (++g->vl_pos == gen_vl_count[p])
+            g->vl_pos = 0;
+
+        // Header + VL-ID + seq; payload content is irrelevant to forward_worker
+        rte_memcpy(pkt, g->hdr, HARNESS_HDR_LEN);
+        pkt[4] = (uint8_t)(vl_id >> 8);
+        pkt[5] = (uint8_t)(vl_id & 0xFF);
+        pkt[HARNESS_VL_IP_OFF] = (uint8_t)(vl_id >> 8);
+        pkt[HARNESS_VL_IP_OFF + 1] = (uint8_t)(vl_id & 0xFF);
+        *(uint64_t *)(pkt + HARNESS_HDR_LEN) = g->seq++;
+
+        m->data_len = PACKET_SIZE;
+        m->pkt_len = PACKET_SIZE;
+    }
+
+    unsigned sent = rte_ring_enqueue_burst(ring, (void * const *)pkts, SW_HARNESS_BURST, NULL);
+    stat_add(&st->to_rx_pkts, sent);
+    stat_add(&st->to_rx_bytes, (uint64_t)sent * PACKET_SIZE);
+    if (unlikely(sent < SW_HARNESS_BURST)) {
+        rte_pktmbuf_free_bulk(pkts + sent, SW_HARNESS_BURST - sent);
+        stat_add(&st->drops, SW_HARNESS_BURST - sent);
+    }
+}
+
+static inline void fabric_sink_queue(uint16_t p, uint16_t q, struct rte_mbuf **pkts)
+{
+    struct harness_counters *st = &fabric_stats[p];
+
+    unsigned n = rte_ring_dequeue_burst(hports[p].tx_rings[q], (void **)pkts,
+                                        SW_HARNESS_BURST, NULL);
+    if (n == 0)
+        return;
+
+    stat_add(&st->from_tx_pkts, n);
+    stat_add(&st->from_tx_bytes, burst_bytes(pkts, n));
+    if (q >= NUM_RX_CORES)
+        stat_add(&st->ctl_pkts, n);
+    rte_pktmbuf_free_bulk(pkts, n);
+}
+
+/**
+ * Source fabric lcore (forwarder role): owns ports p where p % nb_fabric == idx
+ */
+static int fabric_source_main(void *arg)
+{
+    struct fabric_ctx *ctx = (struct fabric_ctx *)arg;
+    struct rte_mbuf *pkts[SW_HARNESS_BURST];
+
+    printf("SW HARNESS: Fabric %u running on lcore %u (%u ports, source)\n",
+           ctx->idx, rte_lcore_id(), ctx->nb_ports);
+
+    while (!*ctx->stop_flag) {
+        for (uint16_t i = 0; i < ctx->nb_ports; i++) {
+            uint16_t p = ctx->ports[i];
+            for (uint16_t q = 0; q < SW_HARNESS_QUEUES; q++)
+                fabric_sink_queue(p, q, pkts);
+            for (uint16_t q = 0; q < NUM_RX_CORES; q++)
+                fabric_gen_queue(p, q, pkts);
+        }
+    }
+
+    printf("SW HARNESS: Fabric %u stopped\n", ctx->idx);
+    return 0;
+}
+
+#endif /* !SW_HARNESS_NULL */
+
+// ==========================================
+// STATS
+// ==========================================
+
+static void take_snapshot(struct harness_snapshot *s)
+{
+    s->tsc = rte_get_tsc_cycles();
+
+    for (uint16_t p = 0; p < nb_harness_ports; p++) {
+        struct rte_eth_stats st;
+        if (rte_eth_stats_get(hports[p].port_id, &st) == 0) {
+            s->app_tx_pkts[p] = st.opackets;
+            s->app_tx_bytes[p] = st.obytes;
+            s->app_tx_err[p] = st.oerrors;
+            s->app_rx_pkts[p] = st.ipackets;
+            s->app_rx_bytes[p] = st.ibytes;
+        }
+
+        const struct harness_counters *c = &fabric_stats[p];
+        s->fab[p].from_tx_pkts = __atomic_load_n(&c->from_tx_pkts, __ATOMIC_RELAXED);
+        s->fab[p].from_tx_bytes = __atomic_load_n(&c->from_tx_bytes, __ATOMIC_RELAXED);
+        s->fab[p].to_rx_pkts = __atomic_load_n(&c->to_rx_pkts, __ATOMIC_RELAXED);
+        s->fab[p].to_rx_bytes = __atomic_load_n(&c->to_rx_bytes, __ATOMIC_RELAXED);
+        s->fab[p].drops = __atomic_load_n(&c->drops, __ATOMIC_RELAXED);
+        s->fab[p].ctl_pkts = __atomic_load_n(&c->ctl_pkts, __ATOMIC_RELAXED);
+    }
+}
+
+// Bytes for an ethdev counter delta; ring PMD may not count bytes, fall
+// back to the average frame the fabric saw on the same path
+static double stage_bytes(uint64_t pkts, uint64_t bytes, uint64_t fab_pkts, uint64_t fab_bytes)
+{
+    if (bytes > 0 || pkts == 0)
+        return (double)bytes;
+    double avg = fab_pkts ? (double)fab_bytes / fab_pkts : (double)PACKET_SIZE;
+    return pkts * avg;
+}
+
+int sw_harness_start(const struct ports_config *ports_config, volatile bool *stop_flag)
+{
+    if (!harness_created)
+        return -1;
+
+    nb_harness_ports = ports_config->nb_ports < SW_HARNESS_PORTS ? ports_config->nb_ports
+                                                                 : SW_HARNESS_PORTS;
+    memset(fabric_stats, 0, sizeof(fabric_stats));
+    memset(&totals, 0, sizeof(totals));
+
+#if SW_HARNESS_NULL
+    if (vmc_role_forwarder()) {
+        fprintf(stderr, "SW HARNESS: SW_HARNESS_NULL is TX-only, run with --role verifier\n");
+        return -1;
+    }
+#endif
+
+#if !SW_HARNESS_NULL
+    // Fabric follows the role: loopback for the verifier, source for the forwarder
+    harness_source = vmc_role_forwarder();
+    harness_mode_name = harness_source ? "source" : "loopback";
+    if (harness_source) {
+        if (build_generators() != 0)
+            return -1;
+    } else {
+        build_remap_tables();
+    }
+    lcore_function_t *fabric_main = harness_source ? fabric_source_main : fabric_loopback_main;
+
+    uint16_t cores[SW_HARNESS_FABRIC_CORES];
+    nb_fabric = (uint16_t)get_unused_cores(SW_HARNESS_FABRIC_CORES, cores);
+    if (nb_fabric == 0) {
+        fprintf(stderr, "SW HARNESS: No free lcore for the fabric (extend -l)\n");
+        return -1;
+    }
+
+    for (uint16_t f = 0; f < nb_fabric; f++) {
+        struct fabric_ctx *ctx = &fabric_ctxs[f];
+        ctx->idx = f;
+        ctx->lcore_id = cores[f];
+        ctx->stop_flag = stop_flag;
+        ctx->nb_ports = 0;
+        for (uint16_t p = f; p < nb_harness_ports; p += nb_fabric)
+            ctx->ports[ctx->nb_ports++] = p;
+    }
+
+    take_snapshot(&prev_snap);
+
+    for (uint16_t f = 0; f < nb_fabric; f++) {
+        if (rte_eal_remote_launch(fabric_main, &fabric_ctxs[f], fabric_ctxs[f].lcore_id) != 0) {
+            fprintf(stderr, "SW HARNESS: Failed to launch fabric on lcore %u\n",
+                    fabric_ctxs[f].lcore_id);
+            return -1;
+        }
+    }
+#else
+    (void)stop_flag;
+    take_snapshot(&prev_snap);
+#endif
+
+    printf("SW HARNESS: %s mode, %u ports, %u fabric lcore(s), warmup %d s, duration %d s\n",
+           harness_mode_name, nb_harness_ports, nb_fabric,
+           SW_HARNESS_WARMUP_S, SW_HARNESS_DURATION_S);
+    return 0;
+}
+
+bool sw_harness_tick(uint32_t loop_count)
+{
+    struct harness_snapshot cur;
+    take_snapshot(&cur);
+
+    double dt = (double)(cur.tsc - prev_snap.tsc) / rte_get_tsc_hz();
+    if (dt <= 0.0)
+        return false;
+
+    printf("\n=== SW Harness (%s) t=%us %s===\n", harness_mode_name, loop_count,
+           loop_count <= SW_HARNESS_WARMUP_S ? "[warmup] " : "");
+    printf("Port | APP TX Mpps    Gbps  full/s | APP RX Mpps    Gbps | FAB IN Mpps | FAB OUT Mpps  drop/s\n");
+
+    struct harness_totals sec;
+    memset(&sec, 0, sizeof(sec));
+
+    for (uint16_t p = 0; p < nb_harness_ports; p++) {
+        const struct harness_counters *c = &cur.fab[p];
+        const struct harness_counters *o = &prev_snap.fab[p];
+        uint64_t in_pkts = c->from_tx_pkts - o->from_tx_pkts;
+        uint64_t in_bytes = c->from_tx_bytes - o->from_tx_bytes;
+        uint64_t out_pkts = c->to_rx_pkts - o->to_rx_pkts;
+        uint64_t out_bytes = c->to_rx_bytes - o->to_rx_bytes;
+        uint64_t drops = c->drops - o->drops;
+
+        uint64_t tx_pkts = cur.app_tx_pkts[p] - prev_snap.app_tx_pkts[p];
+        uint64_t tx_err = cur.app_tx_err[p] - prev_snap.app_tx_err[p];
+        uint64_t rx_pkts = cur.app_rx_pkts[p] - prev_snap.app_rx_pkts[p];
+        double tx_bytes = stage_bytes(tx_pkts, cur.app_tx_bytes[p] - prev_snap.app_tx_bytes[p],
+                                      in_pkts, in_bytes);
+        double rx_bytes = stage_bytes(rx_pkts, cur.app_rx_bytes[p] - prev_snap.app_rx_bytes[p],
+                                      out_pkts, out_bytes);
+
+        printf("  %u  | %11.3f %7.2f %7.0f | %11.3f %7.2f | %11.3f | %12.3f %7.0f\n",
+               p, tx_pkts / dt / 1e6, tx_bytes * 8 / dt / 1e9, tx_err / dt,
+               rx_pkts / dt / 1e6, rx_bytes * 8 / dt / 1e9,
+               in_pkts / dt / 1e6, out_pkts / dt / 1e6, drops / dt);
+
+        sec.app_tx_pkts += tx_pkts;
+        sec.app_tx_bytes += tx_bytes;
+        sec.app_rx_pkts += rx_pkts;
+        sec.app_rx_bytes += rx_bytes;
+        sec.fab_in_pkts += in_pkts;
+        sec.fab_out_pkts += out_pkts;
+        sec.drops += drops;
+    }
+
+    printf(" ALL | %11.3f %7.2f         | %11.3f %7.2f | %11.3f | %12.3f %7.0f\n",
+           sec.app_tx_pkts / dt / 1e6, sec.app_tx_bytes * 8 / dt / 1e9,
+           sec.app_rx_pkts / dt / 1e6, sec.app_rx_bytes * 8 / dt / 1e9,
+           sec.fab_in_pkts / dt / 1e6, sec.fab_out_pkts / dt / 1e6, sec.drops / dt);
+
+    if (loop_count > SW_HARNESS_WARMUP_S) {
+        totals.seconds += dt;
+        totals.app_tx_pkts += sec.app_tx_pkts;
+        totals.app_tx_bytes += sec.app_tx_bytes;
+        totals.app_rx_pkts += sec.app_rx_pkts;
+        totals.app_rx_bytes += sec.app_rx_bytes;
+        totals.fab_in_pkts += sec.fab_in_pkts;
+        totals.fab_out_pkts += sec.fab_out_pkts;
+        totals.drops += sec.drops;
+    }
+
+    prev_snap = cur;
+
+    return SW_HARNESS_DURATION_S > 0 &&
+           loop_count >= (uint32_t)(SW_HARNESS_WARMUP_S + SW_HARNESS_DURATION_S);
+}
+
+void sw_harness_print_summary(void)
+{
+    double s = totals.seconds;
+
+    printf("\n=== SW Harness Summary (%s, %.1f s after %d s warmup) ===\n",
+           harness_mode_name, s, SW_HARNESS_WARMUP_S);
+    if (s <= 0.0) {
+        printf("  No samples after warmup\n");
+        return;
+    }
+
+    double tx_mpps = totals.app_tx_pkts / s / 1e6;
+    double rx_mpps = totals.app_rx_pkts / s / 1e6;
+    double tx_gbps = totals.app_tx_bytes * 8 / s / 1e9;
+    double rx_gbps = totals.app_rx_bytes * 8 / s / 1e9;
+    double in_mpps = totals.fab_in_pkts / s / 1e6;
+    double out_mpps = totals.fab_out_pkts / s / 1e6;
+    double drop_pps = totals.drops / s;
+
+    if (harness_source) {
+        printf("  Generator     : %8.3f Mpps\n", out_mpps);
+        printf("  forward RX    : %8.3f Mpps  %7.2f Gbps\n", rx_mpps, rx_gbps);
+        printf("  forward TX    : %8.3f Mpps  %7.2f Gbps\n", tx_mpps, tx_gbps);
+        printf("  Sink          : %8.3f Mpps\n", in_mpps);
+    } else {
+        printf("  tx_worker     : %8.3f Mpps  %7.2f Gbps\n", tx_mpps, tx_gbps);
+        printf("  Fabric        : %8.3f Mpps in, %8.3f Mpps out\n", in_mpps, out_mpps);
+        printf("  rx_worker     : %8.3f Mpps  %7.2f Gbps\n", rx_mpps, rx_gbps);
+    }
+    printf("  Fabric drops  : %.0f pps\n", drop_pps);
+
+    // Single line for sweep scripts (bench/harness_sweep.sh)
+    printf("HARNESS-RESULT mode=%s role=%s pools=%s ports=%u tx_cores=%d rx_cores=%d fabric_cores=%u seconds=%.1f "
+           "tx_mpps=%.3f tx_gbps=%.3f rx_mpps=%.3f rx_gbps=%.3f "
+           "fabric_in_mpps=%.3f fabric_out_mpps=%.3f drop_pps=%.0f mbuf_mb=%.1f\n",
+           harness_mode_name, vmc_role_name(g_vmc_role), MBUF_POOL_LEGACY ? "legacy" : "sized", nb_harness_ports,
+           NUM_TX_CORES, NUM_RX_CORES, nb_fabric, s,
+           tx_mpps, tx_gbps, rx_mpps, rx_gbps, in_mpps, out_mpps, drop_pps,
+           mbuf_pool_total_bytes() / (1024.0 * 1024.0));
+    fflush(stdout);
+}
+
+void sw_harness_cleanup(void)
+{
+    if (!harness_created)
+        return;
+
+#if !SW_HARNESS_NULL
+    // Workers and fabric are stopped: return ring contents to their pools
+    void *objs[SW_HARNESS_BURST];
+    for (uint16_t p = 0; p < SW_HARNESS_PORTS; p++) {
+        for (uint16_t q = 0; q < SW_HARNESS_QUEUES; q++) {
+            struct rte_ring *rings[2] = {hports[p].tx_rings[q], hports[p].rx_rings[q]};
+            for (int r = 0; r < 2; r++) {
+                unsigned n;
+                while (rings[r] &&
+                       (n = rte_ring_dequeue_burst(rings[r], objs, SW_HARNESS_BURST, NULL)) > 0)
+                    rte_pktmbuf_free_bulk((struct rte_mbuf **)objs, n);
+            }
+        }
+    }
+
+    // Source mode only; NULL otherwise
+    for (uint16_t p = 0; p < SW_HARNESS_PORTS; p++) {
+        if (gen_pools[p])
+            rte_mempool_free(gen_pools[p]);
+        gen_pools[p] = NULL;
+    }
+#endif
+
+    harness_created = false;
+}
+
+#endif /* SW_HARNESS_ENABLED */
@@ -0,0 +1,445 @@
+/**
+ * IMIX traffic profile engine
+ *
+ * Load:  spec -> (size, weight) list -> clamp to [IMIX_MIN, IMIX_MAX] frame,
+ *        merge duplicates, sort -> exact counts per cycle (largest remainder,
+ *        sum == seq_len) -> bucket sequence by smooth weighted round-robin
+ *        (each size spread as evenly as its count allows).
+ * TX:    bucket = seq[(tx_seq + phase(vl)) % seq_len], so any seq_len
+ *        consecutive packets of a VL carry exactly the profile mix and the
+ *        exact cycle mean is what tp_pacer charges on average.
+ * Stats: per worker slot per-size counters, summed once per second; TX Gbps
+ *        from the counters is checked against the registered targets.
+ */
+
+#include "config.h"
+
+#if IMIX_ENABLED
+
+#include <rte_cycles.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+#include "traffic_profile.h"
+
+struct traffic_profile g_traffic_profile;
+
+struct tp_counters tp_tx_counters[MAX_PORTS][TP_TX_SLOTS];
+struct tp_counters tp_rx_counters[MAX_PORTS][NUM_RX_CORES];
+
+static uint64_t tp_target_bps[MAX_PORTS];          // bytes/sec, all TX workers of the port
+
+// Reset baseline (counters are never written by the main lcore)
+static uint64_t tp_tx_base[TP_NB_BUCKETS];
+static uint64_t tp_rx_base[TP_NB_BUCKETS];
+
+// Previous per-second sample for the rate check
+static uint64_t tp_prev_port_bytes[MAX_PORTS];
+static uint64_t tp_prev_tsc;
+
+struct tp_entry
+{
+    uint32_t size;
+    double weight;
+};
+
+// ==========================================
+// BUILT-IN PROFILES
+// ==========================================
+
+static const struct tp_entry tp_simple_imix[] = {
+    {64, 7}, {594, 4}, {1518, 1},
+};
+
+// Bimodal internet mix: small control/ACK frames and full-MTU bulk,
+// thin middle (6-point approximation)
+static const struct tp_entry tp_internet_mix[] = {
+    {64, 40}, {128, 10}, {256, 5}, {576, 10}, {1024, 5}, {1518, 30},
+};
+
+// ==========================================
+// PARSING
+// ==========================================
+
+// "64:7,594:4,1518:1"
+static int parse_inline(const char *spec, struct tp_entry *e, int max)
+{
+    int n = 0;
+    const char *p = spec;
+
+    while (*p) {
+        char *end;
+        unsigned long size = strtoul(p, &end, 10);
+        if (end == p || *end != ':')
+            return -1;
+        p = end + 1;
+        double w = strtod(p, &end);
+        if (end == p || w < 0)
+            return -1;
+        if (n >= max)
+            return -1;
+        e[n].size = (uint32_t)size;
+        e[n].weight = w;
+        n++;
+        p = end;
+        if (*p == ',')
+            p++;
+        else if (*p)
+            return -1;
+    }
+    return n;
+}
+
+// CDF file: "size cumulative" per line (fraction or percent), '#' comments
+static int parse_cdf_file(const char *path, struct tp_entry *e, int max)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        printf("Error: IMIX profile: cannot open %s\n", path);
+        return -1;
+    }
+
+    char line[256];
+    int n = 0, lineno = 0;
+    double prev_cum = 0.0;
+
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        char *p = line;
+        while (isspace((unsigned char)*p))
+            p++;
+        if (*p == '\0' || *p == '#')
+            continue;
+
+        unsigned long size;
+        double cum;
+        if (sscanf(p, "%lu %lf", &size, &cum) != 2 || cum < prev_cum || n >= max) {
+            printf("Error: IMIX profile: %s:%d: expected \"size cumulative\" "
+                   "(non-decreasing, max %d sizes)\n", path, lineno, max);
+            fclose(f);
+            return -1;
+        }
+        e[n].size = (uint32_t)size;
+        e[n].weight = cum - prev_cum;
+        prev_cum = cum;
+        n++;
+    }
+    fclose(f);
+
+    if (prev_cum <= 0.0) {
+        printf("Error: IMIX profile: %s has no probability mass\n", path);
+        return -1;
+    }
+    return n;
+}
+
+// ==========================================
+// BUILD
+// ==========================================
+
+static int cmp_entry(const void *a, const void *b)
+{
+    const struct tp_entry *x = a, *y = b;
+    return (x->size > y->size) - (x->size < y->size);
+}
+
+// Clamp, merge, sort; drop zero weights. Returns remaining count.
+static int normalize_entries(struct tp_entry *e, int n)
+{
+    int clamped = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (e[i].size < IMIX_MIN_PACKET_SIZE) {
+            e[i].size = IMIX_MIN_PACKET_SIZE;
+            clamped++;
+        } else if (e[i].size > IMIX_MAX_PACKET_SIZE) {
+            e[i].size = IMIX_MAX_PACKET_SIZE;
+            clamped++;
+        }
+    }
+    if (clamped > 0)
+        printf("IMIX profile: %d size(s) clamped to [%u..%u] bytes\n",
+               clamped, IMIX_MIN_PACKET_SIZE, IMIX_MAX_PACKET_SIZE);
+
+    qsort(e, n, sizeof(*e), cmp_entry);
+
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        if (e[i].weight <= 0.0)
+            continue;
+        if (m > 0 && e[m - 1].size == e[i].size)
+            e[m - 1].weight += e[i].weight;
+        else
+            e[m++] = e[i];
+    }
+    return m;
+}
+
+// Largest remainder: counts sum to seq_len exactly
+static void assign_counts(struct traffic_profile *tp, const struct tp_entry *e, int n)
+{
+    double total = 0.0;
+    double rem[TP_MAX_SIZES];
+    uint32_t assigned = 0;
+
+    for (int i = 0; i < n; i++)
+        total += e[i].weight;
+
+    for (int i = 0; i < n; i++) {
+        double exact = e[i].weight / total * tp->seq_len;
+        tp->counts[i] = (uint32_t)exact;
+        rem[i] = exact - tp->counts[i];
+        assigned += tp->counts[i];
+    }
+
+    while (assigned < tp->seq_len) {
+        int best = 0;
+        for (int i = 1; i < n; i++) {
+            if (rem[i] > rem[best])
+                best = i;
+        }
+        tp->counts[best]++;
+        rem[best] = -1.0;
+        assigned++;
+    }
+}
+
+// Smooth weighted round-robin: every position takes the bucket furthest
+// behind its share, so each size recurs at ~seq_len/count intervals
+static void build_sequence(struct traffic_profile *tp)
+{
+    int64_t current[TP_MAX_SIZES] = {0};
+
+    for (uint32_t k = 0; k < tp->seq_len; k++) {
+        int best = -1;
+        for (int i = 0; i < tp->nb_sizes; i++) {
+            if (tp->counts[i] == 0)
+                continue;
+            current[i] += tp->counts[i];
+            if (best < 0 || current[i] > current[best])
+                best = i;
+        }
+        current[best] -= tp->seq_len;
+        tp->seq[k] = (uint8_t)best;
+    }
+}
+
+static void finish_profile(struct traffic_profile *tp)
+{
+    tp->cycle_bytes = 0;
+    for (int i = 0; i < tp->nb_sizes; i++)
+        tp->cycle_bytes += (uint64_t)tp->counts[i] * tp->sizes[i];
+
+    memset(tp->bucket_of_len, TP_BUCKET_OTHER, sizeof(tp->bucket_of_len));
+    for (int i = 0; i < tp->nb_sizes; i++)
+        tp->bucket_of_len[tp->sizes[i]] = (uint8_t)i;
+}
+
+// Legacy: keep IMIX_PATTERN_INIT order as the cycle
+static void load_legacy(struct traffic_profile *tp)
+{
+    static const uint16_t pattern[IMIX_PATTERN_SIZE] = IMIX_PATTERN_INIT;
+
+    memset(tp, 0, sizeof(*tp));
+    snprintf(tp->name, sizeof(tp->name), "legacy");
+    tp->seq_len = IMIX_PATTERN_SIZE;
+
+    for (int k = 0; k < IMIX_PATTERN_SIZE; k++) {
+        int b;
+        for (b = 0; b < tp->nb_sizes; b++) {
+            if (tp->sizes[b] == pattern[k])
+                break;
+        }
+        if (b == tp->nb_sizes)
+            tp->sizes[tp->nb_sizes++] = pattern[k];
+        tp->counts[b]++;
+        tp->seq[k] = (uint8_t)b;
+    }
+    finish_profile(tp);
+}
+
+int traffic_profile_load(const char *spec)
+{
+    struct traffic_profile *tp = &g_traffic_profile;
+    struct tp_entry entries[TP_MAX_SIZES * 4];
+    const int max_entries = (int)(sizeof(entries) / sizeof(entries[0]));
+    int n;
+
+    if (spec == NULL) {
+        static const char *const defaults[] = {"legacy", "simple", "internet", IMIX_PROFILE_FILE};
+        spec = (IMIX_PROFILE >= 0 && IMIX_PROFILE <= 3) ? defaults[IMIX_PROFILE] : "legacy";
+    }
+
+    if (strcasecmp(spec, "legacy") == 0) {
+        load_legacy(tp);
+        traffic_profile_print();
+        return 0;
+    }
+
+    if (strcasecmp(spec, "simple") == 0) {
+        n = (int)(sizeof(tp_simple_imix) / sizeof(tp_simple_imix[0]));
+        memcpy(entries, tp_simple_imix, sizeof(tp_simple_imix));
+    } else if (strcasecmp(spec, "internet") == 0) {
+        n = (int)(sizeof(tp_internet_mix) / sizeof(tp_internet_mix[0]));
+        memcpy(entries, tp_internet_mix, sizeof(tp_internet_mix));
+    } else if (strchr(spec, ':') != NULL && strchr(spec, '/') == NULL) {
+        n = parse_inline(spec, entries, max_entries);
+        if (n < 0) {
+            printf("Error: IMIX profile: bad inline spec '%s' (size:weight,...)\n", spec);
+            return -1;
+        }
+    } else {
+        n = parse_cdf_file(spec, entries, max_entries);
+        if (n < 0)
+            return -1;
+    }
+
+    n = normalize_entries(entries, n);
+    if (n == 0 || n > TP_MAX_SIZES) {
+        printf("Error: IMIX profile '%s': %d distinct sizes (1..%d allowed)\n",
+               spec, n, TP_MAX_SIZES);
+        return -1;
+    }
+
+    memset(tp, 0, sizeof(*tp));
+    snprintf(tp->name, sizeof(tp->name), "%s", spec);
+    tp->nb_sizes = (uint16_t)n;
+    tp->seq_len = IMIX_PROFILE_SEQ_LEN;
+    for (int i = 0; i < n; i++)
+        tp->sizes[i] = (uint16_t)entries[i].size;
+
+    assign_counts(tp, entries, n);
+    build_sequence(tp);
+    finish_profile(tp);
+
+    for (int i = 0; i < n; i++) {
+        if (tp->counts[i] == 0)
+            printf("IMIX profile: %u bytes rounds to 0/%u, not sent\n",
+                   tp->sizes[i], tp->seq_len);
+    }
+
+    traffic_profile_print();
+    return 0;
+}
+
+void traffic_profile_print(void)
+{
+    const struct traffic_profile *tp = &g_traffic_profile;
+
+    printf("\n=== IMIX Profile '%s' ===\n", tp->name);
+    printf("  Size (B)   Share    Count/%u\n", tp->seq_len);
+    for (int i = 0; i < tp->nb_sizes; i++)
+        printf("  %8u  %6.2f%%   %u\n", tp->sizes[i],
+               100.0 * tp->counts[i] / tp->seq_len, tp->counts[i]);
+    printf("  Mean: %.2f bytes/packet (exact over %u packets per VL)\n",
+           (double)tp->cycle_bytes / tp->seq_len, tp->seq_len);
+    printf("  Pacing: per-packet byte cost, rate tolerance +/-%.1f%%\n",
+           IMIX_RATE_TOLERANCE_PCT);
+}
+
+void traffic_profile_add_target(uint16_t port_id, uint64_t bytes_per_sec)
+{
+    if (port_id < MAX_PORTS)
+        __atomic_fetch_add(&tp_target_bps[port_id], bytes_per_sec, __ATOMIC_RELAXED);
+}
+
+// ==========================================
+// STATS
+// ==========================================
+
+static uint64_t port_tx_bytes(uint16_t port_id)
+{
+    const struct traffic_profile *tp = &g_traffic_profile;
+    uint64_t bytes = 0;
+
+    for (int s = 0; s < TP_TX_SLOTS; s++) {
+        for (int b = 0; b < tp->nb_sizes; b++)
+            bytes += __atomic_load_n(&tp_tx_counters[port_id][s].pkts[b], __ATOMIC_RELAXED) *
+                     tp->sizes[b];
+    }
+    return bytes;
+}
+
+static void sum_buckets(uint64_t tx[TP_NB_BUCKETS], uint64_t rx[TP_NB_BUCKETS])
+{
+    memset(tx, 0, TP_NB_BUCKETS * sizeof(uint64_t));
+    memset(rx, 0, TP_NB_BUCKETS * sizeof(uint64_t));
+
+    for (int p = 0; p < MAX_PORTS; p++) {
+        for (int b = 0; b < TP_NB_BUCKETS; b++) {
+            for (int s = 0; s < TP_TX_SLOTS; s++)
+                tx[b] += __atomic_load_n(&tp_tx_counters[p][s].pkts[b], __ATOMIC_RELAXED);
+            for (int q = 0; q < NUM_RX_CORES; q++)
+                rx[b] += __atomic_load_n(&tp_rx_counters[p][q].pkts[b], __ATOMIC_RELAXED);
+        }
+    }
+}
+
+void traffic_profile_reset_stats(void)
+{
+    sum_buckets(tp_tx_base, tp_rx_base);
+    for (uint16_t p = 0; p < MAX_PORTS; p++)
+        tp_prev_port_bytes[p] = port_tx_bytes(p);
+    tp_prev_tsc = rte_get_tsc_cycles();
+}
+
+void traffic_profile_print_stats(const struct ports_config *ports_config)
+{
+    const struct traffic_profile *tp = &g_traffic_profile;
+    uint64_t tx[TP_NB_BUCKETS], rx[TP_NB_BUCKETS];
+    uint64_t tx_total = 0, rx_total = 0;
+
+    sum_buckets(tx, rx);
+    for (int b = 0; b < TP_NB_BUCKETS; b++) {
+        tx[b] -= tp_tx_base[b];
+        rx[b] -= tp_rx_base[b];
+        tx_total += tx[b];
+        rx_total += rx[b];
+    }
+
+    printf("\n  IMIX '%s' (mean %.1f B):\n", tp->name, (double)tp->cycle_bytes / tp->seq_len);
+    printf("  ┌──────────┬──────────┬─────────────────────┬──────────┬─────────────────────┬──────────┐\n");
+    printf("  │ Size (B) │ Profile  │      TX Packets     │   TX %%   │      RX Packets     │   RX %%   │\n");
+    printf("  ├──────────┼──────────┼─────────────────────┼──────────┼─────────────────────┼──────────┤\n");
+    for (int b = 0; b < tp->nb_sizes; b++)
+        printf("  │ %8u │ %7.2f%% │ %19lu │ %7.2f%% │ %19lu │ %7.2f%% │\n",
+               tp->sizes[b], 100.0 * tp->counts[b] / tp->seq_len,
+               tx[b], tx_total ? 100.0 * tx[b] / tx_total : 0.0,
+               rx[b], rx_total ? 100.0 * rx[b] / rx_total : 0.0);
+    if (rx[TP_BUCKET_OTHER] > 0)
+        printf("  │    other │        - │                   - │        - │ %19lu │ %7.2f%% │\n",
+               rx[TP_BUCKET_OTHER], 100.0 * rx[TP_BUCKET_OTHER] / rx_total);
+    printf("  └──────────┴──────────┴─────────────────────┴──────────┴─────────────────────┴──────────┘\n");
+
+    // Achieved vs target (frame bytes, same basis as the pacer)
+    uint64_t now = rte_get_tsc_cycles();
+    double dt = tp_prev_tsc ? (double)(now - tp_prev_tsc) / rte_get_tsc_hz() : 0.0;
+    tp_prev_tsc = now;
+
+    for (uint16_t i = 0; i < ports_config->nb_ports; i++) {
+        uint16_t port_id = ports_config->ports[i].port_id;
+        if (port_id >= MAX_PORTS)
+            continue;
+
+        uint64_t bytes = port_tx_bytes(port_id);
+        uint64_t delta = bytes - tp_prev_port_bytes[port_id];
+        tp_prev_port_bytes[port_id] = bytes;
+
+        uint64_t target = __atomic_load_n(&tp_target_bps[port_id], __ATOMIC_RELAXED);
+        if (target == 0 || dt <= 0.0)
+            continue;
+
+        double gbps = delta * 8.0 / dt / 1e9;
+        double target_gbps = target * 8.0 / 1e9;
+        double dev = 100.0 * (gbps - target_gbps) / target_gbps;
+        printf("  Port %2u IMIX TX: %7.3f / %7.3f Gbps (%+6.2f%%) %s\n",
+               port_id, gbps, target_gbps, dev,
+               (dev >= -IMIX_RATE_TOLERANCE_PCT && dev <= IMIX_RATE_TOLERANCE_PCT)
+                   ? "OK" : "OUT OF TOLERANCE");
+    }
+}
+
+#endif /* IMIX_ENABLED */
@@ -2,45 +2,27 @@
 #include "raw_socket_port.h"  // For external packet PRBS verification
 #include "dpdk_external_tx.h" // For integrated external TX
 #include "embedded_latency/embedded_latency.h" // For ate_mode_enabled()
+#include "payload_transform.h"  // splitmix64 / CRC32C / PRBS bit errors
+#include "vl_range.h"
+#include "rx_pipeline.h"        // Staged RX verification (prefetch, per-VL tracker pass)
+#include "rx_flow_steer.h"      // rte_flow VL-ID -> RX queue steering
+#include "traffic_profile.h"    // IMIX profile sequence, pacer, per-size counters
+#include "capture_ring.h"       // Trigger-on-error pcap capture
+#include "pcap_replay.h"        // Pcap replay TX worker
+#include "adaptive_poll.h"      // Empty-poll streak -> pause / UMWAIT / RX interrupt
+#include "startup_trace.h"      // Time to first packet
+#include "capacity.h"           // Per-port state on the port's socket
+#include "vmc_role.h"           // Verifier / forwarder tables and workers
+#include "fwd_remap.h"          // Forward VL-ID / VLAN remap table
+#include "tx_vl_seq.h"          // TX VL-ID owner table, queue-private sequences
 #include <rte_lcore.h>
 #include <rte_launch.h>
 #include <rte_cycles.h>
 #include <rte_ip.h>
 #include <rte_udp.h>
+#include <rte_malloc.h>
 #include <stdlib.h>
 #include <string.h>
-#include <nmmintrin.h>  // SSE4.2 CRC32C
-
-// ==========================================
-// SPLITMIX64 VERIFICATION (matches VMC_2 transform)
-// VMC_2 XORs payload[8..71] with splitmix64, writes CRC32C at [72..75].
-// VMC_1 verifies CRC32C, then checks PRBS on remaining payload[76+].
-// ==========================================
-#define SPLITMIX_XOR_BYTES   64
-#define SPLITMIX_CRC_BYTES   4
-#define SPLITMIX_TOTAL_OVERHEAD (SPLITMIX_XOR_BYTES + SPLITMIX_CRC_BYTES)  // 68
-#define SPLITMIX_MIN_PAYLOAD (SEQ_BYTES + SPLITMIX_TOTAL_OVERHEAD)         // 76
-
-static inline uint64_t splitmix64(uint64_t x)
-{
-    x += 0x9E3779B97F4A7C15ULL;
-    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
-    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
-    return x ^ (x >> 31);
-}
-
-static inline uint32_t hw_crc32c(const void *data, uint32_t len)
-{
-    uint64_t crc = 0xFFFFFFFF;
-    const uint64_t *p64 = (const uint64_t *)data;
-    uint32_t n64 = len / 8;
-    for (uint32_t i = 0; i < n64; i++)
-        crc = _mm_crc32_u64(crc, p64[i]);
-    const uint8_t *p8 = (const uint8_t *)(p64 + n64);
-    for (uint32_t i = 0; i < (len & 7); i++)
-        crc = _mm_crc32_u8((uint32_t)crc, p8[i]);
-    return (uint32_t)(crc ^ 0xFFFFFFFF);
-}
 
 // ==========================================
 // GLOBAL VARIABLES
@@ -52,9 +34,16 @@ struct port_vlan_config port_vlans[MAX_PORTS_CONFIG] = PORT_VLAN_CONFIG_INIT;
 // ATE mode VLAN configuration (loaded at runtime if ATE mode selected)
 static const struct port_vlan_config ate_port_vlans[MAX_PORTS_CONFIG] = ATE_PORT_VLAN_CONFIG_INIT;
 
+// Forwarder role (VMC_2): incoming VL-ID ranges + remap / R2 cross-port targets
+static const struct port_vlan_config fwd_port_vlans[MAX_PORTS_CONFIG] = FWD_PORT_VLAN_CONFIG_INIT;
+static const struct port_vlan_config fwd_ate_port_vlans[MAX_PORTS_CONFIG] = FWD_ATE_PORT_VLAN_CONFIG_INIT;
+
 void port_vlans_load_config(bool ate_mode)
 {
-    if (ate_mode) {
+    if (vmc_role_forwarder()) {
+        memcpy(port_vlans, ate_mode ? fwd_ate_port_vlans : fwd_port_vlans, sizeof(port_vlans));
+        printf("[CONFIG] Forwarder %s VLAN configuration loaded\n", ate_mode ? "ATE mode" : "normal mode");
+    } else if (ate_mode) {
         memcpy(port_vlans, ate_port_vlans, sizeof(port_vlans));
         printf("[ATE] ATE mode VLAN configuration loaded\n");
     } else {
@@ -63,20 +52,17 @@ void port_vlans_load_config(bool ate_mode)
     }
 }
 
-// Global RX statistics per port
-struct rx_stats rx_stats_per_port[MAX_PORTS];
+// Global RX statistics per port (moved into a memzone by stats_shm_init)
+static struct rx_stats rx_stats_local[MAX_PORTS];
+struct rx_stats *rx_stats_per_port = rx_stats_local;
 
 // Global VL-ID sequence trackers per port (for RX validation)
-struct port_vl_tracker port_vl_trackers[MAX_PORTS];
+// Allocated on the port's socket for the configured ports only (init_rx_stats)
+struct port_vl_tracker *port_vl_trackers[MAX_PORTS];
 
-// Per-port, per-VL-ID TX sequence counter
-struct tx_vl_sequence
-{
-    uint64_t sequence[MAX_VL_ID + 1];    // Sequence counter for each VL-ID
-    rte_spinlock_t locks[MAX_VL_ID + 1]; // Lock per VL-ID
-};
-
-static struct tx_vl_sequence tx_vl_sequences[MAX_PORTS];
+// TX VL-ID owner tables (tx_vl_seq.h)
+// Allocated on the port's socket for the configured ports only (init_tx_vl_sequences)
+static struct tx_vl_sequence *tx_vl_sequences[MAX_PORTS];
 
 // ==========================================
 // VL ID RANGE DEFINITIONS (Port-Aware)
@@ -89,212 +75,137 @@ static struct tx_vl_sequence tx_vl_sequences[MAX_PORTS];
 // HELPER FUNCTIONS - VL-ID BASED SEQUENCE
 // ==========================================
 
-/**
- * Initialize TX VL-ID sequences
- */
-static void init_tx_vl_sequences(void)
+static inline struct tx_vl_span get_tx_vl_span(uint16_t port_id, uint16_t queue_id)
 {
-    for (int port = 0; port < MAX_PORTS; port++)
+    struct tx_vl_span span = {
+        .r1_start = get_tx_vl_id_range_start(port_id, queue_id),
+        .r1_size = get_tx_vl_range1_size(port_id, queue_id),
+    };
+    if (port_id < MAX_PORTS_CONFIG && port_vlans[port_id].tx_vl_ids2[queue_id] > 0)
     {
-        for (int vl = 0; vl <= MAX_VL_ID; vl++)
-        {
-            tx_vl_sequences[port].sequence[vl] = 0;
-            rte_spinlock_init(&tx_vl_sequences[port].locks[vl]);
-        }
+        span.r2_start = port_vlans[port_id].tx_vl_ids2[queue_id];
+        span.r2_size = port_vlans[port_id].tx_vl_range2_size[queue_id];
     }
-    printf("TX VL-ID sequence counters initialized\n");
-}
-
-/**
- * Get next sequence for a VL-ID (thread-safe)
- */
-static inline uint64_t get_next_tx_sequence(uint16_t port_id, uint16_t vl_id)
-{
-    if (vl_id > MAX_VL_ID || port_id >= MAX_PORTS)
-        return 0;
-
-    rte_spinlock_lock(&tx_vl_sequences[port_id].locks[vl_id]);
-    uint64_t seq = tx_vl_sequences[port_id].sequence[vl_id]++;
-    rte_spinlock_unlock(&tx_vl_sequences[port_id].locks[vl_id]);
-
-    return seq;
+    return span;
 }
 
 /**
- * Peek current sequence for a VL-ID without incrementing (thread-safe)
- * Use with commit_tx_sequence() for send-then-commit pattern.
+ * Initialize TX VL-ID sequences and resolve VL-ID ownership
+ * Returns -1 if a VL-ID is sent by two TX queues (or twice by one) and
+ * TX_VL_SHARED_SEQ is 0.
  */
-static inline uint64_t peek_tx_sequence(uint16_t port_id, uint16_t vl_id)
+static int init_tx_vl_sequences(void)
 {
-    if (vl_id > MAX_VL_ID || port_id >= MAX_PORTS)
-        return 0;
+    uint32_t owned = 0, shared = 0;
 
-    return tx_vl_sequences[port_id].sequence[vl_id];
-}
+    for (uint16_t i = 0; i < ports_config.nb_ports; i++)
+    {
+        uint16_t port = ports_config.ports[i].port_id;
+        if (port >= MAX_PORTS)
+            continue;
 
-/**
- * Commit (increment) sequence for a VL-ID after successful send.
- * Only call after confirming the packet was actually transmitted.
- */
-static inline void commit_tx_sequence(uint16_t port_id, uint16_t vl_id)
-{
-    if (vl_id > MAX_VL_ID || port_id >= MAX_PORTS)
-        return;
+        if (tx_vl_sequences[port] == NULL)
+            tx_vl_sequences[port] = capacity_port_zmalloc("tx_vl_sequence",
+                                                          sizeof(struct tx_vl_sequence), port);
+        if (tx_vl_sequences[port] == NULL)
+            return -1;
 
-    tx_vl_sequences[port_id].sequence[vl_id]++;
-}
+        struct tx_vl_sequence *txs = tx_vl_sequences[port];
+        memset(txs->owner, TX_VL_OWNER_NONE, sizeof(txs->owner));
+        memset(txs->shared_seq, 0, sizeof(txs->shared_seq));
 
-/**
- * Extract VL-ID from packet DST MAC
- */
-static inline uint16_t extract_vl_id_from_packet(uint8_t *pkt_data, uint16_t l2_len)
-{
-    (void)l2_len; // Unused
-    // DST MAC is at offset 0 in Ethernet header
-    // VL-ID is in last 2 bytes of DST MAC
-    uint8_t *dst_mac = pkt_data;
-    uint16_t vl_id = ((uint16_t)dst_mac[4] << 8) | dst_mac[5];
-    return vl_id;
-}
+        // Queues past tx_vlan_count send nothing (tx_worker), their span
+        // would fall back to queue 0's range and look shared
+        uint16_t tx_queues = RTE_MIN((uint16_t)NUM_TX_CORES, port_vlans[port].tx_vlan_count);
+        for (uint16_t q = 0; q < tx_queues; q++)
+        {
+            struct tx_vl_span span = get_tx_vl_span(port, q);
+            for (uint16_t off = 0; off < span.r1_size + span.r2_size; off++)
+            {
+                uint16_t vl = tx_vl_span_at(&span, off);
+                if (vl > MAX_VL_ID)
+                    continue;
 
-/**
- * Get TX VL ID range start for a port and queue (PORT-AWARE)
- * Config'deki tx_vl_ids değerini döndürür
- */
-static inline uint16_t get_tx_vl_id_range_start(uint16_t port_id, uint16_t queue_index)
-{
-    if (port_id >= MAX_PORTS_CONFIG)
-    {
-        printf("Warning: Invalid port_id %u for TX VL ID range start\n", port_id);
-        return 3; // Fallback
+                if (txs->owner[vl] == TX_VL_OWNER_NONE)
+                {
+                    txs->owner[vl] = (uint8_t)q;
+                    owned++;
+                    continue;
+                }
+                if (txs->owner[vl] != TX_VL_OWNER_SHARED)
+                {
+                    printf("%s: Port %u VL-ID %u sent by TX queue %u and queue %u\n",
+                           TX_VL_SHARED_SEQ ? "Warning" : "Error", port, vl, txs->owner[vl], q);
+                    txs->owner[vl] = TX_VL_OWNER_SHARED;
+                    owned--;
+                    shared++;
+                }
+            }
+        }
     }
-    if (queue_index >= port_vlans[port_id].tx_vlan_count)
+
+    if (shared > 0 && !TX_VL_SHARED_SEQ)
     {
-        printf("Warning: Invalid queue_index %u for port %u TX VL ID range start\n",
-               queue_index, port_id);
-        return port_vlans[port_id].tx_vl_ids[0]; // Fallback to first
+        printf("Error: %u VL-IDs have more than one TX queue owner, fix tx_vl_ids / tx_vl_ids2 "
+               "(or build with TX_VL_SHARED_SEQ=1)\n", shared);
+        return -1;
     }
-    return port_vlans[port_id].tx_vl_ids[queue_index];
-}
-
-/**
- * Get TX VL ID range 1 size for a port and queue
- * Returns tx_vl_range1_size if set, otherwise VL_RANGE_SIZE_PER_QUEUE
- */
-static inline uint16_t get_tx_vl_range1_size(uint16_t port_id, uint16_t queue_index)
-{
-    if (port_id < MAX_PORTS_CONFIG && queue_index < port_vlans[port_id].tx_vlan_count
-        && port_vlans[port_id].tx_vl_range1_size[queue_index] > 0)
-        return port_vlans[port_id].tx_vl_range1_size[queue_index];
-    return VL_RANGE_SIZE_PER_QUEUE;
+    printf("TX VL-ID sequence counters initialized: %u VL-IDs owned by one TX queue (lock-free), "
+           "%u shared (atomic)\n", owned, shared);
+    return 0;
 }
 
 /**
- * Get total TX VL-ID count for a port and queue (range1 + range2)
+ * Set up a TX worker's private sequences (on the port's socket)
  */
-static inline uint16_t get_tx_vl_total_count(uint16_t port_id, uint16_t queue_index)
+static int tx_vl_seq_local_init(struct tx_vl_seq_local *local, uint16_t port_id,
+                                const struct tx_vl_span *span)
 {
-    uint16_t total = get_tx_vl_range1_size(port_id, queue_index);
-    if (port_id < MAX_PORTS_CONFIG && queue_index < port_vlans[port_id].tx_vlan_count
-        && port_vlans[port_id].tx_vl_ids2[queue_index] > 0)
-        total += port_vlans[port_id].tx_vl_range2_size[queue_index];
-    return total;
-}
+    uint16_t size = span->r1_size + span->r2_size;
+    struct tx_vl_sequence *txs = tx_vl_sequences[port_id];
 
-/**
- * Get TX VL ID range end for a port and queue (exclusive, PORT-AWARE)
- * For backward compat: returns range1 end only
- */
-static inline uint16_t get_tx_vl_id_range_end(uint16_t port_id, uint16_t queue_index)
-{
-    return get_tx_vl_id_range_start(port_id, queue_index) + get_tx_vl_range1_size(port_id, queue_index);
-}
+    memset(local, 0, sizeof(*local));
+    local->seq = capacity_port_zmalloc("tx_vl_seq_local", (size_t)size * sizeof(uint64_t), port_id);
+    if (local->seq == NULL)
+        return -1;
+    local->shared_seq = txs->shared_seq;
 
-/**
- * Get RX VL ID range start for a port and queue (PORT-AWARE)
- * Config'deki rx_vl_ids değerini döndürür
- */
-static inline uint16_t get_rx_vl_id_range_start(uint16_t port_id, uint16_t queue_index)
-{
-    if (port_id >= MAX_PORTS_CONFIG)
-    {
-        printf("Warning: Invalid port_id %u for RX VL ID range start\n", port_id);
-        return 3; // Fallback
-    }
-    if (queue_index >= port_vlans[port_id].rx_vlan_count)
+    for (uint16_t off = 0; off < size; off++)
     {
-        printf("Warning: Invalid queue_index %u for port %u RX VL ID range start\n",
-               queue_index, port_id);
-        return port_vlans[port_id].rx_vl_ids[0]; // Fallback to first
+        uint16_t vl = tx_vl_span_at(span, off);
+        if (vl > MAX_VL_ID || txs->owner[vl] != TX_VL_OWNER_SHARED)
+            continue;
+        if (local->shared == NULL)
+        {
+            local->shared = capacity_port_zmalloc("tx_vl_seq_shared", size, port_id);
+            if (local->shared == NULL)
+            {
+                rte_free(local->seq);
+                return -1;
+            }
+        }
+        local->shared[off] = 1;
     }
-    return port_vlans[port_id].rx_vl_ids[queue_index];
-}
-
-/**
- * Get RX VL ID range 1 size for a port and queue
- */
-static inline uint16_t get_rx_vl_range1_size(uint16_t port_id, uint16_t queue_index)
-{
-    if (port_id < MAX_PORTS_CONFIG && queue_index < port_vlans[port_id].rx_vlan_count
-        && port_vlans[port_id].rx_vl_range1_size[queue_index] > 0)
-        return port_vlans[port_id].rx_vl_range1_size[queue_index];
-    return VL_RANGE_SIZE_PER_QUEUE;
-}
-
-/**
- * Get RX VL ID range end for a port and queue (exclusive, PORT-AWARE)
- */
-static inline uint16_t get_rx_vl_id_range_end(uint16_t port_id, uint16_t queue_index)
-{
-    return get_rx_vl_id_range_start(port_id, queue_index) + get_rx_vl_range1_size(port_id, queue_index);
-}
-
-/**
- * Get VL ID range size for a port/queue (backward compat)
- */
-static inline uint16_t get_vl_id_range_size(void)
-{
-    return VL_RANGE_SIZE_PER_QUEUE;
+    return 0;
 }
 
-/**
- * Validate if a VL ID is within the valid TX range for a port and queue (dual-range)
- */
-static inline bool is_valid_tx_vl_id_for_queue(uint16_t vl_id, uint16_t port_id, uint16_t queue_index)
+static void tx_vl_seq_local_free(struct tx_vl_seq_local *local)
 {
-    uint16_t start = get_tx_vl_id_range_start(port_id, queue_index);
-    uint16_t end = start + get_tx_vl_range1_size(port_id, queue_index);
-    if (vl_id >= start && vl_id < end)
-        return true;
-    // Check range 2
-    if (port_id < MAX_PORTS_CONFIG && queue_index < port_vlans[port_id].tx_vlan_count
-        && port_vlans[port_id].tx_vl_ids2[queue_index] > 0) {
-        uint16_t s2 = port_vlans[port_id].tx_vl_ids2[queue_index];
-        uint16_t e2 = s2 + port_vlans[port_id].tx_vl_range2_size[queue_index];
-        if (vl_id >= s2 && vl_id < e2)
-            return true;
-    }
-    return false;
+    rte_free(local->seq);
+    rte_free(local->shared);
 }
 
 /**
- * Validate if a VL ID is within the valid RX range for a port and queue (dual-range)
+ * Extract VL-ID from packet DST MAC
  */
-static inline bool is_valid_rx_vl_id_for_queue(uint16_t vl_id, uint16_t port_id, uint16_t queue_index)
+static inline uint16_t extract_vl_id_from_packet(uint8_t *pkt_data, uint16_t l2_len)
 {
-    uint16_t start = get_rx_vl_id_range_start(port_id, queue_index);
-    uint16_t end = start + get_rx_vl_range1_size(port_id, queue_index);
-    if (vl_id >= start && vl_id < end)
-        return true;
-    // Check range 2
-    if (port_id < MAX_PORTS_CONFIG && queue_index < port_vlans[port_id].rx_vlan_count
-        && port_vlans[port_id].rx_vl_ids2[queue_index] > 0) {
-        uint16_t s2 = port_vlans[port_id].rx_vl_ids2[queue_index];
-        uint16_t e2 = s2 + port_vlans[port_id].rx_vl_range2_size[queue_index];
-        if (vl_id >= s2 && vl_id < e2)
-            return true;
-    }
-    return false;
+    (void)l2_len; // Unused
+    // DST MAC is at offset 0 in Ethernet header
+    // VL-ID is in last 2 bytes of DST MAC
+    uint8_t *dst_mac = pkt_data;
+    uint16_t vl_id = ((uint16_t)dst_mac[4] << 8) | dst_mac[5];
+    return vl_id;
 }
 
 // ==========================================
@@ -320,9 +231,9 @@ static void init_rate_limiter(struct rate_limiter *limiter,
     limiter->max_tokens = limiter->tokens_per_sec / 10000;
 
     // Minimum bucket size to allow at least one burst
-    // IMIX: Ortalama paket boyutu kullan
+    // IMIX: En büyük profil boyutu (ortalama profile göre değişir)
 #if IMIX_ENABLED
-    uint64_t min_bucket = BURST_SIZE * IMIX_AVG_PACKET_SIZE * 2;
+    uint64_t min_bucket = BURST_SIZE * IMIX_MAX_PACKET_SIZE * 2;
 #else
     uint64_t min_bucket = BURST_SIZE * PACKET_SIZE * 2;
 #endif
@@ -466,12 +377,26 @@ void init_rx_stats(void)
         rte_atomic64_init(&rx_stats_per_port[i].raw_socket_rx_pkts);
         rte_atomic64_init(&rx_stats_per_port[i].raw_socket_rx_bytes);
 
-        // Initialize VL-ID sequence trackers (lock-free, watermark-based)
+    }
+
+    // Initialize VL-ID sequence trackers (lock-free, watermark-based)
+    for (uint16_t i = 0; i < ports_config.nb_ports; i++)
+    {
+        uint16_t port = ports_config.ports[i].port_id;
+        if (port >= MAX_PORTS)
+            continue;
+
+        if (port_vl_trackers[port] == NULL)
+            port_vl_trackers[port] = capacity_port_zmalloc("port_vl_tracker",
+                                                           sizeof(struct port_vl_tracker), port);
+        if (port_vl_trackers[port] == NULL)
+            continue;
+
         for (int vl = 0; vl <= MAX_VL_ID; vl++)
         {
-            port_vl_trackers[i].vl_trackers[vl].max_seq = 0;
-            port_vl_trackers[i].vl_trackers[vl].pkt_count = 0;
-            port_vl_trackers[i].vl_trackers[vl].initialized = 0;  // 0=false, 1=true
+            port_vl_trackers[port]->vl_trackers[vl].max_seq = 0;
+            port_vl_trackers[port]->vl_trackers[vl].pkt_count = 0;
+            port_vl_trackers[port]->vl_trackers[vl].initialized = 0;  // 0=false, 1=true
         }
     }
     printf("RX statistics and VL-ID sequence trackers initialized for all ports\n");
@@ -608,34 +533,196 @@ void print_vlan_config(void)
     printf("\n");
 }
 
+#if PRBS_EXTBUF_TX_ENABLED
+// Ports whose driver accepted RTE_ETH_TX_OFFLOAD_MULTI_SEGS
+static bool port_multiseg_tx[MAX_PORTS];
+#endif
+
 // ==========================================
-// PORT SETUP FUNCTIONS
+// MBUF POOL SIZING
 // ==========================================
 
-struct rte_mempool *create_mbuf_pool(uint16_t socket_id, uint16_t port_id)
+#define MBUF_POOL_MAX_RECORDS (MAX_PORTS * 3)
+
+struct mbuf_pool_record
+{
+    uint16_t port_id;
+    uint16_t socket_id;
+    uint8_t role;
+    uint32_t nb_mbufs;
+    uint32_t cache_size;
+    uint32_t obj_size;      // mbuf header + data room
+};
+
+static struct mbuf_pool_record mbuf_pool_records[MBUF_POOL_MAX_RECORDS];
+static uint16_t mbuf_pool_nb_records = 0;
+
+static void mbuf_pool_name(char *buf, size_t len, uint16_t socket_id, uint16_t port_id,
+                           enum mbuf_pool_role role)
+{
+    static const char *const role_names[] = {"rx", "tx", "ext"};
+
+#if MBUF_POOL_LEGACY
+    if (role != MBUF_POOL_TX_EXTBUF)
+    {
+        snprintf(buf, len, "mbuf_pool_%u_%u", socket_id, port_id);
+        return;
+    }
+#endif
+    snprintf(buf, len, "mbuf_%s_%u_%u", role_names[role], socket_id, port_id);
+}
+
+#if !MBUF_POOL_LEGACY
+/*
+ * Every place an mbuf of the pool can sit while the port runs:
+ *   RX: RX descriptor ring per queue; forwarder role also the TX rings the
+ *       forward worker sends on (same queue on the local and cross port)
+ *   TX: TX descriptor ring per queue (held until completion); SW harness
+ *       also the net_ring TX + RX rings between tx_worker and rx_worker
+ * plus one burst and a full lcore cache (flushed at 1.5x) per lcore using
+ * the pool, MBUF_POOL_MARGIN_PCT on top, rounded to a multiple of the cache.
+ */
+static uint32_t mbuf_pool_count(enum mbuf_pool_role role, uint16_t nb_queues)
+{
+    uint32_t n;
+    uint32_t lcores;
+
+    if (role == MBUF_POOL_RX)
+    {
+        n = (uint32_t)nb_queues * RX_RING_SIZE;
+        lcores = NUM_RX_CORES;
+        if (vmc_role_forwarder())
+        {
+            n += 2u * NUM_RX_CORES * TX_RING_SIZE;
+            lcores *= 2;    // Cross-port workers free TX completions too
+        }
+    }
+    else
+    {
+        n = (uint32_t)nb_queues * TX_RING_SIZE;
+        lcores = NUM_TX_CORES + 1;  // + ext TX / latency test / main
+#if SW_HARNESS_ENABLED && !SW_HARNESS_NULL
+        n += 2u * nb_queues * SW_HARNESS_RING_SIZE;
+#endif
+    }
+
+    n += lcores * (BURST_SIZE + MBUF_CACHE_SIZE * 3 / 2);
+    n += n * MBUF_POOL_MARGIN_PCT / 100;
+    return RTE_ALIGN_CEIL(n, MBUF_CACHE_SIZE);
+}
+#endif
+
+struct rte_mempool *create_mbuf_pool(uint16_t socket_id, uint16_t port_id,
+                                     enum mbuf_pool_role role, uint16_t nb_queues)
 {
     char pool_name[32];
-    snprintf(pool_name, sizeof(pool_name), "mbuf_pool_%u_%u", socket_id, port_id);
+    mbuf_pool_name(pool_name, sizeof(pool_name), socket_id, port_id, role);
+
+#if MBUF_POOL_LEGACY
+    // One shared pool per port: the TX pool is the RX pool
+    struct rte_mempool *existing = rte_mempool_lookup(pool_name);
+    if (existing != NULL)
+        return existing;
+
+    const uint32_t nb_mbufs = NUM_MBUFS;
+    const uint32_t cache_size = MBUF_LEGACY_CACHE_SIZE;
+    uint16_t data_room = RTE_MBUF_DEFAULT_BUF_SIZE;
+    (void)nb_queues;
+#else
+    const uint32_t nb_mbufs = mbuf_pool_count(role, nb_queues);
+    const uint32_t cache_size = MBUF_CACHE_SIZE;
+    uint16_t data_room = MBUF_DATA_ROOM_SIZE;
+#endif
+
+    // Payload segments only carry the mbuf header, the data is the PRBS cache
+    if (role == MBUF_POOL_TX_EXTBUF)
+        data_room = 0;
 
     struct rte_mempool *mbuf_pool = rte_pktmbuf_pool_create(
         pool_name,
-        NUM_MBUFS,
-        MBUF_CACHE_SIZE,
+        nb_mbufs,
+        cache_size,
         0,
-        RTE_MBUF_DEFAULT_BUF_SIZE,
+        data_room,
         socket_id);
 
     if (mbuf_pool == NULL)
     {
-        printf("Error: Cannot create mbuf pool for socket %u, port %u\n",
-               socket_id, port_id);
+        printf("Error: Cannot create mbuf pool '%s' (%u mbufs)\n", pool_name, nb_mbufs);
         return NULL;
     }
 
-    printf("Created mbuf pool '%s' on socket %u\n", pool_name, socket_id);
+    if (mbuf_pool_nb_records < MBUF_POOL_MAX_RECORDS)
+    {
+        struct mbuf_pool_record *r = &mbuf_pool_records[mbuf_pool_nb_records++];
+        r->port_id = port_id;
+        r->socket_id = socket_id;
+        r->role = role;
+        r->nb_mbufs = nb_mbufs;
+        r->cache_size = cache_size;
+        r->obj_size = sizeof(struct rte_mbuf) + data_room;
+    }
+
+    printf("Created mbuf pool '%s' on socket %u: %u mbufs x %uB, cache %u\n",
+           pool_name, socket_id, nb_mbufs, data_room, cache_size);
     return mbuf_pool;
 }
 
+struct rte_mempool *lookup_mbuf_pool(uint16_t socket_id, uint16_t port_id,
+                                     enum mbuf_pool_role role)
+{
+    char pool_name[32];
+    mbuf_pool_name(pool_name, sizeof(pool_name), socket_id, port_id, role);
+    return rte_mempool_lookup(pool_name);
+}
+
+uint64_t mbuf_pool_total_bytes(void)
+{
+    uint64_t total = 0;
+    for (uint16_t i = 0; i < mbuf_pool_nb_records; i++)
+        total += (uint64_t)mbuf_pool_records[i].nb_mbufs * mbuf_pool_records[i].obj_size;
+    return total;
+}
+
+void print_mbuf_pool_report(void)
+{
+    const uint64_t legacy_obj = sizeof(struct rte_mbuf) + RTE_MBUF_DEFAULT_BUF_SIZE;
+    uint64_t legacy_total = 0;
+
+    printf("\n=== Mbuf Pools%s ===\n", MBUF_POOL_LEGACY ? " (legacy)" : "");
+    static const char *const role_names[] = {"RX ", "TX ", "EXT"};
+
+    printf("Port  Socket  Role   Mbufs   Cache  Obj(B)     MB\n");
+    for (uint16_t i = 0; i < mbuf_pool_nb_records; i++)
+    {
+        const struct mbuf_pool_record *r = &mbuf_pool_records[i];
+        printf("  %2u    %2u     %s %7u   %4u    %4u  %6.1f\n",
+               r->port_id, r->socket_id, role_names[r->role],
+               r->nb_mbufs, r->cache_size, r->obj_size,
+               (double)r->nb_mbufs * r->obj_size / (1024.0 * 1024.0));
+
+        // RX pool is created first for every port: one legacy pool per port
+        if (r->role == MBUF_POOL_RX)
+            legacy_total += NUM_MBUFS * legacy_obj;
+    }
+
+    const uint64_t total = mbuf_pool_total_bytes();
+    const uint64_t saved = legacy_total > total ? legacy_total - total : 0;
+    printf("Total: %.1f MB, legacy fixed pools: %.1f MB, saved %.1f MB (%.0f%%)\n",
+           total / (1024.0 * 1024.0), legacy_total / (1024.0 * 1024.0),
+           saved / (1024.0 * 1024.0), legacy_total ? 100.0 * saved / legacy_total : 0.0);
+
+    // Per lcore and pool, a cache holds up to 1.5x its size before flushing
+    if (mbuf_pool_nb_records > 0)
+        printf("Lcore cache footprint per pool: %.0f KB (legacy %.0f KB)\n",
+               mbuf_pool_records[0].cache_size * 1.5 * mbuf_pool_records[0].obj_size / 1024.0,
+               MBUF_LEGACY_CACHE_SIZE * 1.5 * legacy_obj / 1024.0);
+}
+
+// ==========================================
+// PORT SETUP FUNCTIONS
+// ==========================================
+
 int setup_tx_queue(uint16_t port_id, uint16_t queue_id, uint16_t socket_id)
 {
     struct rte_eth_txconf txconf;
@@ -741,12 +828,32 @@ int init_port_txrx(uint16_t port_id, struct txrx_config *config)
 
     port_conf.txmode.mq_mode = RTE_ETH_MQ_TX_NONE;
 
+#if PRBS_EXTBUF_TX_ENABLED
+    // Header mbuf + PRBS cache segment per packet
+    port_multiseg_tx[port_id] = (dev_info.tx_offload_capa & RTE_ETH_TX_OFFLOAD_MULTI_SEGS) != 0;
+    if (port_multiseg_tx[port_id])
+        port_conf.txmode.offloads |= RTE_ETH_TX_OFFLOAD_MULTI_SEGS;
+    else
+        printf("Port %u: no multi-segment TX, PRBS extbuf TX off (copy mode)\n", port_id);
+#endif
+
+#if ADAPTIVE_POLL_ENABLED
+    // RX queue interrupts for the idle level of slow ports
+    adaptive_poll_port_conf(port_id, &port_conf);
+#endif
+
     ret = rte_eth_dev_configure(
         port_id,
         config->nb_rx_queues,
         config->nb_tx_queues,
         &port_conf);
 
+#if ADAPTIVE_POLL_ENABLED
+    if (ret < 0 && adaptive_poll_port_conf_fallback(port_id, &port_conf))
+        ret = rte_eth_dev_configure(port_id, config->nb_rx_queues, config->nb_tx_queues,
+                                    &port_conf);
+#endif
+
     if (ret < 0)
     {
         printf("Error configuring port %u: %d\n", port_id, ret);
@@ -757,11 +864,8 @@ int init_port_txrx(uint16_t port_id, struct txrx_config *config)
            port_id, config->nb_tx_queues, config->nb_rx_queues,
            config->nb_rx_queues > 1 ? "Enabled" : "Disabled");
 
-    int socket_id = rte_eth_dev_socket_id(port_id);
-    if (socket_id < 0)
-    {
-        socket_id = 0;
-    }
+    // Descriptor rings on the port's socket (resolved by portNumaNodesMatch)
+    uint16_t socket_id = config->socket_id;
 
     for (uint16_t q = 0; q < config->nb_tx_queues; q++)
     {
@@ -774,7 +878,7 @@ int init_port_txrx(uint16_t port_id, struct txrx_config *config)
 
     for (uint16_t q = 0; q < config->nb_rx_queues; q++)
     {
-        ret = setup_rx_queue(port_id, q, socket_id, config->mbuf_pool);
+        ret = setup_rx_queue(port_id, q, socket_id, config->rx_mbuf_pool);
         if (ret < 0)
         {
             return ret;
@@ -953,15 +1057,32 @@ int tx_worker(void *arg)
         return -1;
     }
 
+    // Same bound as init_tx_vl_sequences: no TX VLAN, no VL-IDs of its own
+    if (params->port_id >= MAX_PORTS_CONFIG ||
+        params->queue_id >= RTE_MIN((uint16_t)NUM_TX_CORES, port_vlans[params->port_id].tx_vlan_count))
+    {
+        printf("TX worker Port %u Queue %u: no TX VLAN configured for this queue, idle\n",
+               params->port_id, params->queue_id);
+        return 0;
+    }
+
     // PORT-AWARE: Dual VL-ID range support
-    const uint16_t vl_r1_start = get_tx_vl_id_range_start(params->port_id, params->queue_id);
-    const uint16_t vl_r1_size = get_tx_vl_range1_size(params->port_id, params->queue_id);
-    const uint16_t vl_r2_start = (params->port_id < MAX_PORTS_CONFIG)
-        ? port_vlans[params->port_id].tx_vl_ids2[params->queue_id] : 0;
-    const uint16_t vl_r2_size = (vl_r2_start > 0 && params->port_id < MAX_PORTS_CONFIG)
-        ? port_vlans[params->port_id].tx_vl_range2_size[params->queue_id] : 0;
+    const struct tx_vl_span vl_span = get_tx_vl_span(params->port_id, params->queue_id);
+    const uint16_t vl_r1_start = vl_span.r1_start;
+    const uint16_t vl_r1_size = vl_span.r1_size;
+    const uint16_t vl_r2_start = vl_span.r2_start;
+    const uint16_t vl_r2_size = vl_span.r2_size;
     const uint16_t vl_range_size = vl_r1_size + vl_r2_size;
 
+    // Private sequences of the VL-IDs this queue owns (ownership resolved at start)
+    struct tx_vl_seq_local vl_seq;
+    if (vl_range_size == 0 || tx_vl_sequences[params->port_id] == NULL ||
+        tx_vl_seq_local_init(&vl_seq, params->port_id, &vl_span) != 0)
+    {
+        printf("Error: No TX sequences for Port %u Queue %u\n", params->port_id, params->queue_id);
+        return -1;
+    }
+
     // Backward compat aliases
     const uint16_t vl_start = vl_r1_start;
 #if TOKEN_BUCKET_TX_ENABLED
@@ -970,12 +1091,6 @@ int tx_worker(void *arg)
     const uint16_t vl_end = vl_start + vl_r1_size;
 #endif
 
-#if IMIX_ENABLED
-    // IMIX: Worker-specific offset for pattern rotation (hybrid shuffle)
-    const uint8_t imix_offset = (uint8_t)((params->port_id * 4 + params->queue_id) % IMIX_PATTERN_SIZE);
-    uint64_t imix_counter = 0;  // Paket sayacı (IMIX pattern için)
-#endif
-
     // ==========================================
     // PACING SETUP
     // ==========================================
@@ -988,14 +1103,23 @@ int tx_worker(void *arg)
     uint64_t delay_cycles = tsc_hz / packets_per_sec;
 #else
     // Rate hesaplama: limiter.tokens_per_sec zaten bytes/sec
-    // IMIX: Ortalama paket boyutu kullanarak packets_per_sec hesapla
 #if IMIX_ENABLED
-    const uint64_t avg_bytes_per_packet = IMIX_AVG_PACKET_SIZE;
+    // IMIX: Paket hızı profilin tam döngü ortalamasından; her paket sonra
+    // kendi byte maliyeti kadar bekletir (tp_pacer, sabit ortalama yok)
+    const double avg_bytes_per_packet =
+        (double)g_traffic_profile.cycle_bytes / g_traffic_profile.seq_len;
+    uint64_t packets_per_sec = (uint64_t)((double)params->limiter.tokens_per_sec / avg_bytes_per_packet);
+    struct tp_pacer pacer;
+    tp_pacer_init(&pacer, tsc_hz, params->limiter.tokens_per_sec);
+    traffic_profile_add_target(params->port_id, params->limiter.tokens_per_sec);
 #else
     const uint64_t avg_bytes_per_packet = PACKET_SIZE;
-#endif
     uint64_t packets_per_sec = params->limiter.tokens_per_sec / avg_bytes_per_packet;
+#endif
     uint64_t delay_cycles = (packets_per_sec > 0) ? (tsc_hz / packets_per_sec) : tsc_hz;
+#if IMIX_ENABLED
+    uint64_t pace_cycles = delay_cycles;  // Bir önceki paketin byte maliyeti
+#endif
 #endif
 
     // Mikrosaniye cinsinden paket arası süre
@@ -1029,13 +1153,18 @@ int tx_worker(void *arg)
     printf("  *** TOKEN BUCKET MODE - %u VL-IDX, 1ms window ***\n", vl_range_size);
 #elif IMIX_ENABLED
     printf("  *** IMIX MODE ENABLED - Variable packet sizes ***\n");
-    printf("  -> IMIX pattern: 100, 200, 400, 800, 1200x3, 1518x3 (avg=%lu bytes)\n", avg_bytes_per_packet);
-    printf("  -> Worker offset: %u (hybrid shuffle)\n", imix_offset);
+    printf("  -> IMIX profile '%s': %u sizes (avg=%.1f bytes)\n",
+           g_traffic_profile.name, g_traffic_profile.nb_sizes, avg_bytes_per_packet);
+    printf("  -> Per-VL sequence phase, exact byte-cost pacing\n");
 #else
     printf("  *** SMOOTH PACING - 1 saniyeye yayılmış trafik ***\n");
 #endif
     printf("  -> Pacing: %.1f us/paket (%.0f paket/s), stagger=%ums\n",
            inter_packet_us, (double)packets_per_sec, (unsigned)(stagger_offset * 1000 / tsc_hz));
+#if PRBS_EXTBUF_TX_ENABLED
+    printf("  -> Payload: %s\n", params->extbuf_pool ? "PRBS cache extbuf (zero-copy, 2 segments)"
+                                                    : "PRBS copy");
+#endif
     printf("  VL-ID Based Sequence: Each VL-ID has independent sequence counter\n");
     printf("  Strategy: Round-robin through ALL VL-IDs in range (%u VL-IDs)\n", vl_range_size);
 
@@ -1050,6 +1179,13 @@ int tx_worker(void *arg)
     // Local packet counter for this worker
     uint64_t local_pkt_counter = 0;
 
+#if ADAPTIVE_POLL_ENABLED
+    // Long pacing gaps sleep in TPAUSE (ports allowed to go past rte_pause)
+    struct adaptive_poll *ap = adaptive_poll_register(ADAPTIVE_POLL_TX, params->port_id,
+                                                      params->queue_id,
+                                                      adaptive_poll_port_max_level(params->port_id));
+#endif
+
     while (!(*params->stop_flag))
     {
 #if TX_TEST_MODE_ENABLED
@@ -1081,10 +1217,14 @@ int tx_worker(void *arg)
         uint64_t now = rte_get_tsc_cycles();
 
         // Zamanı gelene kadar bekle (busy-wait for precision)
+#if ADAPTIVE_POLL_ENABLED
+        now = adaptive_poll_wait_until(ap, now, next_send_time);
+#else
         while (now < next_send_time) {
             rte_pause();
             now = rte_get_tsc_cycles();
         }
+#endif
 
 #if TOKEN_BUCKET_TX_ENABLED
         // Geride kalırsak PHASE-PRESERVING SKIP (burst önleme)
@@ -1100,7 +1240,11 @@ int tx_worker(void *arg)
             next_send_time = now;
         }
 #endif
+#if IMIX_ENABLED && !TOKEN_BUCKET_TX_ENABLED
+        next_send_time += pace_cycles;
+#else
         next_send_time += delay_cycles;
+#endif
 
         // Tek paket tahsisi
         pkt = rte_pktmbuf_alloc(params->mbuf_pool);
@@ -1126,7 +1270,7 @@ int tx_worker(void *arg)
         if (pkt_num % TX_SKIP_EVERY_N_PACKETS == 0)
         {
             // Test mode: intentional skip — consume sequence to create gap
-            uint64_t skip_seq = get_next_tx_sequence(params->port_id, curr_vl);
+            uint64_t skip_seq = get_next_tx_sequence(&vl_seq, current_vl_offset, curr_vl);
             printf("TX Worker Port %u: SKIPPING packet #%lu (VL %u, seq %lu)\n",
                    params->port_id, pkt_num, curr_vl, skip_seq);
             rte_pktmbuf_free(pkt);
@@ -1137,7 +1281,7 @@ int tx_worker(void *arg)
         }
 
         // Peek sequence WITHOUT incrementing — only commit after successful send
-        uint64_t seq = peek_tx_sequence(params->port_id, curr_vl);
+        uint64_t seq = peek_tx_sequence(&vl_seq, current_vl_offset, curr_vl);
 #else
         // Dual-range VL-ID: offset < r1_size => range1, else range2
         uint16_t curr_vl = (current_vl_offset < vl_r1_size)
@@ -1145,7 +1289,7 @@ int tx_worker(void *arg)
             : (vl_r2_start + (current_vl_offset - vl_r1_size));
 
         // Peek sequence WITHOUT incrementing — only commit after successful send
-        uint64_t seq = peek_tx_sequence(params->port_id, curr_vl);
+        uint64_t seq = peek_tx_sequence(&vl_seq, current_vl_offset, curr_vl);
 #endif
 
         // Paket oluştur
@@ -1162,18 +1306,35 @@ int tx_worker(void *arg)
                                 (uint32_t)(curr_vl & 0xFF));
 
 #if IMIX_ENABLED
-        // IMIX: Paket boyutunu pattern'den al
-        uint16_t pkt_size = get_imix_packet_size(imix_counter, imix_offset);
+        // IMIX: Paket boyutu VL'in profil sırasından (VL, sequence) ile
+        const uint8_t imix_bucket = traffic_profile_bucket(curr_vl, seq);
+        uint16_t pkt_size = traffic_profile_size(imix_bucket);
         uint16_t prbs_len = calc_prbs_size(pkt_size);
-        imix_counter++;
+#if !TOKEN_BUCKET_TX_ENABLED
+        pace_cycles = tp_pacer_cycles(&pacer, pkt_size);
+#endif
+#else
+        const uint16_t pkt_size = PACKET_SIZE;
+        const uint16_t prbs_len = NUM_PRBS_BYTES;
+#endif
 
-        // Dinamik boyutlu paket oluştur
+        // Sadece header'lar yazılır (payload PRBS ile tamamen dolar)
         build_packet_dynamic(pkt, &cfg, pkt_size);
-        fill_payload_with_prbs31_dynamic(pkt, params->port_id, seq, l2_len, prbs_len);
-#else
-        build_packet_mbuf(pkt, &cfg);
-        fill_payload_with_prbs31(pkt, params->port_id, seq, l2_len);
+
+#if PRBS_EXTBUF_TX_ENABLED
+        if (likely(params->extbuf_pool != NULL))
+        {
+            // Zero-copy: seq in header mbuf, PRBS segment points into the cache
+            if (unlikely(attach_prbs_extbuf(pkt, params->extbuf_pool, &params->prbs_shinfo,
+                                            params->port_id, seq, l2_len, prbs_len) != 0))
+            {
+                rte_pktmbuf_free(pkt);
+                continue;
+            }
+        }
+        else
 #endif
+        fill_payload_with_prbs31_dynamic(pkt, params->port_id, seq, l2_len, prbs_len);
 
         // Packet trace (TX)
 #if PACKET_TRACE_ENABLED
@@ -1181,7 +1342,7 @@ int tx_worker(void *arg)
             uint8_t *raw = rte_pktmbuf_mtod(pkt, uint8_t *);
             uint16_t trace_vl = ((uint16_t)raw[4] << 8) | raw[5];
             if (SHOULD_TRACE_PACKET(params->port_id, trace_vl, seq)) {
-                trace_print_packet("VMC1_TX", raw, pkt->pkt_len, params->port_id);
+                trace_print_packet("VMC1_TX", raw, rte_pktmbuf_data_len(pkt), params->port_id);
             }
         }
 #endif
@@ -1191,6 +1352,7 @@ int tx_worker(void *arg)
 
         if (unlikely(!first_pkt_sent && nb_tx > 0))
         {
+            startup_trace_first_packet();
             printf("TX Worker: First packet sent on Port %u Queue %u\n",
                    params->port_id, params->queue_id);
             first_pkt_sent = true;
@@ -1199,7 +1361,10 @@ int tx_worker(void *arg)
         if (likely(nb_tx > 0))
         {
             // Sequence'ı sadece paket başarıyla gönderildikten sonra artır
-            commit_tx_sequence(params->port_id, curr_vl);
+            commit_tx_sequence(&vl_seq, current_vl_offset);
+#if IMIX_ENABLED
+            traffic_profile_count_tx(params->port_id, params->queue_id, imix_bucket);
+#endif
         }
         else
         {
@@ -1213,6 +1378,8 @@ int tx_worker(void *arg)
             current_vl_offset = 0;
     }
 
+    tx_vl_seq_local_free(&vl_seq);
+
 #if TX_TEST_MODE_ENABLED
     printf("TX Worker stopped: Port %u, Queue %u (sent %lu packets locally, port total: %lu)\n",
            params->port_id, params->queue_id, local_pkt_counter,
@@ -1227,69 +1394,6 @@ int tx_worker(void *arg)
 // RX WORKER - VL-ID BASED SEQUENCE VALIDATION
 // ==========================================
 
-/**
- * Check if VL-ID is within valid TX range for source port (any queue)
- * This is used to detect external packets - if VL-ID doesn't match
- * what the source port would send, it's from an external source.
- */
-static inline bool is_valid_tx_vl_id_for_source_port(uint16_t vl_id, uint16_t src_port_id)
-{
-    if (src_port_id >= MAX_PORTS_CONFIG)
-        return false;
-
-    // Check all TX queues for source port (dual-range aware)
-    uint16_t queue_count = port_vlans[src_port_id].tx_vlan_count;
-    for (uint16_t q = 0; q < queue_count; q++)
-    {
-        // Range 1
-        uint16_t start = port_vlans[src_port_id].tx_vl_ids[q];
-        uint16_t r1_size = (port_vlans[src_port_id].tx_vl_range1_size[q] > 0)
-                           ? port_vlans[src_port_id].tx_vl_range1_size[q]
-                           : VL_RANGE_SIZE_PER_QUEUE;
-        if (vl_id >= start && vl_id < start + r1_size)
-            return true;
-        // Range 2
-        uint16_t s2 = port_vlans[src_port_id].tx_vl_ids2[q];
-        if (s2 > 0) {
-            uint16_t r2_size = port_vlans[src_port_id].tx_vl_range2_size[q];
-            if (vl_id >= s2 && vl_id < s2 + r2_size)
-                return true;
-        }
-    }
-    return false;
-}
-
-/**
- * Check if VL-ID is within valid RX range for a given port (any queue).
- * Used to detect loopback packets - when VMC_2 remaps VL-IDs, the returning
- * VL-IDs match the port's rx_vl_ids, not tx_vl_ids.
- */
-static inline bool is_valid_rx_vl_id_for_port(uint16_t vl_id, uint16_t port_id)
-{
-    if (port_id >= MAX_PORTS_CONFIG)
-        return false;
-
-    uint16_t queue_count = port_vlans[port_id].rx_vlan_count;
-    for (uint16_t q = 0; q < queue_count; q++)
-    {
-        // Range 1
-        uint16_t start = port_vlans[port_id].rx_vl_ids[q];
-        uint16_t r1_size = (port_vlans[port_id].rx_vl_range1_size[q] > 0)
-                           ? port_vlans[port_id].rx_vl_range1_size[q]
-                           : VL_RANGE_SIZE_PER_QUEUE;
-        if (vl_id >= start && vl_id < start + r1_size)
-            return true;
-        // Range 2
-        uint16_t s2 = port_vlans[port_id].rx_vl_ids2[q];
-        if (s2 > 0) {
-            uint16_t r2_size = port_vlans[port_id].rx_vl_range2_size[q];
-            if (vl_id >= s2 && vl_id < s2 + r2_size)
-                return true;
-        }
-    }
-    return false;
-}
-
 /**
  * Find the DPDK source port that generated a given VL-ID.
  * Checks all DPDK ports' tx_vl_ids (both ranges).
@@ -1381,16 +1485,60 @@ int rx_worker(void *arg)
     bool first_raw_rx = false;  // Track first raw socket packet
 
     // Get VL-ID tracker for this port
-    struct port_vl_tracker *vl_tracker = &port_vl_trackers[params->port_id];
+    struct port_vl_tracker *vl_tracker = port_vl_trackers[params->port_id];
+    if (vl_tracker == NULL)
+    {
+        printf("Error: RX Worker port %u queue %u has no VL-ID tracker\n",
+               params->port_id, params->queue_id);
+        return -1;
+    }
+
+#if CAPTURE_ENABLED
+    // Last N packets of this queue, frozen to pcap on CRC/PRBS error or gap
+    struct capture_ring *cap = capture_ring_get(params->port_id, params->queue_id);
+#endif
+
+#if ADAPTIVE_POLL_ENABLED
+    // Idle escalation per group of INNER_LOOPS polls
+    struct adaptive_poll *ap = adaptive_poll_register(ADAPTIVE_POLL_RX, params->port_id,
+                                                      params->queue_id,
+                                                      adaptive_poll_port_max_level(params->port_id));
+#endif
+
+#if RX_STAGED_PIPELINE
+    // Own VL-IDs: source port TX ranges + our RX ranges (VMC_2 remaps)
+    uint8_t own_vl_map[RX_PIPE_VL_MAP_BYTES];
+    rx_pipe_own_map_build(own_vl_map, params->port_id, params->src_port_id, true);
+    struct rx_pipe_burst pipe;
+#if IMIX_ENABLED
+    const uint32_t rx_min_len = IMIX_MIN_PACKET_SIZE;
+#else
+    const uint32_t rx_min_len = min_len_vlan;
+#endif
+    // rte_flow steering: VL-IDs with a rule to this queue reach only it,
+    // their trackers are ours (the rest stays on RSS, atomics)
+    const uint8_t *vl_excl_map = NULL;
+#if RX_FLOW_STEERING
+    uint8_t excl_vl_map[RX_PIPE_VL_MAP_BYTES];
+    if (rx_flow_steer_exclusive_map(params->port_id, params->queue_id, excl_vl_map))
+        vl_excl_map = excl_vl_map;
+#endif
+#endif
 
     const uint16_t INNER_LOOPS = 8;
 
     while (!(*params->stop_flag))
     {
+#if ADAPTIVE_POLL_ENABLED
+        uint32_t loop_rx = 0;
+#endif
         for (int iter = 0; iter < INNER_LOOPS; iter++)
         {
             uint16_t nb_rx = rte_eth_rx_burst(params->port_id, params->queue_id,
                                               pkts, BURST_SIZE);
+#if ADAPTIVE_POLL_ENABLED
+            loop_rx += nb_rx;
+#endif
 
             if (unlikely(nb_rx == 0))
                 continue;
@@ -1403,12 +1551,25 @@ int rx_worker(void *arg)
 
             local_rx += nb_rx;
 
+#if CAPTURE_ENABLED
+            if (cap != NULL)
+                capture_record_burst(cap, pkts, nb_rx);
+#endif
+
+#if RX_STAGED_PIPELINE
+            // Stage 1-2: headers -> VL-ID / seq, then PRBS lines + trackers
+            rx_pipe_parse(&pipe, pkts, nb_rx, own_vl_map, rx_min_len);
+            rx_pipe_prefetch(&pipe, prbs_cache_ext, vl_tracker->vl_trackers);
+            // Stage 3a: one tracker update per VL-ID, gaps kept per packet
+            local_lost += rx_pipe_track(&pipe, vl_tracker->vl_trackers, vl_excl_map);
+#else
             // Aggressive prefetch
             for (uint16_t i = 0; i + 7 < nb_rx; i++)
             {
                 rte_prefetch0(rte_pktmbuf_mtod(pkts[i + 4], void *));
                 rte_prefetch0(rte_pktmbuf_mtod(pkts[i + 7], void *));
             }
+#endif
 
             // Process packets
             for (uint16_t i = 0; i < nb_rx; i++)
@@ -1446,6 +1607,70 @@ int rx_worker(void *arg)
                     }
                 }
 
+#if RX_STAGED_PIPELINE
+                // Stage 3b: own packet, tracker already updated
+                if (pipe.own[i] != 0)
+                {
+                    const struct rx_pipe_pkt *p = &pipe.pkt[pipe.own[i] - 1];
+#if IMIX_ENABLED
+                    traffic_profile_count_rx(params->port_id, params->queue_id, m->pkt_len);
+#endif
+#if PACKET_TRACE_ENABLED
+                    if (SHOULD_TRACE_PACKET_RX(params->port_id, p->vl_id, p->seq)) {
+                        trace_print_packet("VMC1_RX", pkt, m->pkt_len, params->port_id);
+                    }
+#endif
+                    if (unlikely(p->gap != 0))
+                    {
+#if CAPTURE_ENABLED
+                        if (cap != NULL && p->gap > CAPTURE_GAP_TRIGGER)
+                            capture_trigger(cap, CAPTURE_REASON_GAP, p->vl_id, p->seq,
+                                            p->gap, i, nb_rx);
+#endif
+#if TOKEN_BUCKET_TX_ENABLED
+                        printf("*** LOSS DETECTED [DPDK] Port %u Q%u: VL-ID=%u expected_seq=%lu got_seq=%lu gap=%lu (src_port=%u) ***\n",
+                               params->port_id, params->queue_id, p->vl_id, p->seq - p->gap, p->seq, p->gap, params->src_port_id);
+#endif
+                    }
+
+                    bool crc_ok, prbs_ok;
+                    if (likely(rx_pipe_verify(p, &crc_ok, &prbs_ok)))
+                    {
+                        local_good++;
+                        if (unlikely(!first_good))
+                        {
+                            printf("✓ GOOD: Port %u Q%u VL-ID %u Seq %lu\n",
+                                   params->port_id, params->queue_id, p->vl_id, p->seq);
+                            first_good = true;
+                        }
+                    }
+                    else
+                    {
+                        local_bad++;
+                        if (unlikely(!first_bad))
+                        {
+                            printf("✗ BAD: Port %u Q%u VL-ID %u Seq %lu (CRC=%s PRBS=%s)\n",
+                                   params->port_id, params->queue_id, p->vl_id, p->seq,
+                                   crc_ok ? "OK" : "FAIL", prbs_ok ? "OK" : "FAIL");
+                            first_bad = true;
+                        }
+
+                        // Bit error counting (on remaining PRBS only)
+                        uint64_t pkt_bits = 0;
+                        if (!prbs_ok && p->check_len > 0) {
+                            pkt_bits = prbs_bit_errors(p->recv, p->exp, p->check_len);
+                            local_bits += pkt_bits;
+                        }
+#if CAPTURE_ENABLED
+                        if (cap != NULL)
+                            capture_trigger(cap, crc_ok ? CAPTURE_REASON_PRBS : CAPTURE_REASON_CRC,
+                                            p->vl_id, p->seq, pkt_bits, i, nb_rx);
+#endif
+                    }
+                    continue;
+                }
+#endif
+
                 if (ether_type == 0x0800)
                 {
                     // ==========================================
@@ -1609,6 +1834,9 @@ int rx_worker(void *arg)
                     local_short++;
                     continue;
                 }
+#if IMIX_ENABLED
+                traffic_profile_count_rx(params->port_id, params->queue_id, m->pkt_len);
+#endif
 
                 // Payload offset for VLAN packets
                 const uint32_t payload_off = l2_len_vlan + 20 + 8;
@@ -1651,9 +1879,7 @@ int rx_worker(void *arg)
                         uint8_t *cross_payload = pkt + payload_off;
 
                         // CRC32C verification (splitmix64 transform check)
-                        uint32_t cross_calc_crc = hw_crc32c(cross_payload, SEQ_BYTES + SPLITMIX_XOR_BYTES);
-                        uint32_t cross_recv_crc = *(uint32_t *)(cross_payload + SEQ_BYTES + SPLITMIX_XOR_BYTES);
-                        bool cross_crc_ok = (cross_calc_crc == cross_recv_crc);
+                        bool cross_crc_ok = splitmix64_crc_ok(cross_payload);
 
                         // PRBS verification on remaining payload (skip 68 bytes)
                         uint8_t *cross_recv = cross_payload + SEQ_BYTES + SPLITMIX_TOTAL_OVERHEAD;
@@ -1675,22 +1901,16 @@ int rx_worker(void *arg)
                             local_good++;
                         } else {
                             local_bad++;
+                            uint64_t cross_bits = 0;
                             if (!cross_prbs_ok && cross_check_len > 0) {
-                                uint64_t berr = 0;
-                                const uint64_t *r64 = (const uint64_t *)cross_recv;
-                                const uint64_t *e64 = (const uint64_t *)cross_exp;
-                                const uint16_t nq = cross_check_len / 8;
-                                for (uint16_t k = 0; k < nq; k++)
-                                    berr += __builtin_popcountll(r64[k] ^ e64[k]);
-                                uint16_t rem = cross_check_len & 7;
-                                if (rem) {
-                                    const uint8_t *r8 = (const uint8_t *)(r64 + nq);
-                                    const uint8_t *e8 = (const uint8_t *)(e64 + nq);
-                                    for (uint16_t k = 0; k < rem; k++)
-                                        berr += __builtin_popcount(r8[k] ^ e8[k]);
-                                }
-                                local_bits += berr;
+                                cross_bits = prbs_bit_errors(cross_recv, cross_exp, cross_check_len);
+                                local_bits += cross_bits;
                             }
+#if CAPTURE_ENABLED
+                            if (cap != NULL)
+                                capture_trigger(cap, cross_crc_ok ? CAPTURE_REASON_PRBS : CAPTURE_REASON_CRC,
+                                                vl_id, cross_seq, cross_bits, i, nb_rx);
+#endif
                         }
 
                         // Sequence tracking for cross-port packets
@@ -1706,8 +1926,14 @@ int rx_worker(void *arg)
                                 }
                             } else {
                                 uint64_t expected = __atomic_load_n(&cross_tracker->expected_seq, __ATOMIC_ACQUIRE);
-                                if (cross_seq > expected)
+                                if (cross_seq > expected) {
                                     local_lost += (cross_seq - expected);
+#if CAPTURE_ENABLED
+                                    if (cap != NULL && cross_seq - expected > CAPTURE_GAP_TRIGGER)
+                                        capture_trigger(cap, CAPTURE_REASON_GAP, vl_id, cross_seq,
+                                                        cross_seq - expected, i, nb_rx);
+#endif
+                                }
                                 if (cross_seq >= expected)
                                     __atomic_store_n(&cross_tracker->expected_seq, cross_seq + 1, __ATOMIC_RELEASE);
                             }
@@ -1883,6 +2109,11 @@ int rx_worker(void *arg)
                         {
                             // Gap detected - packets lost
                             local_lost += (seq - expected);
+#if CAPTURE_ENABLED
+                            if (cap != NULL && seq - expected > CAPTURE_GAP_TRIGGER)
+                                capture_trigger(cap, CAPTURE_REASON_GAP, vl_id, seq,
+                                                seq - expected, i, nb_rx);
+#endif
 #if TOKEN_BUCKET_TX_ENABLED
                             printf("*** LOSS DETECTED [DPDK] Port %u Q%u: VL-ID=%u expected_seq=%lu got_seq=%lu gap=%lu (src_port=%u) ***\n",
                                    params->port_id, params->queue_id, vl_id, expected, seq, seq - expected, params->src_port_id);
@@ -1919,9 +2150,7 @@ int rx_worker(void *arg)
                 uint8_t *payload_base = pkt + payload_off;
 
                 // CRC32C verification
-                uint32_t calc_crc = hw_crc32c(payload_base, SEQ_BYTES + SPLITMIX_XOR_BYTES);
-                uint32_t recv_crc = *(uint32_t *)(payload_base + SEQ_BYTES + SPLITMIX_XOR_BYTES);
-                bool crc_ok = (calc_crc == recv_crc);
+                bool crc_ok = splitmix64_crc_ok(payload_base);
 
                 // PRBS verification on remaining payload (skip 68 bytes: 64 XOR'd + 4 CRC)
                 uint8_t *recv = payload_base + SEQ_BYTES + SPLITMIX_TOTAL_OVERHEAD;
@@ -1963,22 +2192,16 @@ int rx_worker(void *arg)
                     }
 
                     // Bit error counting (on remaining PRBS only)
+                    uint64_t pkt_bits = 0;
                     if (!prbs_ok && prbs_check_len > 0) {
-                        uint64_t berr = 0;
-                        const uint64_t *r64 = (const uint64_t *)recv;
-                        const uint64_t *e64 = (const uint64_t *)exp;
-                        const uint16_t nq = prbs_check_len / 8;
-                        for (uint16_t k = 0; k < nq; k++)
-                            berr += __builtin_popcountll(r64[k] ^ e64[k]);
-                        uint16_t rem = prbs_check_len & 7;
-                        if (rem) {
-                            const uint8_t *r8 = (const uint8_t *)(r64 + nq);
-                            const uint8_t *e8 = (const uint8_t *)(e64 + nq);
-                            for (uint16_t k = 0; k < rem; k++)
-                                berr += __builtin_popcount(r8[k] ^ e8[k]);
-                        }
-                        local_bits += berr;
+                        pkt_bits = prbs_bit_errors(recv, exp, prbs_check_len);
+                        local_bits += pkt_bits;
                     }
+#if CAPTURE_ENABLED
+                    if (cap != NULL)
+                        capture_trigger(cap, crc_ok ? CAPTURE_REASON_PRBS : CAPTURE_REASON_CRC,
+                                        vl_id, seq, pkt_bits, i, nb_rx);
+#endif
                 }
             }
 
@@ -2007,8 +2230,15 @@ int rx_worker(void *arg)
                 local_raw_rx = local_raw_bytes = 0;
             }
         }
+#if ADAPTIVE_POLL_ENABLED
+        adaptive_poll_update(ap, loop_rx);
+#endif
     }
 
+#if ADAPTIVE_POLL_ENABLED
+    adaptive_poll_release(ap);
+#endif
+
     // Final flush
     if (local_rx || local_raw_rx || local_external)
     {
@@ -2095,7 +2325,8 @@ int start_txrx_workers(struct ports_config *ports_config, volatile bool *stop_fl
 
     //  CRITICAL: Initialize VL-ID based TX sequences
     printf("Initializing VL-ID based sequence counters...\n");
-    init_tx_vl_sequences();
+    if (init_tx_vl_sequences() != 0)
+        return -1;
 
 #if TX_TEST_MODE_ENABLED
     // Initialize TX test mode counters
@@ -2122,6 +2353,11 @@ int start_txrx_workers(struct ports_config *ports_config, volatile bool *stop_fl
 
         printf("\n--- Port %u RX (Self-loopback via VMC_2) ---\n", port_id);
 
+#if RX_FLOW_STEERING
+        // VL-ID ranges -> RX queues before the workers read the mode
+        rx_flow_steer_install(port_id, src_port_id);
+#endif
+
         for (uint16_t q = 0; q < NUM_RX_CORES; q++)
         {
             uint16_t lcore_id = port->used_rx_cores[q];
@@ -2204,16 +2440,23 @@ int start_txrx_workers(struct ports_config *ports_config, volatile bool *stop_fl
             tx_params[tx_param_idx].nb_ports = ports_config->nb_ports;
 #endif
 
-            char pool_name[32];
-            snprintf(pool_name, sizeof(pool_name), "mbuf_pool_%u_%u",
-                     port->numa_node, port_id);
-            tx_params[tx_param_idx].mbuf_pool = rte_mempool_lookup(pool_name);
+            tx_params[tx_param_idx].mbuf_pool = lookup_mbuf_pool(port->numa_node, port_id,
+                                                                 MBUF_POOL_TX);
             if (tx_params[tx_param_idx].mbuf_pool == NULL)
             {
                 printf("Error: Cannot find mbuf pool for port %u\n", port_id);
                 return -1;
             }
 
+#if PRBS_EXTBUF_TX_ENABLED
+            // Zero-copy payload needs multi-seg TX and an attachable PRBS cache
+            tx_params[tx_param_idx].extbuf_pool = NULL;
+            if (port_multiseg_tx[port_id] && port_prbs_cache[port_id].extbuf_ready)
+                tx_params[tx_param_idx].extbuf_pool = lookup_mbuf_pool(port->numa_node, port_id,
+                                                                       MBUF_POOL_TX_EXTBUF);
+            prbs_extbuf_shinfo_init(&tx_params[tx_param_idx].prbs_shinfo);
+#endif
+
             init_packet_config(&tx_params[tx_param_idx].pkt_config);
 
 #if VLAN_ENABLED
@@ -2237,7 +2480,13 @@ int start_txrx_workers(struct ports_config *ports_config, volatile bool *stop_fl
                    get_tx_vl_id_range_start(port_id, q), get_tx_vl_id_range_end(port_id, q),
                    port_target_gbps, IS_FAST_PORT(port_id) ? "FAST" : "SLOW");
 
-            int ret = rte_eal_remote_launch(tx_worker,
+#if PCAP_REPLAY_ENABLED
+            // Pcap replay instead of the PRBS generator (same lcore / queue / VLs)
+            lcore_function_t *tx_fn = pcap_replay_tx_worker;
+#else
+            lcore_function_t *tx_fn = tx_worker;
+#endif
+            int ret = rte_eal_remote_launch(tx_fn,
                                             &tx_params[tx_param_idx],
                                             lcore_id);
             if (ret != 0)
@@ -2549,6 +2798,13 @@ static int latency_rx_worker(void *arg)
 
     uint32_t loop_count = 0;
 
+#if ADAPTIVE_POLL_ENABLED
+    // Same idle policy as the data RX queue: ADAPTIVE_POLL=1 vs 0 latency
+    // results give the added wake-up latency end to end
+    struct adaptive_poll *ap = adaptive_poll_register(ADAPTIVE_POLL_LATENCY, port_id, 0,
+                                                      adaptive_poll_port_max_level(port_id));
+#endif
+
     // FAST POLLING LOOP - use ONLY queue 0 for latency test
     while (1) {
         // Check timeout every 1000 loops (reduces rdtsc overhead)
@@ -2561,6 +2817,12 @@ static int latency_rx_worker(void *arg)
 
         // Poll ONLY queue 0 for latency test
         uint16_t nb_rx = rte_eth_rx_burst(port_id, 0, pkts, BURST_SIZE);
+#if ADAPTIVE_POLL_ENABLED
+        adaptive_poll_update(ap, nb_rx);
+        // Sleeping polls last up to the UMWAIT / epoll bound: check the timeout next pass
+        if (ap != NULL && ap->last_sleep >= ADAPTIVE_POLL_LEVEL_MONITOR)
+            loop_count = 1000;
+#endif
         if (nb_rx == 0) {
             continue;
         }
@@ -2617,6 +2879,10 @@ static int latency_rx_worker(void *arg)
         }
     }
 
+#if ADAPTIVE_POLL_ENABLED
+    adaptive_poll_release(ap);
+#endif
+
     // Calculate averages
     for (uint16_t r = 0; r < g_latency_test.ports[src_port_id].test_count; r++) {
         struct latency_result *result = &g_latency_test.ports[src_port_id].results[r];
@@ -2816,9 +3082,7 @@ int start_latency_test(struct ports_config *ports_config, volatile bool *stop_fl
         if (lcore_id == 0 || lcore_id >= RTE_MAX_LCORE) continue;
 
         // Get mbuf pool
-        char pool_name[32];
-        snprintf(pool_name, sizeof(pool_name), "mbuf_pool_%u_%u", port->numa_node, port_id);
-        struct rte_mempool *mbuf_pool = rte_mempool_lookup(pool_name);
+        struct rte_mempool *mbuf_pool = lookup_mbuf_pool(port->numa_node, port_id, MBUF_POOL_TX);
         if (!mbuf_pool) {
             printf("Error: Cannot find mbuf pool for port %u\n", port_id);
             continue;
@@ -2911,4 +3175,307 @@ int start_latency_test(struct ports_config *ports_config, volatile bool *stop_fl
     return 0;
 }
 
-#endif /* LATENCY_TEST_ENABLED */
\ No newline at end of file
+#endif /* LATENCY_TEST_ENABLED */
+
+// ==========================================
+// FORWARD WORKER (forwarder role, VMC_2 loopback)
+// ==========================================
+// Launched by start_forward_workers instead of tx_worker / rx_worker; the
+// verifier path above is never entered in this role.
+
+// Per-port per-queue TX spinlock for cross-port thread safety.
+// When cross-port forwarding is active, multiple workers may write to the
+// same TX queue on a target port. DPDK TX queues are NOT thread-safe,
+// so we serialize all TX (local + cross) with a per-queue lock.
+// One cache line per lock (no false sharing between queues / ports), each
+// port's block on the port's socket, configured ports only.
+static struct fwd_tx_queue_lock *tx_queue_lock[MAX_PORTS];   // [port_id][queue_id]
+
+static int init_tx_queue_locks(const struct ports_config *ports_config)
+{
+    for (uint16_t i = 0; i < ports_config->nb_ports; i++)
+    {
+        uint16_t p = ports_config->ports[i].port_id;
+        if (p >= MAX_PORTS)
+            continue;
+
+        if (tx_queue_lock[p] == NULL)
+            tx_queue_lock[p] = capacity_port_zmalloc("fwd_tx_queue_lock",
+                                                     sizeof(struct fwd_tx_queue_lock) * MAX_TX_QUEUES_FWD, p);
+        if (tx_queue_lock[p] == NULL)
+            return -1;
+
+        for (int q = 0; q < MAX_TX_QUEUES_FWD; q++)
+            rte_spinlock_init(&tx_queue_lock[p][q].lock);
+    }
+    return 0;
+}
+
+// Per-port VL-ID -> rewrite table (fwd_remap.h), NULL: process_packet per packet
+static struct fwd_remap_table *fwd_remap[MAX_PORTS];
+
+/**
+ * R2 cross-port targets of a port (table and process_packet alike) must be
+ * configured ports: forward_worker takes tx_queue_lock[target] unchecked.
+ */
+static bool fwd_cross_targets_ok(uint16_t p)
+{
+    const struct port_vlan_config *cfg = &port_vlans[p];
+    bool ok = true;
+
+    for (uint16_t q = 0; q < cfg->tx_vlan_count; q++)
+    {
+        uint16_t target = cfg->r2_fwd_port[q];
+        if (cfg->tx_vl_ids2[q] == 0 || cfg->r2_fwd_vlan[q] == 0 || target == 0)
+            continue;
+        if (target >= MAX_PORTS || tx_queue_lock[target] == NULL)
+        {
+            printf("Error: Port %u queue %u forwards VL-ID %u.. to port %u, which is not configured\n",
+                   p, q, cfg->tx_vl_ids2[q], target);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+static int init_fwd_remap_tables(const struct ports_config *ports_config)
+{
+    for (uint16_t i = 0; i < ports_config->nb_ports; i++)
+    {
+        uint16_t p = ports_config->ports[i].port_id;
+        if (p < MAX_PORTS_CONFIG && !fwd_cross_targets_ok(p))
+            return -1;
+    }
+
+#if FWD_REMAP_TABLE
+    for (uint16_t i = 0; i < ports_config->nb_ports; i++)
+    {
+        uint16_t p = ports_config->ports[i].port_id;
+        if (p >= MAX_PORTS_CONFIG || fwd_remap[p] != NULL)
+            continue;
+
+        struct fwd_remap_table *t = capacity_port_zmalloc("fwd_remap",
+                                                          sizeof(struct fwd_remap_table), p);
+        if (t == NULL)
+        {
+            printf("Warning: Cannot allocate remap table for port %u, per-packet remap\n", p);
+            continue;
+        }
+
+        fwd_remap_build(t, p);
+        uint32_t bad = fwd_remap_check(t, p);
+        if (bad != 0)
+        {
+            printf("Warning: Port %u remap table differs from per-packet remap (%u probes), not used\n",
+                   p, bad);
+            rte_free(t);
+            continue;
+        }
+        fwd_remap[p] = t;
+        printf("  Port %u remap table: VL-ID 0..%u checked\n", p, MAX_VL_ID);
+    }
+#endif
+    return 0;
+}
+
+/**
+ * Forward worker: receives packets, processes VL-ID/VLAN remap + cross-port routing.
+ * Packets are sorted by target port before TX.
+ */
+int forward_worker(void *arg)
+{
+    struct rx_worker_params *params = (struct rx_worker_params *)arg;
+    uint16_t port_id = params->port_id;
+    uint16_t queue_id = params->queue_id;
+    volatile bool *stop_flag = params->stop_flag;
+
+    struct rte_mbuf *bufs[BURST_SIZE];
+    struct rte_mbuf *local_bufs[BURST_SIZE];
+    struct rte_mbuf *cross_bufs[BURST_SIZE];
+    uint64_t total_fwd = 0;
+    uint64_t total_drop = 0;
+    uint16_t targets[BURST_SIZE];
+    uint16_t cross_port = 0;
+    bool first_fwd = false;
+    const struct fwd_remap_table *remap = (port_id < MAX_PORTS) ? fwd_remap[port_id] : NULL;
+
+    printf("[FWD Worker] Port %u Queue %u (lcore %u) - VL-ID remap + cross-port enabled\n",
+           port_id, queue_id, rte_lcore_id());
+
+#if ADAPTIVE_POLL_ENABLED
+    struct adaptive_poll *ap = adaptive_poll_register(ADAPTIVE_POLL_FWD, port_id, queue_id,
+                                                      adaptive_poll_port_max_level(port_id));
+#endif
+
+    while (!*stop_flag) {
+        uint16_t nb_rx = rte_eth_rx_burst(port_id, queue_id, bufs, BURST_SIZE);
+#if ADAPTIVE_POLL_ENABLED
+        adaptive_poll_update(ap, nb_rx);
+#endif
+        if (unlikely(nb_rx == 0))
+            continue;
+
+        uint16_t n_local = 0, n_cross = 0;
+
+#if PACKET_TRACE_ENABLED
+        uint8_t do_trace[BURST_SIZE];
+        // Trace BEFORE remap (VL-IDX is still original)
+        for (uint16_t i = 0; i < nb_rx; i++) {
+            uint8_t *_tr = rte_pktmbuf_mtod(bufs[i], uint8_t *);
+            uint16_t _tv = ((uint16_t)_tr[4] << 8) | _tr[5];
+            uint64_t _ts; memcpy(&_ts, _tr + 46, sizeof(_ts));
+            do_trace[i] = SHOULD_TRACE_PACKET(port_id, _tv, _ts) ? 1 : 0;
+            if (do_trace[i])
+                trace_print_packet("VMC2_RX_BEFORE_REMAP", _tr, bufs[i]->pkt_len, port_id);
+        }
+#endif
+        // Remap the whole burst (VL-ID, VLAN, IP checksum, target port)
+        fwd_remap_burst(remap, bufs, nb_rx, port_id, targets);
+
+        // splitmix64 transform + sort by target port
+        for (uint16_t i = 0; i < nb_rx; i++) {
+#if IMIX_ENABLED
+            traffic_profile_count_rx(port_id, queue_id, bufs[i]->pkt_len);
+#endif
+            uint16_t target = targets[i];
+#if PACKET_TRACE_ENABLED
+            int _do_trace = do_trace[i];
+            // Trace AFTER remap, before splitmix64
+            if (_do_trace) {
+                uint8_t *_tr = rte_pktmbuf_mtod(bufs[i], uint8_t *);
+                trace_print_packet("VMC2_AFTER_REMAP", _tr, bufs[i]->pkt_len, port_id);
+            }
+#endif
+            splitmix64_transform(bufs[i]);
+#if PACKET_TRACE_ENABLED
+            // Trace AFTER splitmix64 transform (before TX)
+            if (_do_trace) {
+                uint8_t *_tr = rte_pktmbuf_mtod(bufs[i], uint8_t *);
+                trace_print_packet("VMC2_AFTER_TRANSFORM_TX", _tr, bufs[i]->pkt_len, port_id);
+            }
+#endif
+            if (target == port_id) {
+                local_bufs[n_local++] = bufs[i];
+            } else {
+                cross_bufs[n_cross++] = bufs[i];
+                cross_port = target;
+            }
+        }
+
+        // TX local packets on same port (locked: cross-port worker may also TX here)
+        if (n_local > 0) {
+            rte_spinlock_lock(&tx_queue_lock[port_id][queue_id].lock);
+            uint16_t nb_tx = rte_eth_tx_burst(port_id, queue_id, local_bufs, n_local);
+            rte_spinlock_unlock(&tx_queue_lock[port_id][queue_id].lock);
+            total_fwd += nb_tx;
+            if (unlikely(nb_tx < n_local)) {
+                total_drop += (n_local - nb_tx);
+                for (uint16_t i = nb_tx; i < n_local; i++)
+                    rte_pktmbuf_free(local_bufs[i]);
+            }
+        }
+
+        // TX cross-port packets on target port (locked: target port's worker also uses this queue)
+        if (n_cross > 0) {
+            rte_spinlock_lock(&tx_queue_lock[cross_port][queue_id].lock);
+            uint16_t nb_tx = rte_eth_tx_burst(cross_port, queue_id, cross_bufs, n_cross);
+            rte_spinlock_unlock(&tx_queue_lock[cross_port][queue_id].lock);
+            total_fwd += nb_tx;
+            if (unlikely(nb_tx < n_cross)) {
+                total_drop += (n_cross - nb_tx);
+                for (uint16_t i = nb_tx; i < n_cross; i++)
+                    rte_pktmbuf_free(cross_bufs[i]);
+            }
+        }
+
+        if (unlikely(!first_fwd && total_fwd > 0)) {
+            startup_trace_first_packet();
+            first_fwd = true;
+        }
+    }
+
+#if ADAPTIVE_POLL_ENABLED
+    adaptive_poll_release(ap);
+#endif
+
+    printf("[FWD Worker] Port %u Queue %u stopped. Forwarded: %lu, Dropped: %lu\n",
+           port_id, queue_id, total_fwd, total_drop);
+    return 0;
+}
+
+/**
+ * Start forward workers for all ports.
+ * Each worker handles one RX queue -> same TX queue on the same port.
+ */
+int start_forward_workers(struct ports_config *ports_config, volatile bool *stop_flag)
+{
+    static struct rx_worker_params fwd_params[MAX_PORTS * NUM_RX_CORES];
+    uint16_t param_idx = 0;
+
+    // Initialize per-port per-queue TX locks for cross-port thread safety
+    if (init_tx_queue_locks(ports_config) != 0)
+    {
+        printf("Error: Cannot allocate forward TX queue locks\n");
+        return -1;
+    }
+
+    printf("\n=== Starting Forward Workers (VMC_2 Loopback Mode) ===\n");
+
+    if (init_fwd_remap_tables(ports_config) != 0)
+    {
+        printf("Error: Cross-port forward targets without TX queues, fix r2_fwd_port\n");
+        return -1;
+    }
+
+    for (uint16_t port_idx = 0; port_idx < ports_config->nb_ports; port_idx++)
+    {
+        struct port *port = &ports_config->ports[port_idx];
+        uint16_t port_id = port->port_id;
+
+        printf("\n--- Port %u Forward (RX -> TX loopback) ---\n", port_id);
+
+#if RX_FLOW_STEERING
+        // One RX queue per VL-ID: forwarded in arrival order per VL
+        rx_flow_steer_install(port_id, port_id);
+#endif
+
+        for (uint16_t q = 0; q < NUM_RX_CORES; q++)
+        {
+            uint16_t lcore_id = port->used_rx_cores[q];
+
+            if (lcore_id == 0 || lcore_id >= RTE_MAX_LCORE)
+            {
+                printf("Warning: Invalid lcore %u for port %u queue %u\n",
+                       lcore_id, port_id, q);
+                continue;
+            }
+
+            fwd_params[param_idx].port_id = port_id;
+            fwd_params[param_idx].src_port_id = port_id;
+            fwd_params[param_idx].queue_id = q;
+            fwd_params[param_idx].lcore_id = lcore_id;
+            fwd_params[param_idx].stop_flag = stop_flag;
+
+            printf("  FWD Queue %u -> Lcore %2u (RX Q%u -> TX Q%u)\n",
+                   q, lcore_id, q, q);
+
+            int ret = rte_eal_remote_launch(forward_worker,
+                                            &fwd_params[param_idx],
+                                            lcore_id);
+            if (ret != 0)
+            {
+                printf("Error launching forward worker on lcore %u: %d\n", lcore_id, ret);
+                return ret;
+            }
+            else
+            {
+                printf("    > Forward Worker launched successfully\n");
+            }
+
+            param_idx++;
+        }
+    }
+
+    printf("\n>>> All forward workers started. VMC_2 is in loopback mode.\n");
+    return 0;
+}
@@ -0,0 +1,192 @@
+/**
+ * Per-(raw port, VL-ID) sequence tracker
+ *
+ * Writers are the raw socket RX workers (vl_seq_update, inline in the
+ * header), one shard each. Everything here runs on the init / stats
+ * thread: registration, reset and the merge on read.
+ */
+
+#include "vl_seq_tracker.h"
+
+#include <stdio.h>
+#include <string.h>
+
+struct vl_seq_port vl_seq_ports[VL_SEQ_MAX_PORTS];
+uint32_t vl_seq_epoch = 1;
+
+int vl_seq_add_range(int raw_index, uint16_t vl_start, uint16_t vl_count)
+{
+    if (raw_index < 0 || raw_index >= VL_SEQ_MAX_PORTS)
+        return -1;
+
+    struct vl_seq_port *tp = &vl_seq_ports[raw_index];
+
+    for (uint32_t vl = vl_start; vl < (uint32_t)vl_start + vl_count && vl < VL_SEQ_VL_MAP_SIZE; vl++) {
+        if (tp->slot_of_vl[vl] != 0)
+            continue;
+        if (tp->nb_slots >= VL_SEQ_MAX_VLS) {
+            printf("[VL-SEQ] Raw port index %d: slot table full (%d), VL-ID %u+ not tracked\n",
+                   raw_index, VL_SEQ_MAX_VLS, vl);
+            return -1;
+        }
+        tp->slot_vl_id[tp->nb_slots] = (uint16_t)vl;
+        tp->slot_of_vl[vl] = ++tp->nb_slots;
+    }
+    return 0;
+}
+
+void vl_seq_clear(void)
+{
+    uint32_t epoch = __atomic_add_fetch(&vl_seq_epoch, 1, __ATOMIC_RELAXED);
+
+    for (int p = 0; p < VL_SEQ_MAX_PORTS; p++) {
+        struct vl_seq_port *tp = &vl_seq_ports[p];
+        memset(tp->slot_of_vl, 0, sizeof(tp->slot_of_vl));
+        tp->nb_slots = 0;
+        for (int s = 0; s < VL_SEQ_MAX_SHARDS; s++)
+            vl_seq_shard_clear(&tp->shards[s], epoch);
+    }
+}
+
+void vl_seq_reset(void)
+{
+    __atomic_add_fetch(&vl_seq_epoch, 1, __ATOMIC_RELEASE);
+}
+
+// One slot merged over every shard of the current epoch
+static bool merge_slot(const struct vl_seq_port *tp, int slot, uint32_t epoch,
+                       uint64_t *min_s, uint64_t *max_s, uint64_t *rx, uint64_t *late)
+{
+    *min_s = UINT64_MAX;
+    *max_s = 0;
+    *rx = 0;
+    *late = 0;
+
+    for (int s = 0; s < VL_SEQ_MAX_SHARDS; s++) {
+        const struct vl_seq_shard *sh = &tp->shards[s];
+        if (__atomic_load_n(&sh->epoch, __ATOMIC_ACQUIRE) != epoch)
+            continue;
+
+        const struct vl_seq_slot *sl = &sh->slots[slot];
+        uint64_t mn = __atomic_load_n(&sl->min_seq, __ATOMIC_ACQUIRE);
+        uint64_t mx = __atomic_load_n(&sl->max_seq, __ATOMIC_ACQUIRE);
+        uint64_t cnt = __atomic_load_n(&sl->rx_count, __ATOMIC_RELAXED);
+        if (cnt == 0 || mn == UINT64_MAX)
+            continue;
+
+        if (mn < *min_s) *min_s = mn;
+        if (mx > *max_s) *max_s = mx;
+        *rx += cnt;
+        *late += __atomic_load_n(&sl->late, __ATOMIC_RELAXED);
+    }
+    return *rx > 0;
+}
+
+static void add_slot(const struct vl_seq_port *tp, int slot, uint32_t epoch,
+                     struct vl_seq_totals *out)
+{
+    uint64_t min_s, max_s, rx, late;
+
+    if (!merge_slot(tp, slot, epoch, &min_s, &max_s, &rx, &late))
+        return;
+
+    uint64_t span = max_s - min_s + 1;
+    out->rx += rx;
+    out->reordered += late;
+    out->active_vls++;
+    if (span > rx)
+        out->lost += span - rx;
+    else
+        out->duplicates += rx - span;
+}
+
+void vl_seq_read(int raw_index, uint16_t vl_start, uint16_t vl_count,
+                 struct vl_seq_totals *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (raw_index < 0 || raw_index >= VL_SEQ_MAX_PORTS)
+        return;
+
+    const struct vl_seq_port *tp = &vl_seq_ports[raw_index];
+    uint32_t epoch = __atomic_load_n(&vl_seq_epoch, __ATOMIC_ACQUIRE);
+
+    for (uint32_t vl = vl_start; vl < (uint32_t)vl_start + vl_count && vl < VL_SEQ_VL_MAP_SIZE; vl++) {
+        uint16_t s = tp->slot_of_vl[vl];
+        if (s != 0)
+            add_slot(tp, s - 1, epoch, out);
+    }
+}
+
+void vl_seq_read_port(int raw_index, struct vl_seq_totals *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (raw_index < 0 || raw_index >= VL_SEQ_MAX_PORTS)
+        return;
+
+    const struct vl_seq_port *tp = &vl_seq_ports[raw_index];
+    uint32_t epoch = __atomic_load_n(&vl_seq_epoch, __ATOMIC_ACQUIRE);
+
+    for (int s = 0; s < tp->nb_slots; s++)
+        add_slot(tp, s, epoch, out);
+}
+
+void vl_seq_print_debug(int raw_index, uint16_t port_id)
+{
+    if (raw_index < 0 || raw_index >= VL_SEQ_MAX_PORTS)
+        return;
+
+    const struct vl_seq_port *tp = &vl_seq_ports[raw_index];
+    uint32_t epoch = __atomic_load_n(&vl_seq_epoch, __ATOMIC_ACQUIRE);
+    uint64_t shard_rx[VL_SEQ_MAX_SHARDS] = {0};
+    int printed = 0;
+    int with_loss = 0;
+    uint16_t worst_vl = 0;
+    uint64_t worst_lost = 0;
+
+    printf("  Port %u Sequence Debug (first 5 active VL-IDs, %u tracked):\n", port_id, tp->nb_slots);
+
+    for (int s = 0; s < tp->nb_slots; s++) {
+        uint64_t min_s, max_s, rx, late;
+        if (!merge_slot(tp, s, epoch, &min_s, &max_s, &rx, &late))
+            continue;
+
+        uint64_t expected = max_s - min_s + 1;
+        uint64_t lost = expected > rx ? expected - rx : 0;
+
+        if (printed < 5) {
+            printf("    VL-ID %u: min=%lu max=%lu rx=%lu expected=%lu lost=%lu late=%lu\n",
+                   tp->slot_vl_id[s], min_s, max_s, rx, expected, lost, late);
+            printed++;
+        }
+        if (lost > 0) {
+            with_loss++;
+            if (lost > worst_lost) {
+                worst_lost = lost;
+                worst_vl = tp->slot_vl_id[s];
+            }
+        }
+    }
+
+    if (printed == 0) {
+        printf("    (no VL-IDs initialized yet)\n");
+        return;
+    }
+
+    for (int sh = 0; sh < VL_SEQ_MAX_SHARDS; sh++) {
+        if (__atomic_load_n(&tp->shards[sh].epoch, __ATOMIC_ACQUIRE) != epoch)
+            continue;
+        for (int s = 0; s < tp->nb_slots; s++)
+            shard_rx[sh] += __atomic_load_n(&tp->shards[sh].slots[s].rx_count, __ATOMIC_RELAXED);
+    }
+    printf("    RX per fanout worker:");
+    for (int sh = 0; sh < VL_SEQ_MAX_SHARDS; sh++) {
+        if (shard_rx[sh] > 0)
+            printf(" Q%d=%lu", sh, shard_rx[sh]);
+    }
+    printf("\n");
+
+    if (with_loss > 0) {
+        printf("    ⚠️  %d VL-IDs have loss, worst: VL-ID %u with %lu lost\n",
+               with_loss, worst_vl, worst_lost);
+    }
+}
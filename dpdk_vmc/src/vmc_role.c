@@ -0,0 +1,26 @@
+#include "vmc_role.h"
+
+#include <string.h>
+
+enum vmc_role g_vmc_role = VMC_ROLE_DEFAULT;
+
+void vmc_role_set(enum vmc_role role)
+{
+    g_vmc_role = role;
+}
+
+int vmc_role_parse(const char *name, enum vmc_role *role)
+{
+    if (strcmp(name, "verifier") == 0 || strcmp(name, "vmc1") == 0)
+        *role = VMC_ROLE_VERIFIER;
+    else if (strcmp(name, "forwarder") == 0 || strcmp(name, "vmc2") == 0)
+        *role = VMC_ROLE_FORWARDER;
+    else
+        return -1;
+    return 0;
+}
+
+const char *vmc_role_name(enum vmc_role role)
+{
+    return role == VMC_ROLE_FORWARDER ? "forwarder" : "verifier";
+}
@@ -0,0 +1,530 @@
+/**
+ * Secondary process stats reader
+ *
+ * Attaches to a running dpdk_app (STATS_SHM_ENABLED=1) as a DPDK secondary
+ * process and samples its counters at a fixed interval, writing totals and
+ * per-second rates as CSV or JSON lines:
+ *
+ *   port     HW counters (rte_eth_stats_get), RX verification counters
+ *            (rx_stats_per_port), VL-ID tracker watermarks (--vl)
+ *   raw      raw socket port TX / RX / PRBS / loss counters
+ *   replay   pcap replay frames / drops + timing error p99 / max (REPLAY=1)
+ *   latency  latency test and embedded latency results (once, when published)
+ *
+ * Read-only: plain loads of the shared counters, no lock, no CAS, no write
+ * into the primary's memory, so the primary's workers are not slowed
+ * beyond the cache lines this process reads. Must be built with the same
+ * options as the primary (the memzone layout is checked on attach).
+ *
+ * Usage (make stats-reader):
+ *   sudo ./dpdk_app-stats -l <free lcore> --proc-type=secondary [--file-prefix P] -- \
+ *        [--interval-ms N] [--count N] [--format csv|json] [--out FILE] [--vl] [--no-hw]
+ *   --interval-ms  sample period (default 100, min 1)
+ *   --count        samples, 0 = until Ctrl+C (default 0)
+ *   --format       csv: t_s,kind,id,metric,value,rate rows; json: one object per sample
+ *   --out          output file (default stdout)
+ *   --vl           scan the VL-ID trackers (active VL-IDs, watermark loss)
+ *   --no-hw        skip rte_eth_stats_get (PMDs without secondary stats)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <errno.h>
+#include <rte_eal.h>
+#include <rte_ethdev.h>
+#include <rte_memzone.h>
+
+#include "stats_shm.h"
+
+#define READER_MAX_METRICS 4096
+
+static volatile bool reader_quit = false;
+
+static const struct stats_shm_dir *dir;
+
+// Output state: metrics are emitted in the same order every sample, the
+// slot index finds the previous value for the rate
+static FILE *out;
+static bool out_json;
+static bool group_open;
+static bool first_group;
+static double sample_t;
+static double sample_dt;
+static const char *group_kind;
+static unsigned group_id;
+static unsigned slot;
+static uint64_t prev_values[READER_MAX_METRICS];
+static bool have_prev;
+
+static void reader_signal(int sig)
+{
+    (void)sig;
+    reader_quit = true;
+}
+
+static double mono_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// ==========================================
+// OUTPUT
+// ==========================================
+
+static void emit_begin_sample(double t, double dt)
+{
+    sample_t = t;
+    sample_dt = dt;
+    slot = 0;
+    first_group = true;
+    if (out_json)
+        fprintf(out, "{\"t\":%.6f,\"groups\":[", t);
+}
+
+static void emit_begin_group(const char *kind, unsigned id)
+{
+    group_kind = kind;
+    group_id = id;
+    group_open = true;
+    if (out_json)
+    {
+        fprintf(out, "%s{\"kind\":\"%s\",\"id\":%u", first_group ? "" : ",", kind, id);
+        first_group = false;
+    }
+}
+
+static void emit_end_group(void)
+{
+    if (out_json && group_open)
+        fprintf(out, "}");
+    group_open = false;
+}
+
+static void emit_end_sample(void)
+{
+    if (out_json)
+        fprintf(out, "]}\n");
+    fflush(out);
+    have_prev = true;
+}
+
+// Counter: total + rate over the last interval (0 after a reset / first sample)
+static void emit_counter(const char *name, uint64_t value)
+{
+    double rate = 0;
+    if (slot < READER_MAX_METRICS)
+    {
+        if (have_prev && value >= prev_values[slot] && sample_dt > 0)
+            rate = (value - prev_values[slot]) / sample_dt;
+        prev_values[slot] = value;
+    }
+    slot++;
+
+    if (out_json)
+        fprintf(out, ",\"%s\":%lu,\"%s_rate\":%.1f", name, value, name, rate);
+    else
+        fprintf(out, "%.6f,%s,%u,%s,%lu,%.1f\n", sample_t, group_kind, group_id, name, value, rate);
+}
+
+// Gauge: value only
+static void emit_gauge(const char *name, double value)
+{
+    slot++;
+    if (out_json)
+        fprintf(out, ",\"%s\":%.3f", name, value);
+    else
+        fprintf(out, "%.6f,%s,%u,%s,%.3f,\n", sample_t, group_kind, group_id, name, value);
+}
+
+// ==========================================
+// SOURCES
+// ==========================================
+
+static void sample_port(uint16_t port_id, bool hw, bool vl)
+{
+    emit_begin_group("port", port_id);
+
+    if (hw)
+    {
+        struct rte_eth_stats st;
+        if (rte_eth_stats_get(port_id, &st) == 0)
+        {
+            emit_counter("hw_rx_pkts", st.ipackets);
+            emit_counter("hw_tx_pkts", st.opackets);
+            emit_counter("hw_rx_bytes", st.ibytes);
+            emit_counter("hw_tx_bytes", st.obytes);
+            emit_counter("hw_rx_missed", st.imissed);
+            emit_counter("hw_rx_errors", st.ierrors);
+        }
+    }
+
+    const struct rx_stats *rs = &dir->rx_stats[port_id];
+    emit_counter("rx_pkts", (uint64_t)rte_atomic64_read((rte_atomic64_t *)&rs->total_rx_pkts));
+    emit_counter("good_pkts", (uint64_t)rte_atomic64_read((rte_atomic64_t *)&rs->good_pkts));
+    emit_counter("bad_pkts", (uint64_t)rte_atomic64_read((rte_atomic64_t *)&rs->bad_pkts));
+    emit_counter("bit_errors", (uint64_t)rte_atomic64_read((rte_atomic64_t *)&rs->bit_errors));
+    emit_counter("lost_pkts", (uint64_t)rte_atomic64_read((rte_atomic64_t *)&rs->lost_pkts));
+    emit_counter("out_of_order_pkts", (uint64_t)rte_atomic64_read((rte_atomic64_t *)&rs->out_of_order_pkts));
+    emit_counter("duplicate_pkts", (uint64_t)rte_atomic64_read((rte_atomic64_t *)&rs->duplicate_pkts));
+    emit_counter("short_pkts", (uint64_t)rte_atomic64_read((rte_atomic64_t *)&rs->short_pkts));
+    emit_counter("external_pkts", (uint64_t)rte_atomic64_read((rte_atomic64_t *)&rs->external_pkts));
+
+    const struct port_vl_tracker *trk = dir->vl_trackers[port_id];
+    if (vl && trk != NULL)
+    {
+        // Same watermark loss as the queue 0 RX worker computes at exit
+        uint64_t active = 0, tracked = 0, lost = 0;
+        for (uint16_t v = 0; v <= MAX_VL_ID; v++)
+        {
+            const struct vl_sequence_tracker *t = &trk->vl_trackers[v];
+            if (!__atomic_load_n(&t->initialized, __ATOMIC_ACQUIRE))
+                continue;
+            uint64_t max_seq = __atomic_load_n(&t->max_seq, __ATOMIC_RELAXED);
+            uint64_t pkt_count = __atomic_load_n(&t->pkt_count, __ATOMIC_RELAXED);
+#if TOKEN_BUCKET_TX_ENABLED
+            uint64_t expected = max_seq - __atomic_load_n(&t->min_seq, __ATOMIC_RELAXED) + 1;
+#else
+            uint64_t expected = max_seq + 1;
+#endif
+            active++;
+            tracked += pkt_count;
+            if (expected > pkt_count)
+                lost += expected - pkt_count;
+        }
+        emit_gauge("vl_active", (double)active);
+        emit_counter("vl_rx_pkts", tracked);
+        emit_counter("vl_lost_pkts", lost);
+    }
+
+    emit_end_group();
+}
+
+static void sample_raw(int i)
+{
+    const struct raw_socket_port *rp = &dir->raw_ports[i];
+    uint64_t tx_pkts = 0, tx_bytes = 0, tx_errors = 0;
+    uint64_t rx_pkts = 0, rx_bytes = 0, good = 0, bad = 0, bits = 0, lost = 0;
+
+    for (uint16_t t = 0; t < rp->tx_target_count && t < MAX_RAW_TARGETS; t++)
+    {
+        const struct raw_target_stats *s = &rp->tx_targets[t].stats;
+        tx_pkts += s->tx_packets;
+        tx_bytes += s->tx_bytes;
+        tx_errors += s->tx_errors;
+    }
+    for (uint16_t s_idx = 0; s_idx < rp->rx_source_count && s_idx < MAX_RAW_TARGETS; s_idx++)
+    {
+        const struct raw_target_stats *s = &rp->rx_sources[s_idx].stats;
+        rx_pkts += s->rx_packets;
+        rx_bytes += s->rx_bytes;
+        good += s->good_pkts;
+        bad += s->bad_pkts;
+        bits += s->bit_errors;
+        lost += s->lost_pkts;
+    }
+
+    emit_begin_group("raw", rp->port_id);
+    emit_counter("tx_pkts", tx_pkts);
+    emit_counter("tx_bytes", tx_bytes);
+    emit_counter("tx_errors", tx_errors);
+    emit_counter("rx_pkts", rx_pkts);
+    emit_counter("rx_bytes", rx_bytes);
+    emit_counter("good_pkts", good);
+    emit_counter("bad_pkts", bad);
+    emit_counter("bit_errors", bits);
+    emit_counter("lost_pkts", lost);
+    emit_counter("dpdk_ext_rx_pkts", rp->dpdk_ext_rx_stats.rx_packets);
+    emit_end_group();
+}
+
+#if PCAP_REPLAY_ENABLED
+static void sample_replay(uint16_t port_id)
+{
+    static uint64_t hist[REPLAY_HIST_BUCKETS];
+    uint64_t frames = 0, bytes = 0, drops = 0, err_max = 0, total = 0;
+
+    memset(hist, 0, sizeof(hist));
+    for (int q = 0; q < NUM_TX_CORES; q++)
+    {
+        const struct replay_stats *st = &dir->replay_stats[port_id][q];
+        frames += st->frames;
+        bytes += st->bytes;
+        drops += st->drops;
+        if (st->err_max_ns > err_max)
+            err_max = st->err_max_ns;
+        for (uint32_t b = 0; b < REPLAY_HIST_BUCKETS; b++)
+            hist[b] += st->hist[b];
+    }
+
+    uint64_t p99 = 0, cum = 0;
+    for (uint32_t b = 0; b < REPLAY_HIST_BUCKETS; b++)
+        total += hist[b];
+    for (uint32_t b = 0; b < REPLAY_HIST_BUCKETS && total > 0; b++)
+    {
+        cum += hist[b];
+        if (cum * 100 >= total * 99)
+        {
+            p99 = replay_hist_bucket_max(b);
+            break;
+        }
+    }
+
+    emit_begin_group("replay", port_id);
+    emit_counter("frames", frames);
+    emit_counter("bytes", bytes);
+    emit_counter("drops", drops);
+    emit_gauge("err_p99_ns", (double)p99);
+    emit_gauge("err_max_ns", (double)err_max);
+    emit_end_group();
+}
+#endif
+
+static void sample_latency(void)
+{
+#if LATENCY_TEST_ENABLED
+    for (uint16_t i = 0; i < dir->nb_ports; i++)
+    {
+        uint16_t port_id = dir->port_ids[i];
+        const struct port_latency_test *pl = &dir->latency_test.ports[port_id];
+        double min_us = 0, max_us = 0, sum_us = 0;
+        unsigned received = 0;
+
+        for (uint16_t v = 0; v < pl->test_count && v < MAX_LATENCY_TESTS_PER_PORT; v++)
+        {
+            const struct latency_result *r = &pl->results[v];
+            if (!r->received)
+                continue;
+            if (received == 0 || r->min_latency_us < min_us)
+                min_us = r->min_latency_us;
+            if (r->max_latency_us > max_us)
+                max_us = r->max_latency_us;
+            sum_us += r->latency_us;
+            received++;
+        }
+        if (pl->test_count == 0)
+            continue;
+
+        emit_begin_group("latency", port_id);
+        emit_gauge("tests", pl->test_count);
+        emit_gauge("received", received);
+        emit_gauge("min_us", min_us);
+        emit_gauge("avg_us", received ? sum_us / received : 0);
+        emit_gauge("max_us", max_us);
+        emit_end_group();
+    }
+#endif
+
+    const struct emb_latency_state *emb = &dir->emb_latency;
+    for (uint32_t i = 0; i < emb->combined_count && i < EMB_LAT_MAX_PORT_PAIRS; i++)
+    {
+        const struct emb_combined_latency *c = &emb->combined[i];
+        emit_begin_group("emb_latency", c->tx_port);
+        emit_gauge("rx_port", c->rx_port);
+        emit_gauge("total_us", c->total_latency_us);
+        emit_gauge("switch_us", c->switch_latency_us);
+        emit_gauge("unit_us", c->unit_valid ? c->unit_latency_us : 0);
+        emit_gauge("passed", c->passed);
+        emit_end_group();
+    }
+}
+
+// ==========================================
+// ATTACH
+// ==========================================
+
+static int attach(void)
+{
+    const struct rte_memzone *mz = rte_memzone_lookup(STATS_SHM_DIR_NAME);
+    if (mz == NULL)
+    {
+        fprintf(stderr, "Error: memzone %s not found (primary not running, or STATS_SHM_ENABLED=0)\n",
+                STATS_SHM_DIR_NAME);
+        return -1;
+    }
+    dir = mz->addr;
+
+    if (dir->magic != STATS_SHM_MAGIC || dir->version != STATS_SHM_VERSION)
+    {
+        fprintf(stderr, "Error: %s magic %08x version %u, expected %08x version %u\n",
+                STATS_SHM_DIR_NAME, dir->magic, dir->version, STATS_SHM_MAGIC, STATS_SHM_VERSION);
+        return -1;
+    }
+
+    const struct stats_shm_layout *l = &dir->layout;
+    if (l->max_ports != MAX_PORTS || l->max_vl_id != MAX_VL_ID ||
+        l->num_tx_cores != NUM_TX_CORES || l->num_rx_cores != NUM_RX_CORES ||
+        l->max_raw_ports != MAX_RAW_SOCKET_PORTS || l->max_raw_targets != MAX_RAW_TARGETS ||
+        l->dir_size != sizeof(struct stats_shm_dir) ||
+        l->rx_stats_size != sizeof(struct rx_stats) ||
+        l->vl_tracker_size != sizeof(struct port_vl_tracker) ||
+        l->raw_port_size != sizeof(struct raw_socket_port))
+    {
+        fprintf(stderr, "Error: primary built with other sizes (ports %u, VL-ID %u, TX %u / RX %u cores, "
+                "dir %u B); rebuild the reader with the primary's options\n",
+                l->max_ports, l->max_vl_id, l->num_tx_cores, l->num_rx_cores, l->dir_size);
+        return -1;
+    }
+
+    // Workers not started yet: wait for the port list
+    while (!dir->ready && !reader_quit)
+    {
+        struct timespec ts = {.tv_sec = 0, .tv_nsec = 100 * 1000 * 1000};
+        nanosleep(&ts, NULL);
+    }
+    rte_smp_rmb();
+
+    fprintf(stderr, "Attached to primary pid %d: %u DPDK ports, %d raw ports%s\n",
+            dir->primary_pid, dir->nb_ports, dir->raw_ports ? dir->raw_port_count : 0,
+#if PCAP_REPLAY_ENABLED
+            dir->replay_stats ? ", pcap replay" : ""
+#else
+            ""
+#endif
+            );
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s <EAL args> --proc-type=secondary -- [--interval-ms N] [--count N] "
+            "[--format csv|json] [--out FILE] [--vl] [--no-hw]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    int ret = rte_eal_init(argc, argv);
+    if (ret < 0)
+    {
+        fprintf(stderr, "Error with EAL initialization\n");
+        return 1;
+    }
+    argc -= ret;
+    argv += ret;
+
+    if (rte_eal_process_type() != RTE_PROC_SECONDARY)
+    {
+        fprintf(stderr, "Error: run with --proc-type=secondary (a primary would own the ports)\n");
+        rte_eal_cleanup();
+        return 1;
+    }
+
+    unsigned interval_ms = 100;
+    uint64_t count = 0;
+    bool hw = true, vl = false;
+    const char *out_path = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--interval-ms") && i + 1 < argc)
+            interval_ms = (unsigned)strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--count") && i + 1 < argc)
+            count = strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--format") && i + 1 < argc)
+            out_json = !strcmp(argv[++i], "json");
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc)
+            out_path = argv[++i];
+        else if (!strcmp(argv[i], "--vl"))
+            vl = true;
+        else if (!strcmp(argv[i], "--no-hw"))
+            hw = false;
+        else
+        {
+            usage(argv[0]);
+            rte_eal_cleanup();
+            return 2;
+        }
+    }
+    if (interval_ms == 0)
+        interval_ms = 1;
+
+    signal(SIGINT, reader_signal);
+    signal(SIGTERM, reader_signal);
+
+    out = stdout;
+    if (out_path != NULL && (out = fopen(out_path, "w")) == NULL)
+    {
+        fprintf(stderr, "Error: Cannot open %s: %s\n", out_path, strerror(errno));
+        rte_eal_cleanup();
+        return 1;
+    }
+
+    if (attach() != 0 || reader_quit)
+    {
+        if (out != stdout)
+            fclose(out);
+        rte_eal_cleanup();
+        return 1;
+    }
+
+    if (!out_json)
+        fprintf(out, "t_s,kind,id,metric,value,rate\n");
+
+    // Absolute deadlines: the period does not drift with the sampling cost
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    double t0 = mono_s(), prev_t = t0;
+    uint32_t latency_seq = 0;
+    uint64_t samples = 0;
+    uint64_t overruns = 0;
+
+    while (!reader_quit && (count == 0 || samples < count))
+    {
+        double now = mono_s();
+        emit_begin_sample(now - t0, now - prev_t);
+        prev_t = now;
+
+        for (uint16_t i = 0; i < dir->nb_ports; i++)
+            sample_port(dir->port_ids[i], hw, vl);
+        if (dir->raw_ports != NULL)
+            for (int i = 0; i < dir->raw_port_count && i < MAX_RAW_SOCKET_PORTS; i++)
+                sample_raw(i);
+#if PCAP_REPLAY_ENABLED
+        if (dir->replay_stats != NULL)
+            for (uint16_t i = 0; i < dir->nb_ports; i++)
+                sample_replay(dir->port_ids[i]);
+#endif
+
+        // Latency results: once per stable (even) copy
+        uint32_t seq = dir->latency_seq;
+        rte_smp_rmb();
+        if (!(seq & 1) && seq != latency_seq)
+        {
+            uint32_t metrics = slot;
+            sample_latency();
+            slot = metrics;     // One-shot groups do not shift the counter slots
+            latency_seq = seq;
+        }
+
+        emit_end_sample();
+        samples++;
+
+        next.tv_nsec += (long)interval_ms * 1000000L;
+        while (next.tv_nsec >= 1000000000L)
+        {
+            next.tv_nsec -= 1000000000L;
+            next.tv_sec++;
+        }
+        struct timespec cur;
+        clock_gettime(CLOCK_MONOTONIC, &cur);
+        if (cur.tv_sec > next.tv_sec || (cur.tv_sec == next.tv_sec && cur.tv_nsec > next.tv_nsec))
+        {
+            overruns++;
+            next = cur;     // Sampling slower than the period: restart from now
+        }
+        else
+        {
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+        }
+    }
+
+    fprintf(stderr, "%lu samples, %lu over the %u ms period\n", samples, overruns, interval_ms);
+    if (out != stdout)
+        fclose(out);
+    rte_eal_cleanup();
+    return 0;
+}
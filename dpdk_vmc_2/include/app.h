@@ -1,16 +0,0 @@
-#ifndef APP_H
-#define APP_H
-
-#include <stdint.h>
-
-/**
- * Application configuration structure
- * Can be extended with application-specific settings
- */
-struct app_config
-{
-    uint16_t app_id;
-    // Add more application-specific configuration here
-};
-
-#endif /* APP_H */
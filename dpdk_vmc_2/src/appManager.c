@@ -1,2 +0,0 @@
-#include "app.h"
-
@@ -1,156 +0,0 @@
-#include "helpers.h"
-
-#include <stdio.h>
-#include <string.h>
-#include <stdbool.h>
-#include <rte_ethdev.h>
-#include <rte_atomic.h>
-
-#include "config.h"
-#include "tx_rx_manager.h"  // rx_stats_per_port için
-#include "dpdk_external_tx.h" // External TX stats için
-#include "raw_socket_port.h"  // reset_raw_socket_stats için
-
-// Daemon mode flag - when true, ANSI escape codes are disabled
-bool g_daemon_mode = false;
-
-void helper_set_daemon_mode(bool enabled) {
-    g_daemon_mode = enabled;
-}
-
-// Yardımcı fonksiyonlar
-static inline double to_gbps(uint64_t bytes) {
-    return (bytes * 8.0) / 1e9;
-}
-
-void helper_reset_stats(const struct ports_config *ports_config,
-                        uint64_t prev_tx_bytes[], uint64_t prev_rx_bytes[])
-{
-    // HW istatistiklerini resetle ve prev_* sayaçlarını sıfırla
-    for (uint16_t i = 0; i < ports_config->nb_ports; i++) {
-        uint16_t port_id = ports_config->ports[i].port_id;
-        rte_eth_stats_reset(port_id);
-        prev_tx_bytes[port_id] = 0;
-        prev_rx_bytes[port_id] = 0;
-    }
-
-    // RX doğrulama istatistikleri (PRBS) sıfırla
-    init_rx_stats();
-
-    // Raw socket ve global sequence tracking sıfırla
-    reset_raw_socket_stats();
-}
-
-void helper_print_stats(const struct ports_config *ports_config,
-                        const uint64_t prev_tx_bytes[], const uint64_t prev_rx_bytes[],
-                        bool warmup_complete, unsigned loop_count, unsigned test_time)
-{
-    // Ekranı temizle (sadece interaktif modda, daemon modda log dosyası için devre dışı)
-    if (!g_daemon_mode) {
-        printf("\033[2J\033[H");
-    } else {
-        // Daemon modda: Tablolar arasında ayırıcı satır
-        printf("\n========== [%s %u sn] ==========\n",
-               warmup_complete ? "TEST" : "WARM-UP",
-               warmup_complete ? test_time : loop_count);
-    }
-
-    // Başlık (240 karakter genişlik)
-    printf("╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗\n");
-    if (!warmup_complete) {
-        printf("║                                                                    WARM-UP PHASE (%3u/120 sn) - İstatistikler 120 saniyede sıfırlanacak                                                                                        ║\n", loop_count);
-    } else {
-        printf("║                                                                    TEST DEVAM EDİYOR - Test Süresi: %5u sn                                                                                                                    ║\n", test_time);
-    }
-    printf("╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝\n\n");
-
-    // Ana istatistik tablosu (240 karakter)
-    printf("┌──────┬─────────────────────────────────────────────────────────────────────┬─────────────────────────────────────────────────────────────────────┬───────────────────────────────────────────────────────────────────────────────────────────────────┐\n");
-    printf("│ Port │                            TX (Gönderilen)                          │                            RX (Alınan)                              │                                      PRBS Doğrulama                                               │\n");
-    printf("│      ├─────────────────────┬─────────────────────┬─────────────────────────┼─────────────────────┬─────────────────────┬─────────────────────────┼─────────────────────┬─────────────────────┬─────────────────────┬─────────────────────┬─────────────┤\n");
-    printf("│      │       Packets       │        Bytes        │          Gbps           │       Packets       │        Bytes        │          Gbps           │        Good         │         Bad         │        Lost         │      Bit Error      │     BER     │\n");
-    printf("├──────┼─────────────────────┼─────────────────────┼─────────────────────────┼─────────────────────┼─────────────────────┼─────────────────────────┼─────────────────────┼─────────────────────┼─────────────────────┼─────────────────────┼─────────────┤\n");
-
-    struct rte_eth_stats st;
-
-    for (uint16_t i = 0; i < ports_config->nb_ports; i++) {
-        uint16_t port_id = ports_config->ports[i].port_id;
-
-        if (rte_eth_stats_get(port_id, &st) != 0) {
-            printf("│  %2u  │         N/A         │         N/A         │           N/A           │         N/A         │         N/A         │           N/A           │         N/A         │         N/A         │         N/A         │         N/A         │     N/A     │\n", port_id);
-            continue;
-        }
-
-        // HW istatistikleri
-        uint64_t tx_pkts = st.opackets;
-        uint64_t tx_bytes = st.obytes;
-        uint64_t rx_pkts = st.ipackets;
-        uint64_t rx_bytes = st.ibytes;
-
-        // Per-second rate hesaplama
-        uint64_t tx_bytes_delta = tx_bytes - prev_tx_bytes[port_id];
-        uint64_t rx_bytes_delta = rx_bytes - prev_rx_bytes[port_id];
-        double tx_gbps = to_gbps(tx_bytes_delta);
-        double rx_gbps = to_gbps(rx_bytes_delta);
-
-        // PRBS doğrulama istatistikleri
-        uint64_t good = rte_atomic64_read(&rx_stats_per_port[port_id].good_pkts);
-        uint64_t bad = rte_atomic64_read(&rx_stats_per_port[port_id].bad_pkts);
-        uint64_t lost = rte_atomic64_read(&rx_stats_per_port[port_id].lost_pkts);
-        uint64_t bit_errors = rte_atomic64_read(&rx_stats_per_port[port_id].bit_errors);
-
-        // Bit Error Rate (BER) hesaplama
-        double ber = 0.0;
-        uint64_t total_bits = rx_bytes * 8;
-        if (total_bits > 0) {
-            ber = (double)bit_errors / (double)total_bits;
-        }
-
-        // Tabloyu yazdır
-        printf("│  %2u  │ %19lu │ %19lu │ %23.2f │ %19lu │ %19lu │ %23.2f │ %19lu │ %19lu │ %19lu │ %19lu │ %11.2e │\n",
-               port_id,
-               tx_pkts, tx_bytes, tx_gbps,
-               rx_pkts, rx_bytes, rx_gbps,
-               good, bad, lost, bit_errors, ber);
-    }
-
-    printf("└──────┴─────────────────────┴─────────────────────┴─────────────────────────┴─────────────────────┴─────────────────────┴─────────────────────────┴─────────────────────┴─────────────────────┴─────────────────────┴─────────────────────┴─────────────┘\n");
-
-    // Uyarılar
-    bool has_warning = false;
-    for (uint16_t i = 0; i < ports_config->nb_ports; i++) {
-        uint16_t port_id = ports_config->ports[i].port_id;
-
-        uint64_t bad_pkts = rte_atomic64_read(&rx_stats_per_port[port_id].bad_pkts);
-        uint64_t bit_errors = rte_atomic64_read(&rx_stats_per_port[port_id].bit_errors);
-        uint64_t lost_pkts = rte_atomic64_read(&rx_stats_per_port[port_id].lost_pkts);
-
-        if (bad_pkts > 0 || bit_errors > 0 || lost_pkts > 0) {
-            if (!has_warning) {
-                printf("\n  UYARILAR:\n");
-                has_warning = true;
-            }
-            if (bad_pkts > 0) {
-                printf("      Port %u: %lu bad paket tespit edildi!\n", port_id, bad_pkts);
-            }
-            if (bit_errors > 0) {
-                printf("      Port %u: %lu bit hatası tespit edildi!\n", port_id, bit_errors);
-            }
-            if (lost_pkts > 0) {
-                printf("      Port %u: %lu kayıp paket tespit edildi!\n", port_id, lost_pkts);
-            }
-        }
-
-        // HW missed packets kontrolü
-        if (rte_eth_stats_get(port_id, &st) == 0 && st.imissed > 0) {
-            if (!has_warning) {
-                printf("\n  UYARILAR:\n");
-                has_warning = true;
-            }
-            printf("      Port %u: %lu paket donanım tarafından kaçırıldı (imissed)!\n", port_id, st.imissed);
-        }
-    }
-
-    printf("\n  Ctrl+C ile durdur\n");
-    fflush(stdout);
-}